@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <format>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/map/art_map.hpp"
+
+const auto sizes = std::vector{1000, 10000, 100000, 1000000};
+volatile int sink = 0;
+
+constexpr int tenants = 97;
+constexpr int scanned_tenants = 10;
+
+// URL-like paths, which share long prefixes such as "/api/v1/tenants/17/"
+std::vector<std::string> create_paths(const int& size) {
+  const auto resources = std::vector<std::string>{"users", "orders", "invoices", "products", "sessions"};
+  auto paths = std::vector<std::string>();
+  for (int index = 0; index < size; ++index) {
+    paths.push_back(std::format("/api/v1/tenants/{}/{}/{}", index % tenants, resources[index % resources.size()], index));
+  }
+  std::ranges::shuffle(paths, std::mt19937(42));
+  return paths;
+}
+
+void benchmark_lookup(const int& size) {
+  const auto paths = create_paths(size);
+  auto art = containers::associative::art_map<int>();
+  auto hashed = std::unordered_map<std::string, int>();
+  auto map = std::map<std::string, int>();
+  for (int index = 0; index < size; ++index) {
+    art.insert(paths[index], index);
+    hashed.emplace(paths[index], index);
+    map.emplace(paths[index], index);
+  }
+
+  containers::benchmark::print_benchmark([&art, &paths] {
+    for (const auto& path : paths) {
+      sink = sink + art.find_by_key(path).value_or(0);
+    }
+  }, "art_map", "find_by_key", size);
+
+  containers::benchmark::print_benchmark([&hashed, &paths] {
+    for (const auto& path : paths) {
+      sink = sink + hashed.find(path)->second;
+    }
+  }, "std::unordered_map", "find", size);
+
+  containers::benchmark::print_benchmark([&map, &paths] {
+    for (const auto& path : paths) {
+      sink = sink + map.find(path)->second;
+    }
+  }, "std::map", "find", size);
+}
+
+void benchmark_prefix_queries(const int& size) {
+  const auto paths = create_paths(size);
+  auto art = containers::associative::art_map<int>();
+  auto hashed = std::unordered_map<std::string, int>();
+  for (int index = 0; index < size; ++index) {
+    art.insert(paths[index], index);
+    hashed.emplace(paths[index], index);
+  }
+
+  // Routes are the tenant prefixes, requests go to paths below them
+  const auto requests = std::min(size, 1000);
+  containers::benchmark::print_benchmark([&art, &paths, &requests] {
+    for (int request = 0; request < requests; ++request) {
+      sink = sink + art.longest_prefix_match(paths[request] + "/details")->second;
+    }
+  }, "art_map", "longest_prefix_match of 1000 requests", size);
+
+  containers::benchmark::print_benchmark([&hashed, &paths, &requests] {
+    for (int request = 0; request < requests; ++request) {
+      // Without ordered keys every prefix of the request has to be looked up, longest first
+      const auto target = paths[request] + "/details";
+      for (auto length = target.size(); length > 0; --length) {
+        if (const auto found = hashed.find(target.substr(0, length)); found != hashed.end()) {
+          sink = sink + found->second;
+          break;
+        }
+      }
+    }
+  }, "std::unordered_map", "lookup of every prefix of 1000 requests", size);
+
+  containers::benchmark::print_benchmark([&art] {
+    for (int tenant = 0; tenant < scanned_tenants; ++tenant) {
+      for (auto iterator = art.prefix_scan(std::format("/api/v1/tenants/{}/users/", tenant)).begin(); iterator != art.end(); ++iterator) {
+        sink = sink + iterator.value();
+      }
+    }
+  }, "art_map", "prefix_scan of the users of 10 tenants", size);
+
+  containers::benchmark::print_benchmark([&hashed] {
+    for (int tenant = 0; tenant < scanned_tenants; ++tenant) {
+      const auto prefix = std::format("/api/v1/tenants/{}/users/", tenant);
+      for (const auto& [key, value] : hashed) {
+        if (key.starts_with(prefix)) {
+          sink = sink + value;
+        }
+      }
+    }
+  }, "std::unordered_map", "full scans for the users of 10 tenants", size);
+}
+
+int main() {
+  containers::benchmark::benchmark_with_different_sizes(benchmark_lookup, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_prefix_queries, sizes);
+}
\ No newline at end of file
@@ -0,0 +1,91 @@
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/set/bitmap_set.hpp"
+
+const auto sizes = std::vector{1000, 10000, 100000, 1000000};
+volatile std::uint32_t sink = 0;
+
+// The slots of a scheduler, the keys are the free ones among them
+constexpr std::uint32_t universe = 1 << 24;
+constexpr int number_queries = 100000;
+
+std::vector<std::uint32_t> random_keys(const int& size, const std::uint32_t& seed) {
+  auto generator = std::mt19937(seed);
+  auto key = std::uniform_int_distribution<std::uint32_t>(0, universe - 1);
+  auto keys = std::vector<std::uint32_t>(size);
+  std::ranges::generate(keys, [&] { return key(generator); });
+  return keys;
+}
+
+void benchmark_insert(const int& size) {
+  const auto keys = random_keys(size, 42);
+  containers::benchmark::print_benchmark([&keys] {
+    auto set = containers::associative::bitmap_set(universe);
+    for (const auto& key : keys) {
+      set.insert_safely(key);
+    }
+    sink = sink + static_cast<std::uint32_t>(set.size());
+  }, "bitmap_set", "insert into 2^24 slots, including allocation", size);
+
+  containers::benchmark::print_benchmark([&keys] {
+    auto set = std::set<std::uint32_t>();
+    for (const auto& key : keys) {
+      set.insert(key);
+    }
+    sink = sink + static_cast<std::uint32_t>(set.size());
+  }, "std::set", "insert into 2^24 slots", size);
+}
+
+void benchmark_next_free_slot(const int& size) {
+  const auto keys = random_keys(size, 42);
+  const auto ticks = random_keys(number_queries, 7);
+  auto bitmap = containers::associative::bitmap_set(universe);
+  auto set = std::set<std::uint32_t>();
+  for (const auto& key : keys) {
+    bitmap.insert_safely(key);
+    set.insert(key);
+  }
+
+  containers::benchmark::print_benchmark([&bitmap, &ticks] {
+    for (const auto& tick : ticks) {
+      sink = sink + bitmap.lower_bound(tick).value_or(0);
+    }
+  }, "bitmap_set", "lower_bound of 100000 ticks", size);
+
+  containers::benchmark::print_benchmark([&set, &ticks] {
+    for (const auto& tick : ticks) {
+      const auto next = set.lower_bound(tick);
+      sink = sink + (next != set.end() ? *next : 0);
+    }
+  }, "std::set", "lower_bound of 100000 ticks", size);
+
+  // Takes the next free slot after every tick and frees it again at a later tick, as a scheduler does
+  containers::benchmark::print_benchmark([&bitmap, &ticks] {
+    for (const auto& tick : ticks) {
+      if (const auto slot = bitmap.lower_bound(tick)) {
+        bitmap.remove(*slot);
+        bitmap.insert_safely((*slot + tick) % universe);
+      }
+    }
+  }, "bitmap_set", "take and free a slot for 100000 ticks", size);
+
+  containers::benchmark::print_benchmark([&set, &ticks] {
+    for (const auto& tick : ticks) {
+      if (const auto slot = set.lower_bound(tick); slot != set.end()) {
+        const auto taken = *slot;
+        set.erase(slot);
+        set.insert((taken + tick) % universe);
+      }
+    }
+  }, "std::set", "take and free a slot for 100000 ticks", size);
+}
+
+int main() {
+  containers::benchmark::benchmark_with_different_sizes(benchmark_insert, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_next_free_slot, sizes);
+}
\ No newline at end of file
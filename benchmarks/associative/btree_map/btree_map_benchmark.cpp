@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/map/btree_map.hpp"
+
+const auto sizes = std::vector{1000, 10000, 100000, 1000000};
+volatile int sink = 0;
+
+// Range scans read 100 consecutive keys each
+constexpr int scan_length = 100;
+
+std::vector<int> shuffled_keys(const int& size) {
+  auto keys = std::vector<int>(size);
+  for (int key = 0; key < size; ++key) {
+    keys[key] = 2 * key;
+  }
+  std::ranges::shuffle(keys, std::mt19937(42));
+  return keys;
+}
+
+void benchmark_insert(const int& size) {
+  const auto keys = shuffled_keys(size);
+  containers::benchmark::print_benchmark([&keys] {
+    auto map = containers::associative::btree_map<int, int>();
+    for (const auto& key : keys) {
+      map.insert(key, key);
+    }
+    sink = sink + static_cast<int>(map.size());
+  }, "btree_map", "insert in random order", size);
+
+  containers::benchmark::print_benchmark([&keys] {
+    auto map = std::map<int, int>();
+    for (const auto& key : keys) {
+      map.emplace(key, key);
+    }
+    sink = sink + static_cast<int>(map.size());
+  }, "std::map", "insert in random order", size);
+
+  auto pairs = std::vector<std::pair<int, int>>();
+  for (int key = 0; key < size; ++key) {
+    pairs.emplace_back(2 * key, key);
+  }
+  containers::benchmark::print_benchmark([&pairs] {
+    auto map = containers::associative::btree_map<int, int>();
+    map.build_from_sorted(pairs);
+    sink = sink + static_cast<int>(map.size());
+  }, "btree_map", "build_from_sorted", size);
+}
+
+void benchmark_lookup(const int& size) {
+  const auto keys = shuffled_keys(size);
+  auto btree = containers::associative::btree_map<int, int>();
+  auto map = std::map<int, int>();
+  for (const auto& key : keys) {
+    btree.insert(key, key);
+    map.emplace(key, key);
+  }
+
+  // Half of the lookups miss, the odd keys fall between the stored ones
+  containers::benchmark::print_benchmark([&btree, &keys] {
+    for (const auto& key : keys) {
+      sink = sink + btree.find_by_key(key).value_or(0) + btree.find_by_key(key + 1).value_or(0);
+    }
+  }, "btree_map", "find_by_key, half of the keys missing", size);
+
+  containers::benchmark::print_benchmark([&map, &keys] {
+    for (const auto& key : keys) {
+      const auto hit = map.find(key);
+      const auto miss = map.find(key + 1);
+      sink = sink + (hit != map.end() ? hit->second : 0) + (miss != map.end() ? miss->second : 0);
+    }
+  }, "std::map", "find, half of the keys missing", size);
+}
+
+void benchmark_range_scan(const int& size) {
+  const auto keys = shuffled_keys(size);
+  auto btree = containers::associative::btree_map<int, int>();
+  auto map = std::map<int, int>();
+  for (const auto& key : keys) {
+    btree.insert(key, key);
+    map.emplace(key, key);
+  }
+
+  const auto scans = std::max(1, size / scan_length);
+  containers::benchmark::print_benchmark([&btree, &keys, &scans] {
+    for (int scan = 0; scan < scans; ++scan) {
+      const auto first = keys[scan];
+      for (auto iterator = btree.lower_bound(first); iterator != btree.end() && iterator.key() < first + 2 * scan_length; ++iterator) {
+        sink = sink + iterator.value();
+      }
+    }
+  }, "btree_map", "range scans of 100 keys", size);
+
+  containers::benchmark::print_benchmark([&map, &keys, &scans] {
+    for (int scan = 0; scan < scans; ++scan) {
+      const auto first = keys[scan];
+      for (auto iterator = map.lower_bound(first); iterator != map.end() && iterator->first < first + 2 * scan_length; ++iterator) {
+        sink = sink + iterator->second;
+      }
+    }
+  }, "std::map", "range scans of 100 keys", size);
+}
+
+int main() {
+  containers::benchmark::benchmark_with_different_sizes(benchmark_insert, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_lookup, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_range_scan, sizes);
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <format>
+#include <random>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/set/btree_multi_set.hpp"
+
+const auto window_sizes = std::vector{1000, 10000, 100000, 1000000};
+volatile int sink = 0;
+
+// One p50, p99 and p99.9 query after every this many new samples
+constexpr int samples_per_query = 100;
+constexpr int queries = 100;
+
+// Latencies in microseconds, log-normally distributed like request latencies
+std::vector<int> create_latencies(const int& count) {
+  auto generator = std::mt19937(42);
+  auto distribution = std::lognormal_distribution<double>(6, 1);
+  auto latencies = std::vector<int>(count);
+  std::ranges::generate(latencies, [&] { return static_cast<int>(distribution(generator)); });
+  return latencies;
+}
+
+void benchmark_rolling_percentiles(const int& window_size) {
+  const auto latencies = create_latencies(window_size + queries * samples_per_query);
+
+  containers::benchmark::print_benchmark([&latencies, &window_size] {
+    auto window = containers::associative::btree_multi_set<int>();
+    auto order = std::deque<int>();
+    for (int index = 0; index < window_size; ++index) {
+      window.insert(latencies[index]);
+      order.push_back(latencies[index]);
+    }
+    for (int query = 0; query < queries; ++query) {
+      for (int sample = 0; sample < samples_per_query; ++sample) {
+        window.remove_one(order.front());
+        order.pop_front();
+        const auto latency = latencies[window_size + query * samples_per_query + sample];
+        window.insert(latency);
+        order.push_back(latency);
+      }
+      sink = sink + window.percentile(50) + window.percentile(99) + window.percentile(99.9);
+    }
+  }, "btree_multi_set", std::format("{} rolling percentile queries", queries), window_size);
+
+  // The previous approach: every query sorts a copy of the window
+  containers::benchmark::print_benchmark([&latencies, &window_size] {
+    auto order = std::deque<int>(latencies.begin(), latencies.begin() + window_size);
+    for (int query = 0; query < queries; ++query) {
+      for (int sample = 0; sample < samples_per_query; ++sample) {
+        order.pop_front();
+        order.push_back(latencies[window_size + query * samples_per_query + sample]);
+      }
+      auto sorted = std::vector<int>(order.begin(), order.end());
+      std::ranges::sort(sorted);
+      const auto at = [&sorted](const double& percent) {
+        const auto rank = static_cast<size_t>(std::ceil(percent / 100 * static_cast<double>(sorted.size())));
+        return sorted[std::max<size_t>(rank, 1) - 1];
+      };
+      sink = sink + at(50) + at(99) + at(99.9);
+    }
+  }, "sorted copy", std::format("{} rolling percentile queries", queries), window_size);
+}
+
+int main() {
+  containers::benchmark::benchmark_with_different_sizes(benchmark_rolling_percentiles, window_sizes);
+}
\ No newline at end of file
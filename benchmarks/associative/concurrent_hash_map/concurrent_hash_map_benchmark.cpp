@@ -0,0 +1,95 @@
+#include <iostream>
+#include <format>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/map/hash_map.hpp"
+#include "associative/concurrent/concurrent_hash_map.hpp"
+
+constexpr auto hash_function = std::hash<int>();
+constexpr auto key_space = 1000;
+constexpr auto operations_per_thread = 20000;
+const auto read_ratios = std::vector{0.5, 0.9, 0.99};
+
+// Powers of two up to all available cores, including the core count itself
+std::vector<int> create_thread_counts() {
+  const auto cores = static_cast<int>(std::max(std::thread::hardware_concurrency(), 1U));
+  auto thread_counts = std::vector<int>();
+  for (int threads = 1; threads < cores; threads *= 2) {
+    thread_counts.push_back(threads);
+  }
+  thread_counts.push_back(cores);
+  return thread_counts;
+}
+
+// Runs a mixed workload: every operation is a lookup with the given probability, an upsert or remove otherwise
+template<typename Find, typename Upsert, typename Remove>
+void run_workload(const int& threads, const double& read_ratio, Find find, Upsert upsert, Remove remove) {
+  auto workers = std::vector<std::thread>();
+  for (int thread = 0; thread < threads; ++thread) {
+    workers.emplace_back([&, thread] {
+      std::mt19937 rng(thread);
+      std::uniform_int_distribution<int> key(0, key_space - 1);
+      std::bernoulli_distribution read(read_ratio);
+      std::bernoulli_distribution write_is_upsert(0.5);
+      for (int operation = 0; operation < operations_per_thread; ++operation) {
+        if (read(rng)) {
+          find(key(rng));
+        } else if (write_is_upsert(rng)) {
+          upsert(key(rng), operation);
+        } else {
+          remove(key(rng));
+        }
+      }
+    });
+  }
+  std::ranges::for_each(workers, [](auto& worker) { worker.join(); });
+}
+
+void benchmark_concurrent_hash_map(const int& threads, const double& read_ratio) {
+  auto map = containers::associative::concurrent_hash_map<int, int>(hash_function, 64);
+  for (int key = 0; key < key_space; ++key) {
+    map.insert(key, key);
+  }
+
+  containers::benchmark::print_benchmark([&map, &threads, &read_ratio] {
+    run_workload(
+      threads,
+      read_ratio,
+      [&map](const int& key) { map.find_by_key(key); },
+      [&map](const int& key, const int& value) { map.upsert(key, value); },
+      [&map](const int& key) { map.remove(key); }
+    );
+  }, "concurrent_hash_map", std::format("{} threads, {} reads", threads, read_ratio), threads * operations_per_thread);
+}
+
+void benchmark_locked_hash_map(const int& threads, const double& read_ratio) {
+  auto map = containers::associative::hash_map<int, int>(hash_function);
+  std::mutex mutex;
+  for (int key = 0; key < key_space; ++key) {
+    map.insert(key, key);
+  }
+
+  containers::benchmark::print_benchmark([&map, &mutex, &threads, &read_ratio] {
+    run_workload(
+      threads,
+      read_ratio,
+      [&map, &mutex](const int& key) { std::scoped_lock lock(mutex); map.find_by_key(key); },
+      [&map, &mutex](const int& key, const int& value) { std::scoped_lock lock(mutex); map.upsert(key, value); },
+      [&map, &mutex](const int& key) { std::scoped_lock lock(mutex); map.remove(key); }
+    );
+  }, "locked_hash_map", std::format("{} threads, {} reads", threads, read_ratio), threads * operations_per_thread);
+}
+
+int main() {
+  for (const auto& read_ratio : read_ratios) {
+    for (const auto& threads : create_thread_counts()) {
+      benchmark_concurrent_hash_map(threads, read_ratio);
+      benchmark_locked_hash_map(threads, read_ratio);
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <iostream>
+#include <format>
+#include <mutex>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/concurrent/concurrent_skip_list_set.hpp"
+
+constexpr auto key_space = 100000;
+constexpr auto operations_per_thread = 20000;
+const auto read_ratios = std::vector{0.5, 0.9, 0.99};
+
+// Powers of two up to all available cores, including the core count itself
+std::vector<int> create_thread_counts() {
+  const auto cores = static_cast<int>(std::max(std::thread::hardware_concurrency(), 1U));
+  auto thread_counts = std::vector<int>();
+  for (int threads = 1; threads < cores; threads *= 2) {
+    thread_counts.push_back(threads);
+  }
+  thread_counts.push_back(cores);
+  return thread_counts;
+}
+
+// Runs a mixed workload: every operation is a lookup with the given probability, an insert or remove otherwise
+template<typename Exists, typename Insert, typename Remove>
+void run_workload(const int& threads, const double& read_ratio, Exists exists, Insert insert, Remove remove) {
+  auto workers = std::vector<std::thread>();
+  for (int thread = 0; thread < threads; ++thread) {
+    workers.emplace_back([&, thread] {
+      std::mt19937 rng(thread);
+      std::uniform_int_distribution<int> key(0, key_space - 1);
+      std::bernoulli_distribution read(read_ratio);
+      std::bernoulli_distribution write_is_insert(0.5);
+      for (int operation = 0; operation < operations_per_thread; ++operation) {
+        if (read(rng)) {
+          exists(key(rng));
+        } else if (write_is_insert(rng)) {
+          insert(key(rng));
+        } else {
+          remove(key(rng));
+        }
+      }
+    });
+  }
+  std::ranges::for_each(workers, [](auto& worker) { worker.join(); });
+}
+
+void benchmark_concurrent_skip_list_set(const int& threads, const double& read_ratio) {
+  auto set = containers::associative::concurrent_skip_list_set<int>();
+  for (int key = 0; key < key_space; key += 2) {
+    set.insert(key);
+  }
+
+  containers::benchmark::print_benchmark([&set, &threads, &read_ratio] {
+    run_workload(
+      threads,
+      read_ratio,
+      [&set](const int& key) { set.exists(key); },
+      [&set](const int& key) { set.insert_safely(key); },
+      [&set](const int& key) { set.remove(key); }
+    );
+  }, "concurrent_skip_list_set", std::format("{} threads, {} reads", threads, read_ratio), threads * operations_per_thread);
+}
+
+void benchmark_locked_set(const int& threads, const double& read_ratio) {
+  auto set = std::set<int>();
+  std::mutex mutex;
+  for (int key = 0; key < key_space; key += 2) {
+    set.insert(key);
+  }
+
+  containers::benchmark::print_benchmark([&set, &mutex, &threads, &read_ratio] {
+    run_workload(
+      threads,
+      read_ratio,
+      [&set, &mutex](const int& key) { std::scoped_lock lock(mutex); set.contains(key); },
+      [&set, &mutex](const int& key) { std::scoped_lock lock(mutex); set.insert(key); },
+      [&set, &mutex](const int& key) { std::scoped_lock lock(mutex); set.erase(key); }
+    );
+  }, "locked_std_set", std::format("{} threads, {} reads", threads, read_ratio), threads * operations_per_thread);
+}
+
+int main() {
+  for (const auto& read_ratio : read_ratios) {
+    for (const auto& threads : create_thread_counts()) {
+      benchmark_concurrent_skip_list_set(threads, read_ratio);
+      benchmark_locked_set(threads, read_ratio);
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include <filesystem>
+#include <format>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/map/hash_map.hpp"
+#include "associative/durable/durable_hash_map.hpp"
+
+using durable_hash_map_t = containers::associative::durable_hash_map<std::string, std::string>;
+
+constexpr auto hash_function = std::hash<std::string>();
+const auto sizes = std::vector{10, 100, 1000, 10000};
+const auto directory = std::filesystem::temp_directory_path() / "durable_hash_map_benchmark";
+
+// Durability is paid per operation, so report the throughput next to the total time
+void print_throughput(const std::function<void()>& action, const std::string& action_name, const int& size) {
+  const auto duration = containers::benchmark::benchmark_action(action);
+  const int microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+  std::cout << std::format(
+    "[durable_hash_map] {} took {:d} ({:e}) microseconds for size {:d}, {:.0f} ops/s.",
+    action_name,
+    microseconds,
+    static_cast<double>(microseconds),
+    size,
+    size / duration.count()
+  ) << std::endl;
+}
+
+void benchmark_in_memory(const int& size) {
+  auto map = containers::associative::hash_map<std::string, std::string>(hash_function);
+  print_throughput([&map, &size] {
+    for (int i = 0; i < size; ++i) {
+      map.upsert(std::to_string(i), "value" + std::to_string(i));
+    }
+  }, "upsert without log (hash_map)", size);
+}
+
+void benchmark_upsert(const containers::associative::durability_level& level, const std::string& level_name, const int& size) {
+  std::filesystem::remove_all(directory);
+  auto options = containers::associative::durability_options{};
+  options.level = level;
+  auto map = durable_hash_map_t(hash_function, directory, options);
+  print_throughput([&map, &size] {
+    for (int i = 0; i < size; ++i) {
+      map.upsert(std::to_string(i), "value" + std::to_string(i));
+    }
+    map.sync();
+  }, "upsert with " + level_name, size);
+}
+
+void benchmark_recover(const bool& checkpointed, const int& size) {
+  std::filesystem::remove_all(directory);
+  {
+    auto options = containers::associative::durability_options{};
+    options.level = containers::associative::durability_level::none;
+    auto map = durable_hash_map_t(hash_function, directory, options);
+    for (int i = 0; i < size; ++i) {
+      map.upsert(std::to_string(i % 100), "value" + std::to_string(i));
+    }
+    if (checkpointed) {
+      map.checkpoint();
+    }
+  }
+  print_throughput([] {
+    const auto map = durable_hash_map_t(hash_function, directory);
+  }, checkpointed ? "recover from checkpoint" : "recover from log", size);
+}
+
+int main() {
+  containers::benchmark::benchmark_with_different_sizes(benchmark_in_memory, sizes);
+  containers::benchmark::benchmark_with_different_sizes([](const int& size) {
+    benchmark_upsert(containers::associative::durability_level::none, "durability_level::none", size);
+  }, sizes);
+  containers::benchmark::benchmark_with_different_sizes([](const int& size) {
+    benchmark_upsert(containers::associative::durability_level::group_commit, "durability_level::group_commit", size);
+  }, sizes);
+  containers::benchmark::benchmark_with_different_sizes([](const int& size) {
+    benchmark_upsert(containers::associative::durability_level::every_operation, "durability_level::every_operation", size);
+  }, sizes);
+  containers::benchmark::benchmark_with_different_sizes([](const int& size) {
+    benchmark_recover(false, size);
+  }, sizes);
+  containers::benchmark::benchmark_with_different_sizes([](const int& size) {
+    benchmark_recover(true, size);
+  }, sizes);
+  std::filesystem::remove_all(directory);
+}
\ No newline at end of file
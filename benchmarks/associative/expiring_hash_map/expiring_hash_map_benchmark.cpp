@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/map/hash_map.hpp"
+#include "associative/map/expiring_hash_map.hpp"
+
+using namespace std::chrono_literals;
+
+using time_point_t = std::chrono::steady_clock::time_point;
+
+constexpr auto hash_function = std::hash<int>();
+const auto sizes = std::vector{10, 100, 1000, 10000};
+constexpr auto ttl = 1s;
+constexpr auto long_ttl = 1h;
+constexpr int hot_sessions = 100;
+constexpr auto step = 10ms;
+
+// Besides `size` idle sessions living for an hour, a few short-lived sessions are written
+// round-robin, each expiring before it is written again
+int create_session(const int& operation, const int& size) {
+  return size + (operation * 7) % (3 * hot_sessions / 2);
+}
+
+// The longest single operation is the stall a request served by the same thread sees
+void print_operations(const std::function<void(const int&)>& operation, const std::string& name, const std::string& action_name, const int& size) {
+  auto total = std::chrono::duration<double>::zero();
+  auto longest = std::chrono::duration<double>::zero();
+  for (int index = 0; index < 2000; ++index) {
+    const auto duration = containers::benchmark::benchmark_action([&operation, &index] {
+      operation(index);
+    });
+    total += duration;
+    longest = std::max(longest, duration);
+  }
+  std::cout << std::format(
+    "[{}] {} took {} microseconds, the longest operation {} microseconds for size {}.",
+    name,
+    action_name,
+    std::chrono::duration_cast<std::chrono::microseconds>(total).count(),
+    std::chrono::duration_cast<std::chrono::microseconds>(longest).count(),
+    size
+  ) << std::endl;
+}
+
+void benchmark_upsert_with_sweep(const int& size) {
+  auto map = containers::associative::hash_map<int, std::pair<int, time_point_t>>(hash_function);
+  auto time = time_point_t();
+  for (int session = 0; session < size; ++session) {
+    map.insert(session, std::make_pair(session, time + long_ttl));
+  }
+  print_operations([&map, &time, &size](const int& operation) {
+    time += step;
+    map.upsert(create_session(operation, size), std::make_pair(operation, time + ttl));
+    // Sweep the whole table every tenth of the short time to live
+    if (operation % 10 == 0) {
+      auto expired = std::vector<int>();
+      map.parallel_for_each([&expired, &time](const int& key, const std::pair<int, time_point_t>& entry) {
+        if (entry.second <= time) {
+          expired.push_back(key);
+        }
+      }, 1);
+      for (const auto& key : expired) {
+        map.remove(key);
+      }
+    }
+  }, "hash_map", "upsert with periodic full sweep", size);
+}
+
+void benchmark_upsert_with_timing_wheel(const int& size) {
+  auto time = time_point_t();
+  auto map = containers::associative::expiring_hash_map<int, int>(hash_function, ttl, 1ms, [&time] {
+    return time;
+  });
+  for (int session = 0; session < size; ++session) {
+    map.insert(session, session, long_ttl);
+  }
+  print_operations([&map, &time, &size](const int& operation) {
+    time += step;
+    map.upsert(create_session(operation, size), operation);
+  }, "expiring_hash_map", "upsert with timing wheel expiry", size);
+}
+
+int main() {
+  containers::benchmark::benchmark_with_different_sizes(benchmark_upsert_with_sweep, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_upsert_with_timing_wheel, sizes);
+}
\ No newline at end of file
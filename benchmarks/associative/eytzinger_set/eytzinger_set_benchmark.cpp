@@ -0,0 +1,50 @@
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/set/eytzinger_set.hpp"
+#include "associative/set/flat_ordered_set.hpp"
+
+const auto sizes = std::vector{1000, 10000, 100000, 1000000, 10000000};
+volatile int sink = 0;
+
+constexpr int number_queries = 1000000;
+
+void benchmark_lower_bound(const int& size) {
+  auto keys = std::vector<int>(size);
+  for (int key = 0; key < size; ++key) {
+    keys[key] = 2 * key;
+  }
+  auto generator = std::mt19937(42);
+  auto query = std::uniform_int_distribution<int>(0, 2 * size);
+  auto queries = std::vector<int>(number_queries);
+  std::ranges::generate(queries, [&] { return query(generator); });
+
+  const auto flat = containers::associative::flat_ordered_set<int>(keys);
+  const auto frozen = flat.freeze();
+
+  containers::benchmark::print_benchmark([&frozen, &queries] {
+    for (const auto& key : queries) {
+      sink = sink + frozen.lower_bound(key).value_or(0);
+    }
+  }, "eytzinger_set", "lower_bound of 10^6 random keys", size);
+
+  containers::benchmark::print_benchmark([&flat, &queries] {
+    for (const auto& key : queries) {
+      const auto next = flat.lower_bound(key);
+      sink = sink + (next != flat.end() ? *next : 0);
+    }
+  }, "flat_ordered_set", "lower_bound of 10^6 random keys", size);
+
+  containers::benchmark::print_benchmark([&keys, &queries] {
+    for (const auto& key : queries) {
+      const auto next = std::ranges::lower_bound(keys, key);
+      sink = sink + (next != keys.end() ? *next : 0);
+    }
+  }, "std::lower_bound", "sorted std::vector, 10^6 random keys", size);
+}
+
+int main() {
+  containers::benchmark::benchmark_with_different_sizes(benchmark_lower_bound, sizes);
+}
\ No newline at end of file
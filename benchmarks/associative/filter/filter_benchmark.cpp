@@ -0,0 +1,84 @@
+#include <iostream>
+#include <format>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/filter/bloom_filter.hpp"
+#include "associative/filter/cuckoo_filter.hpp"
+#include "associative/set/hash_multi_set.hpp"
+
+constexpr auto hash_function = std::hash<std::string>();
+constexpr auto number_keys = 100000;
+constexpr auto number_probes = 100000;
+const auto bits_per_key = std::vector{4, 6, 8, 10, 12, 16, 20};
+const auto sizes = std::vector{100, 1000, 10000};
+
+// Probes are disjoint from the inserted keys, so every positive answer is a false positive
+template<typename Filter>
+double measure_false_positive_rate(const Filter& filter) {
+  int false_positives = 0;
+  for (int index = 0; index < number_probes; ++index) {
+    false_positives += filter.might_contain("missing" + std::to_string(index));
+  }
+  return static_cast<double>(false_positives) / number_probes;
+}
+
+void print_false_positive_rate(const std::string& name, const double& bits, const double& rate) {
+  std::cout << std::format(
+    "[{}] {:.2f} bits per key result in a false-positive rate of {:e}.",
+    name,
+    bits,
+    rate
+  ) << std::endl;
+}
+
+void benchmark_bloom_filter_false_positive_rate() {
+  for (const auto& bits : bits_per_key) {
+    auto filter = containers::associative::bloom_filter<std::string>(hash_function, number_keys, bits);
+    for (int index = 0; index < number_keys; ++index) {
+      filter.insert(std::to_string(index));
+    }
+    const auto actual_bits = static_cast<double>(filter.memory_usage() * 8) / number_keys;
+    print_false_positive_rate("bloom_filter", actual_bits, measure_false_positive_rate(filter));
+  }
+}
+
+void benchmark_cuckoo_filter_false_positive_rate() {
+  // The fingerprint size is fixed, so the bits per key only depend on the load of the table
+  for (const auto& load : {0.5, 0.7, 0.9}) {
+    auto filter = containers::associative::cuckoo_filter<std::string>(hash_function, number_keys);
+    const auto keys = static_cast<int>(load * static_cast<double>(filter.memory_usage() / sizeof(std::uint16_t)));
+    for (int index = 0; index < keys; ++index) {
+      filter.insert(std::to_string(index));
+    }
+    const auto actual_bits = static_cast<double>(filter.memory_usage() * 8) / keys;
+    print_false_positive_rate("cuckoo_filter", actual_bits, measure_false_positive_rate(filter));
+  }
+}
+
+void benchmark_hash_multi_set_exists_misses(const int& size, const bool& filtered) {
+  auto hash_multi_set = containers::associative::hash_multi_set<std::string>(hash_function, size);
+  for (int index = 0; index < size; ++index) {
+    hash_multi_set.insert(std::to_string(index));
+  }
+  if (filtered) {
+    hash_multi_set.enable_filter();
+  }
+
+  containers::benchmark::print_benchmark([&hash_multi_set, &size] {
+    for (int index = 0; index < size; ++index) {
+      hash_multi_set.exists("missing" + std::to_string(index));
+    }
+  }, filtered ? "filtered_hash_multiset" : "hash_multiset", "hash multiset exists (misses)", size);
+}
+
+int main() {
+  benchmark_bloom_filter_false_positive_rate();
+  benchmark_cuckoo_filter_false_positive_rate();
+
+  containers::benchmark::benchmark_with_different_sizes([](const int& size) {
+    benchmark_hash_multi_set_exists_misses(size, false);
+    benchmark_hash_multi_set_exists_misses(size, true);
+  }, sizes);
+}
\ No newline at end of file
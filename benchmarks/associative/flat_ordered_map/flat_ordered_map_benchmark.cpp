@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <map>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/map/btree_map.hpp"
+#include "associative/map/flat_ordered_map.hpp"
+
+const auto sizes = std::vector{1000, 10000, 100000, 1000000};
+volatile int sink = 0;
+
+// Batches of this many pairs are merged into the map at once
+constexpr int batch_size = 1000;
+
+std::vector<std::pair<int, int>> shuffled_pairs(const int& size) {
+  auto pairs = std::vector<std::pair<int, int>>();
+  for (int key = 0; key < size; ++key) {
+    pairs.emplace_back(2 * key, key);
+  }
+  std::ranges::shuffle(pairs, std::mt19937(42));
+  return pairs;
+}
+
+void benchmark_construction(const int& size) {
+  const auto pairs = shuffled_pairs(size);
+  containers::benchmark::print_benchmark([&pairs] {
+    const auto map = containers::associative::flat_ordered_map<int, int>(pairs);
+    sink = sink + static_cast<int>(map.size());
+  }, "flat_ordered_map", "construct from unsorted pairs", size);
+
+  containers::benchmark::print_benchmark([&pairs] {
+    auto map = std::map<int, int>();
+    for (const auto& [key, value] : pairs) {
+      map.emplace(key, value);
+    }
+    sink = sink + static_cast<int>(map.size());
+  }, "std::map", "insert unsorted pairs", size);
+
+  // Repeated single insertions shift the arrays every time, so they are only measured for small sizes
+  if (size <= 100000) {
+    containers::benchmark::print_benchmark([&pairs] {
+      auto map = containers::associative::flat_ordered_map<int, int>();
+      for (auto batch = pairs.begin(); batch != pairs.end(); batch += batch_size) {
+        map.insert_batch(std::ranges::subrange(batch, batch + std::min<long>(batch_size, pairs.end() - batch)));
+      }
+      sink = sink + static_cast<int>(map.size());
+    }, "flat_ordered_map", "insert_batch of 1000 pairs each", size);
+
+    containers::benchmark::print_benchmark([&pairs] {
+      auto map = containers::associative::flat_ordered_map<int, int>();
+      for (const auto& [key, value] : pairs) {
+        map.insert(key, value);
+      }
+      sink = sink + static_cast<int>(map.size());
+    }, "flat_ordered_map", "insert one at a time", size);
+  }
+}
+
+void benchmark_lookup(const int& size) {
+  const auto pairs = shuffled_pairs(size);
+  const auto flat = containers::associative::flat_ordered_map<int, int>(pairs);
+  auto btree = containers::associative::btree_map<int, int>();
+  auto map = std::map<int, int>();
+  for (const auto& [key, value] : pairs) {
+    btree.insert(key, value);
+    map.emplace(key, value);
+  }
+  auto sorted_keys = std::vector<int>(flat.keys().begin(), flat.keys().end());
+
+  // Half of the lookups miss, the odd keys fall between the stored ones
+  containers::benchmark::print_benchmark([&flat, &pairs] {
+    for (const auto& [key, value] : pairs) {
+      sink = sink + flat.find_by_key(key).value_or(0) + flat.find_by_key(key + 1).value_or(0);
+    }
+  }, "flat_ordered_map", "find_by_key, half of the keys missing", size);
+
+  containers::benchmark::print_benchmark([&sorted_keys, &pairs] {
+    for (const auto& [key, value] : pairs) {
+      const auto hit = std::ranges::lower_bound(sorted_keys, key);
+      const auto miss = std::ranges::lower_bound(sorted_keys, key + 1);
+      sink = sink + (*hit == key) + (miss != sorted_keys.end() && *miss == key + 1);
+    }
+  }, "std::lower_bound", "sorted std::vector, half of the keys missing", size);
+
+  containers::benchmark::print_benchmark([&btree, &pairs] {
+    for (const auto& [key, value] : pairs) {
+      sink = sink + btree.find_by_key(key).value_or(0) + btree.find_by_key(key + 1).value_or(0);
+    }
+  }, "btree_map", "find_by_key, half of the keys missing", size);
+
+  containers::benchmark::print_benchmark([&map, &pairs] {
+    for (const auto& [key, value] : pairs) {
+      const auto hit = map.find(key);
+      const auto miss = map.find(key + 1);
+      sink = sink + (hit != map.end() ? hit->second : 0) + (miss != map.end() ? miss->second : 0);
+    }
+  }, "std::map", "find, half of the keys missing", size);
+}
+
+int main() {
+  containers::benchmark::benchmark_with_different_sizes(benchmark_construction, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_lookup, sizes);
+}
\ No newline at end of file
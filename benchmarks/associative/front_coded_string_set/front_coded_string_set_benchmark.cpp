@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <format>
+#include <iostream>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/set/front_coded_string_set.hpp"
+
+const auto sizes = std::vector{1000, 10000, 100000, 1000000};
+volatile size_t sink = 0;
+
+constexpr int number_queries = 100000;
+
+// URL-like strings, sorted neighbours share most of their prefix as in a real vocabulary
+std::vector<std::string> vocabulary(const int& size) {
+  auto keys = std::vector<std::string>();
+  for (int key = 0; key < size; ++key) {
+    keys.push_back(std::format("https://example.com/users/{:08}/photos/{}", key / 4 * 7919 % 100000000, key % 4));
+  }
+  std::ranges::shuffle(keys, std::mt19937(42));
+  return keys;
+}
+
+void benchmark_memory(const int& size) {
+  const auto keys = vocabulary(size);
+  const auto set = containers::associative::front_coded_string_set(keys);
+  auto node_based = std::set<std::string>(keys.begin(), keys.end());
+
+  // A node holds the tree links and the std::string, longer strings another heap allocation
+  auto node_bytes = size_t{0};
+  for (const auto& key : node_based) {
+    node_bytes += 32 + sizeof(std::string) + (key.capacity() > 15 ? key.capacity() + 1 : 0);
+  }
+  std::cout << std::format(
+    "[front_coded_string_set] {} bytes, {:.1f} per string, {:.1f}x smaller than the {} bytes of std::set<std::string> for size {}.",
+    set.size_in_bytes(),
+    static_cast<double>(set.size_in_bytes()) / static_cast<double>(set.size()),
+    static_cast<double>(node_bytes) / static_cast<double>(set.size_in_bytes()),
+    node_bytes,
+    size
+  ) << std::endl;
+}
+
+void benchmark_lookup(const int& size) {
+  const auto keys = vocabulary(size);
+  const auto set = containers::associative::front_coded_string_set(keys);
+  const auto node_based = std::set<std::string>(keys.begin(), keys.end());
+
+  // Half of the lookups miss, their last character is changed
+  auto generator = std::mt19937(7);
+  auto queries = std::vector<std::string>(number_queries);
+  for (auto& query : queries) {
+    query = keys[generator() % keys.size()];
+    if (generator() % 2 == 0) {
+      query.back() = 'x';
+    }
+  }
+
+  containers::benchmark::print_benchmark([&set, &queries] {
+    for (const auto& query : queries) {
+      sink = sink + set.exists(query);
+    }
+  }, "front_coded_string_set", "exists of 100000 strings, half missing", size);
+
+  containers::benchmark::print_benchmark([&node_based, &queries] {
+    for (const auto& query : queries) {
+      sink = sink + node_based.contains(query);
+    }
+  }, "std::set", "contains of 100000 strings, half missing", size);
+
+  containers::benchmark::print_benchmark([&set] {
+    for (const auto& key : set) {
+      sink = sink + key.size();
+    }
+  }, "front_coded_string_set", "iterate all strings", size);
+
+  containers::benchmark::print_benchmark([&node_based] {
+    for (const auto& key : node_based) {
+      sink = sink + key.size();
+    }
+  }, "std::set", "iterate all strings", size);
+}
+
+int main() {
+  containers::benchmark::benchmark_with_different_sizes(benchmark_memory, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_lookup, sizes);
+}
\ No newline at end of file
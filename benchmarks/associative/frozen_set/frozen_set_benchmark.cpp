@@ -0,0 +1,57 @@
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/set/hash_set.hpp"
+#include "associative/set/frozen_set.hpp"
+
+const auto sizes = std::vector{1, 10, 100, 1000, 10000};
+// Keeps the compiler from dropping lookups whose result is unused
+volatile size_t found_keys = 0;
+
+std::vector<std::string> create_keys(const int& size) {
+  auto keys = std::vector<std::string>();
+  for (int i = 0; i < size; ++i) {
+    keys.push_back("key" + std::to_string(i));
+  }
+  return keys;
+}
+
+void benchmark_build(const int& size) {
+  const auto keys = create_keys(size);
+  containers::benchmark::print_benchmark([&keys] {
+    const auto set = containers::associative::frozen_set<std::string>(keys);
+  }, "frozen_set", "build", size);
+}
+
+// Half of the lookups miss, as for a keyword table queried with every identifier
+void benchmark_hash_set_exists(const int& size) {
+  auto set = containers::associative::hash_set<std::string>(std::hash<std::string>());
+  set.build_parallel(create_keys(size));
+  const auto queries = create_keys(size * 2);
+  containers::benchmark::print_benchmark([&set, &queries] {
+    size_t found = 0;
+    for (const auto& query : queries) {
+      found += set.exists(query);
+    }
+    found_keys = found;
+  }, "hash_set", "exists", size);
+}
+
+void benchmark_frozen_set_exists(const int& size) {
+  const auto set = containers::associative::frozen_set<std::string>(create_keys(size));
+  const auto queries = create_keys(size * 2);
+  containers::benchmark::print_benchmark([&set, &queries] {
+    size_t found = 0;
+    for (const auto& query : queries) {
+      found += set.exists(query);
+    }
+    found_keys = found;
+  }, "frozen_set", "exists", size);
+}
+
+int main() {
+  containers::benchmark::benchmark_with_different_sizes(benchmark_build, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_hash_set_exists, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_frozen_set_exists, sizes);
+}
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include <unordered_map>
+#include <iostream>
+#include <format>
+#include <random>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/join/hash_join.hpp"
+
+constexpr auto hash_function = std::hash<int>();
+// Every build key has this many rows, so inner joins fan out
+constexpr auto rows_per_key = 4;
+const auto build_sizes = std::vector{100, 1000, 10000};
+const auto selectivities = std::vector{0.1, 0.5, 0.9};
+
+std::vector<std::pair<int, int>> create_build_rows(const int& size) {
+  auto rows = std::vector<std::pair<int, int>>();
+  rows.reserve(size);
+  for (int index = 0; index < size; ++index) {
+    rows.emplace_back(index / rows_per_key, index);
+  }
+  return rows;
+}
+
+// Creates probe keys of which the given fraction hits a build key
+std::vector<int> create_probe_keys(const int& size, const double& selectivity) {
+  const auto distinct_build_keys = std::max(size / rows_per_key, 1);
+  std::mt19937 rng(123);
+  std::bernoulli_distribution hit(selectivity);
+  std::uniform_int_distribution<int> build_key(0, distinct_build_keys - 1);
+
+  auto keys = std::vector<int>(size);
+  for (auto& key : keys) {
+    key = hit(rng) ? build_key(rng) : distinct_build_keys + build_key(rng);
+  }
+  return keys;
+}
+
+void benchmark_build(const int& size) {
+  const auto rows = create_build_rows(size);
+  containers::benchmark::print_benchmark([&rows, &size] {
+    auto join = containers::associative::hash_join<int, int>(hash_function);
+    join.build(rows, std::max(size / rows_per_key, 1));
+  }, "hash_join", "build", size);
+  containers::benchmark::print_benchmark([&rows, &size] {
+    auto table = std::unordered_multimap<int, int>(size, hash_function);
+    for (const auto& [key, value] : rows) {
+      table.emplace(key, value);
+    }
+  }, "unordered_multimap", "build", size);
+}
+
+void benchmark_probe(const int& size, const double& selectivity, const containers::associative::join_mode& mode) {
+  const auto rows = create_build_rows(size);
+  const auto keys = create_probe_keys(size, selectivity);
+  const auto mode_name = mode == containers::associative::join_mode::inner ? "inner"
+    : mode == containers::associative::join_mode::semi ? "semi" : "anti";
+
+  auto join = containers::associative::hash_join<int, int>(hash_function, mode);
+  join.build(rows, std::max(size / rows_per_key, 1));
+  containers::benchmark::print_benchmark([&join, &keys] {
+    containers::associative::join_result<int> result;
+    join.probe(keys, result);
+  }, "hash_join", std::format("{} probe (selectivity {})", mode_name, selectivity), size);
+
+  auto table = std::unordered_multimap<int, int>(size, hash_function);
+  for (const auto& [key, value] : rows) {
+    table.emplace(key, value);
+  }
+  containers::benchmark::print_benchmark([&table, &keys, &mode] {
+    containers::associative::join_result<int> result;
+    for (size_t index = 0; index < keys.size(); ++index) {
+      const auto [first, last] = table.equal_range(keys[index]);
+      if (mode == containers::associative::join_mode::anti) {
+        if (first == last) {
+          result.probe_indices.push_back(index);
+        }
+      } else if (mode == containers::associative::join_mode::semi) {
+        if (first != last) {
+          result.probe_indices.push_back(index);
+        }
+      } else {
+        for (auto it = first; it != last; ++it) {
+          result.probe_indices.push_back(index);
+          result.values.push_back(it->second);
+        }
+      }
+    }
+  }, "unordered_multimap", std::format("{} probe (selectivity {})", mode_name, selectivity), size);
+}
+
+int main() {
+  containers::benchmark::benchmark_with_different_sizes(benchmark_build, build_sizes);
+
+  for (const auto& mode : {
+    containers::associative::join_mode::inner,
+    containers::associative::join_mode::semi,
+    containers::associative::join_mode::anti
+  }) {
+    for (const auto& selectivity : selectivities) {
+      containers::benchmark::benchmark_with_different_sizes([&selectivity, &mode](const int& size) {
+        benchmark_probe(size, selectivity, mode);
+      }, build_sizes);
+    }
+  }
+}
\ No newline at end of file
@@ -117,10 +117,74 @@ void benchmark_remove() {
   std::cout << "Started threads for remove-benchmarks" << std::endl;
 }
 
+void benchmark_hash_map_build_sequential(const int& size) {
+  auto pairs = std::vector<std::pair<std::string, int>>();
+  for (int i = 0; i < size; ++i) {
+    pairs.emplace_back(std::to_string(i), i);
+  }
+  containers::benchmark::print_benchmark([&pairs] {
+    auto hash_map = containers::associative::hash_map<std::string, int>(hash_function);
+    for (const auto& [key, value] : pairs) {
+      hash_map.insert(key, value);
+    }
+  }, "hash_map", "hash map build with insert", size);
+}
+
+void benchmark_hash_map_build_parallel(const int& size) {
+  auto pairs = std::vector<std::pair<std::string, int>>();
+  for (int i = 0; i < size; ++i) {
+    pairs.emplace_back(std::to_string(i), i);
+  }
+  containers::benchmark::print_benchmark([&pairs] {
+    auto hash_map = containers::associative::hash_map<std::string, int>(hash_function);
+    hash_map.build_parallel(pairs);
+  }, "hash_map", "hash map build_parallel", size);
+}
+
+void benchmark_build() {
+  // Runs on a single thread, because build_parallel already uses all cores
+  std::thread build_thread([] {
+    containers::benchmark::benchmark_with_different_sizes(benchmark_hash_map_build_sequential, sizes);
+    containers::benchmark::benchmark_with_different_sizes(benchmark_hash_map_build_parallel, sizes);
+  });
+  joined_threads.push_back(std::move(build_thread));
+  std::cout << "Started threads for build-benchmarks" << std::endl;
+}
+
+void benchmark_hash_map_sum_with_iterator(const int& size) {
+  auto hash_map = create_hash_map(size);
+  containers::benchmark::print_benchmark([&hash_map] {
+    long sum = 0;
+    for (auto iterator = hash_map.begin(); iterator != hash_map.end(); ++iterator) {
+      sum += (*iterator).second;
+    }
+  }, "hash_map", "hash map sum with iterator", size);
+}
+
+void benchmark_hash_map_sum_with_parallel_reduce(const int& size) {
+  const auto hash_map = create_hash_map(size);
+  containers::benchmark::print_benchmark([&hash_map] {
+    static_cast<void>(hash_map.parallel_reduce(0L, [](const std::string&, const int& value) {
+      return static_cast<long>(value);
+    }, std::plus<>()));
+  }, "hash_map", "hash map sum with parallel_reduce", size);
+}
+
+void benchmark_scan() {
+  std::thread scan_thread([] {
+    containers::benchmark::benchmark_with_different_sizes(benchmark_hash_map_sum_with_iterator, sizes);
+    containers::benchmark::benchmark_with_different_sizes(benchmark_hash_map_sum_with_parallel_reduce, sizes);
+  });
+  joined_threads.push_back(std::move(scan_thread));
+  std::cout << "Started threads for scan-benchmarks" << std::endl;
+}
+
 int main() {
   benchmark_insert();
   benchmark_find();
   benchmark_remove();
+  benchmark_build();
+  benchmark_scan();
 
   std::cout << "Waiting for all threads to finish execution..." << std::endl;
   std::ranges::for_each(joined_threads, [](auto& thread) { thread.join(); });
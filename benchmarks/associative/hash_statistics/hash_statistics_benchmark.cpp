@@ -0,0 +1,59 @@
+#include <format>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/map/hash_map.hpp"
+
+const auto sizes = std::vector{10, 100, 1000, 10000};
+volatile int sink = 0;
+
+// Hashes most keys to one of 8 values, the kind of hasher stats() should expose
+containers::hash_t skewed_hash(const int& key) {
+  return key % 10 == 0 ? key : key % 8;
+}
+
+template<bool Statistics>
+void benchmark_find(const int& size) {
+  auto map = containers::associative::hash_map<int, int, Statistics>(std::hash<int>());
+  for (int key = 0; key < size; ++key) {
+    map.insert(key, key);
+  }
+  containers::benchmark::print_benchmark([&map, &size] {
+    for (int key = 0; key < 2 * size; ++key) {
+      const auto value = map.find_by_key(key);
+      sink = sink + (value.has_value() ? *value : 0);
+    }
+  }, Statistics ? "hash_map with statistics" : "hash_map", "find, half of the keys missing", size);
+}
+
+void print_skewed_stats(const int& size) {
+  auto map = containers::associative::hash_map<int, int, true>(skewed_hash);
+  for (int key = 0; key < size; ++key) {
+    map.insert(key, key);
+  }
+  for (int key = 0; key < 2 * size; ++key) {
+    sink = sink + map.find_by_key(key).value_or(0);
+  }
+
+  const auto stats = map.stats();
+  std::cout << std::format(
+    "[hash_map] skewed hash: {} buckets, max chain {}, {:.2f} empty, {:.1f} probes per hit, {:.1f} per miss, {} rehashes in {} microseconds, {:.0f} bytes per element for size {}.",
+    stats.bucket_count,
+    stats.max_chain_length,
+    stats.empty_bucket_ratio,
+    static_cast<double>(stats.hit_probe_count) / static_cast<double>(stats.hit_count),
+    static_cast<double>(stats.miss_probe_count) / static_cast<double>(stats.miss_count),
+    stats.rehash_count,
+    std::chrono::duration_cast<std::chrono::microseconds>(stats.rehash_time).count(),
+    stats.bytes_per_element,
+    size
+  ) << std::endl;
+}
+
+int main() {
+  containers::benchmark::benchmark_with_different_sizes(benchmark_find<false>, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_find<true>, sizes);
+  containers::benchmark::benchmark_with_different_sizes(print_skewed_stats, sizes);
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/cache/lru_cache.hpp"
+#include "associative/cache/sharded_lru_cache.hpp"
+
+constexpr auto hash_function = std::hash<int>();
+const auto sizes = std::vector{10, 100, 1000, 10000};
+constexpr int threads = 4;
+
+// Keys cycle over twice the capacity with a hot first half, so gets both hit and miss
+int create_key(const int& operation, const int& size) {
+  return operation % 4 == 0 ? operation % (2 * size) : operation % (size / 2 + 1);
+}
+
+void benchmark_get_or_put(const int& size) {
+  auto cache = containers::associative::lru_cache<int, int>(hash_function, size);
+  containers::benchmark::print_benchmark([&cache, &size] {
+    for (int operation = 0; operation < 10 * size; ++operation) {
+      const auto key = create_key(operation, size);
+      if (!cache.get(key).has_value()) {
+        cache.put(key, operation);
+      }
+    }
+  }, "lru_cache", "get or put", size);
+}
+
+void benchmark_locked_get_or_put(const int& size) {
+  auto cache = containers::associative::lru_cache<int, int>(hash_function, size);
+  auto mutex = std::mutex();
+  containers::benchmark::print_benchmark([&cache, &mutex, &size] {
+    auto workers = std::vector<std::thread>();
+    for (int thread = 0; thread < threads; ++thread) {
+      workers.emplace_back([&cache, &mutex, &size, thread] {
+        for (int operation = thread; operation < 10 * size; operation += threads) {
+          const auto key = create_key(operation, size);
+          const auto lock = std::lock_guard(mutex);
+          if (!cache.get(key).has_value()) {
+            cache.put(key, operation);
+          }
+        }
+      });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  }, "lru_cache", "get or put behind one mutex, 4 threads", size);
+}
+
+void benchmark_sharded_get_or_put(const int& size) {
+  auto cache = containers::associative::sharded_lru_cache<int, int>(hash_function, size, 16);
+  containers::benchmark::print_benchmark([&cache, &size] {
+    auto workers = std::vector<std::thread>();
+    for (int thread = 0; thread < threads; ++thread) {
+      workers.emplace_back([&cache, &size, thread] {
+        for (int operation = thread; operation < 10 * size; operation += threads) {
+          const auto key = create_key(operation, size);
+          if (!cache.get(key).has_value()) {
+            cache.put(key, operation);
+          }
+        }
+      });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+  }, "sharded_lru_cache", "get or put, 16 shards, 4 threads", size);
+}
+
+int main() {
+  containers::benchmark::benchmark_with_different_sizes(benchmark_get_or_put, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_locked_get_or_put, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_sharded_get_or_put, sizes);
+}
\ No newline at end of file
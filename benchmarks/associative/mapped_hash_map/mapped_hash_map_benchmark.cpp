@@ -0,0 +1,57 @@
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/map/hash_map.hpp"
+#include "associative/snapshot/mapped_hash_map.hpp"
+
+constexpr auto hash_function = std::hash<std::string>();
+const auto sizes = std::vector{1, 10, 100, 1000, 10000, 100000};
+const auto path = (std::filesystem::temp_directory_path() / "mapped_hash_map_benchmark.snapshot").string();
+
+std::vector<std::pair<std::string, std::string>> create_pairs(const int& size) {
+  auto pairs = std::vector<std::pair<std::string, std::string>>();
+  for (int i = 0; i < size; ++i) {
+    pairs.emplace_back(std::to_string(i), "value" + std::to_string(i));
+  }
+  return pairs;
+}
+
+// Loading reference data the way a restarting service does without snapshots
+void benchmark_rebuild(const int& size) {
+  const auto pairs = create_pairs(size);
+  containers::benchmark::print_benchmark([&pairs] {
+    auto hash_map = containers::associative::hash_map<std::string, std::string>(hash_function);
+    hash_map.build_parallel(pairs);
+  }, "hash_map", "rebuild with build_parallel", size);
+}
+
+void benchmark_open_snapshot(const int& size) {
+  auto hash_map = containers::associative::hash_map<std::string, std::string>(hash_function);
+  hash_map.build_parallel(create_pairs(size));
+  hash_map.save_snapshot(path);
+  containers::benchmark::print_benchmark([] {
+    const auto mapped = containers::associative::mapped_hash_map<std::string, std::string>::open(path, hash_function);
+    static_cast<void>(mapped.find_view("0"));
+  }, "mapped_hash_map", "open snapshot", size);
+}
+
+void benchmark_find(const int& size) {
+  auto hash_map = containers::associative::hash_map<std::string, std::string>(hash_function);
+  hash_map.build_parallel(create_pairs(size));
+  hash_map.save_snapshot(path);
+  const auto mapped = containers::associative::mapped_hash_map<std::string, std::string>::open(path, hash_function);
+  containers::benchmark::print_benchmark([&mapped, &size] {
+    for (int i = 0; i < size; ++i) {
+      static_cast<void>(mapped.find_view(std::to_string(i)));
+    }
+  }, "mapped_hash_map", "find_view", size);
+}
+
+int main() {
+  containers::benchmark::benchmark_with_different_sizes(benchmark_rebuild, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_open_snapshot, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_find, sizes);
+  std::filesystem::remove(path);
+}
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/map/persistent_hash_map.hpp"
+
+constexpr auto hash_function = std::hash<std::string>();
+const auto sizes = std::vector{1, 10, 100, 1000, 10000, 100000};
+
+using persistent_hash_map_t = containers::associative::persistent_hash_map<std::string, int>;
+
+void benchmark_persistent_insert(const int& size) {
+  auto map = persistent_hash_map_t(hash_function);
+  containers::benchmark::print_benchmark([&map, &size] {
+    for (int i = 0; i < size; ++i) {
+      map.insert(std::to_string(i), i);
+    }
+  }, "persistent_hash_map", "persistent insert", size);
+}
+
+void benchmark_transient_insert(const int& size) {
+  const auto map = persistent_hash_map_t(hash_function);
+  containers::benchmark::print_benchmark([&map, &size] {
+    auto transient = map.as_transient();
+    for (int i = 0; i < size; ++i) {
+      transient.insert(std::to_string(i), i);
+    }
+    static_cast<void>(transient.persistent());
+  }, "persistent_hash_map", "transient insert", size);
+}
+
+void benchmark_find(const int& size) {
+  auto transient = persistent_hash_map_t(hash_function).as_transient();
+  for (int i = 0; i < size; ++i) {
+    transient.insert(std::to_string(i), i);
+  }
+  const auto map = transient.persistent();
+  containers::benchmark::print_benchmark([&map, &size] {
+    for (int i = 0; i < size; ++i) {
+      static_cast<void>(map.find_by_key(std::to_string(i)));
+    }
+  }, "persistent_hash_map", "find", size);
+}
+
+// Takes a snapshot before every update, as a reader starting a consistent scan would
+void benchmark_snapshot_and_upsert(const int& size) {
+  auto map = persistent_hash_map_t(hash_function);
+  auto snapshots = std::vector<persistent_hash_map_t>();
+  snapshots.reserve(size);
+  containers::benchmark::print_benchmark([&map, &snapshots, &size] {
+    for (int i = 0; i < size; ++i) {
+      snapshots.push_back(map);
+      map.upsert(std::to_string(i), i);
+    }
+  }, "persistent_hash_map", "snapshot and upsert", size);
+}
+
+int main() {
+  containers::benchmark::benchmark_with_different_sizes(benchmark_persistent_insert, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_transient_insert, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_find, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_snapshot_and_upsert, sizes);
+}
\ No newline at end of file
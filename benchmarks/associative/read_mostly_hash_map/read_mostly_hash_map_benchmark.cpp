@@ -0,0 +1,90 @@
+#include <atomic>
+#include <format>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/map/hash_map.hpp"
+#include "associative/concurrent/read_mostly_hash_map.hpp"
+
+constexpr auto hash_function = std::hash<int>();
+constexpr auto key_space = 1000;
+constexpr auto reads_per_thread = 20000;
+
+// Powers of two up to all available cores, including the core count itself
+std::vector<int> create_thread_counts() {
+  const auto cores = static_cast<int>(std::max(std::thread::hardware_concurrency(), 1U));
+  auto thread_counts = std::vector<int>();
+  for (int threads = 1; threads < cores; threads *= 2) {
+    thread_counts.push_back(threads);
+  }
+  thread_counts.push_back(cores);
+  return thread_counts;
+}
+
+// Runs the readers while a single writer keeps updating values until all readers are done
+template<typename Find, typename Upsert>
+void run_workload(const int& readers, Find find, Upsert upsert) {
+  std::atomic<bool> done = false;
+  auto writer = std::thread([&] {
+    std::mt19937 rng(readers);
+    std::uniform_int_distribution<int> key(0, key_space - 1);
+    for (int value = 0; !done.load(std::memory_order_relaxed); ++value) {
+      upsert(key(rng), value);
+    }
+  });
+
+  auto workers = std::vector<std::thread>();
+  for (int thread = 0; thread < readers; ++thread) {
+    workers.emplace_back([&, thread] {
+      std::mt19937 rng(thread);
+      std::uniform_int_distribution<int> key(0, key_space - 1);
+      for (int operation = 0; operation < reads_per_thread; ++operation) {
+        find(key(rng));
+      }
+    });
+  }
+  std::ranges::for_each(workers, [](auto& worker) { worker.join(); });
+  done.store(true);
+  writer.join();
+}
+
+void benchmark_read_mostly_hash_map(const int& readers) {
+  auto map = containers::associative::read_mostly_hash_map<int, int>(hash_function);
+  for (int key = 0; key < key_space; ++key) {
+    map.insert(key, key);
+  }
+
+  containers::benchmark::print_benchmark([&map, &readers] {
+    run_workload(
+      readers,
+      [&map](const int& key) { map.find_by_key(key); },
+      [&map](const int& key, const int& value) { map.upsert(key, value); }
+    );
+  }, "read_mostly_hash_map", std::format("{} readers, 1 writer", readers), readers * reads_per_thread);
+}
+
+void benchmark_locked_hash_map(const int& readers) {
+  auto map = containers::associative::hash_map<int, int>(hash_function);
+  std::mutex mutex;
+  for (int key = 0; key < key_space; ++key) {
+    map.insert(key, key);
+  }
+
+  containers::benchmark::print_benchmark([&map, &mutex, &readers] {
+    run_workload(
+      readers,
+      [&map, &mutex](const int& key) { std::scoped_lock lock(mutex); map.find_by_key(key); },
+      [&map, &mutex](const int& key, const int& value) { std::scoped_lock lock(mutex); map.upsert(key, value); }
+    );
+  }, "locked_hash_map", std::format("{} readers, 1 writer", readers), readers * reads_per_thread);
+}
+
+int main() {
+  for (const auto& readers : create_thread_counts()) {
+    benchmark_read_mostly_hash_map(readers);
+    benchmark_locked_hash_map(readers);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+#include <iostream>
+#include <format>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/set/hash_set.hpp"
+#include "associative/set/hash_multi_set.hpp"
+#include "associative/sketch/count_min_sketch.hpp"
+#include "associative/sketch/hyperloglog.hpp"
+
+constexpr auto hash_function = std::hash<std::string>();
+constexpr auto sketch_width = 2048;
+constexpr auto sketch_depth = 4;
+constexpr auto hyperloglog_precision = 12;
+constexpr auto heavy_hitters = 10;
+constexpr auto number_threads = 4;
+const auto sizes = std::vector{1000, 10000};
+
+// Creates a skewed stream: key i is drawn with a probability proportional to 1 / (i + 1)
+std::vector<std::string> create_stream(const int& size) {
+  auto weights = std::vector<double>(size);
+  for (int index = 0; index < size; ++index) {
+    weights[index] = 1.0 / (index + 1);
+  }
+  std::mt19937 rng(123);
+  std::discrete_distribution<int> distribution(weights.begin(), weights.end());
+
+  auto stream = std::vector<std::string>(size);
+  for (auto& key : stream) {
+    key = std::to_string(distribution(rng));
+  }
+  return stream;
+}
+
+// Approximates the heap memory of a node based container: one node plus shared_ptr control block per element
+template<typename Node>
+size_t approximate_node_memory(const size_t& elements) {
+  return elements * (sizeof(Node) + 2 * sizeof(void*));
+}
+
+void benchmark_counting(const int& size) {
+  const auto stream = create_stream(size);
+
+  auto exact = containers::associative::hash_multi_set<std::string>(hash_function);
+  containers::benchmark::print_benchmark([&exact, &stream] {
+    for (const auto& key : stream) {
+      exact.insert(key);
+    }
+  }, "hash_multiset", "count stream", size);
+
+  auto sketch = containers::associative::count_min_sketch<std::string>(hash_function, sketch_width, sketch_depth);
+  containers::benchmark::print_benchmark([&sketch, &stream] {
+    for (const auto& key : stream) {
+      sketch.add(key);
+    }
+  }, "count_min_sketch", "count stream", size);
+
+  // The stream is skewed towards small keys, so these are the heavy hitters
+  double relative_error = 0;
+  for (int key = 0; key < heavy_hitters; ++key) {
+    const auto exact_count = static_cast<double>(exact.count(std::to_string(key)));
+    const auto estimated_count = static_cast<double>(sketch.estimate(std::to_string(key)));
+    relative_error += exact_count > 0 ? (estimated_count - exact_count) / exact_count : 0;
+  }
+
+  using node_t = containers::sequential::abstract_doubly_linked_list<std::pair<std::string, containers::hash_t>>::node;
+  std::cout << std::format(
+    "[count_min_sketch] mean relative error of top {} keys is {:e}, memory {} bytes vs ~{} bytes exact for size {}.",
+    heavy_hitters,
+    relative_error / heavy_hitters,
+    sketch.memory_usage(),
+    approximate_node_memory<node_t>(exact.size()),
+    size
+  ) << std::endl;
+}
+
+void benchmark_cardinality(const int& size) {
+  const auto stream = create_stream(size);
+
+  auto exact = containers::associative::hash_set<std::string>(hash_function);
+  containers::benchmark::print_benchmark([&exact, &stream] {
+    for (const auto& key : stream) {
+      exact.insert_safely(key);
+    }
+  }, "hash_set", "distinct stream", size);
+
+  auto sketch = containers::associative::hyperloglog<std::string>(hash_function, hyperloglog_precision);
+  containers::benchmark::print_benchmark([&sketch, &stream] {
+    for (const auto& key : stream) {
+      sketch.add(key);
+    }
+  }, "hyperloglog", "distinct stream", size);
+
+  using node_t = containers::sequential::abstract_doubly_linked_list<std::pair<std::string, containers::hash_t>>::node;
+  std::cout << std::format(
+    "[hyperloglog] estimated {:e} of {} distinct keys, memory {} bytes vs ~{} bytes exact for size {}.",
+    sketch.estimate(),
+    exact.size(),
+    sketch.memory_usage(),
+    approximate_node_memory<node_t>(exact.size()),
+    size
+  ) << std::endl;
+}
+
+void benchmark_parallel_merge(const int& size) {
+  const auto stream = create_stream(size);
+
+  containers::benchmark::print_benchmark([&stream] {
+    auto sketches = std::vector<containers::associative::count_min_sketch<std::string>>();
+    for (int thread = 0; thread < number_threads; ++thread) {
+      sketches.emplace_back(hash_function, sketch_width, sketch_depth);
+    }
+
+    auto threads = std::vector<std::thread>();
+    for (int thread = 0; thread < number_threads; ++thread) {
+      threads.emplace_back([&sketches, &stream, thread] {
+        for (size_t index = thread; index < stream.size(); index += number_threads) {
+          sketches[thread].add(stream[index]);
+        }
+      });
+    }
+    std::ranges::for_each(threads, [](auto& thread) { thread.join(); });
+
+    for (int thread = 1; thread < number_threads; ++thread) {
+      sketches[0].merge(sketches[thread]);
+    }
+  }, "count_min_sketch", std::format("count stream on {} threads and merge", number_threads), size);
+}
+
+int main() {
+  containers::benchmark::benchmark_with_different_sizes(benchmark_counting, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_cardinality, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_parallel_merge, sizes);
+}
\ No newline at end of file
@@ -0,0 +1,81 @@
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "associative/duplicate_key.hpp"
+#include "associative/map/hash_map.hpp"
+#include "associative/set/hash_set.hpp"
+#include "associative/concurrent/concurrent_hash_map.hpp"
+
+const auto sizes = std::vector{10, 100, 1000, 10000};
+volatile int sink = 0;
+
+// Every key is inserted 10 times, so 9 out of 10 inserts hit an existing key
+constexpr int repetitions = 10;
+
+template<typename Map>
+void benchmark_map(const std::string& name, const int& size) {
+  containers::benchmark::print_benchmark([&size] {
+    auto map = Map(std::hash<int>());
+    for (int repetition = 0; repetition < repetitions; ++repetition) {
+      for (int key = 0; key < size; ++key) {
+        try {
+          map.insert(key, key);
+        } catch (const containers::associative::duplicate_key<int>&) {
+          sink = sink + 1;
+        }
+      }
+    }
+  }, name, "insert, catching duplicate_key", size);
+
+  containers::benchmark::print_benchmark([&size] {
+    auto map = Map(std::hash<int>());
+    for (int repetition = 0; repetition < repetitions; ++repetition) {
+      for (int key = 0; key < size; ++key) {
+        if (!map.try_insert(key, key)) {
+          sink = sink + 1;
+        }
+      }
+    }
+  }, name, "try_insert", size);
+}
+
+void benchmark_hash_map(const int& size) {
+  benchmark_map<containers::associative::hash_map<int, int>>("hash_map", size);
+}
+
+void benchmark_concurrent_hash_map(const int& size) {
+  benchmark_map<containers::associative::concurrent_hash_map<int, int>>("concurrent_hash_map", size);
+}
+
+void benchmark_hash_set(const int& size) {
+  containers::benchmark::print_benchmark([&size] {
+    auto set = containers::associative::hash_set<int>(std::hash<int>());
+    for (int repetition = 0; repetition < repetitions; ++repetition) {
+      for (int key = 0; key < size; ++key) {
+        try {
+          set.insert(key);
+        } catch (const containers::associative::duplicate_key<int>&) {
+          sink = sink + 1;
+        }
+      }
+    }
+  }, "hash_set", "insert, catching duplicate_key", size);
+
+  containers::benchmark::print_benchmark([&size] {
+    auto set = containers::associative::hash_set<int>(std::hash<int>());
+    for (int repetition = 0; repetition < repetitions; ++repetition) {
+      for (int key = 0; key < size; ++key) {
+        if (!set.try_insert(key)) {
+          sink = sink + 1;
+        }
+      }
+    }
+  }, "hash_set", "try_insert", size);
+}
+
+int main() {
+  containers::benchmark::benchmark_with_different_sizes(benchmark_hash_map, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_concurrent_hash_map, sizes);
+  containers::benchmark::benchmark_with_different_sizes(benchmark_hash_set, sizes);
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <span>
+
+#include "container.hpp"
+
+namespace containers::associative {
+  /**
+   * @brief Finds the first key not less than the given key in a sorted array, without branching on comparisons.
+   *
+   * Every step halves the remaining range and selects the upper or lower half with a conditional
+   * move instead of a jump, so there are no branch mispredictions and the number of steps only
+   * depends on the size. On arrays in cache this beats std::lower_bound, whose branch on every
+   * comparison is mispredicted half of the time.
+   *
+   * @param keys The keys, sorted by operator<.
+   * @param key The key to look up.
+   * @return The index of the first key not less than the given key, keys.size() if there is none.
+   * @note Runtime complexity: O(log n).
+   */
+  template<typename Key>
+  [[nodiscard]] constexpr size_t branchless_lower_bound(const std::span<const Key> keys, const Key& key) noexcept {
+    if (keys.empty()) {
+      return 0;
+    }
+    const auto* base = keys.data();
+    auto length = keys.size();
+    while (length > 1) {
+      const auto half = length / 2;
+      base = base[half] < key ? base + half : base;
+      length -= half;
+    }
+    return static_cast<size_t>(base - keys.data()) + (*base < key);
+  }
+}
\ No newline at end of file
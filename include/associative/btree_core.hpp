@@ -0,0 +1,164 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+
+#include "container.hpp"
+
+namespace containers::associative {
+  /**
+   * @brief The default number of keys per B+ tree node, as many as fit into four cache lines but at least 8.
+   * @tparam Key The type of the keys.
+   */
+  template<typename Key>
+  inline constexpr size_t btree_default_capacity = std::max<size_t>(8, 4 * 64 / sizeof(Key));
+
+  /**
+   * @class btree_core
+   * @brief The B+ tree behind btree_map and btree_multi_set.
+   *
+   * Keeps the nodes balanced: insertions split full nodes, removals borrow from or merge with
+   * a sibling, so every node but the root holds at least Capacity / 2 keys. The containers on
+   * top keep their element count and answer their queries by walking the nodes themselves.
+   *
+   * @tparam Key The type of the keys, ordered by operator<.
+   * @tparam Payload The type stored next to every key in the leaves, e.g. the value of a map entry.
+   * @tparam Capacity The maximum number of keys per node.
+   * @tparam Counted Whether inner nodes store the total weight below each child, the weight of
+   * a leaf entry being its payload.
+   *
+   * @details
+   * - Payloads are stored in the leaves only. Inner nodes store separator keys: the subtree
+   *   left of a separator holds smaller keys, the subtree right of it greater or equal ones.
+   * - The leaves are linked in key order.
+   * - Keys and payloads are stored in fixed arrays and must be default constructible.
+   *
+   * @note This class is not thread-safe.
+   */
+  template<typename Key, typename Payload, size_t Capacity, bool Counted = false>
+  class btree_core final {
+    static_assert(Capacity >= 4, "B+ tree nodes must hold at least 4 keys");
+    static_assert(!Counted || std::is_same_v<Payload, size_t>, "the payloads of a counted B+ tree are weights");
+
+  public:
+    struct node {
+      bool leaf;
+      size_t count = 0;
+      std::array<Key, Capacity> keys;
+
+      explicit node(const bool& leaf) : leaf(leaf) {}
+      virtual ~node() = default;
+    };
+
+    struct leaf_node final : node {
+      std::array<Payload, Capacity> payloads;
+      leaf_node* next = nullptr;
+
+      leaf_node() : node(true) {}
+    };
+
+    struct no_totals {};
+
+    struct inner_node final : node {
+      std::array<std::unique_ptr<node>, Capacity + 1> children;
+      // The total weight below each child, only kept by counted trees
+      [[no_unique_address]] std::conditional_t<Counted, std::array<size_t, Capacity + 1>, no_totals> totals{};
+
+      inner_node() : node(false) {}
+    };
+
+    /**
+     * @brief Constructs an empty tree, a single empty leaf.
+     */
+    btree_core();
+
+    btree_core(const btree_core&) = delete;
+    btree_core& operator=(const btree_core&) = delete;
+
+    /**
+     * @brief Adds a key with a payload, or updates the payload of an existing key.
+     * @param key The key to add.
+     * @param payload The payload of the key if it is added.
+     * @param update Called with a reference to the payload if the key exists.
+     * @return True if the key has been added, false if it existed.
+     * @note Runtime complexity: O(log n).
+     */
+    template<typename Update>
+    bool insert(const Key& key, const Payload& payload, const Update& update);
+
+    /**
+     * @brief Shrinks or removes the entry of a key.
+     * @param key The key of the entry.
+     * @param shrink Called with a reference to the payload, returns whether to remove the entry.
+     * @return True if the key exists, false otherwise.
+     * @note Runtime complexity: O(log n).
+     */
+    template<typename Shrink>
+    bool remove(const Key& key, const Shrink& shrink);
+
+    /**
+     * @brief Replaces the tree with one built bottom-up from (key, payload) pairs sorted by key.
+     *
+     * The leaves are filled up from left to right and the inner levels are built on top of
+     * them, without searching or splitting any node. Only the last node of a level may have
+     * to take a few entries of its neighbour to reach the minimum occupancy.
+     *
+     * @param pairs A range of tuple-like (key, payload) pairs sorted by key.
+     * @return The number of pairs.
+     * @throws duplicate_key<Key> If a key is given twice.
+     * @throws std::invalid_argument If the keys are not sorted.
+     * @note The tree is left unchanged if an exception is thrown.
+     * @note Runtime complexity: O(n).
+     */
+    template<std::ranges::input_range Range>
+    size_t build_from_sorted(Range&& pairs) requires (!Counted);
+
+    /**
+     * @brief Removes all keys.
+     */
+    void clear();
+
+    [[nodiscard]] const node* root() const noexcept;
+    [[nodiscard]] const leaf_node* find_leaf(const Key& key) const;
+    [[nodiscard]] const leaf_node* first_leaf() const;
+
+    [[nodiscard]] static size_t subtree_total(const node* current) requires Counted;
+    [[nodiscard]] static size_t child_index(const inner_node* inner, const Key& key);
+    [[nodiscard]] static size_t key_index(const node* current, const Key& key);
+
+  private:
+    static constexpr size_t min_count = Capacity / 2;
+
+    // A node split off during an insertion, to be added to the parent right of the split node
+    struct split_t {
+      Key separator;
+      std::unique_ptr<node> right;
+      size_t right_total;
+    };
+
+    std::unique_ptr<node> root_node;
+
+    template<typename Update>
+    static std::optional<split_t> insert_into(node* current, const Key& key, const Payload& payload, const Update& update, bool& inserted, size_t& added);
+    template<typename Update>
+    static std::optional<split_t> insert_into_leaf(leaf_node* leaf, const Key& key, const Payload& payload, const Update& update, bool& inserted, size_t& added);
+    template<typename Update>
+    static std::optional<split_t> insert_into_inner(inner_node* inner, const Key& key, const Payload& payload, const Update& update, bool& inserted, size_t& added);
+
+    static void insert_entry(leaf_node* leaf, const size_t& position, const Key& key, const Payload& payload);
+    static void insert_child(inner_node* inner, const size_t& position, split_t&& split);
+
+    template<typename Shrink>
+    static std::optional<size_t> remove_from(node* current, const Key& key, const Shrink& shrink);
+    static void rebalance_child(inner_node* parent, const size_t& index);
+    static void merge_children(inner_node* parent, const size_t& index);
+
+    [[nodiscard]] static size_t weight(const Payload& payload) noexcept;
+  };
+}
+
+#include "inline/btree_core.tpp"
\ No newline at end of file
@@ -0,0 +1,172 @@
+#pragma once
+
+#include <algorithm>
+#include <utility>
+
+#include "associative/hash_mix.hpp"
+
+namespace containers::associative {
+  template<typename Key, typename Value>
+  lru_cache<Key, Value>::lru_cache(
+    const std::function<hash_t(const Key&)>& hash_function,
+    const size_t& capacity,
+    const weigher_t& weigher,
+    const eviction_callback_t& on_evict
+  ) :
+    maximum_weight(capacity),
+    weigher(weigher),
+    on_evict(on_evict),
+    hash_function(hash_function),
+    chains(initial_chain_count)
+  {}
+
+  template<typename Key, typename Value>
+  std::optional<Value> lru_cache<Key, Value>::get(const Key& key) {
+    const auto node = find_node(key);
+    if (!node.has_value()) {
+      ++miss_count;
+      return std::nullopt;
+    }
+
+    ++hit_count;
+    entries.move_to_front(*node);
+    return std::get<1>((*node)->data);
+  }
+
+  template<typename Key, typename Value>
+  void lru_cache<Key, Value>::put(const Key& key, const Value& value) {
+    const auto entry_weight = weigh(key, value);
+    const auto node = find_node(key);
+    if (entry_weight > maximum_weight) {
+      if (node.has_value()) {
+        unlink(*node);
+      }
+      return;
+    }
+
+    if (node.has_value()) {
+      auto& [entry_key, entry_value, previous_weight] = (*node)->data;
+      entry_value = value;
+      current_weight = current_weight - previous_weight + entry_weight;
+      previous_weight = entry_weight;
+      entries.move_to_front(*node);
+    } else {
+      entries.push_front(std::make_tuple(key, value, entry_weight));
+      index_node(entries.front());
+      current_weight += entry_weight;
+      container::number_elements++;
+    }
+    evict_to_capacity();
+  }
+
+  template<typename Key, typename Value>
+  bool lru_cache<Key, Value>::remove(const Key& key) {
+    const auto node = find_node(key);
+    if (!node.has_value()) {
+      return false;
+    }
+    unlink(*node);
+    return true;
+  }
+
+  template<typename Key, typename Value>
+  bool lru_cache<Key, Value>::exists(const Key& key) const {
+    return find_node(key).has_value();
+  }
+
+  template<typename Key, typename Value>
+  void lru_cache<Key, Value>::clear() {
+    while (!entries.empty()) {
+      unlink(entries.back());
+    }
+  }
+
+  template<typename Key, typename Value>
+  size_t lru_cache<Key, Value>::capacity() const noexcept {
+    return maximum_weight;
+  }
+
+  template<typename Key, typename Value>
+  size_t lru_cache<Key, Value>::weight() const noexcept {
+    return current_weight;
+  }
+
+  template<typename Key, typename Value>
+  size_t lru_cache<Key, Value>::hits() const noexcept {
+    return hit_count;
+  }
+
+  template<typename Key, typename Value>
+  size_t lru_cache<Key, Value>::misses() const noexcept {
+    return miss_count;
+  }
+
+  template<typename Key, typename Value>
+  size_t lru_cache<Key, Value>::evictions() const noexcept {
+    return eviction_count;
+  }
+
+  template<typename Key, typename Value>
+  size_t lru_cache<Key, Value>::weigh(const Key& key, const Value& value) const {
+    return weigher ? weigher(key, value) : 1;
+  }
+
+  template<typename Key, typename Value>
+  std::optional<typename lru_cache<Key, Value>::node_t> lru_cache<Key, Value>::find_node(const Key& key) const {
+    for (const auto& node : chains[chain_index(key)]) {
+      if (std::get<0>(node->data) == key) {
+        return node;
+      }
+    }
+    return std::nullopt;
+  }
+
+  template<typename Key, typename Value>
+  size_t lru_cache<Key, Value>::chain_index(const Key& key) const {
+    return mix_hash(hash_function(key)) & (chains.size() - 1);
+  }
+
+  template<typename Key, typename Value>
+  void lru_cache<Key, Value>::index_node(const node_t& node) {
+    if (container::number_elements >= chains.size()) {
+      // Doubles the chains, so rehashing costs O(1) amortized per insertion
+      auto nodes = std::vector<std::vector<node_t>>(2 * chains.size());
+      std::swap(chains, nodes);
+      for (const auto& chain : nodes) {
+        for (const auto& other : chain) {
+          chains[chain_index(std::get<0>(other->data))].push_back(other);
+        }
+      }
+    }
+    chains[chain_index(std::get<0>(node->data))].push_back(node);
+  }
+
+  template<typename Key, typename Value>
+  void lru_cache<Key, Value>::unindex_node(const node_t& node) {
+    auto& chain = chains[chain_index(std::get<0>(node->data))];
+    const auto position = std::ranges::find(chain, node);
+    *position = chain.back();
+    chain.pop_back();
+  }
+
+  template<typename Key, typename Value>
+  void lru_cache<Key, Value>::unlink(const node_t& node) {
+    unindex_node(node);
+    current_weight -= std::get<2>(node->data);
+    entries.erase(node);
+    container::number_elements--;
+  }
+
+  template<typename Key, typename Value>
+  void lru_cache<Key, Value>::evict_to_capacity() {
+    while (current_weight > maximum_weight) {
+      const auto victim = entries.back();
+      unlink(victim);
+      ++eviction_count;
+      if (on_evict) {
+        // The entry is already unlinked, so the callback may use the cache
+        on_evict(std::get<0>(victim->data), std::get<1>(victim->data));
+      }
+    }
+  }
+}
\ No newline at end of file
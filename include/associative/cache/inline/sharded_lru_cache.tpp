@@ -0,0 +1,119 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+
+namespace containers::associative {
+  template<typename Key, typename Value>
+  sharded_lru_cache<Key, Value>::shard::shard(
+    const std::function<hash_t(const Key&)>& hash_function,
+    const size_t& capacity,
+    const weigher_t& weigher,
+    const eviction_callback_t& on_evict
+  ) : cache(hash_function, capacity, weigher, on_evict) {}
+
+  template<typename Key, typename Value>
+  sharded_lru_cache<Key, Value>::sharded_lru_cache(
+    const std::function<hash_t(const Key&)>& hash_function,
+    const size_t& capacity,
+    const size_t& shard_count,
+    const weigher_t& weigher,
+    const eviction_callback_t& on_evict
+  ) : hash_function(hash_function) {
+    // No more shards than units of capacity, so every shard can hold an entry
+    auto adjusted_shard_count = std::bit_ceil(std::max<size_t>(shard_count, 1));
+    if (adjusted_shard_count > std::max<size_t>(capacity, 1)) {
+      adjusted_shard_count = std::bit_floor(std::max<size_t>(capacity, 1));
+    }
+    // The first shards take one unit of the remainder each, so the shards sum up to the capacity exactly
+    const auto shard_capacity = capacity / adjusted_shard_count;
+    const auto remainder = capacity % adjusted_shard_count;
+    shards.reserve(adjusted_shard_count);
+    for (size_t index = 0; index < adjusted_shard_count; ++index) {
+      shards.push_back(std::make_unique<shard>(hash_function, shard_capacity + (index < remainder), weigher, on_evict));
+    }
+  }
+
+  template<typename Key, typename Value>
+  std::optional<Value> sharded_lru_cache<Key, Value>::get(const Key& key) {
+    auto& shard = find_shard(key);
+    const auto lock = std::lock_guard(shard.mutex);
+    return shard.cache.get(key);
+  }
+
+  template<typename Key, typename Value>
+  void sharded_lru_cache<Key, Value>::put(const Key& key, const Value& value) {
+    auto& shard = find_shard(key);
+    const auto lock = std::lock_guard(shard.mutex);
+    shard.cache.put(key, value);
+  }
+
+  template<typename Key, typename Value>
+  bool sharded_lru_cache<Key, Value>::remove(const Key& key) {
+    auto& shard = find_shard(key);
+    const auto lock = std::lock_guard(shard.mutex);
+    return shard.cache.remove(key);
+  }
+
+  template<typename Key, typename Value>
+  bool sharded_lru_cache<Key, Value>::exists(const Key& key) const {
+    const auto& shard = find_shard(key);
+    const auto lock = std::lock_guard(shard.mutex);
+    return shard.cache.exists(key);
+  }
+
+  template<typename Key, typename Value>
+  void sharded_lru_cache<Key, Value>::clear() {
+    for (const auto& shard : shards) {
+      const auto lock = std::lock_guard(shard->mutex);
+      shard->cache.clear();
+    }
+  }
+
+  template<typename Key, typename Value>
+  size_t sharded_lru_cache<Key, Value>::size() const {
+    return sum([](const lru_cache<Key, Value>& cache) { return cache.size(); });
+  }
+
+  template<typename Key, typename Value>
+  size_t sharded_lru_cache<Key, Value>::weight() const {
+    return sum([](const lru_cache<Key, Value>& cache) { return cache.weight(); });
+  }
+
+  template<typename Key, typename Value>
+  size_t sharded_lru_cache<Key, Value>::hits() const {
+    return sum([](const lru_cache<Key, Value>& cache) { return cache.hits(); });
+  }
+
+  template<typename Key, typename Value>
+  size_t sharded_lru_cache<Key, Value>::misses() const {
+    return sum([](const lru_cache<Key, Value>& cache) { return cache.misses(); });
+  }
+
+  template<typename Key, typename Value>
+  size_t sharded_lru_cache<Key, Value>::evictions() const {
+    return sum([](const lru_cache<Key, Value>& cache) { return cache.evictions(); });
+  }
+
+  template<typename Key, typename Value>
+  size_t sharded_lru_cache<Key, Value>::shard_count() const noexcept {
+    return shards.size();
+  }
+
+  template<typename Key, typename Value>
+  typename sharded_lru_cache<Key, Value>::shard& sharded_lru_cache<Key, Value>::find_shard(const Key& key) const {
+    // Mixed, so the shard does not correlate with the bucket the hash_map of the shard picks from the raw hash
+    return *shards[(mix_hash(hash_function(key)) >> 32) & (shards.size() - 1)];
+  }
+
+  template<typename Key, typename Value>
+  template<typename Statistic>
+  size_t sharded_lru_cache<Key, Value>::sum(const Statistic& statistic) const {
+    size_t total = 0;
+    for (const auto& shard : shards) {
+      const auto lock = std::lock_guard(shard->mutex);
+      total += statistic(shard->cache);
+    }
+    return total;
+  }
+}
\ No newline at end of file
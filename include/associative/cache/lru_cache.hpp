@@ -0,0 +1,151 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include "container.hpp"
+#include "sequential/doubly_linked_list.hpp"
+
+namespace containers::associative {
+  /**
+   * @class lru_cache
+   * @brief A bounded key-value cache evicting the least recently used entries.
+   *
+   * The entries are kept in a doubly_linked_list from most to least recently used, and a hash
+   * table of chains, indexed directly by the hash of a key, maps every key to its list node. A
+   * hit moves the node to the front of the list, an insertion beyond the capacity drops nodes
+   * from the back.
+   *
+   * @tparam Key The type of the keys.
+   * @tparam Value The type of the cached values.
+   *
+   * @details
+   * - The capacity is counted in weight. By default every entry weighs 1, so the capacity is a
+   *   number of entries. A weigher, e.g. returning the size in bytes, makes it a budget of bytes.
+   * - An entry weighing more than the whole capacity is not cached.
+   * - The eviction callback is called for every entry dropped to make room, not for entries
+   *   removed or replaced explicitly.
+   * - Hits, misses and evictions are counted.
+   *
+   * @note This class is not thread-safe, see sharded_lru_cache.
+   */
+  template<typename Key, typename Value>
+  class lru_cache final : public container {
+  public:
+    using weigher_t = std::function<size_t(const Key&, const Value&)>;
+    using eviction_callback_t = std::function<void(const Key&, const Value&)>;
+
+    /**
+     * @brief Constructs an empty cache.
+     *
+     * @param hash_function A callable object that computes the hash of a given key.
+     * @param capacity The total weight of all entries the cache holds at most.
+     * @param weigher Returns the weight of an entry, every entry weighs 1 if empty.
+     * @param on_evict Called with every entry evicted to make room, if not empty.
+     */
+    lru_cache(
+      const std::function<hash_t(const Key&)>& hash_function,
+      const size_t& capacity,
+      const weigher_t& weigher = nullptr,
+      const eviction_callback_t& on_evict = nullptr
+    );
+
+    /**
+     * @brief Returns the value of a key and marks the entry as most recently used.
+     * @param key The key to look up.
+     * @return The value, or std::nullopt if the key is not cached.
+     * @note Runtime complexity: O(1) on average.
+     */
+    [[nodiscard]] std::optional<Value> get(const Key& key);
+
+    /**
+     * @brief Caches a value as the most recently used entry, evicting entries beyond the capacity.
+     * @param key The key of the entry.
+     * @param value The value, replacing the value of an already cached key.
+     * @note Runtime complexity: O(1) on average, plus O(1) per evicted entry.
+     */
+    void put(const Key& key, const Value& value);
+
+    /**
+     * @brief Removes the entry of a key without calling the eviction callback.
+     * @param key The key to remove.
+     * @return True if the key was cached, false otherwise.
+     * @note Runtime complexity: O(1) on average.
+     */
+    bool remove(const Key& key);
+
+    /**
+     * @brief Checks whether a key is cached, without marking it as used or counting a hit or miss.
+     * @param key The key to look up.
+     * @return True if the key is cached, false otherwise.
+     */
+    [[nodiscard]] bool exists(const Key& key) const;
+
+    /**
+     * @brief Removes all entries without calling the eviction callback.
+     */
+    void clear();
+
+    /**
+     * @brief Returns the total weight the cache holds at most.
+     * @return The capacity.
+     */
+    [[nodiscard]] size_t capacity() const noexcept;
+
+    /**
+     * @brief Returns the total weight of the cached entries.
+     * @return The weight, the number of entries without a weigher.
+     */
+    [[nodiscard]] size_t weight() const noexcept;
+
+    /**
+     * @brief Returns the number of get() calls that found their key.
+     * @return The hit count.
+     */
+    [[nodiscard]] size_t hits() const noexcept;
+
+    /**
+     * @brief Returns the number of get() calls that did not find their key.
+     * @return The miss count.
+     */
+    [[nodiscard]] size_t misses() const noexcept;
+
+    /**
+     * @brief Returns the number of entries evicted to make room.
+     * @return The eviction count.
+     */
+    [[nodiscard]] size_t evictions() const noexcept;
+
+  private:
+    static constexpr size_t initial_chain_count = 8;
+
+    using entry_t = std::tuple<Key, Value, size_t>;
+    using list_t = sequential::doubly_linked_list<entry_t>;
+    using node_t = typename sequential::abstract_doubly_linked_list<entry_t>::node_t;
+
+    const size_t maximum_weight;
+    const weigher_t weigher;
+    const eviction_callback_t on_evict;
+    // Most recently used first
+    list_t entries;
+    const std::function<hash_t(const Key&)> hash_function;
+    // The nodes by the hash of their key, at most one per chain on average
+    std::vector<std::vector<node_t>> chains;
+    size_t current_weight = 0;
+    size_t hit_count = 0;
+    size_t miss_count = 0;
+    size_t eviction_count = 0;
+
+    [[nodiscard]] size_t weigh(const Key& key, const Value& value) const;
+    [[nodiscard]] std::optional<node_t> find_node(const Key& key) const;
+    [[nodiscard]] size_t chain_index(const Key& key) const;
+    void index_node(const node_t& node);
+    void unindex_node(const node_t& node);
+    void unlink(const node_t& node);
+    void evict_to_capacity();
+  };
+}
+
+#include "inline/lru_cache.tpp"
\ No newline at end of file
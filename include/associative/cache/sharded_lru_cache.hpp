@@ -0,0 +1,114 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "container.hpp"
+#include "associative/hash_mix.hpp"
+#include "associative/cache/lru_cache.hpp"
+
+namespace containers::associative {
+  /**
+   * @class sharded_lru_cache
+   * @brief A thread-safe lru_cache, split into independently locked shards.
+   *
+   * Every key belongs to one shard, chosen by its mixed hash, and each shard is an lru_cache
+   * with its own mutex and an equal part of the capacity. Threads accessing different shards
+   * never wait for each other.
+   *
+   * @tparam Key The type of the keys.
+   * @tparam Value The type of the cached values.
+   *
+   * @details
+   * - Recency is tracked per shard, so an entry is evicted when it is the least recently used
+   *   of its shard, which approximates global LRU order for evenly spread keys.
+   * - The eviction callback is called while the shard is locked and must not use the cache.
+   * - size(), weight() and the counters sum up all shards, locking one at a time.
+   *
+   * @note All member functions are thread-safe.
+   */
+  template<typename Key, typename Value>
+  class sharded_lru_cache final {
+  public:
+    using weigher_t = typename lru_cache<Key, Value>::weigher_t;
+    using eviction_callback_t = typename lru_cache<Key, Value>::eviction_callback_t;
+
+    /**
+     * @brief Constructs an empty cache.
+     *
+     * @param hash_function A callable object that computes the hash of a given key, thread-safe.
+     * @param capacity The total weight of all entries, split over the shards as evenly as possible.
+     * An entry heavier than the part of its shard is not cached.
+     * @param shard_count The number of shards, rounded up to a power of 2, but at most the
+     * greatest power of 2 not above the capacity.
+     * @param weigher Returns the weight of an entry, every entry weighs 1 if empty.
+     * @param on_evict Called with every entry evicted to make room, if not empty.
+     */
+    sharded_lru_cache(
+      const std::function<hash_t(const Key&)>& hash_function,
+      const size_t& capacity,
+      const size_t& shard_count = std::thread::hardware_concurrency(),
+      const weigher_t& weigher = nullptr,
+      const eviction_callback_t& on_evict = nullptr
+    );
+
+    //! @copydoc lru_cache::get
+    [[nodiscard]] std::optional<Value> get(const Key& key);
+    //! @copydoc lru_cache::put
+    void put(const Key& key, const Value& value);
+    //! @copydoc lru_cache::remove
+    bool remove(const Key& key);
+    //! @copydoc lru_cache::exists
+    [[nodiscard]] bool exists(const Key& key) const;
+    //! @copydoc lru_cache::clear
+    void clear();
+
+    /**
+     * @brief Returns the number of cached entries.
+     * @return The size, summed over the shards.
+     */
+    [[nodiscard]] size_t size() const;
+
+    //! @copydoc lru_cache::weight
+    [[nodiscard]] size_t weight() const;
+    //! @copydoc lru_cache::hits
+    [[nodiscard]] size_t hits() const;
+    //! @copydoc lru_cache::misses
+    [[nodiscard]] size_t misses() const;
+    //! @copydoc lru_cache::evictions
+    [[nodiscard]] size_t evictions() const;
+
+    /**
+     * @brief Returns the number of shards.
+     * @return The shard count, a power of 2.
+     */
+    [[nodiscard]] size_t shard_count() const noexcept;
+
+  private:
+    // Own cache lines, so threads working on neighbouring shards do not contend
+    struct alignas(64) shard {
+      mutable std::mutex mutex;
+      lru_cache<Key, Value> cache;
+
+      shard(
+        const std::function<hash_t(const Key&)>& hash_function,
+        const size_t& capacity,
+        const weigher_t& weigher,
+        const eviction_callback_t& on_evict
+      );
+    };
+
+    const std::function<hash_t(const Key&)> hash_function;
+    std::vector<std::unique_ptr<shard>> shards;
+
+    [[nodiscard]] shard& find_shard(const Key& key) const;
+    template<typename Statistic>
+    [[nodiscard]] size_t sum(const Statistic& statistic) const;
+  };
+}
+
+#include "inline/sharded_lru_cache.tpp"
\ No newline at end of file
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <vector>
+
+#include "associative/map/associative_map.hpp"
+#include "associative/map/hash_map.hpp"
+
+namespace containers::associative {
+  /**
+   * @class concurrent_hash_map
+   * @brief A thread-safe hash map built from independently locked hash_map segments.
+   *
+   * This class provides the associative_map interface for concurrent use. Keys are
+   * distributed over a fixed number of segments, each being a hash_map guarded by its
+   * own reader-writer lock, so threads working on different segments never contend.
+   *
+   * @tparam Key The type of the keys stored in the map.
+   * @tparam Value The type of the values associated with the keys.
+   *
+   * @details
+   * - The segment of a key is selected by the mixed hash of the key, the bucket inside
+   *   the segment by the plain hash, so both choices stay independent.
+   * - Lookups take a shared lock, modifications an exclusive lock of a single segment.
+   * - Every segment grows and shrinks its buckets on its own, so a resize only blocks
+   *   the keys of one segment.
+   * - Values are returned by copy, references into the map are never handed out.
+   *
+   * @note All member functions are thread-safe.
+   */
+  template<typename Key, typename Value>
+  class concurrent_hash_map final : public associative_map<Key, Value> {
+  public:
+    /**
+     * @brief Constructs an empty concurrent_hash_map.
+     *
+     * @param hash_function A callable object that computes the hash of a given key.
+     * @param segment_count The number of independently locked segments.
+     *
+     * @details The number of segments is adjusted to the nearest power of 2 greater than or equal to `segment_count`.
+     * More segments allow more threads to modify the map at the same time.
+     */
+    explicit concurrent_hash_map(
+      const std::function<hash_t(const Key&)>& hash_function,
+      const size_t& segment_count = 16
+    );
+
+    //! @copydoc associative_map::insert
+    virtual void insert(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::insert_safely
+    virtual void insert_safely(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::try_insert
+    virtual std::expected<void, container_error> try_insert(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::find_by_key
+    virtual std::optional<Value> find_by_key(const Key& key) const override;
+    //! @copydoc associative_map::find_by_key_or_throw
+    virtual Value find_by_key_or_throw(const Key& key) const override;
+    //! @copydoc associative_map::remove
+    virtual void remove(const Key& key) override;
+
+    /**
+     * @brief Inserts a key-value pair or replaces the value of an existing key.
+     * @param key The key to insert or update.
+     * @param value The value to associate with the key.
+     * @note Runtime complexity: O(1) on average.
+     */
+    void upsert(const Key& key, const Value& value);
+
+    /**
+     * @brief Returns the number of elements in the map.
+     * @return The size of the map at some point during the call.
+     * @note Runtime complexity: O(1).
+     */
+    [[nodiscard]] virtual size_t size() const noexcept override;
+
+    /**
+     * @brief Returns the number of independently locked segments.
+     * @return The segment count.
+     */
+    [[nodiscard]] size_t segment_count() const noexcept;
+
+  private:
+    // Aligned to a cache line, so locking one segment does not invalidate the lock of its neighbour
+    struct alignas(64) segment {
+      mutable std::shared_mutex mutex;
+      hash_map<Key, Value> map;
+
+      explicit segment(const std::function<hash_t(const Key&)>& hash_function);
+    };
+
+    const std::function<hash_t(const Key&)> hash_function;
+    std::vector<std::unique_ptr<segment>> segments;
+    // Kept apart from container::number_elements, which is not atomic
+    std::atomic<size_t> element_count{0};
+
+    [[nodiscard]] segment& find_segment_by_key(const Key& key) const;
+    void add_to_size(const std::ptrdiff_t& difference) noexcept;
+  };
+}
+
+#include "inline/concurrent_hash_map.tpp"
\ No newline at end of file
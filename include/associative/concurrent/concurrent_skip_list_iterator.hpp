@@ -0,0 +1,49 @@
+#pragma once
+
+#include <iterator>
+#include <memory>
+
+#include "associative/concurrent/epoch_domain.hpp"
+
+namespace containers::associative {
+  /**
+   * @class concurrent_skip_list_iterator
+   * @brief A weakly consistent forward iterator over the keys of a concurrent_skip_list_set.
+   *
+   * The iterator holds an epoch_domain::guard, shared by its copies, so the nodes it visits
+   * are not freed while other threads remove them. The guard is dropped once the iterator
+   * reaches the end.
+   *
+   * @tparam Node The key node type of the set.
+   * @tparam Key The type of the keys stored in the set.
+   *
+   * @note An iterator and its copies must stay on the thread that created them. Holding
+   * one for long delays the reclamation of removed nodes in all lock-free containers.
+   */
+  template<typename Node, typename Key>
+  class concurrent_skip_list_iterator {
+  public:
+    using iterator_concept = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Key;
+
+    concurrent_skip_list_iterator();
+    concurrent_skip_list_iterator(const Node* current, const std::shared_ptr<epoch_domain::guard>& guard);
+
+    const Key& operator*() const;
+
+    // Prefix increment
+    concurrent_skip_list_iterator& operator++();
+    // Postfix increment
+    concurrent_skip_list_iterator operator++(int);
+
+    bool operator==(const concurrent_skip_list_iterator& other) const;
+
+  private:
+    // nullptr past the last key
+    const Node* current;
+    std::shared_ptr<epoch_domain::guard> guard;
+  };
+}
+
+#include "inline/concurrent_skip_list_iterator.tpp"
\ No newline at end of file
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include "associative/set/ordered_set.hpp"
+#include "associative/concurrent/concurrent_skip_list_iterator.hpp"
+
+namespace containers::associative {
+  /**
+   * @class concurrent_skip_list_set
+   * @brief A lock-free ordered set based on a skip list.
+   *
+   * This class provides the ordered_set interface for concurrent use without any locks,
+   * following the lock-free skip list of Fraser and of Herlihy and Shavit.
+   *
+   * @tparam Key The type of the keys stored in the set, ordered by operator<.
+   *
+   * @details
+   * - Every key is stored in one node, which is linked into the sorted lists of its lowest
+   *   levels. A node reaches every further level with probability 1/2, so searches skip
+   *   over most keys on the upper levels.
+   * - A key belongs to the set once its node is linked on level 0, and leaves it once its
+   *   level 0 pointer is marked. The upper levels are only shortcuts, linked after and marked
+   *   before level 0.
+   * - Marked nodes are unlinked by insert() and remove() of any thread that encounters them.
+   *   exists() skips them without writing, so it never retries.
+   * - A node is reclaimed through the epoch_domain once its inserting thread has stopped
+   *   linking it and its removing thread has marked it, whichever happens last.
+   * - Iteration is weakly consistent: it returns the keys in order, includes every key present
+   *   during the whole iteration, and may or may not include keys inserted or removed meanwhile.
+   *
+   * @note All member functions are thread-safe and lock-free.
+   */
+  template<typename Key>
+  class concurrent_skip_list_set final : public ordered_set<Key> {
+  private:
+    static constexpr size_t max_height = 32;
+
+    struct node {
+      const size_t height;
+      // Pointers to the next node of every level, the lowest bit marks this node as logically removed
+      const std::unique_ptr<std::atomic<std::uintptr_t>[]> next;
+
+      explicit node(const size_t& height);
+    };
+
+    struct key_node final : node {
+      const Key key;
+      // Released once by the inserting and once by the removing thread, the second one retires the node
+      std::atomic<std::uint8_t> releases{0};
+
+      key_node(const Key& key, const size_t& height);
+    };
+
+  public:
+    using iterator_t = concurrent_skip_list_iterator<key_node, Key>;
+
+    /**
+     * @brief Constructs an empty concurrent_skip_list_set.
+     */
+    concurrent_skip_list_set();
+
+    virtual ~concurrent_skip_list_set() override;
+    concurrent_skip_list_set(const concurrent_skip_list_set&) = delete;
+    concurrent_skip_list_set& operator=(const concurrent_skip_list_set&) = delete;
+
+    //! @copydoc associative_set::insert
+    virtual void insert(const Key& key) override;
+    //! @copydoc associative_set::insert_safely
+    virtual void insert_safely(const Key& key) override;
+    //! @copydoc associative_set::try_insert
+    virtual std::expected<void, container_error> try_insert(const Key& key) override;
+    //! @copydoc associative_set::exists
+    virtual bool exists(const Key& key) const override;
+    //! @copydoc associative_set::remove
+    virtual void remove(const Key& key) override;
+
+    /**
+     * @copydoc ordered_set::find_lower_bound
+     * @note Runtime complexity: O(log n) expected.
+     */
+    virtual std::optional<Key> find_lower_bound(const Key& key) const override;
+
+    /**
+     * @copydoc ordered_set::find_upper_bound
+     * @note Runtime complexity: O(log n) expected.
+     */
+    virtual std::optional<Key> find_upper_bound(const Key& key) const override;
+
+    /**
+     * @brief Returns the number of keys in the set.
+     * @return The size of the set at some point during the call.
+     */
+    [[nodiscard]] virtual size_t size() const noexcept override;
+
+    /**
+     * @brief Returns an iterator to the first key not less than the given key.
+     * @param key The key to look up.
+     * @return The iterator, or end() if all keys are less.
+     * @note The iterator pins the calling thread to the epoch_domain, see concurrent_skip_list_iterator.
+     * @note Runtime complexity: O(log n) expected.
+     */
+    [[nodiscard]] iterator_t lower_bound(const Key& key) const;
+
+    /**
+     * @brief Returns an iterator to the smallest key.
+     * @return The iterator, or end() if the set is empty.
+     * @note The iterator pins the calling thread to the epoch_domain, see concurrent_skip_list_iterator.
+     */
+    iterator_t begin() const;
+    iterator_t end() const;
+    iterator_t cbegin() const;
+    iterator_t cend() const;
+
+  private:
+    using path_t = std::array<node*, max_height>;
+
+    node* const head;
+    std::atomic<size_t> element_count{0};
+
+    bool insert_if_absent(const Key& key);
+    void link_upper_levels(key_node* inserted, path_t& predecessors, path_t& successors);
+    void release(key_node* released);
+
+    bool find(const Key& key, path_t& predecessors, path_t& successors) const;
+    [[nodiscard]] const key_node* find_first_not_less(const Key& key) const;
+    void add_to_size(const std::ptrdiff_t& difference) noexcept;
+
+    [[nodiscard]] static size_t random_height();
+    [[nodiscard]] static const key_node* skip_marked(std::uintptr_t bits, const size_t& level);
+  };
+}
+
+#include "inline/concurrent_skip_list_set.tpp"
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace containers::associative {
+  /**
+   * @class epoch_domain
+   * @brief Epoch-based memory reclamation for lock-free containers.
+   *
+   * Lock-free containers unlink nodes while other threads may still read them, so an
+   * unlinked node must not be freed right away. Threads announce that they access
+   * shared nodes by holding a guard, which pins the global epoch. Retired nodes are
+   * freed once the global epoch has advanced twice since their retirement, because
+   * by then no guard can still reference them.
+   *
+   * @details
+   * - There is one process-wide domain, obtained with instance().
+   * - Every thread gets its own record on first use, which is recycled when the thread exits.
+   *   Retired nodes of exiting threads are handed over to the domain.
+   * - Pinning and retiring never block. Only threads exiting with pending retired nodes
+   *   take a lock.
+   *
+   * @note All member functions are thread-safe.
+   */
+  class epoch_domain final {
+  public:
+    using deleter_t = void (*)(void*);
+
+    /**
+     * @brief Pins the current thread to the global epoch for its lifetime.
+     *
+     * While a guard is alive, no node retired after the guard has been created is freed.
+     * Guards may be nested, only the outermost guard pins and unpins the thread.
+     */
+    class guard final {
+    public:
+      guard();
+      ~guard();
+      guard(const guard&) = delete;
+      guard& operator=(const guard&) = delete;
+    };
+
+    /**
+     * @brief Returns the process-wide domain.
+     * @return The domain shared by all lock-free containers.
+     */
+    [[nodiscard]] static epoch_domain& instance();
+
+    /**
+     * @brief Schedules a node for deletion once no guard can reference it anymore.
+     * @param pointer The node, already unreachable for threads that pin from now on.
+     * @param deleter Frees the node.
+     * @note Must be called while holding a guard.
+     */
+    void retire(void* pointer, deleter_t deleter);
+
+    /**
+     * @brief Tries to advance the global epoch and frees all nodes that are safe to free.
+     */
+    void collect();
+
+    /**
+     * @brief Returns the current global epoch.
+     * @return The global epoch, which only ever increases.
+     */
+    [[nodiscard]] std::uint64_t epoch() const noexcept;
+
+    ~epoch_domain();
+    epoch_domain(const epoch_domain&) = delete;
+    epoch_domain& operator=(const epoch_domain&) = delete;
+
+  private:
+    struct retired_node {
+      void* pointer;
+      deleter_t deleter;
+      std::uint64_t epoch;
+    };
+
+    // Aligned to a cache line, so pinning a thread never invalidates the record of another thread
+    struct alignas(64) record {
+      std::atomic<std::uint64_t> epoch{0};
+      std::atomic<bool> active{false};
+      std::atomic<bool> in_use{true};
+      record* next = nullptr;
+      size_t nesting = 0;
+      std::vector<retired_node> retired;
+    };
+
+    // Number of retired nodes of a thread that trigger a collection
+    static constexpr size_t collect_threshold = 64;
+
+    std::atomic<std::uint64_t> global_epoch{0};
+    std::atomic<record*> records{nullptr};
+    std::mutex orphans_mutex;
+    std::vector<retired_node> orphans;
+
+    epoch_domain() = default;
+
+    [[nodiscard]] record& current_record();
+    [[nodiscard]] record* acquire_record();
+    void release_record(record* thread_record);
+    bool try_advance();
+    void free_safe_nodes(std::vector<retired_node>& nodes) const;
+  };
+}
\ No newline at end of file
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <bit>
+#include <mutex>
+
+#include "associative/duplicate_key.hpp"
+#include "associative/hash_mix.hpp"
+#include "associative/map/value_not_found.hpp"
+
+namespace containers::associative {
+  template<typename Key, typename Value>
+  concurrent_hash_map<Key, Value>::segment::segment(
+    const std::function<hash_t(const Key&)>& hash_function
+  ) : map(hash_function) {}
+
+  template<typename Key, typename Value>
+  concurrent_hash_map<Key, Value>::concurrent_hash_map(
+    const std::function<hash_t(const Key&)>& hash_function,
+    const size_t& segment_count
+  ) : hash_function(hash_function) {
+    const auto adjusted_segment_count = std::bit_ceil(std::max<size_t>(segment_count, 1));
+    segments.reserve(adjusted_segment_count);
+    for (size_t index = 0; index < adjusted_segment_count; ++index) {
+      segments.push_back(std::make_unique<segment>(hash_function));
+    }
+  }
+
+  template<typename Key, typename Value>
+  void concurrent_hash_map<Key, Value>::insert(const Key& key, const Value& value) {
+    if (!try_insert(key, value)) {
+      throw duplicate_key<Key>(key);
+    }
+  }
+
+  template<typename Key, typename Value>
+  void concurrent_hash_map<Key, Value>::insert_safely(const Key& key, const Value& value) {
+    auto& segment = find_segment_by_key(key);
+    std::unique_lock lock(segment.mutex);
+    const auto initial_size = segment.map.size();
+    segment.map.insert_safely(key, value);
+    add_to_size(static_cast<std::ptrdiff_t>(segment.map.size() - initial_size));
+  }
+
+  template<typename Key, typename Value>
+  std::expected<void, container_error> concurrent_hash_map<Key, Value>::try_insert(const Key& key, const Value& value) {
+    auto& segment = find_segment_by_key(key);
+    std::unique_lock lock(segment.mutex);
+    auto result = segment.map.try_insert(key, value);
+    if (result) {
+      add_to_size(1);
+    }
+    return result;
+  }
+
+  template<typename Key, typename Value>
+  void concurrent_hash_map<Key, Value>::upsert(const Key& key, const Value& value) {
+    auto& segment = find_segment_by_key(key);
+    std::unique_lock lock(segment.mutex);
+    const auto initial_size = segment.map.size();
+    segment.map.upsert(key, value);
+    add_to_size(static_cast<std::ptrdiff_t>(segment.map.size() - initial_size));
+  }
+
+  template<typename Key, typename Value>
+  std::optional<Value> concurrent_hash_map<Key, Value>::find_by_key(const Key& key) const {
+    const auto& segment = find_segment_by_key(key);
+    std::shared_lock lock(segment.mutex);
+    return segment.map.find_by_key(key);
+  }
+
+  template<typename Key, typename Value>
+  Value concurrent_hash_map<Key, Value>::find_by_key_or_throw(const Key& key) const {
+    const auto& optional = find_by_key(key);
+    if (!optional.has_value()) {
+      throw value_not_found<Key>(key);
+    }
+    return optional.value();
+  }
+
+  template<typename Key, typename Value>
+  void concurrent_hash_map<Key, Value>::remove(const Key& key) {
+    auto& segment = find_segment_by_key(key);
+    std::unique_lock lock(segment.mutex);
+    const auto initial_size = segment.map.size();
+    segment.map.remove(key);
+    add_to_size(-static_cast<std::ptrdiff_t>(initial_size - segment.map.size()));
+  }
+
+  template<typename Key, typename Value>
+  size_t concurrent_hash_map<Key, Value>::size() const noexcept {
+    return element_count.load(std::memory_order_relaxed);
+  }
+
+  template<typename Key, typename Value>
+  size_t concurrent_hash_map<Key, Value>::segment_count() const noexcept {
+    return segments.size();
+  }
+
+  template<typename Key, typename Value>
+  typename concurrent_hash_map<Key, Value>::segment& concurrent_hash_map<Key, Value>::find_segment_by_key(
+    const Key& key
+  ) const {
+    const auto segment_index = static_cast<size_t>(mix_hash(hash_function(key)) >> 32) & (segments.size() - 1);
+    return *segments[segment_index];
+  }
+
+  template<typename Key, typename Value>
+  void concurrent_hash_map<Key, Value>::add_to_size(const std::ptrdiff_t& difference) noexcept {
+    if (difference != 0) {
+      element_count.fetch_add(static_cast<size_t>(difference), std::memory_order_relaxed);
+    }
+  }
+}
\ No newline at end of file
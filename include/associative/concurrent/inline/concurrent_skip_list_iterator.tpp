@@ -0,0 +1,46 @@
+#pragma once
+
+#include "associative/concurrent/marked_pointer.hpp"
+
+namespace containers::associative {
+  template<typename Node, typename Key>
+  concurrent_skip_list_iterator<Node, Key>::concurrent_skip_list_iterator()
+    : current(nullptr), guard(nullptr) {}
+
+  template<typename Node, typename Key>
+  concurrent_skip_list_iterator<Node, Key>::concurrent_skip_list_iterator(
+    const Node* current,
+    const std::shared_ptr<epoch_domain::guard>& guard
+  ) : current(current), guard(current != nullptr ? guard : nullptr) {}
+
+  template<typename Node, typename Key>
+  const Key& concurrent_skip_list_iterator<Node, Key>::operator*() const {
+    return current->key;
+  }
+
+  template<typename Node, typename Key>
+  concurrent_skip_list_iterator<Node, Key>& concurrent_skip_list_iterator<Node, Key>::operator++() {
+    // A removed node keeps pointing to its successor at the time of removal, so every key present since then follows
+    auto* next = lockfree_detail::to_pointer<const Node>(current->next[0].load());
+    while (next != nullptr && lockfree_detail::is_marked(next->next[0].load())) {
+      next = lockfree_detail::to_pointer<const Node>(next->next[0].load());
+    }
+    current = next;
+    if (current == nullptr) {
+      guard.reset();
+    }
+    return *this;
+  }
+
+  template<typename Node, typename Key>
+  concurrent_skip_list_iterator<Node, Key> concurrent_skip_list_iterator<Node, Key>::operator++(int) {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  template<typename Node, typename Key>
+  bool concurrent_skip_list_iterator<Node, Key>::operator==(const concurrent_skip_list_iterator& other) const {
+    return current == other.current;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,285 @@
+#pragma once
+
+#include <bit>
+#include <random>
+
+#include "associative/duplicate_key.hpp"
+#include "associative/concurrent/epoch_domain.hpp"
+#include "associative/concurrent/marked_pointer.hpp"
+
+namespace containers::associative {
+  template<typename Key>
+  concurrent_skip_list_set<Key>::node::node(const size_t& height)
+    : height(height), next(std::make_unique<std::atomic<std::uintptr_t>[]>(height)) {}
+
+  template<typename Key>
+  concurrent_skip_list_set<Key>::key_node::key_node(const Key& key, const size_t& height)
+    : node(height), key(key) {}
+
+  template<typename Key>
+  concurrent_skip_list_set<Key>::concurrent_skip_list_set() : head(new node(max_height)) {}
+
+  template<typename Key>
+  concurrent_skip_list_set<Key>::~concurrent_skip_list_set() {
+    auto* current = lockfree_detail::to_pointer<key_node>(head->next[0].load());
+    while (current != nullptr) {
+      auto* next = lockfree_detail::to_pointer<key_node>(current->next[0].load());
+      delete current;
+      current = next;
+    }
+    delete head;
+  }
+
+  template<typename Key>
+  void concurrent_skip_list_set<Key>::insert(const Key& key) {
+    if (!insert_if_absent(key)) {
+      throw duplicate_key<Key>(key);
+    }
+  }
+
+  template<typename Key>
+  void concurrent_skip_list_set<Key>::insert_safely(const Key& key) {
+    insert_if_absent(key);
+  }
+
+  template<typename Key>
+  std::expected<void, container_error> concurrent_skip_list_set<Key>::try_insert(const Key& key) {
+    if (!insert_if_absent(key)) {
+      return std::unexpected(container_error::duplicate_key);
+    }
+    return {};
+  }
+
+  template<typename Key>
+  bool concurrent_skip_list_set<Key>::exists(const Key& key) const {
+    epoch_domain::guard guard;
+    const auto* found = find_first_not_less(key);
+    return found != nullptr && !(key < found->key);
+  }
+
+  template<typename Key>
+  void concurrent_skip_list_set<Key>::remove(const Key& key) {
+    epoch_domain::guard guard;
+    auto predecessors = path_t();
+    auto successors = path_t();
+    if (!find(key, predecessors, successors)) {
+      return;
+    }
+
+    auto* removed = static_cast<key_node*>(successors[0]);
+    for (auto level = removed->height - 1; level > 0; --level) {
+      auto bits = removed->next[level].load();
+      while (!lockfree_detail::is_marked(bits) && !removed->next[level].compare_exchange_weak(bits, bits | 1)) {}
+    }
+
+    // Marking level 0 removes the key logically, only one thread can succeed
+    auto bits = removed->next[0].load();
+    while (!lockfree_detail::is_marked(bits)) {
+      if (removed->next[0].compare_exchange_strong(bits, bits | 1)) {
+        add_to_size(-1);
+        release(removed);
+        return;
+      }
+    }
+  }
+
+  template<typename Key>
+  std::optional<Key> concurrent_skip_list_set<Key>::find_lower_bound(const Key& key) const {
+    epoch_domain::guard guard;
+    const auto* found = find_first_not_less(key);
+    if (found == nullptr) {
+      return std::nullopt;
+    }
+    return found->key;
+  }
+
+  template<typename Key>
+  std::optional<Key> concurrent_skip_list_set<Key>::find_upper_bound(const Key& key) const {
+    epoch_domain::guard guard;
+    const auto* found = find_first_not_less(key);
+    if (found != nullptr && !(key < found->key)) {
+      found = skip_marked(found->next[0].load(), 0);
+    }
+    if (found == nullptr) {
+      return std::nullopt;
+    }
+    return found->key;
+  }
+
+  template<typename Key>
+  size_t concurrent_skip_list_set<Key>::size() const noexcept {
+    return element_count.load(std::memory_order_relaxed);
+  }
+
+  template<typename Key>
+  typename concurrent_skip_list_set<Key>::iterator_t concurrent_skip_list_set<Key>::lower_bound(const Key& key) const {
+    auto guard = std::make_shared<epoch_domain::guard>();
+    return iterator_t(find_first_not_less(key), guard);
+  }
+
+  template<typename Key>
+  typename concurrent_skip_list_set<Key>::iterator_t concurrent_skip_list_set<Key>::begin() const {
+    auto guard = std::make_shared<epoch_domain::guard>();
+    return iterator_t(skip_marked(head->next[0].load(), 0), guard);
+  }
+
+  template<typename Key>
+  typename concurrent_skip_list_set<Key>::iterator_t concurrent_skip_list_set<Key>::end() const {
+    return iterator_t();
+  }
+
+  template<typename Key>
+  typename concurrent_skip_list_set<Key>::iterator_t concurrent_skip_list_set<Key>::cbegin() const {
+    return begin();
+  }
+
+  template<typename Key>
+  typename concurrent_skip_list_set<Key>::iterator_t concurrent_skip_list_set<Key>::cend() const {
+    return end();
+  }
+
+  template<typename Key>
+  bool concurrent_skip_list_set<Key>::insert_if_absent(const Key& key) {
+    epoch_domain::guard guard;
+    auto predecessors = path_t();
+    auto successors = path_t();
+
+    key_node* inserted = nullptr;
+    while (true) {
+      if (find(key, predecessors, successors)) {
+        delete inserted;
+        return false;
+      }
+
+      if (inserted == nullptr) {
+        inserted = new key_node(key, random_height());
+      }
+      for (size_t level = 0; level < inserted->height; ++level) {
+        inserted->next[level].store(lockfree_detail::to_bits(successors[level]), std::memory_order_relaxed);
+      }
+      // Linking level 0 inserts the key, the upper levels follow
+      auto expected = lockfree_detail::to_bits(successors[0]);
+      if (predecessors[0]->next[0].compare_exchange_strong(expected, lockfree_detail::to_bits<node>(inserted))) {
+        break;
+      }
+    }
+
+    add_to_size(1);
+    link_upper_levels(inserted, predecessors, successors);
+    release(inserted);
+    return true;
+  }
+
+  template<typename Key>
+  void concurrent_skip_list_set<Key>::link_upper_levels(key_node* inserted, path_t& predecessors, path_t& successors) {
+    for (size_t level = 1; level < inserted->height; ++level) {
+      while (true) {
+        // Other threads only ever mark the pointers of the node, so a failed exchange means it is being removed
+        auto bits = inserted->next[level].load();
+        const auto successor = lockfree_detail::to_bits(successors[level]);
+        if (lockfree_detail::is_marked(bits)
+          || (bits != successor && !inserted->next[level].compare_exchange_strong(bits, successor))
+        ) {
+          return;
+        }
+
+        auto expected = successor;
+        if (predecessors[level]->next[level].compare_exchange_strong(expected, lockfree_detail::to_bits<node>(inserted))) {
+          break;
+        }
+        find(inserted->key, predecessors, successors);
+        if (successors[0] != inserted) {
+          return;
+        }
+      }
+    }
+  }
+
+  template<typename Key>
+  void concurrent_skip_list_set<Key>::release(key_node* released) {
+    if (released->releases.fetch_add(1) == 0) {
+      return;
+    }
+
+    // Marked on every level and no longer linked by its inserting thread, one more search unlinks the node for good
+    auto predecessors = path_t();
+    auto successors = path_t();
+    find(released->key, predecessors, successors);
+    epoch_domain::instance().retire(released, [](void* pointer) {
+      delete static_cast<key_node*>(pointer);
+    });
+  }
+
+  template<typename Key>
+  bool concurrent_skip_list_set<Key>::find(const Key& key, path_t& predecessors, path_t& successors) const {
+    const auto try_find = [&]() -> bool {
+      auto* predecessor = head;
+      for (auto level = max_height; level-- > 0;) {
+        auto* current = lockfree_detail::to_pointer<node>(predecessor->next[level].load());
+        while (current != nullptr) {
+          const auto next = current->next[level].load();
+          if (lockfree_detail::is_marked(next)) {
+            auto expected = lockfree_detail::to_bits(current);
+            if (!predecessor->next[level].compare_exchange_strong(expected, next & ~std::uintptr_t{1})) {
+              return false;
+            }
+            current = lockfree_detail::to_pointer<node>(next);
+            continue;
+          }
+          if (!(static_cast<key_node*>(current)->key < key)) {
+            break;
+          }
+          predecessor = current;
+          current = lockfree_detail::to_pointer<node>(next);
+        }
+        predecessors[level] = predecessor;
+        successors[level] = current;
+      }
+      return true;
+    };
+
+    while (!try_find()) {}
+    return successors[0] != nullptr && !(key < static_cast<key_node*>(successors[0])->key);
+  }
+
+  template<typename Key>
+  const typename concurrent_skip_list_set<Key>::key_node* concurrent_skip_list_set<Key>::find_first_not_less(
+    const Key& key
+  ) const {
+    // Only reads, marked nodes are stepped over instead of unlinked
+    const node* predecessor = head;
+    const key_node* current = nullptr;
+    for (auto level = max_height; level-- > 0;) {
+      current = skip_marked(predecessor->next[level].load(), level);
+      while (current != nullptr && current->key < key) {
+        predecessor = current;
+        current = skip_marked(current->next[level].load(), level);
+      }
+    }
+    return current;
+  }
+
+  template<typename Key>
+  void concurrent_skip_list_set<Key>::add_to_size(const std::ptrdiff_t& difference) noexcept {
+    element_count.fetch_add(static_cast<size_t>(difference), std::memory_order_relaxed);
+  }
+
+  template<typename Key>
+  size_t concurrent_skip_list_set<Key>::random_height() {
+    thread_local auto generator = std::mt19937_64(std::random_device()());
+    // Every further level with probability 1/2
+    return std::min<size_t>(max_height, 1 + std::countr_one(generator()));
+  }
+
+  template<typename Key>
+  const typename concurrent_skip_list_set<Key>::key_node* concurrent_skip_list_set<Key>::skip_marked(
+    std::uintptr_t bits,
+    const size_t& level
+  ) {
+    auto* current = lockfree_detail::to_pointer<const key_node>(bits);
+    while (current != nullptr && lockfree_detail::is_marked(bits = current->next[level].load())) {
+      current = lockfree_detail::to_pointer<const key_node>(bits);
+    }
+    return current;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,278 @@
+#pragma once
+
+#include <bit>
+#include <optional>
+
+#include "associative/duplicate_key.hpp"
+#include "associative/concurrent/epoch_domain.hpp"
+#include "associative/concurrent/marked_pointer.hpp"
+
+namespace containers::associative {
+  template<typename Key>
+  lockfree_hash_set<Key>::node::node(const std::uint64_t& split_order_key)
+    : split_order_key(split_order_key) {}
+
+  template<typename Key>
+  lockfree_hash_set<Key>::key_node::key_node(const std::uint64_t& split_order_key, const Key& key)
+    : node(split_order_key), key(key) {}
+
+  template<typename Key>
+  lockfree_hash_set<Key>::lockfree_hash_set(
+    const std::function<hash_t(const Key&)>& hash_function
+  ) :
+    hash_function(hash_function),
+    head(new node(calculate_dummy_key(0)))
+  {
+    directory[0].store(new bucket_t[1]{});
+    directory[0].load()[0].store(head);
+  }
+
+  template<typename Key>
+  lockfree_hash_set<Key>::~lockfree_hash_set() {
+    auto* current = head;
+    while (current != nullptr) {
+      auto* next = lockfree_detail::to_pointer<node>(current->next.load());
+      if (current->split_order_key & 1) {
+        delete static_cast<key_node*>(current);
+      } else {
+        delete current;
+      }
+      current = next;
+    }
+    for (auto& level : directory) {
+      delete[] level.load();
+    }
+  }
+
+  template<typename Key>
+  void lockfree_hash_set<Key>::insert(const Key& key) {
+    if (!insert_if_absent(key)) {
+      throw duplicate_key<Key>(key);
+    }
+  }
+
+  template<typename Key>
+  void lockfree_hash_set<Key>::insert_safely(const Key& key) {
+    insert_if_absent(key);
+  }
+
+  template<typename Key>
+  std::expected<void, container_error> lockfree_hash_set<Key>::try_insert(const Key& key) {
+    if (!insert_if_absent(key)) {
+      return std::unexpected(container_error::duplicate_key);
+    }
+    return {};
+  }
+
+  template<typename Key>
+  bool lockfree_hash_set<Key>::insert_if_absent(const Key& key) {
+    epoch_domain::guard guard;
+    const auto hash = static_cast<std::uint32_t>(hash_function(key));
+    const auto split_order_key = calculate_regular_key(hash);
+    auto* bucket = find_bucket(hash & (buckets.load() - 1));
+
+    key_node* new_node = nullptr;
+    while (true) {
+      const auto [previous, current, found] = find(bucket, split_order_key, &key);
+      if (found) {
+        delete new_node;
+        return false;
+      }
+
+      if (new_node == nullptr) {
+        new_node = new key_node(split_order_key, key);
+      }
+      auto expected = lockfree_detail::to_bits(current);
+      new_node->next.store(expected);
+      if (previous->next.compare_exchange_strong(expected, lockfree_detail::to_bits<node>(new_node))) {
+        break;
+      }
+    }
+
+    add_to_size(1);
+    auto bucket_count = buckets.load();
+    if (size() > bucket_count * max_load && bucket_count < (size_t{1} << 32)) {
+      buckets.compare_exchange_strong(bucket_count, bucket_count * 2);
+    }
+    return true;
+  }
+
+  template<typename Key>
+  bool lockfree_hash_set<Key>::exists(const Key& key) const {
+    epoch_domain::guard guard;
+    const auto hash = static_cast<std::uint32_t>(hash_function(key));
+    auto* bucket = find_bucket(hash & (buckets.load() - 1));
+    return find(bucket, calculate_regular_key(hash), &key).found;
+  }
+
+  template<typename Key>
+  void lockfree_hash_set<Key>::remove(const Key& key) {
+    epoch_domain::guard guard;
+    const auto hash = static_cast<std::uint32_t>(hash_function(key));
+    const auto split_order_key = calculate_regular_key(hash);
+    auto* bucket = find_bucket(hash & (buckets.load() - 1));
+
+    while (true) {
+      const auto [previous, current, found] = find(bucket, split_order_key, &key);
+      if (!found) {
+        return;
+      }
+
+      // Marking the node removes it logically, only one thread can succeed
+      auto next = current->next.load();
+      if (lockfree_detail::is_marked(next) || !current->next.compare_exchange_strong(next, next | 1)) {
+        continue;
+      }
+      add_to_size(-1);
+
+      auto expected = lockfree_detail::to_bits(current);
+      if (previous->next.compare_exchange_strong(expected, next)) {
+        epoch_domain::instance().retire(current, [](void* pointer) {
+          delete static_cast<key_node*>(pointer);
+        });
+      } else {
+        // The list changed in between, searching again unlinks the marked node
+        static_cast<void>(find(bucket, split_order_key, &key));
+      }
+      return;
+    }
+  }
+
+  template<typename Key>
+  size_t lockfree_hash_set<Key>::size() const noexcept {
+    return element_count.load(std::memory_order_relaxed);
+  }
+
+  template<typename Key>
+  size_t lockfree_hash_set<Key>::bucket_count() const noexcept {
+    return buckets.load();
+  }
+
+  template<typename Key>
+  typename lockfree_hash_set<Key>::position lockfree_hash_set<Key>::find(
+    node* start,
+    const std::uint64_t& split_order_key,
+    const Key* key
+  ) const {
+    const auto try_find = [&]() -> std::optional<position> {
+      auto* previous = start;
+      auto* current = lockfree_detail::to_pointer<node>(previous->next.load());
+      while (current != nullptr) {
+        const auto next = current->next.load();
+        if (lockfree_detail::is_marked(next)) {
+          // Only nodes holding a key are ever marked, dummy nodes stay forever
+          auto expected = lockfree_detail::to_bits(current);
+          if (!previous->next.compare_exchange_strong(expected, next & ~std::uintptr_t{1})) {
+            return std::nullopt;
+          }
+          epoch_domain::instance().retire(current, [](void* pointer) {
+            delete static_cast<key_node*>(pointer);
+          });
+          current = lockfree_detail::to_pointer<node>(next);
+          continue;
+        }
+
+        if (previous->next.load() != lockfree_detail::to_bits(current)) {
+          return std::nullopt;
+        }
+        if (current->split_order_key > split_order_key) {
+          return position{previous, current, false};
+        }
+        if (current->split_order_key == split_order_key
+          && (key == nullptr || static_cast<key_node*>(current)->key == *key)
+        ) {
+          return position{previous, current, true};
+        }
+        previous = current;
+        current = lockfree_detail::to_pointer<node>(next);
+      }
+      return position{previous, nullptr, false};
+    };
+
+    while (true) {
+      if (const auto result = try_find(); result.has_value()) {
+        return *result;
+      }
+    }
+  }
+
+  template<typename Key>
+  typename lockfree_hash_set<Key>::node* lockfree_hash_set<Key>::find_bucket(const std::uint32_t& bucket_index) const {
+    auto* bucket = find_bucket_slot(bucket_index).load();
+    return bucket != nullptr ? bucket : initialize_bucket(bucket_index);
+  }
+
+  template<typename Key>
+  typename lockfree_hash_set<Key>::node* lockfree_hash_set<Key>::initialize_bucket(
+    const std::uint32_t& bucket_index
+  ) const {
+    // The parent bucket is the bucket this one has been split from
+    const auto parent_index = bucket_index & ~(std::uint32_t{1} << (std::bit_width(bucket_index) - 1));
+    auto* parent = find_bucket(parent_index);
+    const auto split_order_key = calculate_dummy_key(bucket_index);
+
+    auto* dummy = new node(split_order_key);
+    while (true) {
+      const auto [previous, current, found] = find(parent, split_order_key, nullptr);
+      if (found) {
+        // Another thread has created the dummy node first
+        delete dummy;
+        dummy = current;
+        break;
+      }
+
+      auto expected = lockfree_detail::to_bits(current);
+      dummy->next.store(expected);
+      if (previous->next.compare_exchange_strong(expected, lockfree_detail::to_bits(dummy))) {
+        break;
+      }
+    }
+
+    find_bucket_slot(bucket_index).store(dummy);
+    return dummy;
+  }
+
+  template<typename Key>
+  typename lockfree_hash_set<Key>::bucket_t& lockfree_hash_set<Key>::find_bucket_slot(
+    const std::uint32_t& bucket_index
+  ) const {
+    const auto level = static_cast<size_t>(std::bit_width(bucket_index));
+    const auto level_size = level == 0 ? size_t{1} : size_t{1} << (level - 1);
+    const auto offset = level == 0 ? size_t{0} : bucket_index - level_size;
+
+    auto* buckets_of_level = directory[level].load();
+    if (buckets_of_level == nullptr) {
+      auto* allocated = new bucket_t[level_size]{};
+      if (directory[level].compare_exchange_strong(buckets_of_level, allocated)) {
+        buckets_of_level = allocated;
+      } else {
+        delete[] allocated;
+      }
+    }
+    return buckets_of_level[offset];
+  }
+
+  template<typename Key>
+  void lockfree_hash_set<Key>::add_to_size(const std::ptrdiff_t& difference) noexcept {
+    element_count.fetch_add(static_cast<size_t>(difference), std::memory_order_relaxed);
+  }
+
+  template<typename Key>
+  std::uint64_t lockfree_hash_set<Key>::calculate_regular_key(const std::uint32_t& hash) noexcept {
+    return (static_cast<std::uint64_t>(reverse_bits(hash)) << 1) | 1;
+  }
+
+  template<typename Key>
+  std::uint64_t lockfree_hash_set<Key>::calculate_dummy_key(const std::uint32_t& bucket_index) noexcept {
+    return static_cast<std::uint64_t>(reverse_bits(bucket_index)) << 1;
+  }
+
+  template<typename Key>
+  std::uint32_t lockfree_hash_set<Key>::reverse_bits(std::uint32_t value) noexcept {
+    value = ((value >> 1) & 0x55555555U) | ((value & 0x55555555U) << 1);
+    value = ((value >> 2) & 0x33333333U) | ((value & 0x33333333U) << 2);
+    value = ((value >> 4) & 0x0f0f0f0fU) | ((value & 0x0f0f0f0fU) << 4);
+    value = ((value >> 8) & 0x00ff00ffU) | ((value & 0x00ff00ffU) << 8);
+    return (value >> 16) | (value << 16);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,235 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+
+#include "associative/duplicate_key.hpp"
+#include "associative/concurrent/epoch_domain.hpp"
+#include "associative/map/value_not_found.hpp"
+
+namespace containers::associative {
+  template<typename Key, typename Value>
+  read_mostly_hash_map<Key, Value>::read_mostly_hash_map(
+    const std::function<hash_t(const Key&)>& hash_function,
+    const size_t& bucket_count
+  ) : hash_function(hash_function) {
+    auto initial = std::make_unique<version>();
+    const auto adjusted_bucket_count = std::bit_ceil(std::max<size_t>(bucket_count, 1));
+    for (size_t index = 0; index < adjusted_bucket_count; ++index) {
+      initial->buckets.push_back(new bucket_t());
+    }
+    current.store(initial.release());
+  }
+
+  template<typename Key, typename Value>
+  read_mostly_hash_map<Key, Value>::~read_mostly_hash_map() {
+    auto* last = current.load();
+    for (auto* bucket : last->buckets) {
+      delete bucket;
+    }
+    delete last;
+  }
+
+  template<typename Key, typename Value>
+  void read_mostly_hash_map<Key, Value>::insert(const Key& key, const Value& value) {
+    if (!insert_if_absent(key, value)) {
+      throw duplicate_key<Key>(key);
+    }
+  }
+
+  template<typename Key, typename Value>
+  void read_mostly_hash_map<Key, Value>::insert_safely(const Key& key, const Value& value) {
+    insert_if_absent(key, value);
+  }
+
+  template<typename Key, typename Value>
+  std::expected<void, container_error> read_mostly_hash_map<Key, Value>::try_insert(const Key& key, const Value& value) {
+    if (!insert_if_absent(key, value)) {
+      return std::unexpected(container_error::duplicate_key);
+    }
+    return {};
+  }
+
+  template<typename Key, typename Value>
+  bool read_mostly_hash_map<Key, Value>::insert_if_absent(const Key& key, const Value& value) {
+    std::scoped_lock lock(writer_mutex);
+    epoch_domain::guard guard;
+    auto* previous = current.load();
+    const auto hash = hash_function(key);
+    const auto bucket_index = calculate_bucket_index(hash, previous->buckets.size());
+    const auto& bucket = *previous->buckets[bucket_index];
+
+    if (find_in_bucket(bucket, key) != bucket.end()) {
+      return false;
+    }
+
+    auto updated = std::make_unique<bucket_t>(bucket);
+    updated->emplace_back(key, value, hash);
+    publish(previous, bucket_index, std::move(updated), 1);
+    return true;
+  }
+
+  template<typename Key, typename Value>
+  void read_mostly_hash_map<Key, Value>::upsert(const Key& key, const Value& value) {
+    std::scoped_lock lock(writer_mutex);
+    epoch_domain::guard guard;
+    auto* previous = current.load();
+    const auto hash = hash_function(key);
+    const auto bucket_index = calculate_bucket_index(hash, previous->buckets.size());
+    const auto& bucket = *previous->buckets[bucket_index];
+
+    auto updated = std::make_unique<bucket_t>(bucket);
+    const auto position = find_in_bucket(bucket, key);
+    if (position != bucket.end()) {
+      std::get<1>((*updated)[position - bucket.begin()]) = value;
+      publish(previous, bucket_index, std::move(updated), 0);
+    } else {
+      updated->emplace_back(key, value, hash);
+      publish(previous, bucket_index, std::move(updated), 1);
+    }
+  }
+
+  template<typename Key, typename Value>
+  std::optional<Value> read_mostly_hash_map<Key, Value>::find_by_key(const Key& key) const {
+    epoch_domain::guard guard;
+    const auto* snapshot = current.load();
+    const auto& bucket = *snapshot->buckets[calculate_bucket_index(hash_function(key), snapshot->buckets.size())];
+    const auto position = find_in_bucket(bucket, key);
+    if (position == bucket.end()) {
+      return std::nullopt;
+    }
+    return std::get<1>(*position);
+  }
+
+  template<typename Key, typename Value>
+  Value read_mostly_hash_map<Key, Value>::find_by_key_or_throw(const Key& key) const {
+    const auto& optional = find_by_key(key);
+    if (!optional.has_value()) {
+      throw value_not_found<Key>(key);
+    }
+    return optional.value();
+  }
+
+  template<typename Key, typename Value>
+  void read_mostly_hash_map<Key, Value>::remove(const Key& key) {
+    std::scoped_lock lock(writer_mutex);
+    epoch_domain::guard guard;
+    auto* previous = current.load();
+    const auto bucket_index = calculate_bucket_index(hash_function(key), previous->buckets.size());
+    const auto& bucket = *previous->buckets[bucket_index];
+    if (find_in_bucket(bucket, key) == bucket.end()) {
+      return;
+    }
+
+    auto updated = std::make_unique<bucket_t>();
+    std::ranges::copy_if(bucket, std::back_inserter(*updated), [&key](const auto& tuple) {
+      return std::get<0>(tuple) != key;
+    });
+    publish(previous, bucket_index, std::move(updated), -1);
+  }
+
+  template<typename Key, typename Value>
+  size_t read_mostly_hash_map<Key, Value>::size() const noexcept {
+    return element_count.load(std::memory_order_relaxed);
+  }
+
+  template<typename Key, typename Value>
+  size_t read_mostly_hash_map<Key, Value>::bucket_count() const {
+    epoch_domain::guard guard;
+    return current.load()->buckets.size();
+  }
+
+  template<typename Key, typename Value>
+  void read_mostly_hash_map<Key, Value>::publish(
+    version* previous,
+    const size_t& bucket_index,
+    std::unique_ptr<bucket_t> bucket,
+    const std::ptrdiff_t& difference
+  ) {
+    const auto bucket_count = previous->buckets.size();
+    const auto new_size = static_cast<double>(size() + difference);
+    auto new_bucket_count = bucket_count;
+    if (new_size / static_cast<double>(bucket_count) >= 0.75) {
+      new_bucket_count = bucket_count * 2;
+    } else if (new_size / static_cast<double>(bucket_count) <= 0.25) {
+      new_bucket_count = std::max<size_t>(bucket_count / 2, 1);
+    }
+
+    auto buckets = previous->buckets;
+    buckets[bucket_index] = bucket.get();
+    auto next = new_bucket_count == bucket_count
+      ? std::make_unique<version>(version{std::move(buckets)})
+      : create_version(buckets, new_bucket_count);
+
+    // Readers may still hold the previous version, so it is only retired after the swap
+    current.store(next.release());
+    add_to_size(difference);
+    if (new_bucket_count == bucket_count) {
+      static_cast<void>(bucket.release());
+      retire_bucket(previous->buckets[bucket_index]);
+    } else {
+      std::ranges::for_each(previous->buckets, retire_bucket);
+    }
+    retire_version(previous);
+  }
+
+  template<typename Key, typename Value>
+  std::unique_ptr<typename read_mostly_hash_map<Key, Value>::version> read_mostly_hash_map<Key, Value>::create_version(
+    const std::vector<bucket_t*>& buckets,
+    const size_t& bucket_count
+  ) const {
+    auto created = std::make_unique<version>();
+    created->buckets.reserve(bucket_count);
+    try {
+      for (size_t index = 0; index < bucket_count; ++index) {
+        created->buckets.push_back(new bucket_t());
+      }
+      for (const auto* bucket : buckets) {
+        for (const auto& tuple : *bucket) {
+          created->buckets[calculate_bucket_index(std::get<2>(tuple), bucket_count)]->push_back(tuple);
+        }
+      }
+    } catch (...) {
+      std::ranges::for_each(created->buckets, [](const bucket_t* bucket) { delete bucket; });
+      throw;
+    }
+    return created;
+  }
+
+  template<typename Key, typename Value>
+  size_t read_mostly_hash_map<Key, Value>::calculate_bucket_index(
+    const hash_t& hash,
+    const size_t& bucket_count
+  ) noexcept {
+    return static_cast<size_t>(hash) & (bucket_count - 1);
+  }
+
+  template<typename Key, typename Value>
+  typename read_mostly_hash_map<Key, Value>::bucket_t::const_iterator read_mostly_hash_map<Key, Value>::find_in_bucket(
+    const bucket_t& bucket,
+    const Key& key
+  ) {
+    return std::ranges::find_if(bucket, [&key](const auto& tuple) {
+      return std::get<0>(tuple) == key;
+    });
+  }
+
+  template<typename Key, typename Value>
+  void read_mostly_hash_map<Key, Value>::retire_bucket(bucket_t* bucket) {
+    epoch_domain::instance().retire(bucket, [](void* pointer) {
+      delete static_cast<bucket_t*>(pointer);
+    });
+  }
+
+  template<typename Key, typename Value>
+  void read_mostly_hash_map<Key, Value>::retire_version(version* retired) {
+    epoch_domain::instance().retire(retired, [](void* pointer) {
+      delete static_cast<version*>(pointer);
+    });
+  }
+
+  template<typename Key, typename Value>
+  void read_mostly_hash_map<Key, Value>::add_to_size(const std::ptrdiff_t& difference) noexcept {
+    element_count.fetch_add(static_cast<size_t>(difference), std::memory_order_relaxed);
+  }
+}
\ No newline at end of file
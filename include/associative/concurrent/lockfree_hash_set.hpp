@@ -0,0 +1,119 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+#include "associative/set/associative_set.hpp"
+
+namespace containers::associative {
+  /**
+   * @class lockfree_hash_set
+   * @brief A lock-free hash set based on a split-ordered linked list.
+   *
+   * This class provides the associative_set interface for concurrent use without any
+   * locks, following "Split-Ordered Lists: Lock-Free Extensible Hash Tables" by
+   * Shalev and Shavit.
+   *
+   * @tparam Key The type of the keys stored in the set.
+   *
+   * @details
+   * - All keys are stored in a single lock-free sorted linked list (Harris-Michael), ordered
+   *   by the bit-reversed hash. Keys of the same bucket are therefore always adjacent, and
+   *   doubling the bucket count splits every bucket without moving any node.
+   * - Every bucket is a shortcut pointer to a dummy node in the list. Buckets are created
+   *   lazily on first access by inserting their dummy node after the dummy node of their
+   *   parent bucket.
+   * - The bucket directory consists of levels of doubling size, allocated on demand.
+   * - The bucket count doubles when the average number of keys per bucket exceeds 2.
+   * - Removed nodes are unlinked by any thread that encounters them and reclaimed through
+   *   the epoch_domain once no thread can still reference them.
+   *
+   * @note All member functions are thread-safe and lock-free.
+   */
+  template<typename Key>
+  class lockfree_hash_set final : public associative_set<Key> {
+  public:
+    /**
+     * @brief Constructs an empty lockfree_hash_set with a single bucket.
+     *
+     * @param hash_function A callable object that computes the hash of a given key.
+     */
+    explicit lockfree_hash_set(const std::function<hash_t(const Key&)>& hash_function);
+
+    virtual ~lockfree_hash_set() override;
+    lockfree_hash_set(const lockfree_hash_set&) = delete;
+    lockfree_hash_set& operator=(const lockfree_hash_set&) = delete;
+
+    //! @copydoc associative_set::insert
+    virtual void insert(const Key& key) override;
+    //! @copydoc associative_set::insert_safely
+    virtual void insert_safely(const Key& key) override;
+    //! @copydoc associative_set::try_insert
+    virtual std::expected<void, container_error> try_insert(const Key& key) override;
+    //! @copydoc associative_set::exists
+    virtual bool exists(const Key& key) const override;
+    //! @copydoc associative_set::remove
+    virtual void remove(const Key& key) override;
+
+    /**
+     * @brief Returns the number of keys in the set.
+     * @return The size of the set at some point during the call.
+     */
+    [[nodiscard]] virtual size_t size() const noexcept override;
+
+    /**
+     * @brief Returns the current number of buckets.
+     * @return The bucket count, always a power of 2.
+     */
+    [[nodiscard]] size_t bucket_count() const noexcept;
+
+  private:
+    // Dummy nodes have an even split-order key, nodes holding a key an odd one
+    struct node {
+      const std::uint64_t split_order_key;
+      // Pointer to the next node, the lowest bit marks this node as logically removed
+      std::atomic<std::uintptr_t> next{0};
+
+      explicit node(const std::uint64_t& split_order_key);
+    };
+
+    struct key_node final : node {
+      const Key key;
+
+      key_node(const std::uint64_t& split_order_key, const Key& key);
+    };
+
+    struct position {
+      node* previous;
+      node* current;
+      bool found;
+    };
+
+    using bucket_t = std::atomic<node*>;
+    static constexpr size_t max_load = 2;
+    // Level 0 holds bucket 0, level i holds the buckets [2^(i - 1), 2^i)
+    static constexpr size_t directory_levels = 33;
+
+    const std::function<hash_t(const Key&)> hash_function;
+    mutable std::array<std::atomic<bucket_t*>, directory_levels> directory{};
+    std::atomic<size_t> buckets{1};
+    std::atomic<size_t> element_count{0};
+    node* head;
+
+    bool insert_if_absent(const Key& key);
+
+    [[nodiscard]] position find(node* start, const std::uint64_t& split_order_key, const Key* key) const;
+    [[nodiscard]] node* find_bucket(const std::uint32_t& bucket_index) const;
+    [[nodiscard]] node* initialize_bucket(const std::uint32_t& bucket_index) const;
+    [[nodiscard]] bucket_t& find_bucket_slot(const std::uint32_t& bucket_index) const;
+    void add_to_size(const std::ptrdiff_t& difference) noexcept;
+
+    [[nodiscard]] static std::uint64_t calculate_regular_key(const std::uint32_t& hash) noexcept;
+    [[nodiscard]] static std::uint64_t calculate_dummy_key(const std::uint32_t& bucket_index) noexcept;
+    [[nodiscard]] static std::uint32_t reverse_bits(std::uint32_t value) noexcept;
+  };
+}
+
+#include "inline/lockfree_hash_set.tpp"
\ No newline at end of file
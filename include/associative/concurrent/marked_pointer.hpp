@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+namespace containers::associative::lockfree_detail {
+  // Lock-free lists store a pointer and a mark in one word, the lowest bit marks a node as logically removed
+
+  [[nodiscard]] inline bool is_marked(const std::uintptr_t& bits) noexcept {
+    return (bits & 1) != 0;
+  }
+
+  template<typename Node>
+  [[nodiscard]] Node* to_pointer(const std::uintptr_t& bits) noexcept {
+    return reinterpret_cast<Node*>(bits & ~std::uintptr_t{1});
+  }
+
+  template<typename Node>
+  [[nodiscard]] std::uintptr_t to_bits(Node* pointer) noexcept {
+    return reinterpret_cast<std::uintptr_t>(pointer);
+  }
+}
\ No newline at end of file
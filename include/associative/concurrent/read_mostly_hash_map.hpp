@@ -0,0 +1,117 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include "associative/map/associative_map.hpp"
+
+namespace containers::associative {
+  /**
+   * @class read_mostly_hash_map
+   * @brief A thread-safe hash map for workloads with many lookups and rare modifications.
+   *
+   * This class provides the associative_map interface for concurrent use. The map is an
+   * immutable version of its buckets, published through an atomic pointer. Lookups read
+   * the current version without taking any lock, modifications build a new version and
+   * swap it in, in the style of read-copy-update.
+   *
+   * @tparam Key The type of the keys stored in the map.
+   * @tparam Value The type of the values associated with the keys.
+   *
+   * @details
+   * - Lookups are wait-free. They only pin the thread in the epoch_domain, which writes
+   *   a thread-local record and no cache line shared with other threads.
+   * - Modifications are serialized by a mutex. A modification copies the bucket
+   *   directory and the single bucket it changes, all other buckets are shared with the
+   *   previous version.
+   * - Replaced versions and buckets are freed through the epoch_domain once no lookup
+   *   can still read them.
+   * - Every modification costs O(number of buckets), so the map suits data that is read
+   *   far more often than it is written.
+   *
+   * @note All member functions are thread-safe.
+   */
+  template<typename Key, typename Value>
+  class read_mostly_hash_map final : public associative_map<Key, Value> {
+  public:
+    /**
+     * @brief Constructs an empty read_mostly_hash_map.
+     *
+     * @param hash_function A callable object that computes the hash of a given key.
+     * @param bucket_count The initial number of buckets.
+     *
+     * @details The number of buckets is adjusted to the nearest power of 2 greater than or equal to `bucket_count`.
+     */
+    explicit read_mostly_hash_map(
+      const std::function<hash_t(const Key&)>& hash_function,
+      const size_t& bucket_count = 1
+    );
+
+    virtual ~read_mostly_hash_map() override;
+    read_mostly_hash_map(const read_mostly_hash_map&) = delete;
+    read_mostly_hash_map& operator=(const read_mostly_hash_map&) = delete;
+
+    //! @copydoc associative_map::insert
+    virtual void insert(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::insert_safely
+    virtual void insert_safely(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::try_insert
+    virtual std::expected<void, container_error> try_insert(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::find_by_key
+    virtual std::optional<Value> find_by_key(const Key& key) const override;
+    //! @copydoc associative_map::find_by_key_or_throw
+    virtual Value find_by_key_or_throw(const Key& key) const override;
+    //! @copydoc associative_map::remove
+    virtual void remove(const Key& key) override;
+
+    /**
+     * @brief Inserts a key-value pair or replaces the value of an existing key.
+     * @param key The key to insert or update.
+     * @param value The value to associate with the key.
+     * @note Runtime complexity: O(number of buckets).
+     */
+    void upsert(const Key& key, const Value& value);
+
+    /**
+     * @brief Returns the number of elements in the map.
+     * @return The size of the map at some point during the call.
+     * @note Runtime complexity: O(1).
+     */
+    [[nodiscard]] virtual size_t size() const noexcept override;
+
+    /**
+     * @brief Returns the number of buckets of the current version.
+     * @return The bucket count.
+     */
+    [[nodiscard]] size_t bucket_count() const;
+
+  private:
+    using bucket_t = std::vector<std::tuple<Key, Value, hash_t>>;
+
+    // Neither a version nor its buckets are modified after they have been published
+    struct version {
+      std::vector<bucket_t*> buckets;
+    };
+
+    const std::function<hash_t(const Key&)> hash_function;
+    std::atomic<version*> current;
+    std::atomic<size_t> element_count{0};
+    std::mutex writer_mutex;
+
+    bool insert_if_absent(const Key& key, const Value& value);
+    void publish(version* previous, const size_t& bucket_index, std::unique_ptr<bucket_t> bucket, const std::ptrdiff_t& difference);
+    [[nodiscard]] std::unique_ptr<version> create_version(const std::vector<bucket_t*>& buckets, const size_t& bucket_count) const;
+    [[nodiscard]] static size_t calculate_bucket_index(const hash_t& hash, const size_t& bucket_count) noexcept;
+    [[nodiscard]] static typename bucket_t::const_iterator find_in_bucket(const bucket_t& bucket, const Key& key);
+    static void retire_bucket(bucket_t* bucket);
+    static void retire_version(version* retired);
+    void add_to_size(const std::ptrdiff_t& difference) noexcept;
+  };
+}
+
+#include "inline/read_mostly_hash_map.tpp"
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <exception>
+#include <string>
+
+namespace containers::associative {
+  /**
+   * @class durability_error
+   * @brief Thrown when a write-ahead log or checkpoint cannot be written or read back.
+   */
+  class durability_error final : public std::exception {
+  public:
+    explicit durability_error(const std::string& message);
+
+    virtual const char* what() const noexcept override;
+  private:
+    const std::string message;
+  };
+}
\ No newline at end of file
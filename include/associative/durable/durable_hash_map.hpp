@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <optional>
+#include <string_view>
+
+#include "associative/map/associative_map.hpp"
+#include "associative/map/hash_map.hpp"
+#include "associative/durable/write_ahead_log.hpp"
+#include "associative/snapshot/snapshot_format.hpp"
+
+namespace containers::associative {
+  /**
+   * @class durable_hash_map
+   * @brief A hash_map whose modifications survive restarts, kept in a write_ahead_log.
+   *
+   * Every insert, upsert and remove is appended to the log before it is applied to the map.
+   * Constructing the map on the same directory again loads the last checkpoint and replays
+   * the log behind it, which restores all operations that reached the disk.
+   *
+   * @tparam Key The type of the keys, trivially copyable or std::string.
+   * @tparam Value The type of the values, trivially copyable or std::string.
+   *
+   * @details
+   * - How many of the last operations a power loss may take is set by durability_options::level,
+   *   see durability_level. sync() makes all operations durable at once.
+   * - A checkpoint writes every key-value pair once and empties the log, which bounds both
+   *   the log size and the recovery time. It is taken every durability_options::checkpoint_interval
+   *   operations or by calling checkpoint().
+   * - Operations without effect, e.g. removing a missing key, are not logged.
+   * - Only one map may use a directory at a time.
+   *
+   * @note This class is not thread-safe.
+   */
+  template<snapshot_storable Key, snapshot_storable Value>
+  class durable_hash_map final : public associative_map<Key, Value> {
+  public:
+    /**
+     * @brief Opens the map kept in a directory, recovering its contents.
+     *
+     * @param hash_function A callable object that computes the hash of a given key.
+     * @param directory The directory of the log, created if it does not exist.
+     * @param options When to fsync and when to checkpoint.
+     * @throws durability_error If the log cannot be opened or the checkpoint is corrupt.
+     * @note Runtime complexity: O(n) in the size of the checkpoint and the log.
+     */
+    durable_hash_map(
+      const std::function<hash_t(const Key&)>& hash_function,
+      const std::filesystem::path& directory,
+      const durability_options& options = {}
+    );
+
+    //! @copydoc associative_map::insert
+    virtual void insert(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::insert_safely
+    virtual void insert_safely(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::try_insert
+    virtual std::expected<void, container_error> try_insert(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::find_by_key
+    virtual std::optional<Value> find_by_key(const Key& key) const override;
+    //! @copydoc associative_map::find_by_key_or_throw
+    virtual Value find_by_key_or_throw(const Key& key) const override;
+    //! @copydoc associative_map::remove
+    virtual void remove(const Key& key) override;
+
+    /**
+     * @brief Inserts a key-value pair or replaces the value of an existing key.
+     * @param key The key to insert or update.
+     * @param value The value to associate with the key.
+     * @note Runtime complexity: O(1) on average.
+     */
+    void upsert(const Key& key, const Value& value);
+
+    /**
+     * @brief Forces all logged operations to stable storage.
+     * @throws durability_error If the log cannot be written.
+     */
+    void sync();
+
+    /**
+     * @brief Writes the current contents as the new checkpoint and empties the log.
+     * @throws durability_error If the checkpoint cannot be written.
+     * @note Runtime complexity: O(n * b) with b buckets, since the iterators of hash_map look up
+     * every bucket by its index in the bucket list.
+     */
+    void checkpoint();
+
+    /**
+     * @brief Returns the map holding the current contents, e.g. for iteration.
+     * @return The in-memory map.
+     */
+    [[nodiscard]] const hash_map<Key, Value>& contents() const noexcept;
+
+  private:
+    enum class operation : std::uint8_t { insert = 1, upsert = 2, remove = 3 };
+
+    hash_map<Key, Value> map;
+    write_ahead_log log;
+
+    void apply(const std::uint8_t& operation_code, std::string_view payload);
+    void append(const operation& operation_code, std::string_view payload);
+    void checkpoint_if_due();
+  };
+}
+
+#include "inline/durable_hash_map.tpp"
\ No newline at end of file
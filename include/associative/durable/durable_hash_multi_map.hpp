@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <span>
+#include <string_view>
+
+#include "associative/map/associative_multi_map.hpp"
+#include "associative/map/hash_multi_map.hpp"
+#include "associative/durable/write_ahead_log.hpp"
+#include "associative/snapshot/snapshot_format.hpp"
+
+namespace containers::associative {
+  /**
+   * @class durable_hash_multi_map
+   * @brief A hash_multi_map whose modifications survive restarts, kept in a write_ahead_log.
+   *
+   * Works like durable_hash_map: every insert and remove is appended to the log before it is
+   * applied, and constructing the multi-map on the same directory again replays the last
+   * checkpoint and the log behind it.
+   *
+   * @tparam Key The type of the keys, trivially copyable or std::string.
+   * @tparam Value The type of the values, trivially copyable or std::string.
+   *
+   * @details
+   * - The values of a key are recovered in insertion order.
+   * - Operations without effect, e.g. removing a missing key, are not logged.
+   * - Only one multi-map may use a directory at a time.
+   *
+   * @note This class is not thread-safe.
+   */
+  template<snapshot_storable Key, snapshot_storable Value>
+  class durable_hash_multi_map final : public associative_multi_map<Key, Value> {
+  public:
+    /**
+     * @brief Opens the multi-map kept in a directory, recovering its contents.
+     *
+     * @param hash_function A callable object that computes the hash of a given key.
+     * @param directory The directory of the log, created if it does not exist.
+     * @param options When to fsync and when to checkpoint.
+     * @throws durability_error If the log cannot be opened or the checkpoint is corrupt.
+     * @note Runtime complexity: O(n) in the size of the checkpoint and the log.
+     */
+    durable_hash_multi_map(
+      const std::function<hash_t(const Key&)>& hash_function,
+      const std::filesystem::path& directory,
+      const durability_options& options = {}
+    );
+
+    //! @copydoc associative_multi_map::insert
+    virtual void insert(const Key& key, const Value& value) override;
+    //! @copydoc associative_multi_map::exists_by_key
+    virtual bool exists_by_key(const Key& key) const override;
+    //! @copydoc associative_multi_map::exists
+    virtual bool exists(const Key& key, const Value& value) const override;
+    //! @copydoc associative_multi_map::count
+    virtual size_t count(const Key& key) const override;
+    //! @copydoc associative_multi_map::remove_by_key
+    virtual void remove_by_key(const Key& key) override;
+    //! @copydoc associative_multi_map::remove
+    virtual void remove(const Key& key, const Value& value) override;
+
+    /**
+     * @brief Returns a view of all values associated with the specified key.
+     * @param key The key to search for.
+     * @return A contiguous view of the values in insertion order, empty if the key does not exist.
+     * @note The view is invalidated by any modification of the multi-map.
+     */
+    [[nodiscard]] std::span<const Value> values(const Key& key) const;
+
+    /**
+     * @brief Forces all logged operations to stable storage.
+     * @throws durability_error If the log cannot be written.
+     */
+    void sync();
+
+    /**
+     * @brief Writes the current contents as the new checkpoint and empties the log.
+     * @throws durability_error If the checkpoint cannot be written.
+     * @note Runtime complexity: O(n * b) with b buckets, since the iterators of hash_multi_map look up
+     * every bucket by its index in the bucket list.
+     */
+    void checkpoint();
+
+    /**
+     * @brief Returns the multi-map holding the current contents, e.g. for iteration.
+     * @return The in-memory multi-map.
+     */
+    [[nodiscard]] const hash_multi_map<Key, Value>& contents() const noexcept;
+
+  private:
+    enum class operation : std::uint8_t { insert = 1, remove_by_key = 2, remove = 3 };
+
+    hash_multi_map<Key, Value> map;
+    write_ahead_log log;
+
+    void apply(const std::uint8_t& operation_code, std::string_view payload);
+    void append(const operation& operation_code, std::string_view payload);
+    void checkpoint_if_due();
+  };
+}
+
+#include "inline/durable_hash_multi_map.tpp"
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <string>
+
+#include "associative/duplicate_key.hpp"
+#include "associative/durable/log_payload.hpp"
+
+namespace containers::associative {
+  template<snapshot_storable Key, snapshot_storable Value>
+  durable_hash_map<Key, Value>::durable_hash_map(
+    const std::function<hash_t(const Key&)>& hash_function,
+    const std::filesystem::path& directory,
+    const durability_options& options
+  ) :
+    map(hash_function),
+    log(directory, options, [this](const std::uint8_t& operation_code, std::string_view payload) {
+      apply(operation_code, payload);
+    })
+  {
+    container::number_elements = map.size();
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void durable_hash_map<Key, Value>::insert(const Key& key, const Value& value) {
+    if (!try_insert(key, value)) {
+      throw duplicate_key<Key>(key);
+    }
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void durable_hash_map<Key, Value>::insert_safely(const Key& key, const Value& value) {
+    static_cast<void>(try_insert(key, value));
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  std::expected<void, container_error> durable_hash_map<Key, Value>::try_insert(const Key& key, const Value& value) {
+    // Checked before appending, a rejected insert leaves no record in the log
+    if (map.find_by_key(key).has_value()) {
+      return std::unexpected(container_error::duplicate_key);
+    }
+    append(operation::insert, durable_detail::encode_payload(key, value));
+    map.insert(key, value);
+    container::number_elements = map.size();
+    checkpoint_if_due();
+    return {};
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  std::optional<Value> durable_hash_map<Key, Value>::find_by_key(const Key& key) const {
+    return map.find_by_key(key);
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  Value durable_hash_map<Key, Value>::find_by_key_or_throw(const Key& key) const {
+    return map.find_by_key_or_throw(key);
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void durable_hash_map<Key, Value>::remove(const Key& key) {
+    if (!map.find_by_key(key).has_value()) {
+      return;
+    }
+    append(operation::remove, durable_detail::encode_payload(key));
+    map.remove(key);
+    container::number_elements = map.size();
+    checkpoint_if_due();
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void durable_hash_map<Key, Value>::upsert(const Key& key, const Value& value) {
+    append(operation::upsert, durable_detail::encode_payload(key, value));
+    map.upsert(key, value);
+    container::number_elements = map.size();
+    checkpoint_if_due();
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void durable_hash_map<Key, Value>::sync() {
+    log.sync();
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void durable_hash_map<Key, Value>::checkpoint() {
+    log.checkpoint([this](const write_ahead_log::emit_t& emit) {
+      // Iterated on the calling thread, in bucket order
+      for (auto iterator = map.cbegin(); iterator != map.cend(); ++iterator) {
+        const auto [key, value] = *iterator;
+        emit(static_cast<std::uint8_t>(operation::insert), durable_detail::encode_payload(key, value));
+      }
+    });
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  const hash_map<Key, Value>& durable_hash_map<Key, Value>::contents() const noexcept {
+    return map;
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void durable_hash_map<Key, Value>::apply(const std::uint8_t& operation_code, std::string_view payload) {
+    switch (static_cast<operation>(operation_code)) {
+      case operation::insert:
+      case operation::upsert: {
+        const auto [key, value] = durable_detail::decode_key_value<Key, Value>(payload);
+        map.upsert(key, value);
+        break;
+      }
+      case operation::remove:
+        map.remove(durable_detail::decode_key<Key>(payload));
+        break;
+      default:
+        throw durability_error("unknown log operation " + std::to_string(operation_code));
+    }
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void durable_hash_map<Key, Value>::append(const operation& operation_code, std::string_view payload) {
+    log.append(static_cast<std::uint8_t>(operation_code), payload);
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void durable_hash_map<Key, Value>::checkpoint_if_due() {
+    // Only once the operation is applied, or the checkpoint would miss it
+    if (log.checkpoint_due()) {
+      checkpoint();
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <string>
+
+#include "associative/durable/log_payload.hpp"
+
+namespace containers::associative {
+  template<snapshot_storable Key, snapshot_storable Value>
+  durable_hash_multi_map<Key, Value>::durable_hash_multi_map(
+    const std::function<hash_t(const Key&)>& hash_function,
+    const std::filesystem::path& directory,
+    const durability_options& options
+  ) :
+    map(hash_function),
+    log(directory, options, [this](const std::uint8_t& operation_code, std::string_view payload) {
+      apply(operation_code, payload);
+    })
+  {
+    container::number_elements = map.size();
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void durable_hash_multi_map<Key, Value>::insert(const Key& key, const Value& value) {
+    append(operation::insert, durable_detail::encode_payload(key, value));
+    map.insert(key, value);
+    container::number_elements = map.size();
+    checkpoint_if_due();
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  bool durable_hash_multi_map<Key, Value>::exists_by_key(const Key& key) const {
+    return map.exists_by_key(key);
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  bool durable_hash_multi_map<Key, Value>::exists(const Key& key, const Value& value) const {
+    return map.exists(key, value);
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  size_t durable_hash_multi_map<Key, Value>::count(const Key& key) const {
+    return map.count(key);
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void durable_hash_multi_map<Key, Value>::remove_by_key(const Key& key) {
+    if (!map.exists_by_key(key)) {
+      return;
+    }
+    append(operation::remove_by_key, durable_detail::encode_payload(key));
+    map.remove_by_key(key);
+    container::number_elements = map.size();
+    checkpoint_if_due();
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void durable_hash_multi_map<Key, Value>::remove(const Key& key, const Value& value) {
+    if (!map.exists(key, value)) {
+      return;
+    }
+    append(operation::remove, durable_detail::encode_payload(key, value));
+    map.remove(key, value);
+    container::number_elements = map.size();
+    checkpoint_if_due();
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  std::span<const Value> durable_hash_multi_map<Key, Value>::values(const Key& key) const {
+    return map.values(key);
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void durable_hash_multi_map<Key, Value>::sync() {
+    log.sync();
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void durable_hash_multi_map<Key, Value>::checkpoint() {
+    log.checkpoint([this](const write_ahead_log::emit_t& emit) {
+      // Iterated on the calling thread, which keeps the values of every key in insertion order
+      for (auto iterator = map.cbegin(); iterator != map.cend(); ++iterator) {
+        const auto [key, value] = *iterator;
+        emit(static_cast<std::uint8_t>(operation::insert), durable_detail::encode_payload(key, value));
+      }
+    });
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  const hash_multi_map<Key, Value>& durable_hash_multi_map<Key, Value>::contents() const noexcept {
+    return map;
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void durable_hash_multi_map<Key, Value>::apply(const std::uint8_t& operation_code, std::string_view payload) {
+    switch (static_cast<operation>(operation_code)) {
+      case operation::insert: {
+        const auto [key, value] = durable_detail::decode_key_value<Key, Value>(payload);
+        map.insert(key, value);
+        break;
+      }
+      case operation::remove_by_key:
+        map.remove_by_key(durable_detail::decode_key<Key>(payload));
+        break;
+      case operation::remove: {
+        const auto [key, value] = durable_detail::decode_key_value<Key, Value>(payload);
+        map.remove(key, value);
+        break;
+      }
+      default:
+        throw durability_error("unknown log operation " + std::to_string(operation_code));
+    }
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void durable_hash_multi_map<Key, Value>::append(const operation& operation_code, std::string_view payload) {
+    log.append(static_cast<std::uint8_t>(operation_code), payload);
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void durable_hash_multi_map<Key, Value>::checkpoint_if_due() {
+    // Only once the operation is applied, or the checkpoint would miss it
+    if (log.checkpoint_due()) {
+      checkpoint();
+    }
+  }
+}
\ No newline at end of file
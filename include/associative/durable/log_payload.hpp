@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "associative/durable/durability_error.hpp"
+#include "associative/snapshot/snapshot_format.hpp"
+
+namespace containers::associative::durable_detail {
+  /**
+   * @brief Encodes a key as the payload of a log record, as its snapshot_codec bytes.
+   */
+  template<snapshot_storable Key>
+  [[nodiscard]] std::string encode_payload(const Key& key) {
+    return std::string(snapshot_codec<Key>::encode(key));
+  }
+
+  /**
+   * @brief Encodes a key-value pair as the payload of a log record: the key size, the key and the value.
+   */
+  template<snapshot_storable Key, snapshot_storable Value>
+  [[nodiscard]] std::string encode_payload(const Key& key, const Value& value) {
+    const auto key_bytes = snapshot_codec<Key>::encode(key);
+    const auto value_bytes = snapshot_codec<Value>::encode(value);
+    const std::uint64_t key_size = key_bytes.size();
+    auto payload = std::string();
+    payload.reserve(sizeof(key_size) + key_bytes.size() + value_bytes.size());
+    payload.append(reinterpret_cast<const char*>(&key_size), sizeof(key_size));
+    payload.append(key_bytes);
+    payload.append(value_bytes);
+    return payload;
+  }
+
+  template<snapshot_storable T>
+  [[nodiscard]] T decode_field(std::string_view bytes) {
+    if (snapshot_codec<T>::fixed_size != 0 && bytes.size() != snapshot_codec<T>::fixed_size) {
+      throw durability_error("log record of " + std::to_string(bytes.size()) + " bytes does not hold the logged type");
+    }
+    return T(snapshot_codec<T>::decode(bytes.data(), bytes.size()));
+  }
+
+  /**
+   * @brief Decodes a payload written by encode_payload(key).
+   * @throws durability_error If the payload does not hold a Key.
+   */
+  template<snapshot_storable Key>
+  [[nodiscard]] Key decode_key(std::string_view payload) {
+    return decode_field<Key>(payload);
+  }
+
+  /**
+   * @brief Decodes a payload written by encode_payload(key, value).
+   * @throws durability_error If the payload does not hold a Key and a Value.
+   */
+  template<snapshot_storable Key, snapshot_storable Value>
+  [[nodiscard]] std::pair<Key, Value> decode_key_value(std::string_view payload) {
+    std::uint64_t key_size = 0;
+    if (payload.size() < sizeof(key_size)) {
+      throw durability_error("log record is too short for a key-value pair");
+    }
+    std::memcpy(&key_size, payload.data(), sizeof(key_size));
+    payload.remove_prefix(sizeof(key_size));
+    if (key_size > payload.size()) {
+      throw durability_error("log record is too short for its key");
+    }
+    return {decode_field<Key>(payload.substr(0, key_size)), decode_field<Value>(payload.substr(key_size))};
+  }
+}
\ No newline at end of file
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include "container.hpp"
+
+namespace containers::associative {
+  /**
+   * @brief When appended records are forced to stable storage.
+   */
+  enum class durability_level : std::uint8_t {
+    //! Every record is handed to the operating system right away but never fsync'd, survives a crash of the process only.
+    none,
+    //! Every record is handed to the operating system right away, but fsync'd together with its group once
+    //! the group is full or its oldest record is too old. A crash of the process loses nothing, a power loss
+    //! the records of the last group.
+    group_commit,
+    //! Every record is written and fsync'd before append() returns.
+    every_operation
+  };
+
+  /**
+   * @brief Configures a write_ahead_log.
+   */
+  struct durability_options {
+    durability_level level = durability_level::group_commit;
+    //! The number of records fsync'd together with durability_level::group_commit.
+    size_t group_size = 64;
+    //! The longest time a record waits for the fsync of its group with durability_level::group_commit.
+    //! It is only checked when the next record is appended, so to bound the loss of a power failure while
+    //! appends pause, the caller has to call sync() itself, e.g. from a timer every group_delay.
+    std::chrono::milliseconds group_delay{10};
+    //! The number of records after which checkpoint_due() becomes true, 0 to checkpoint manually only.
+    size_t checkpoint_interval = 0;
+  };
+
+  /**
+   * @brief Fixed-size header in front of the payload of every log record.
+   *
+   * The checksum covers the other header fields and the payload, so a record torn by a
+   * crash in the middle of a write is recognized and ends the log.
+   */
+  struct log_record_header {
+    std::uint64_t sequence;
+    std::uint32_t payload_size;
+    std::uint32_t checksum;
+    std::uint8_t operation;
+    std::array<std::uint8_t, 7> reserved;
+  };
+
+  /**
+   * @brief Fixed-size header at the start of the log and of the checkpoint file.
+   *
+   * For a checkpoint, `sequence` is the last log record the checkpoint contains.
+   */
+  struct log_file_header {
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    std::uint32_t endianness;
+    std::uint64_t sequence;
+  };
+
+  constexpr std::array<char, 8> log_magic{'C', 'T', 'N', 'R', 'W', 'L', 'O', 'G'};
+  constexpr std::array<char, 8> checkpoint_magic{'C', 'T', 'N', 'R', 'C', 'K', 'P', 'T'};
+  constexpr std::uint32_t log_version = 1;
+
+  /**
+   * @class write_ahead_log
+   * @brief An append-only log of operations with periodic checkpoints, kept in a directory.
+   *
+   * Containers log every modification before applying it. On startup, the checkpoint and
+   * all records appended after it are replayed, which restores the state at the last
+   * record that reached the disk.
+   *
+   * @details
+   * - The directory holds the file `checkpoint`, the compacted state as of some sequence
+   *   number, and the file `log`, the records appended since.
+   * - Every record carries a sequence number. A checkpoint is written next to the old one,
+   *   fsync'd and renamed into place before the log is truncated, so after a crash in
+   *   between the records it already contains are recognized by their sequence and skipped.
+   * - Records are opaque: an operation code and payload bytes chosen by the container.
+   * - A torn or corrupt record ends the log, it and everything behind it are cut off on recovery.
+   *
+   * @note This class is not thread-safe.
+   */
+  class write_ahead_log final {
+  public:
+    using apply_t = std::function<void(std::uint8_t operation, std::string_view payload)>;
+    using emit_t = std::function<void(std::uint8_t operation, std::string_view payload)>;
+
+    /**
+     * @brief Opens the log in a directory, replaying the checkpoint and the log tail.
+     *
+     * @param directory The directory of the log, created if it does not exist.
+     * @param options When to fsync and when to checkpoint.
+     * @param apply Called for every recovered record in order.
+     * @throws durability_error If the files cannot be opened or the checkpoint is corrupt.
+     */
+    write_ahead_log(const std::filesystem::path& directory, const durability_options& options, const apply_t& apply);
+    /**
+     * @brief Fsyncs the records of the last group, then closes the log.
+     */
+    ~write_ahead_log();
+
+    write_ahead_log(const write_ahead_log&) = delete;
+    write_ahead_log& operator=(const write_ahead_log&) = delete;
+
+    /**
+     * @brief Appends a record.
+     * @param operation The operation code, passed back on replay.
+     * @param payload The bytes of the operation, passed back on replay.
+     * @throws durability_error If the record cannot be written.
+     * @note The record has been handed to the operating system when this returns, but it is only
+     * durable with durability_level::every_operation or once sync() returns.
+     */
+    void append(const std::uint8_t& operation, std::string_view payload);
+
+    /**
+     * @brief Fsyncs all appended records, whatever the durability level.
+     * @throws durability_error If the records cannot be written.
+     */
+    void sync();
+
+    /**
+     * @brief Replaces the checkpoint with the current state and empties the log.
+     * @param write_state Called once with a function emitting records which, replayed in
+     * order, rebuild the current state.
+     * @throws durability_error If the checkpoint cannot be written, the previous checkpoint
+     * and the log then stay valid.
+     */
+    void checkpoint(const std::function<void(const emit_t&)>& write_state);
+
+    /**
+     * @brief Checks whether enough records have been appended since the last checkpoint.
+     * @return True if a checkpoint interval is configured and has been reached.
+     */
+    [[nodiscard]] bool checkpoint_due() const noexcept;
+
+    /**
+     * @brief Returns the sequence number of the last appended record.
+     * @return The sequence number, 0 if no record has been appended yet.
+     */
+    [[nodiscard]] std::uint64_t last_sequence() const noexcept;
+
+  private:
+    const std::filesystem::path directory;
+    const durability_options options;
+    int descriptor = -1;
+    std::uint64_t sequence = 0;
+    size_t records_since_checkpoint = 0;
+    std::string pending;
+    size_t unsynced_records = 0;
+    std::chrono::steady_clock::time_point oldest_unsynced;
+
+    [[nodiscard]] std::filesystem::path log_path() const;
+    [[nodiscard]] std::filesystem::path checkpoint_path() const;
+    [[nodiscard]] std::uint64_t recover_checkpoint(const apply_t& apply);
+    void recover_log(const std::uint64_t& checkpoint_sequence, const apply_t& apply);
+    void write_pending();
+  };
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "container.hpp"
+
+namespace containers::associative {
+  /**
+   * @class bloom_filter
+   * @brief A blocked bloom filter for fast negative membership queries.
+   *
+   * A bloom filter answers whether a key may have been inserted. A negative answer
+   * is always correct, a positive answer is wrong with a small false-positive rate
+   * that shrinks with the number of bits spent per key.
+   *
+   * @tparam Key The type of the keys inserted into the filter.
+   *
+   * @details
+   * - The filter is split into cache-line sized blocks of eight 64 bit words. A key
+   *   selects one block and sets exactly one bit in every word of it, so each
+   *   operation touches a single cache line.
+   * - The eight bit positions are computed with the same multiply-shift on every
+   *   word, which compilers turn into SIMD instructions.
+   * - The hash function has the same signature as the one of the hash containers,
+   *   so a filter can share it with the container it is placed in front of.
+   * - Keys cannot be removed. size() returns the number of insertions.
+   *
+   * @note This class is not thread-safe.
+   */
+  template<typename Key>
+  class bloom_filter final : public container {
+  public:
+    static constexpr size_t words_per_block = 8;
+    static constexpr size_t bits_per_block = words_per_block * 64;
+
+    /**
+     * @brief Constructs an empty bloom filter sized for the expected number of keys.
+     *
+     * @param hash_function A callable object that computes the hash of a given key.
+     * @param expected_elements The number of keys the filter is sized for.
+     * @param bits_per_key The number of bits reserved per expected key.
+     *
+     * @details The number of blocks is rounded up, a filter always has at least one block.
+     */
+    bloom_filter(
+      const std::function<hash_t(const Key&)>& hash_function,
+      const size_t& expected_elements,
+      const size_t& bits_per_key = 10
+    );
+
+    /**
+     * @brief Inserts a key into the filter.
+     * @param key The key to insert.
+     * @note Runtime complexity: O(1).
+     */
+    void insert(const Key& key);
+
+    /**
+     * @brief Inserts a key into the filter using its precomputed hash.
+     * @param hash The hash of the key, as computed by the hash function of this filter.
+     * @note Runtime complexity: O(1).
+     */
+    void insert_hash(const hash_t& hash);
+
+    /**
+     * @brief Checks whether a key may have been inserted.
+     * @param key The key to search for.
+     * @return False if the key has definitely not been inserted, true otherwise.
+     * @note Runtime complexity: O(1).
+     */
+    [[nodiscard]] bool might_contain(const Key& key) const;
+
+    /**
+     * @brief Checks whether a key may have been inserted using its precomputed hash.
+     * @param hash The hash of the key, as computed by the hash function of this filter.
+     * @return False if the key has definitely not been inserted, true otherwise.
+     * @note Runtime complexity: O(1).
+     */
+    [[nodiscard]] bool might_contain_hash(const hash_t& hash) const noexcept;
+
+    /**
+     * @brief Removes all keys from the filter.
+     * @note Runtime complexity: O(m) with m being the number of blocks.
+     */
+    void clear() noexcept;
+
+    /**
+     * @brief Returns the memory used by the bit array.
+     * @return The size of all blocks in bytes.
+     */
+    [[nodiscard]] size_t memory_usage() const noexcept;
+
+  private:
+    struct alignas(64) block_t {
+      std::array<std::uint64_t, words_per_block> words{};
+    };
+
+    const std::function<hash_t(const Key&)> hash_function;
+    std::vector<block_t> blocks;
+
+    [[nodiscard]] static block_t create_mask(const std::uint64_t& mixed_hash) noexcept;
+    [[nodiscard]] size_t calculate_block_index(const std::uint64_t& mixed_hash) const noexcept;
+  };
+}
+
+#include "inline/bloom_filter.tpp"
\ No newline at end of file
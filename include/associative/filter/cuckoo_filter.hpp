@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "container.hpp"
+
+namespace containers::associative {
+  /**
+   * @class cuckoo_filter
+   * @brief A cuckoo filter for fast negative membership queries with support for removal.
+   *
+   * Like a bloom filter, a cuckoo filter answers whether a key may have been inserted,
+   * with no false negatives and a small false-positive rate. Unlike a bloom filter,
+   * previously inserted keys can be removed again.
+   *
+   * @tparam Key The type of the keys inserted into the filter.
+   *
+   * @details
+   * - The filter stores a 16 bit fingerprint of every key in one of two candidate
+   *   buckets of four slots each (partial-key cuckoo hashing).
+   * - The second bucket is derived from the first bucket and the fingerprint alone,
+   *   so fingerprints can be relocated without knowing their keys.
+   * - When both buckets are full, resident fingerprints are kicked to their alternative
+   *   bucket. If this fails after a bounded number of kicks, the filter is full and
+   *   rejects further insertions.
+   * - The hash function has the same signature as the one of the hash containers.
+   *
+   * @note Only remove keys that have been inserted before, otherwise the fingerprint
+   * of a different key may be removed.
+   * @note This class is not thread-safe.
+   */
+  template<typename Key>
+  class cuckoo_filter final : public container {
+  public:
+    using fingerprint_t = std::uint16_t;
+    static constexpr size_t slots_per_bucket = 4;
+    static constexpr size_t max_kicks = 500;
+
+    /**
+     * @brief Constructs an empty cuckoo filter sized for the specified number of keys.
+     *
+     * @param hash_function A callable object that computes the hash of a given key.
+     * @param capacity The number of keys the filter should be able to hold.
+     *
+     * @details The number of buckets is rounded up to a power of 2, such that the
+     * capacity is reached at a load of at most 95%.
+     */
+    cuckoo_filter(const std::function<hash_t(const Key&)>& hash_function, const size_t& capacity);
+
+    /**
+     * @brief Inserts a key into the filter.
+     * @param key The key to insert.
+     * @return True if the key has been inserted, false if the filter is full.
+     * @note Runtime complexity: O(1) amortized.
+     */
+    bool insert(const Key& key);
+
+    /**
+     * @brief Checks whether a key may have been inserted.
+     * @param key The key to search for.
+     * @return False if the key has definitely not been inserted, true otherwise.
+     * @note Runtime complexity: O(1).
+     */
+    [[nodiscard]] bool might_contain(const Key& key) const;
+
+    /**
+     * @brief Removes one occurrence of a previously inserted key.
+     * @param key The key to remove.
+     * @return True if a matching fingerprint has been removed, false otherwise.
+     * @note Runtime complexity: O(1).
+     */
+    bool remove(const Key& key);
+
+    /**
+     * @brief Returns the fraction of occupied slots.
+     * @return The load factor between 0 and 1.
+     */
+    [[nodiscard]] double load_factor() const noexcept;
+
+    /**
+     * @brief Returns the memory used by the fingerprint table.
+     * @return The size of all buckets in bytes.
+     */
+    [[nodiscard]] size_t memory_usage() const noexcept;
+
+  private:
+    using bucket_t = std::array<fingerprint_t, slots_per_bucket>;
+    static constexpr fingerprint_t empty_slot = 0;
+
+    const std::function<hash_t(const Key&)> hash_function;
+    std::vector<bucket_t> buckets;
+    // Fingerprint evicted by the last failed insertion, it still counts as inserted
+    std::optional<std::pair<size_t, fingerprint_t>> victim;
+
+    [[nodiscard]] std::pair<size_t, fingerprint_t> calculate_index_and_fingerprint(const Key& key) const;
+    [[nodiscard]] size_t calculate_alternative_index(const size_t& index, const fingerprint_t& fingerprint) const noexcept;
+    [[nodiscard]] bool bucket_contains(const size_t& index, const fingerprint_t& fingerprint) const noexcept;
+    bool try_insert_into_bucket(const size_t& index, const fingerprint_t& fingerprint) noexcept;
+    bool try_remove_from_bucket(const size_t& index, const fingerprint_t& fingerprint) noexcept;
+  };
+}
+
+#include "inline/cuckoo_filter.tpp"
\ No newline at end of file
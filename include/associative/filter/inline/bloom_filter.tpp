@@ -0,0 +1,84 @@
+#pragma once
+
+#include <algorithm>
+
+#include "associative/hash_mix.hpp"
+
+namespace containers::associative {
+  template<typename Key>
+  bloom_filter<Key>::bloom_filter(
+    const std::function<hash_t(const Key&)>& hash_function,
+    const size_t& expected_elements,
+    const size_t& bits_per_key
+  ) :
+    hash_function(hash_function),
+    blocks(std::max<size_t>((expected_elements * bits_per_key + bits_per_block - 1) / bits_per_block, 1))
+  {}
+
+  template<typename Key>
+  void bloom_filter<Key>::insert(const Key& key) {
+    insert_hash(hash_function(key));
+  }
+
+  template<typename Key>
+  void bloom_filter<Key>::insert_hash(const hash_t& hash) {
+    const auto mixed_hash = mix_hash(hash);
+    const auto mask = create_mask(mixed_hash);
+    auto& block = blocks[calculate_block_index(mixed_hash)];
+    for (size_t word = 0; word < words_per_block; ++word) {
+      block.words[word] |= mask.words[word];
+    }
+    container::number_elements++;
+  }
+
+  template<typename Key>
+  bool bloom_filter<Key>::might_contain(const Key& key) const {
+    return might_contain_hash(hash_function(key));
+  }
+
+  template<typename Key>
+  bool bloom_filter<Key>::might_contain_hash(const hash_t& hash) const noexcept {
+    const auto mixed_hash = mix_hash(hash);
+    const auto mask = create_mask(mixed_hash);
+    const auto& block = blocks[calculate_block_index(mixed_hash)];
+    // Accumulating all words without early exit keeps the loop branch-free and vectorizable
+    std::uint64_t missing = 0;
+    for (size_t word = 0; word < words_per_block; ++word) {
+      missing |= mask.words[word] & ~block.words[word];
+    }
+    return missing == 0;
+  }
+
+  template<typename Key>
+  void bloom_filter<Key>::clear() noexcept {
+    std::ranges::fill(blocks, block_t{});
+    container::number_elements = 0;
+  }
+
+  template<typename Key>
+  size_t bloom_filter<Key>::memory_usage() const noexcept {
+    return blocks.size() * sizeof(block_t);
+  }
+
+  template<typename Key>
+  typename bloom_filter<Key>::block_t bloom_filter<Key>::create_mask(const std::uint64_t& mixed_hash) noexcept {
+    // Arbitrary odd constants, one independent multiply-shift hash per word
+    static constexpr std::array<std::uint64_t, words_per_block> salts{
+      0x47b6137b44974d91ULL, 0x8824ad5ba2b7289dULL, 0x705495c72df1424bULL, 0x9efc49475c6bfb31ULL,
+      0x1c8c5b5d3f5d6e8bULL, 0x2df1424b9efc4947ULL, 0xa2b7289d47b6137bULL, 0x5c6bfb318824ad5bULL
+    };
+
+    block_t mask;
+    const auto seed = mixed_hash | 1;
+    for (size_t word = 0; word < words_per_block; ++word) {
+      mask.words[word] = std::uint64_t{1} << ((seed * salts[word]) >> 58);
+    }
+    return mask;
+  }
+
+  template<typename Key>
+  size_t bloom_filter<Key>::calculate_block_index(const std::uint64_t& mixed_hash) const noexcept {
+    // Maps the high half of the hash onto [0, blocks) without a division
+    return static_cast<size_t>(((mixed_hash >> 32) * blocks.size()) >> 32);
+  }
+}
\ No newline at end of file
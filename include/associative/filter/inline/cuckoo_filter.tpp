@@ -0,0 +1,149 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+
+#include "associative/hash_mix.hpp"
+
+namespace containers::associative {
+  template<typename Key>
+  cuckoo_filter<Key>::cuckoo_filter(
+    const std::function<hash_t(const Key&)>& hash_function,
+    const size_t& capacity
+  ) :
+    hash_function(hash_function),
+    buckets(std::bit_ceil(std::max<size_t>(
+      static_cast<size_t>(static_cast<double>(capacity) / 0.95 / slots_per_bucket) + 1,
+      1
+    )))
+  {}
+
+  template<typename Key>
+  bool cuckoo_filter<Key>::insert(const Key& key) {
+    if (victim.has_value()) {
+      return false;
+    }
+
+    auto [index, fingerprint] = calculate_index_and_fingerprint(key);
+    if (try_insert_into_bucket(index, fingerprint)
+      || try_insert_into_bucket(calculate_alternative_index(index, fingerprint), fingerprint)
+    ) {
+      container::number_elements++;
+      return true;
+    }
+
+    // Both buckets are full, relocate resident fingerprints to make room
+    for (size_t kick = 0; kick < max_kicks; ++kick) {
+      const auto slot = (fingerprint + kick) % slots_per_bucket;
+      std::swap(fingerprint, buckets[index][slot]);
+      index = calculate_alternative_index(index, fingerprint);
+      if (try_insert_into_bucket(index, fingerprint)) {
+        container::number_elements++;
+        return true;
+      }
+    }
+
+    victim = std::make_pair(index, fingerprint);
+    container::number_elements++;
+    return true;
+  }
+
+  template<typename Key>
+  bool cuckoo_filter<Key>::might_contain(const Key& key) const {
+    const auto [index, fingerprint] = calculate_index_and_fingerprint(key);
+    const auto alternative_index = calculate_alternative_index(index, fingerprint);
+    if (victim.has_value()
+      && victim->second == fingerprint
+      && (victim->first == index || victim->first == alternative_index)
+    ) {
+      return true;
+    }
+    return bucket_contains(index, fingerprint) || bucket_contains(alternative_index, fingerprint);
+  }
+
+  template<typename Key>
+  bool cuckoo_filter<Key>::remove(const Key& key) {
+    const auto [index, fingerprint] = calculate_index_and_fingerprint(key);
+    const auto alternative_index = calculate_alternative_index(index, fingerprint);
+
+    if (try_remove_from_bucket(index, fingerprint) || try_remove_from_bucket(alternative_index, fingerprint)) {
+      container::number_elements--;
+      // A slot got free, so the victim may fit again
+      if (victim.has_value()) {
+        const auto [victim_index, victim_fingerprint] = *victim;
+        if (try_insert_into_bucket(victim_index, victim_fingerprint)
+          || try_insert_into_bucket(calculate_alternative_index(victim_index, victim_fingerprint), victim_fingerprint)
+        ) {
+          victim.reset();
+        }
+      }
+      return true;
+    }
+
+    if (victim.has_value()
+      && victim->second == fingerprint
+      && (victim->first == index || victim->first == alternative_index)
+    ) {
+      victim.reset();
+      container::number_elements--;
+      return true;
+    }
+    return false;
+  }
+
+  template<typename Key>
+  double cuckoo_filter<Key>::load_factor() const noexcept {
+    return static_cast<double>(container::number_elements)
+      / static_cast<double>(buckets.size() * slots_per_bucket);
+  }
+
+  template<typename Key>
+  size_t cuckoo_filter<Key>::memory_usage() const noexcept {
+    return buckets.size() * sizeof(bucket_t);
+  }
+
+  template<typename Key>
+  std::pair<size_t, typename cuckoo_filter<Key>::fingerprint_t> cuckoo_filter<Key>::calculate_index_and_fingerprint(
+    const Key& key
+  ) const {
+    const auto mixed_hash = mix_hash(hash_function(key));
+    const auto index = static_cast<size_t>(mixed_hash) & (buckets.size() - 1);
+    const auto fingerprint = static_cast<fingerprint_t>(mixed_hash >> 48);
+    // A fingerprint of 0 marks an empty slot
+    return std::make_pair(index, fingerprint == empty_slot ? fingerprint_t{1} : fingerprint);
+  }
+
+  template<typename Key>
+  size_t cuckoo_filter<Key>::calculate_alternative_index(
+    const size_t& index,
+    const fingerprint_t& fingerprint
+  ) const noexcept {
+    // XOR keeps the mapping symmetric: the alternative of the alternative is the original index
+    return (index ^ static_cast<size_t>(mix_hash(fingerprint))) & (buckets.size() - 1);
+  }
+
+  template<typename Key>
+  bool cuckoo_filter<Key>::bucket_contains(const size_t& index, const fingerprint_t& fingerprint) const noexcept {
+    return std::ranges::find(buckets[index], fingerprint) != buckets[index].end();
+  }
+
+  template<typename Key>
+  bool cuckoo_filter<Key>::try_insert_into_bucket(const size_t& index, const fingerprint_t& fingerprint) noexcept {
+    const auto slot = std::ranges::find(buckets[index], empty_slot);
+    if (slot == buckets[index].end()) {
+      return false;
+    }
+    *slot = fingerprint;
+    return true;
+  }
+
+  template<typename Key>
+  bool cuckoo_filter<Key>::try_remove_from_bucket(const size_t& index, const fingerprint_t& fingerprint) noexcept {
+    const auto slot = std::ranges::find(buckets[index], fingerprint);
+    if (slot == buckets[index].end()) {
+      return false;
+    }
+    *slot = empty_slot;
+    return true;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+
+#include "container.hpp"
+
+namespace containers::associative {
+  /**
+   * @brief Spreads a hash over 64 well-mixed bits (SplitMix64 finalizer).
+   *
+   * User-provided hash functions only return a hash_t, whose low bits are often
+   * poorly distributed (e.g. the identity hash of integers). Probabilistic
+   * structures derive several independent indices from one hash, so they mix it first.
+   *
+   * @param hash The hash to mix.
+   * @param seed A seed to derive independent mixes of the same hash.
+   * @return The mixed 64 bit value.
+   */
+  [[nodiscard]] constexpr std::uint64_t mix_hash(const hash_t& hash, const std::uint64_t& seed = 0) noexcept {
+    auto mixed = static_cast<std::uint64_t>(static_cast<std::uint32_t>(hash)) + (seed + 1) * 0x9e3779b97f4a7c15ULL;
+    mixed = (mixed ^ (mixed >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    mixed = (mixed ^ (mixed >> 27)) * 0x94d049bb133111ebULL;
+    return mixed ^ (mixed >> 31);
+  }
+}
\ No newline at end of file
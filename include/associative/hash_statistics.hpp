@@ -0,0 +1,118 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+#include "container.hpp"
+
+namespace containers::associative {
+  /**
+   * @brief A snapshot of the shape and the history of a hash container, see hash_map::stats().
+   *
+   * Chains are the entries of one bucket. For hash_multi_map an entry is a key with all its
+   * values, as a lookup compares keys only.
+   */
+  struct hash_statistics {
+    size_t element_count = 0;
+    size_t bucket_count = 0;
+    //! Entries per bucket, the value the containers keep between 0.25 and 0.75.
+    double load_factor = 0;
+    //! The number of buckets by chain length, index 0 counts the empty buckets.
+    std::vector<size_t> chain_length_histogram;
+    size_t max_chain_length = 0;
+    double empty_bucket_ratio = 0;
+    //! The number of times all entries have been redistributed over new buckets.
+    size_t rehash_count = 0;
+    std::chrono::nanoseconds rehash_time{0};
+    //! Approximate heap bytes of buckets, nodes and their shared_ptr control blocks per element.
+    double bytes_per_element = 0;
+    size_t hit_count = 0;
+    size_t miss_count = 0;
+    //! Keys compared by lookups which found their key.
+    size_t hit_probe_count = 0;
+    //! Keys compared by lookups which did not find their key.
+    size_t miss_probe_count = 0;
+  };
+
+  /**
+   * @class hash_statistics_counters
+   * @brief The event counters behind hash_statistics, kept by hash containers with statistics enabled.
+   *
+   * The disabled specialization is empty and its functions do nothing, so containers declare
+   * it `[[no_unique_address]]` and call it unconditionally at no cost.
+   *
+   * @tparam Enabled Whether events are counted.
+   */
+  template<bool Enabled>
+  class hash_statistics_counters;
+
+  template<>
+  class hash_statistics_counters<false> {
+  public:
+    struct rehash_start {};
+
+    void count_lookup(const bool&, const size_t&) noexcept {}
+    [[nodiscard]] rehash_start start_rehash() const noexcept { return {}; }
+    void count_rehash(const rehash_start&) noexcept {}
+  };
+
+  template<>
+  class hash_statistics_counters<true> {
+  public:
+    using rehash_start = std::chrono::steady_clock::time_point;
+
+    /**
+     * @brief Counts a lookup.
+     * @param hit Whether the key has been found.
+     * @param probes The number of keys compared.
+     */
+    void count_lookup(const bool& hit, const size_t& probes) noexcept;
+
+    /**
+     * @brief Returns the start time of a rehash, to pass to count_rehash() once it is done.
+     * @return The current time.
+     */
+    [[nodiscard]] rehash_start start_rehash() const noexcept;
+
+    /**
+     * @brief Counts a finished rehash and its duration.
+     * @param start The value returned by start_rehash() before the rehash.
+     */
+    void count_rehash(const rehash_start& start) noexcept;
+
+    /**
+     * @brief Copies the counters into statistics.
+     * @param statistics The statistics to fill in.
+     */
+    void write_to(hash_statistics& statistics) const noexcept;
+
+  private:
+    size_t rehash_count = 0;
+    std::chrono::nanoseconds rehash_time{0};
+    size_t hit_count = 0;
+    size_t miss_count = 0;
+    size_t hit_probe_count = 0;
+    size_t miss_probe_count = 0;
+  };
+
+  /**
+   * @brief Measures the buckets of a hash container and combines them with its counters.
+   *
+   * @param buckets The bucket directory, a doubly_linked_list of doubly_linked_list chains.
+   * @param element_count The number of elements of the container.
+   * @param extra_bytes Heap bytes beyond buckets and nodes, e.g. the value arrays of hash_multi_map.
+   * @param counters The event counters of the container.
+   * @return The statistics.
+   * @note Runtime complexity: O(number of buckets).
+   */
+  template<typename Buckets>
+  [[nodiscard]] hash_statistics collect_hash_statistics(
+    const Buckets& buckets,
+    const size_t& element_count,
+    const size_t& extra_bytes,
+    const hash_statistics_counters<true>& counters
+  );
+}
+
+#include "inline/hash_statistics.tpp"
\ No newline at end of file
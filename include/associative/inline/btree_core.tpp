@@ -0,0 +1,485 @@
+#pragma once
+
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include "associative/duplicate_key.hpp"
+
+namespace containers::associative {
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  btree_core<Key, Payload, Capacity, Counted>::btree_core() : root_node(std::make_unique<leaf_node>()) {}
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  template<typename Update>
+  bool btree_core<Key, Payload, Capacity, Counted>::insert(const Key& key, const Payload& payload, const Update& update) {
+    auto inserted = false;
+    auto added = size_t{0};
+    auto split = insert_into(root_node.get(), key, payload, update, inserted, added);
+    if (split.has_value()) {
+      // The tree only grows at the root, so all leaves stay at the same depth
+      auto new_root = std::make_unique<inner_node>();
+      if constexpr (Counted) {
+        new_root->totals[0] = subtree_total(root_node.get());
+        new_root->totals[1] = split->right_total;
+      }
+      new_root->keys[0] = std::move(split->separator);
+      new_root->children[0] = std::move(root_node);
+      new_root->children[1] = std::move(split->right);
+      new_root->count = 1;
+      root_node = std::move(new_root);
+    }
+    return inserted;
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  template<typename Shrink>
+  bool btree_core<Key, Payload, Capacity, Counted>::remove(const Key& key, const Shrink& shrink) {
+    if (!remove_from(root_node.get(), key, shrink).has_value()) {
+      return false;
+    }
+
+    // A root left with a single child is replaced by it, which is how the tree shrinks
+    if (!root_node->leaf && root_node->count == 0) {
+      auto child = std::move(static_cast<inner_node*>(root_node.get())->children[0]);
+      root_node = std::move(child);
+    }
+    return true;
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  template<std::ranges::input_range Range>
+  size_t btree_core<Key, Payload, Capacity, Counted>::build_from_sorted(Range&& pairs) requires (!Counted) {
+    // The nodes of the level being built, with the smallest key below each of them
+    auto level = std::vector<std::unique_ptr<node>>();
+    auto minimums = std::vector<Key>();
+    leaf_node* last = nullptr;
+    auto count = size_t{0};
+
+    for (const auto& pair : pairs) {
+      const auto& key = std::get<0>(pair);
+      if (last != nullptr && !(last->keys[last->count - 1] < key)) {
+        if (!(key < last->keys[last->count - 1])) {
+          throw duplicate_key<Key>(key);
+        }
+        throw std::invalid_argument("the keys passed to build_from_sorted must be sorted");
+      }
+      if (last == nullptr || last->count == Capacity) {
+        auto leaf = std::make_unique<leaf_node>();
+        if (last != nullptr) {
+          last->next = leaf.get();
+        }
+        last = leaf.get();
+        minimums.push_back(key);
+        level.push_back(std::move(leaf));
+      }
+      last->keys[last->count] = key;
+      last->payloads[last->count] = std::get<1>(pair);
+      last->count++;
+      count++;
+    }
+
+    if (level.size() > 1 && last->count < min_count) {
+      auto* previous = static_cast<leaf_node*>(level[level.size() - 2].get());
+      const auto missing = min_count - last->count;
+      std::move_backward(last->keys.begin(), last->keys.begin() + last->count, last->keys.begin() + min_count);
+      std::move_backward(last->payloads.begin(), last->payloads.begin() + last->count, last->payloads.begin() + min_count);
+      std::move(previous->keys.begin() + (Capacity - missing), previous->keys.end(), last->keys.begin());
+      std::move(previous->payloads.begin() + (Capacity - missing), previous->payloads.end(), last->payloads.begin());
+      previous->count -= missing;
+      last->count = min_count;
+      minimums.back() = last->keys[0];
+    }
+
+    while (level.size() > 1) {
+      auto parents = std::vector<std::unique_ptr<node>>();
+      auto parent_minimums = std::vector<Key>();
+      inner_node* parent = nullptr;
+      for (size_t index = 0; index < level.size(); ++index) {
+        if (parent == nullptr || parent->count == Capacity) {
+          auto created = std::make_unique<inner_node>();
+          parent = created.get();
+          parent->children[0] = std::move(level[index]);
+          parent_minimums.push_back(std::move(minimums[index]));
+          parents.push_back(std::move(created));
+        } else {
+          parent->keys[parent->count] = std::move(minimums[index]);
+          parent->children[parent->count + 1] = std::move(level[index]);
+          parent->count++;
+        }
+      }
+
+      if (parents.size() > 1 && parent->count < min_count) {
+        // Rotates children of the full neighbour over, the separator passing through parent_minimums
+        auto* previous = static_cast<inner_node*>(parents[parents.size() - 2].get());
+        while (parent->count < min_count) {
+          std::move_backward(parent->keys.begin(), parent->keys.begin() + parent->count, parent->keys.begin() + parent->count + 1);
+          std::move_backward(parent->children.begin(), parent->children.begin() + parent->count + 1, parent->children.begin() + parent->count + 2);
+          parent->keys[0] = std::move(parent_minimums.back());
+          parent->children[0] = std::move(previous->children[previous->count]);
+          parent_minimums.back() = std::move(previous->keys[previous->count - 1]);
+          previous->count--;
+          parent->count++;
+        }
+      }
+
+      level = std::move(parents);
+      minimums = std::move(parent_minimums);
+    }
+
+    root_node = level.empty() ? std::make_unique<leaf_node>() : std::move(level.front());
+    return count;
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  void btree_core<Key, Payload, Capacity, Counted>::clear() {
+    root_node = std::make_unique<leaf_node>();
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  const typename btree_core<Key, Payload, Capacity, Counted>::node* btree_core<Key, Payload, Capacity, Counted>::root() const noexcept {
+    return root_node.get();
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  const typename btree_core<Key, Payload, Capacity, Counted>::leaf_node* btree_core<Key, Payload, Capacity, Counted>::find_leaf(
+    const Key& key
+  ) const {
+    const auto* current = root_node.get();
+    while (!current->leaf) {
+      const auto* inner = static_cast<const inner_node*>(current);
+      current = inner->children[child_index(inner, key)].get();
+    }
+    return static_cast<const leaf_node*>(current);
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  const typename btree_core<Key, Payload, Capacity, Counted>::leaf_node* btree_core<Key, Payload, Capacity, Counted>::first_leaf() const {
+    const auto* current = root_node.get();
+    while (!current->leaf) {
+      current = static_cast<const inner_node*>(current)->children[0].get();
+    }
+    return static_cast<const leaf_node*>(current);
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  size_t btree_core<Key, Payload, Capacity, Counted>::subtree_total(const node* current) requires Counted {
+    if (current->leaf) {
+      const auto* leaf = static_cast<const leaf_node*>(current);
+      return std::accumulate(leaf->payloads.begin(), leaf->payloads.begin() + leaf->count, size_t{0});
+    }
+    const auto* inner = static_cast<const inner_node*>(current);
+    return std::accumulate(inner->totals.begin(), inner->totals.begin() + inner->count + 1, size_t{0});
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  size_t btree_core<Key, Payload, Capacity, Counted>::child_index(const inner_node* inner, const Key& key) {
+    return std::upper_bound(inner->keys.begin(), inner->keys.begin() + inner->count, key) - inner->keys.begin();
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  size_t btree_core<Key, Payload, Capacity, Counted>::key_index(const node* current, const Key& key) {
+    return std::lower_bound(current->keys.begin(), current->keys.begin() + current->count, key) - current->keys.begin();
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  template<typename Update>
+  std::optional<typename btree_core<Key, Payload, Capacity, Counted>::split_t> btree_core<Key, Payload, Capacity, Counted>::insert_into(
+    node* current,
+    const Key& key,
+    const Payload& payload,
+    const Update& update,
+    bool& inserted,
+    size_t& added
+  ) {
+    if (current->leaf) {
+      return insert_into_leaf(static_cast<leaf_node*>(current), key, payload, update, inserted, added);
+    }
+    return insert_into_inner(static_cast<inner_node*>(current), key, payload, update, inserted, added);
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  template<typename Update>
+  std::optional<typename btree_core<Key, Payload, Capacity, Counted>::split_t> btree_core<Key, Payload, Capacity, Counted>::insert_into_leaf(
+    leaf_node* leaf,
+    const Key& key,
+    const Payload& payload,
+    const Update& update,
+    bool& inserted,
+    size_t& added
+  ) {
+    const auto position = key_index(leaf, key);
+    if (position < leaf->count && !(key < leaf->keys[position])) {
+      const auto before = weight(leaf->payloads[position]);
+      update(leaf->payloads[position]);
+      added = weight(leaf->payloads[position]) - before;
+      return std::nullopt;
+    }
+
+    inserted = true;
+    added = weight(payload);
+    if (leaf->count < Capacity) {
+      insert_entry(leaf, position, key, payload);
+      return std::nullopt;
+    }
+
+    auto right = std::make_unique<leaf_node>();
+    constexpr auto middle = Capacity / 2;
+    std::move(leaf->keys.begin() + middle, leaf->keys.end(), right->keys.begin());
+    std::move(leaf->payloads.begin() + middle, leaf->payloads.end(), right->payloads.begin());
+    right->count = Capacity - middle;
+    leaf->count = middle;
+    right->next = leaf->next;
+    leaf->next = right.get();
+
+    if (position <= middle) {
+      insert_entry(leaf, position, key, payload);
+    } else {
+      insert_entry(right.get(), position - middle, key, payload);
+    }
+    auto separator = right->keys[0];
+    auto right_total = size_t{0};
+    if constexpr (Counted) {
+      right_total = subtree_total(right.get());
+    }
+    return split_t{std::move(separator), std::move(right), right_total};
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  template<typename Update>
+  std::optional<typename btree_core<Key, Payload, Capacity, Counted>::split_t> btree_core<Key, Payload, Capacity, Counted>::insert_into_inner(
+    inner_node* inner,
+    const Key& key,
+    const Payload& payload,
+    const Update& update,
+    bool& inserted,
+    size_t& added
+  ) {
+    const auto index = child_index(inner, key);
+    auto split = insert_into(inner->children[index].get(), key, payload, update, inserted, added);
+    if constexpr (Counted) {
+      inner->totals[index] += added;
+    }
+    if (!split.has_value()) {
+      return std::nullopt;
+    }
+    if constexpr (Counted) {
+      inner->totals[index] -= split->right_total;
+    }
+    if (inner->count < Capacity) {
+      insert_child(inner, index, std::move(*split));
+      return std::nullopt;
+    }
+
+    // Lays out the Capacity + 1 keys in order, then moves the middle one up
+    auto keys = std::array<Key, Capacity + 1>();
+    auto children = std::array<std::unique_ptr<node>, Capacity + 2>();
+    std::move(inner->keys.begin(), inner->keys.begin() + index, keys.begin());
+    std::move(inner->keys.begin() + index, inner->keys.end(), keys.begin() + index + 1);
+    keys[index] = std::move(split->separator);
+    std::move(inner->children.begin(), inner->children.begin() + index + 1, children.begin());
+    std::move(inner->children.begin() + index + 1, inner->children.end(), children.begin() + index + 2);
+    children[index + 1] = std::move(split->right);
+
+    auto right = std::make_unique<inner_node>();
+    constexpr auto middle = (Capacity + 1) / 2;
+    std::move(keys.begin(), keys.begin() + middle, inner->keys.begin());
+    std::move(children.begin(), children.begin() + middle + 1, inner->children.begin());
+    inner->count = middle;
+    std::move(keys.begin() + middle + 1, keys.end(), right->keys.begin());
+    std::move(children.begin() + middle + 1, children.end(), right->children.begin());
+    right->count = Capacity - middle;
+
+    auto right_total = size_t{0};
+    if constexpr (Counted) {
+      auto totals = std::array<size_t, Capacity + 2>();
+      std::copy(inner->totals.begin(), inner->totals.begin() + index + 1, totals.begin());
+      std::copy(inner->totals.begin() + index + 1, inner->totals.end(), totals.begin() + index + 2);
+      totals[index + 1] = split->right_total;
+      std::copy(totals.begin(), totals.begin() + middle + 1, inner->totals.begin());
+      std::copy(totals.begin() + middle + 1, totals.end(), right->totals.begin());
+      right_total = subtree_total(right.get());
+    }
+    return split_t{std::move(keys[middle]), std::move(right), right_total};
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  void btree_core<Key, Payload, Capacity, Counted>::insert_entry(
+    leaf_node* leaf,
+    const size_t& position,
+    const Key& key,
+    const Payload& payload
+  ) {
+    std::move_backward(leaf->keys.begin() + position, leaf->keys.begin() + leaf->count, leaf->keys.begin() + leaf->count + 1);
+    std::move_backward(leaf->payloads.begin() + position, leaf->payloads.begin() + leaf->count, leaf->payloads.begin() + leaf->count + 1);
+    leaf->keys[position] = key;
+    leaf->payloads[position] = payload;
+    leaf->count++;
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  void btree_core<Key, Payload, Capacity, Counted>::insert_child(inner_node* inner, const size_t& position, split_t&& split) {
+    std::move_backward(inner->keys.begin() + position, inner->keys.begin() + inner->count, inner->keys.begin() + inner->count + 1);
+    std::move_backward(inner->children.begin() + position + 1, inner->children.begin() + inner->count + 1, inner->children.begin() + inner->count + 2);
+    if constexpr (Counted) {
+      std::copy_backward(inner->totals.begin() + position + 1, inner->totals.begin() + inner->count + 1, inner->totals.begin() + inner->count + 2);
+      inner->totals[position + 1] = split.right_total;
+    }
+    inner->keys[position] = std::move(split.separator);
+    inner->children[position + 1] = std::move(split.right);
+    inner->count++;
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  template<typename Shrink>
+  std::optional<size_t> btree_core<Key, Payload, Capacity, Counted>::remove_from(node* current, const Key& key, const Shrink& shrink) {
+    if (current->leaf) {
+      auto* leaf = static_cast<leaf_node*>(current);
+      const auto position = key_index(leaf, key);
+      if (position == leaf->count || key < leaf->keys[position]) {
+        return std::nullopt;
+      }
+      const auto before = weight(leaf->payloads[position]);
+      if (!shrink(leaf->payloads[position])) {
+        return before - weight(leaf->payloads[position]);
+      }
+      std::move(leaf->keys.begin() + position + 1, leaf->keys.begin() + leaf->count, leaf->keys.begin() + position);
+      std::move(leaf->payloads.begin() + position + 1, leaf->payloads.begin() + leaf->count, leaf->payloads.begin() + position);
+      leaf->count--;
+      return before;
+    }
+
+    // Separators are left as they are, a separator that is no longer a key still splits the key space
+    auto* inner = static_cast<inner_node*>(current);
+    const auto index = child_index(inner, key);
+    const auto removed = remove_from(inner->children[index].get(), key, shrink);
+    if (!removed.has_value()) {
+      return std::nullopt;
+    }
+    if constexpr (Counted) {
+      inner->totals[index] -= *removed;
+    }
+    if (inner->children[index]->count < min_count) {
+      rebalance_child(inner, index);
+    }
+    return removed;
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  void btree_core<Key, Payload, Capacity, Counted>::rebalance_child(inner_node* parent, const size_t& index) {
+    auto* child = parent->children[index].get();
+    auto* left = index > 0 ? parent->children[index - 1].get() : nullptr;
+    auto* right = index < parent->count ? parent->children[index + 1].get() : nullptr;
+
+    if (left != nullptr && left->count > min_count) {
+      auto moved = size_t{0};
+      std::move_backward(child->keys.begin(), child->keys.begin() + child->count, child->keys.begin() + child->count + 1);
+      if (child->leaf) {
+        auto* leaf = static_cast<leaf_node*>(child);
+        auto* left_leaf = static_cast<leaf_node*>(left);
+        std::move_backward(leaf->payloads.begin(), leaf->payloads.begin() + leaf->count, leaf->payloads.begin() + leaf->count + 1);
+        leaf->keys[0] = std::move(left_leaf->keys[left_leaf->count - 1]);
+        leaf->payloads[0] = std::move(left_leaf->payloads[left_leaf->count - 1]);
+        moved = weight(leaf->payloads[0]);
+        parent->keys[index - 1] = leaf->keys[0];
+      } else {
+        auto* inner = static_cast<inner_node*>(child);
+        auto* left_inner = static_cast<inner_node*>(left);
+        std::move_backward(inner->children.begin(), inner->children.begin() + inner->count + 1, inner->children.begin() + inner->count + 2);
+        inner->keys[0] = std::move(parent->keys[index - 1]);
+        inner->children[0] = std::move(left_inner->children[left_inner->count]);
+        if constexpr (Counted) {
+          std::copy_backward(inner->totals.begin(), inner->totals.begin() + inner->count + 1, inner->totals.begin() + inner->count + 2);
+          moved = inner->totals[0] = left_inner->totals[left_inner->count];
+        }
+        parent->keys[index - 1] = std::move(left_inner->keys[left_inner->count - 1]);
+      }
+      if constexpr (Counted) {
+        parent->totals[index - 1] -= moved;
+        parent->totals[index] += moved;
+      }
+      left->count--;
+      child->count++;
+      return;
+    }
+
+    if (right != nullptr && right->count > min_count) {
+      auto moved = size_t{0};
+      if (child->leaf) {
+        auto* leaf = static_cast<leaf_node*>(child);
+        auto* right_leaf = static_cast<leaf_node*>(right);
+        leaf->keys[leaf->count] = std::move(right_leaf->keys[0]);
+        leaf->payloads[leaf->count] = std::move(right_leaf->payloads[0]);
+        moved = weight(leaf->payloads[leaf->count]);
+        std::move(right_leaf->keys.begin() + 1, right_leaf->keys.begin() + right_leaf->count, right_leaf->keys.begin());
+        std::move(right_leaf->payloads.begin() + 1, right_leaf->payloads.begin() + right_leaf->count, right_leaf->payloads.begin());
+        parent->keys[index] = right_leaf->keys[0];
+      } else {
+        auto* inner = static_cast<inner_node*>(child);
+        auto* right_inner = static_cast<inner_node*>(right);
+        inner->keys[inner->count] = std::move(parent->keys[index]);
+        inner->children[inner->count + 1] = std::move(right_inner->children[0]);
+        if constexpr (Counted) {
+          moved = inner->totals[inner->count + 1] = right_inner->totals[0];
+          std::copy(right_inner->totals.begin() + 1, right_inner->totals.begin() + right_inner->count + 1, right_inner->totals.begin());
+        }
+        parent->keys[index] = std::move(right_inner->keys[0]);
+        std::move(right_inner->keys.begin() + 1, right_inner->keys.begin() + right_inner->count, right_inner->keys.begin());
+        std::move(right_inner->children.begin() + 1, right_inner->children.begin() + right_inner->count + 1, right_inner->children.begin());
+      }
+      if constexpr (Counted) {
+        parent->totals[index + 1] -= moved;
+        parent->totals[index] += moved;
+      }
+      right->count--;
+      child->count++;
+      return;
+    }
+
+    // Neither sibling can spare a key, so together they fit into one node
+    merge_children(parent, left != nullptr ? index - 1 : index);
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  void btree_core<Key, Payload, Capacity, Counted>::merge_children(inner_node* parent, const size_t& index) {
+    auto* left = parent->children[index].get();
+    auto* right = parent->children[index + 1].get();
+    if (left->leaf) {
+      auto* left_leaf = static_cast<leaf_node*>(left);
+      auto* right_leaf = static_cast<leaf_node*>(right);
+      std::move(right_leaf->keys.begin(), right_leaf->keys.begin() + right_leaf->count, left_leaf->keys.begin() + left_leaf->count);
+      std::move(right_leaf->payloads.begin(), right_leaf->payloads.begin() + right_leaf->count, left_leaf->payloads.begin() + left_leaf->count);
+      left_leaf->count += right_leaf->count;
+      left_leaf->next = right_leaf->next;
+    } else {
+      auto* left_inner = static_cast<inner_node*>(left);
+      auto* right_inner = static_cast<inner_node*>(right);
+      left_inner->keys[left_inner->count] = std::move(parent->keys[index]);
+      std::move(right_inner->keys.begin(), right_inner->keys.begin() + right_inner->count, left_inner->keys.begin() + left_inner->count + 1);
+      std::move(right_inner->children.begin(), right_inner->children.begin() + right_inner->count + 1, left_inner->children.begin() + left_inner->count + 1);
+      if constexpr (Counted) {
+        std::copy(right_inner->totals.begin(), right_inner->totals.begin() + right_inner->count + 1, left_inner->totals.begin() + left_inner->count + 1);
+      }
+      left_inner->count += right_inner->count + 1;
+    }
+
+    std::move(parent->keys.begin() + index + 1, parent->keys.begin() + parent->count, parent->keys.begin() + index);
+    std::move(parent->children.begin() + index + 2, parent->children.begin() + parent->count + 1, parent->children.begin() + index + 1);
+    parent->children[parent->count].reset();
+    if constexpr (Counted) {
+      parent->totals[index] += parent->totals[index + 1];
+      std::copy(parent->totals.begin() + index + 2, parent->totals.begin() + parent->count + 1, parent->totals.begin() + index + 1);
+      parent->totals[parent->count] = 0;
+    }
+    parent->count--;
+  }
+
+  template<typename Key, typename Payload, size_t Capacity, bool Counted>
+  size_t btree_core<Key, Payload, Capacity, Counted>::weight(const Payload& payload) noexcept {
+    if constexpr (Counted) {
+      return payload;
+    } else {
+      return 0;
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+
+namespace containers::associative {
+  template<typename Buckets>
+  hash_statistics collect_hash_statistics(
+    const Buckets& buckets,
+    const size_t& element_count,
+    const size_t& extra_bytes,
+    const hash_statistics_counters<true>& counters
+  ) {
+    // Lists hand out their nodes as std::shared_ptr
+    using bucket_node_t = typename std::remove_cvref_t<decltype(buckets.front())>::element_type;
+    using entry_node_t = typename std::remove_cvref_t<decltype(buckets.front()->data.front())>::element_type;
+    // Every node is allocated by std::make_shared next to its control block
+    constexpr auto control_block_size = 2 * sizeof(void*);
+
+    auto statistics = hash_statistics();
+    statistics.element_count = element_count;
+    statistics.bucket_count = buckets.size();
+    auto entry_count = size_t{0};
+    for (const auto& bucket_ptr : buckets) {
+      const auto chain_length = bucket_ptr->data.size();
+      if (chain_length >= statistics.chain_length_histogram.size()) {
+        statistics.chain_length_histogram.resize(chain_length + 1, 0);
+      }
+      ++statistics.chain_length_histogram[chain_length];
+      statistics.max_chain_length = std::max(statistics.max_chain_length, chain_length);
+      entry_count += chain_length;
+    }
+
+    if (statistics.bucket_count > 0) {
+      statistics.load_factor = static_cast<double>(entry_count) / static_cast<double>(statistics.bucket_count);
+      statistics.empty_bucket_ratio = static_cast<double>(statistics.chain_length_histogram[0]) / static_cast<double>(statistics.bucket_count);
+    }
+    if (element_count > 0) {
+      const auto bytes = statistics.bucket_count * (sizeof(bucket_node_t) + control_block_size)
+        + entry_count * (sizeof(entry_node_t) + control_block_size)
+        + extra_bytes;
+      statistics.bytes_per_element = static_cast<double>(bytes) / static_cast<double>(element_count);
+    }
+    counters.write_to(statistics);
+    return statistics;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+
+#include "associative/duplicate_key.hpp"
+#include "associative/perfect_hash_error.hpp"
+
+namespace containers::associative {
+  template<typename Key, size_t Extent, typename Hash>
+  template<typename Elements, typename KeyOf>
+  constexpr frozen_storage_t<size_t, Extent> perfect_hash<Key, Extent, Hash>::build(const Elements& elements, const KeyOf& key_of) {
+    const auto hash_function = Hash();
+    auto raw_hashes = std::vector<std::uint64_t>();
+    raw_hashes.reserve(elements.size());
+    for (const auto& element : elements) {
+      raw_hashes.push_back(static_cast<std::uint64_t>(hash_function(key_of(element))));
+    }
+
+    // Keys of equal hash land in the same slot whatever the seed, so reject them up front
+    auto by_hash = std::vector<size_t>(elements.size());
+    std::iota(by_hash.begin(), by_hash.end(), size_t{0});
+    std::sort(by_hash.begin(), by_hash.end(), [&raw_hashes](const size_t& left, const size_t& right) {
+      return raw_hashes[left] < raw_hashes[right];
+    });
+    for (size_t index = 1; index < by_hash.size(); ++index) {
+      if (raw_hashes[by_hash[index - 1]] != raw_hashes[by_hash[index]]) {
+        continue;
+      }
+      const auto& key = key_of(elements[by_hash[index]]);
+      if (key_of(elements[by_hash[index - 1]]) == key) {
+        throw duplicate_key<Key>(key);
+      }
+      throw perfect_hash_error("distinct keys have the same hash");
+    }
+
+    auto slots = std::vector<size_t>(elements.size());
+    for (seed = 0; seed < max_seed; ++seed) {
+      if (try_build(raw_hashes, slots)) {
+        auto result = frozen_storage_t<size_t, Extent>();
+        if constexpr (Extent == std::dynamic_extent) {
+          result.resize(slots.size());
+        }
+        std::copy(slots.begin(), slots.end(), result.begin());
+        return result;
+      }
+    }
+    throw perfect_hash_error("no perfect hash found for " + std::to_string(elements.size()) + " keys");
+  }
+
+  template<typename Key, size_t Extent, typename Hash>
+  constexpr size_t perfect_hash<Key, Extent, Hash>::slot(const Key& key) const noexcept {
+    if (slot_count == 0) {
+      return 0;
+    }
+    const auto key_hash = hash(key);
+    return static_cast<size_t>(mix(key_hash ^ pilots[bucket(key_hash)]) % slot_count);
+  }
+
+  template<typename Key, size_t Extent, typename Hash>
+  constexpr std::uint64_t perfect_hash<Key, Extent, Hash>::mix(std::uint64_t value) noexcept {
+    value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    value = (value ^ (value >> 27)) * 0x94d049bb133111ebULL;
+    return value ^ (value >> 31);
+  }
+
+  template<typename Key, size_t Extent, typename Hash>
+  constexpr std::uint64_t perfect_hash<Key, Extent, Hash>::hash(const Key& key) const noexcept {
+    return mix(static_cast<std::uint64_t>(Hash()(key)) + (seed + 1) * 0x9e3779b97f4a7c15ULL);
+  }
+
+  template<typename Key, size_t Extent, typename Hash>
+  constexpr size_t perfect_hash<Key, Extent, Hash>::bucket(const std::uint64_t& hash) const noexcept {
+    // The high bits pick the bucket, the low bits the slot, so keys of one bucket still spread
+    return static_cast<size_t>(((hash >> 32) * pilots.size()) >> 32);
+  }
+
+  template<typename Key, size_t Extent, typename Hash>
+  constexpr bool perfect_hash<Key, Extent, Hash>::try_build(const std::vector<std::uint64_t>& raw_hashes, std::vector<size_t>& slots) {
+    const auto key_count = raw_hashes.size();
+    slot_count = key_count;
+    if constexpr (Extent == std::dynamic_extent) {
+      pilots.assign(calculate_perfect_hash_bucket_count(key_count), 0);
+    } else {
+      std::fill(pilots.begin(), pilots.end(), 0);
+    }
+
+    // Group the keys by bucket, counting sort as in write_snapshot
+    auto hashes = std::vector<std::uint64_t>(key_count);
+    auto bounds = std::vector<size_t>(pilots.size() + 1, 0);
+    for (size_t index = 0; index < key_count; ++index) {
+      hashes[index] = mix(raw_hashes[index] + (seed + 1) * 0x9e3779b97f4a7c15ULL);
+      ++bounds[bucket(hashes[index]) + 1];
+    }
+    for (size_t index = 1; index < bounds.size(); ++index) {
+      bounds[index] += bounds[index - 1];
+    }
+    auto keys = std::vector<size_t>(key_count);
+    auto next = std::vector<size_t>(bounds.begin(), bounds.end() - 1);
+    for (size_t index = 0; index < key_count; ++index) {
+      keys[next[bucket(hashes[index])]++] = index;
+    }
+
+    auto buckets = std::vector<size_t>(pilots.size());
+    std::iota(buckets.begin(), buckets.end(), size_t{0});
+    std::sort(buckets.begin(), buckets.end(), [&bounds](const size_t& left, const size_t& right) {
+      const auto left_size = bounds[left + 1] - bounds[left];
+      const auto right_size = bounds[right + 1] - bounds[right];
+      return left_size != right_size ? left_size > right_size : left < right;
+    });
+
+    auto taken = std::vector<char>(key_count, 0);
+    auto positions = std::vector<size_t>();
+    for (const auto& bucket_index : buckets) {
+      const auto begin = bounds[bucket_index];
+      const auto end = bounds[bucket_index + 1];
+      if (begin == end) {
+        break;
+      }
+
+      auto placed = false;
+      for (std::uint32_t pilot = 0; pilot < max_pilot && !placed; ++pilot) {
+        positions.clear();
+        placed = true;
+        for (auto key = begin; key < end; ++key) {
+          const auto position = static_cast<size_t>(mix(hashes[keys[key]] ^ pilot) % key_count);
+          if (taken[position] || std::find(positions.begin(), positions.end(), position) != positions.end()) {
+            placed = false;
+            break;
+          }
+          positions.push_back(position);
+        }
+        if (placed) {
+          pilots[bucket_index] = pilot;
+          for (auto key = begin; key < end; ++key) {
+            taken[positions[key - begin]] = 1;
+            slots[keys[key]] = positions[key - begin];
+          }
+        }
+      }
+      if (!placed) {
+        return false;
+      }
+    }
+    return true;
+  }
+}
\ No newline at end of file
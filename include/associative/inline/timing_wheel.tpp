@@ -0,0 +1,109 @@
+#pragma once
+
+#include <algorithm>
+
+namespace containers::associative {
+  template<typename Key>
+  timing_wheel<Key>::timing_wheel(const std::uint64_t& start_tick) : current(start_tick) {}
+
+  template<typename Key>
+  void timing_wheel<Key>::schedule(const Key& key, const std::uint64_t& deadline) {
+    // The slot of the current tick has already been processed
+    place(record_t(key, deadline), current + 1);
+  }
+
+  template<typename Key>
+  void timing_wheel<Key>::advance(const std::uint64_t& tick, const callback_t& on_due) {
+    while (current < tick) {
+      if (level_sizes[0] == 0) {
+        auto level = size_t{1};
+        while (level < level_count && level_sizes[level] == 0) {
+          ++level;
+        }
+        if (level == level_count) {
+          current = tick;
+          break;
+        }
+        // Nothing is due before the next cascade of the lowest non-empty level
+        const auto span = level_span(level);
+        const auto next = (current / span + 1) * span;
+        if (next > tick) {
+          current = tick;
+          break;
+        }
+        current = next - 1;
+      }
+
+      ++current;
+      for (auto level = level_count - 1; level > 0; --level) {
+        if (current % level_span(level) == 0) {
+          cascade(level);
+        }
+      }
+
+      auto due = std::move(slots[0][current & (slot_count - 1)]);
+      slots[0][current & (slot_count - 1)].clear();
+      level_sizes[0] -= due.size();
+      for (const auto& [key, deadline] : due) {
+        on_due(key, deadline);
+      }
+    }
+  }
+
+  template<typename Key>
+  void timing_wheel<Key>::clear() {
+    for (auto& level : slots) {
+      for (auto& slot : level) {
+        slot.clear();
+      }
+    }
+    level_sizes.fill(0);
+  }
+
+  template<typename Key>
+  size_t timing_wheel<Key>::scheduled() const noexcept {
+    auto count = size_t{0};
+    for (const auto& size : level_sizes) {
+      count += size;
+    }
+    return count;
+  }
+
+  template<typename Key>
+  std::uint64_t timing_wheel<Key>::current_tick() const noexcept {
+    return current;
+  }
+
+  template<typename Key>
+  constexpr std::uint64_t timing_wheel<Key>::level_span(const size_t& level) noexcept {
+    return std::uint64_t{1} << (slot_bits * level);
+  }
+
+  template<typename Key>
+  void timing_wheel<Key>::place(record_t&& record, const std::uint64_t& earliest) {
+    const auto horizon = level_span(level_count);
+    // Where the record is placed, its real deadline is kept for the callback
+    auto position = std::max(record.second, earliest);
+    if (position - current >= horizon) {
+      position = current + horizon - 1;
+    }
+
+    auto level = size_t{0};
+    while (position - current >= level_span(level + 1)) {
+      ++level;
+    }
+    slots[level][(position >> (slot_bits * level)) & (slot_count - 1)].push_back(std::move(record));
+    ++level_sizes[level];
+  }
+
+  template<typename Key>
+  void timing_wheel<Key>::cascade(const size_t& level) {
+    auto& slot = slots[level][(current >> (slot_bits * level)) & (slot_count - 1)];
+    auto records = std::move(slot);
+    slot.clear();
+    level_sizes[level] -= records.size();
+    for (auto& record : records) {
+      place(std::move(record), current);
+    }
+  }
+}
\ No newline at end of file
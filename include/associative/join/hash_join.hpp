@@ -0,0 +1,133 @@
+#pragma once
+
+#include <functional>
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include "associative/map/hash_multi_map.hpp"
+
+namespace containers::associative {
+  /**
+   * @brief The kind of join performed by a hash_join.
+   */
+  enum class join_mode {
+    inner, ///< Emits every matching (probe key, build value) combination.
+    semi,  ///< Emits each probe key that has at least one match, once.
+    anti   ///< Emits each probe key that has no match.
+  };
+
+  /**
+   * @brief Columnar output buffer of a hash_join probe.
+   *
+   * Row i of the result consists of probe_indices[i] and, for inner joins, values[i].
+   * Semi and anti joins only fill the probe_indices column.
+   *
+   * @tparam Value The type of the build side rows.
+   */
+  template<typename Value>
+  struct join_result {
+    std::vector<size_t> probe_indices; ///< Index of the matched key in the probed span.
+    std::vector<Value> values;         ///< Matched build side row (inner joins only).
+
+    /**
+     * @brief Returns the number of emitted rows.
+     * @return The size of the probe_indices column.
+     */
+    [[nodiscard]] size_t size() const noexcept;
+
+    /**
+     * @brief Removes all rows while keeping the allocated capacity.
+     */
+    void clear() noexcept;
+  };
+
+  /**
+   * @class hash_join
+   * @brief A hash join operator using a hash_multi_map as its build side.
+   *
+   * @tparam Key The type of the join keys.
+   * @tparam Value The type of the build side rows.
+   *
+   * @details
+   * - build() optionally sizes the underlying hash_multi_map for an estimate of the distinct
+   *   keys and then bulk-inserts all rows, so no bucket redistribution happens while building.
+   * - probe() processes the probe keys in batches: all keys of a batch are hashed
+   *   first and then matched against the build side using the precomputed hashes.
+   * - Matches are either handed to a callback or appended to a columnar join_result.
+   *
+   * @note This class is not thread-safe.
+   */
+  template<typename Key, typename Value>
+  class hash_join final {
+  public:
+    /**
+     * @brief Callback invoked once per emitting probe key.
+     *
+     * Receives the index of the probe key and the matching build side rows. Semi joins
+     * only pass the first matching row, anti joins pass no rows.
+     */
+    using emit_t = std::function<void(size_t, std::span<const Value>)>;
+
+    /**
+     * @brief Constructs an empty hash join.
+     *
+     * @param hash_function A callable object that computes the hash of a given key.
+     * @param mode The kind of join to perform.
+     * @param batch_size The number of probe keys hashed before they are matched.
+     */
+    explicit hash_join(
+      const std::function<hash_t(const Key&)>& hash_function,
+      join_mode mode = join_mode::inner,
+      size_t batch_size = 64
+    );
+
+    /**
+     * @brief Adds all rows of a range of (key, row) pairs to the build side.
+     *
+     * @param rows A range whose elements are tuple-like (key, row) pairs.
+     * @param distinct_keys The number of distinct keys expected on the build side afterwards,
+     * used to size it before inserting. 0 leaves the sizing to the insertions.
+     * @note Runtime complexity: O(n) on average.
+     */
+    template<std::ranges::input_range Range>
+    void build(Range&& rows, size_t distinct_keys = 0);
+
+    /**
+     * @brief Probes the build side with the specified keys.
+     *
+     * @param keys The probe keys.
+     * @param emit Called with the probe index and the matching rows, see emit_t.
+     * @note Runtime complexity: O(n + m) on average, with n probe keys and m matches.
+     */
+    void probe(std::span<const Key> keys, const emit_t& emit) const;
+
+    /**
+     * @brief Probes the build side with the specified keys and appends the result to a columnar buffer.
+     *
+     * @param keys The probe keys.
+     * @param result The buffer the matched rows are appended to.
+     * @note Runtime complexity: O(n + m) on average, with n probe keys and m matches.
+     */
+    void probe(std::span<const Key> keys, join_result<Value>& result) const;
+
+    /**
+     * @brief Returns the kind of join performed.
+     * @return The join mode.
+     */
+    [[nodiscard]] join_mode mode() const noexcept;
+
+    /**
+     * @brief Returns the build side of the join.
+     * @return The hash_multi_map holding all build rows.
+     */
+    [[nodiscard]] const hash_multi_map<Key, Value>& build_side() const noexcept;
+
+  private:
+    hash_multi_map<Key, Value> table;
+    const join_mode join_kind;
+    const size_t batch_size;
+  };
+}
+
+#include "inline/hash_join.tpp"
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <algorithm>
+#include <tuple>
+
+namespace containers::associative {
+  template<typename Value>
+  size_t join_result<Value>::size() const noexcept {
+    return probe_indices.size();
+  }
+
+  template<typename Value>
+  void join_result<Value>::clear() noexcept {
+    probe_indices.clear();
+    values.clear();
+  }
+
+  template<typename Key, typename Value>
+  hash_join<Key, Value>::hash_join(
+    const std::function<hash_t(const Key&)>& hash_function,
+    const join_mode mode,
+    const size_t batch_size
+  ) :
+    table(hash_function),
+    join_kind(mode),
+    batch_size(std::max<size_t>(batch_size, 1))
+  {}
+
+  template<typename Key, typename Value>
+  template<std::ranges::input_range Range>
+  void hash_join<Key, Value>::build(Range&& rows, const size_t distinct_keys) {
+    // The bucket list is sized by distinct keys, which the row count of a range with duplicates overstates
+    table.reserve(distinct_keys);
+    for (const auto& row : rows) {
+      table.insert(std::get<0>(row), std::get<1>(row));
+    }
+  }
+
+  template<typename Key, typename Value>
+  void hash_join<Key, Value>::probe(std::span<const Key> keys, const emit_t& emit) const {
+    auto hashes = std::vector<hash_t>(std::min(batch_size, keys.size()));
+    for (size_t batch_begin = 0; batch_begin < keys.size(); batch_begin += batch_size) {
+      const auto batch = keys.subspan(batch_begin, std::min(batch_size, keys.size() - batch_begin));
+      for (size_t index = 0; index < batch.size(); ++index) {
+        hashes[index] = table.hash(batch[index]);
+      }
+
+      for (size_t index = 0; index < batch.size(); ++index) {
+        const auto& matches = table.values(batch[index], hashes[index]);
+        const auto probe_index = batch_begin + index;
+        switch (join_kind) {
+          case join_mode::inner:
+            if (!matches.empty()) {
+              emit(probe_index, matches);
+            }
+            break;
+          case join_mode::semi:
+            if (!matches.empty()) {
+              emit(probe_index, matches.first(1));
+            }
+            break;
+          case join_mode::anti:
+            if (matches.empty()) {
+              emit(probe_index, matches);
+            }
+            break;
+        }
+      }
+    }
+  }
+
+  template<typename Key, typename Value>
+  void hash_join<Key, Value>::probe(std::span<const Key> keys, join_result<Value>& result) const {
+    probe(keys, [this, &result](const size_t probe_index, const std::span<const Value> matches) {
+      if (join_kind != join_mode::inner) {
+        result.probe_indices.push_back(probe_index);
+        return;
+      }
+      result.probe_indices.insert(result.probe_indices.end(), matches.size(), probe_index);
+      result.values.insert(result.values.end(), matches.begin(), matches.end());
+    });
+  }
+
+  template<typename Key, typename Value>
+  join_mode hash_join<Key, Value>::mode() const noexcept {
+    return join_kind;
+  }
+
+  template<typename Key, typename Value>
+  const hash_multi_map<Key, Value>& hash_join<Key, Value>::build_side() const noexcept {
+    return table;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,202 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "ordered_map.hpp"
+#include "art_map_iterator.hpp"
+
+namespace containers::associative {
+  /**
+   * @class art_map
+   * @brief An ordered map from strings to values, implemented as an adaptive radix tree.
+   *
+   * A lookup descends one level per key byte instead of comparing whole keys, so it costs
+   * O(key length) whatever the number of entries. All keys sharing a prefix lie in one
+   * subtree, which makes prefix queries a single descent.
+   *
+   * @tparam Value The type of the values associated with the keys.
+   *
+   * @details
+   * - Inner nodes grow and shrink between four layouts by their number of children: Node4 and
+   *   Node16 keep sorted byte arrays, searched with SSE2 in Node16 where available, Node48 maps
+   *   all 256 bytes to 48 child slots and Node256 indexes its children by byte directly.
+   * - Path compression: an inner node stores the bytes all keys below it share, so chains of
+   *   single-child nodes never occur.
+   * - Leaves store their full key. A key which is a proper prefix of other keys is stored as the
+   *   terminal leaf of the inner node where it ends, so keys may contain any byte including '\0'.
+   * - Keys are ordered as by std::string::operator<, bytewise unsigned.
+   * - Iterators are invalidated by every modification.
+   *
+   * @note This class is not thread-safe.
+   */
+  template<typename Value>
+  class art_map final : public ordered_map<std::string, Value> {
+  private:
+    enum class node_type : std::uint8_t { leaf, node4, node16, node48, node256 };
+
+    struct node {
+      const node_type type;
+
+      explicit node(const node_type& type) : type(type) {}
+      virtual ~node() = default;
+
+      [[nodiscard]] bool is_leaf() const noexcept { return type == node_type::leaf; }
+    };
+
+    struct leaf_node final : node {
+      const std::string key;
+      Value value;
+
+      leaf_node(const std::string& key, const Value& value) : node(node_type::leaf), key(key), value(value) {}
+    };
+
+    struct inner_node : node {
+      std::uint16_t count = 0;
+      // The compressed path, the bytes after the parent's child byte shared by all keys below
+      std::string prefix;
+      // The leaf of the key ending right after the prefix
+      std::unique_ptr<leaf_node> terminal;
+
+      explicit inner_node(const node_type& type) : node(type) {}
+
+      /**
+       * @brief Returns the child with the smallest byte at or after a position, for iteration.
+       * @param position The position to continue from, advanced past the returned child.
+       * @return The child, or nullptr if there are no more children.
+       */
+      const node* next_child(size_t& position) const;
+    };
+
+    struct node4 final : inner_node {
+      std::array<std::uint8_t, 4> keys{};
+      std::array<std::unique_ptr<node>, 4> children;
+
+      node4() : inner_node(node_type::node4) {}
+    };
+
+    struct node16 final : inner_node {
+      std::array<std::uint8_t, 16> keys{};
+      std::array<std::unique_ptr<node>, 16> children;
+
+      node16() : inner_node(node_type::node16) {}
+    };
+
+    struct node48 final : inner_node {
+      // The child slot of every byte plus one, 0 for bytes without a child
+      std::array<std::uint8_t, 256> indices{};
+      std::array<std::unique_ptr<node>, 48> children;
+
+      node48() : inner_node(node_type::node48) {}
+    };
+
+    struct node256 final : inner_node {
+      std::array<std::unique_ptr<node>, 256> children;
+
+      node256() : inner_node(node_type::node256) {}
+    };
+
+  public:
+    using iterator_t = art_map_iterator<node, inner_node, leaf_node, Value>;
+
+    /**
+     * @brief Constructs an empty art_map.
+     */
+    art_map() = default;
+
+    virtual ~art_map() override = default;
+    art_map(const art_map&) = delete;
+    art_map& operator=(const art_map&) = delete;
+
+    //! @copydoc associative_map::insert
+    virtual void insert(const std::string& key, const Value& value) override;
+    //! @copydoc associative_map::insert_safely
+    virtual void insert_safely(const std::string& key, const Value& value) override;
+    //! @copydoc associative_map::try_insert
+    virtual std::expected<void, container_error> try_insert(const std::string& key, const Value& value) override;
+    //! @copydoc associative_map::find_by_key
+    virtual std::optional<Value> find_by_key(const std::string& key) const override;
+    //! @copydoc associative_map::find_by_key_or_throw
+    virtual Value find_by_key_or_throw(const std::string& key) const override;
+    //! @copydoc associative_map::remove
+    virtual void remove(const std::string& key) override;
+
+    /**
+     * @copydoc ordered_map::find_lower_bound
+     * @note Runtime complexity: O(key length) plus the length of the key found.
+     */
+    virtual std::optional<std::pair<std::string, Value>> find_lower_bound(const std::string& key) const override;
+
+    /**
+     * @copydoc ordered_map::find_upper_bound
+     * @note Runtime complexity: O(key length) plus the length of the key found.
+     */
+    virtual std::optional<std::pair<std::string, Value>> find_upper_bound(const std::string& key) const override;
+
+    /**
+     * @brief Inserts a key-value pair or replaces the value of an existing key.
+     * @param key The key to insert or update.
+     * @param value The value to associate with the key.
+     * @note Runtime complexity: O(key length).
+     */
+    void upsert(const std::string& key, const Value& value);
+
+    /**
+     * @brief Removes all key-value pairs.
+     */
+    void clear();
+
+    /**
+     * @brief Returns the key-value pairs whose keys start with a prefix, in key order.
+     * @param prefix The prefix, the empty prefix matches all keys.
+     * @return A view over the subtree holding the matching keys.
+     * @note Runtime complexity: O(prefix length) plus O(1) amortized per visited pair.
+     */
+    [[nodiscard]] std::ranges::subrange<iterator_t> prefix_scan(std::string_view prefix) const;
+
+    /**
+     * @brief Finds the longest key which is a prefix of the given key, e.g. the most specific route of a path.
+     * @param key The key to match, which is a prefix of itself.
+     * @return The matching key and its value, or std::nullopt if no key is a prefix of the given key.
+     * @note Runtime complexity: O(key length).
+     */
+    [[nodiscard]] std::optional<std::pair<std::string, Value>> longest_prefix_match(std::string_view key) const;
+
+    iterator_t begin() const;
+    iterator_t end() const;
+    iterator_t cbegin() const;
+    iterator_t cend() const;
+
+  private:
+    enum class insert_mode { keep_existing, replace_existing };
+
+    std::unique_ptr<node> root;
+
+    bool insert_with_mode(const std::string& key, const Value& value, insert_mode mode);
+    [[nodiscard]] const leaf_node* find_leaf(std::string_view key) const;
+    [[nodiscard]] static const leaf_node* lower_bound_leaf(const node* current, std::string_view key, size_t depth);
+    [[nodiscard]] static const leaf_node* minimum(const node* current);
+    [[nodiscard]] static const node* next_child_after(const inner_node* inner, const std::uint8_t& byte);
+
+    static bool remove_from(std::unique_ptr<node>& slot, std::string_view key, size_t depth);
+
+    static void place_leaf(std::unique_ptr<node>& slot, std::unique_ptr<leaf_node> leaf, const size_t& depth);
+    static std::unique_ptr<node>* find_child(inner_node* inner, const std::uint8_t& byte);
+    static const node* find_child(const inner_node* inner, const std::uint8_t& byte);
+    static void add_child(std::unique_ptr<node>& slot, const std::uint8_t& byte, std::unique_ptr<node> child);
+    static void remove_child(inner_node* inner, const std::uint8_t& byte);
+    static void grow(std::unique_ptr<node>& slot);
+    static void shrink(std::unique_ptr<node>& slot);
+    static void collapse(std::unique_ptr<node>& slot);
+    static void move_header(inner_node* from, inner_node* to);
+    [[nodiscard]] static size_t common_prefix_length(std::string_view first, std::string_view second) noexcept;
+  };
+}
+
+#include "inline/art_map.tpp"
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <iterator>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace containers::associative {
+  /**
+   * @class art_map_iterator
+   * @brief A forward iterator over the leaves of an art_map subtree, in key order.
+   *
+   * The iterator keeps the path from the subtree root to the current leaf on a stack, with
+   * the next child position of every inner node on it.
+   *
+   * @tparam Node The node base type of the map.
+   * @tparam Inner The inner node base type of the map, providing next_child().
+   * @tparam Leaf The leaf node type of the map.
+   * @tparam Value The type of the values associated with the keys.
+   */
+  template<typename Node, typename Inner, typename Leaf, typename Value>
+  class art_map_iterator {
+  public:
+    using iterator_concept = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::pair<std::string, Value>;
+
+    art_map_iterator();
+    explicit art_map_iterator(const Node* root);
+
+    value_type operator*() const;
+
+    /**
+     * @brief Returns the key of the current pair without copying it.
+     * @return The key.
+     */
+    [[nodiscard]] const std::string& key() const;
+
+    /**
+     * @brief Returns the value of the current pair without copying it.
+     * @return The value.
+     */
+    [[nodiscard]] const Value& value() const;
+
+    // Prefix increment
+    art_map_iterator& operator++();
+    // Postfix increment
+    art_map_iterator operator++(int);
+
+    bool operator==(const art_map_iterator& other) const;
+
+  private:
+    struct frame {
+      const Inner* inner;
+      size_t position;
+    };
+
+    std::vector<frame> path;
+    // nullptr past the last leaf of the subtree
+    const Leaf* current;
+
+    void descend(const Node* node);
+  };
+}
+
+#include "inline/art_map_iterator.tpp"
\ No newline at end of file
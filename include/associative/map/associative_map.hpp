@@ -1,10 +1,12 @@
 #pragma once
 
 #include <vector>
+#include <expected>
 #include <functional>
 #include <optional>
 
 #include "container.hpp"
+#include "container_error.hpp"
 
 namespace containers::associative {
   template<typename Key, typename Value>
@@ -30,6 +32,15 @@ namespace containers::associative {
      */
     virtual void insert_safely(const Key& key, const Value& value) = 0;
 
+    /**
+     * @brief Inserts a key-value pair into the container if the key does not exist yet.
+     * @param key The key to insert.
+     * @param value The value associated with the key.
+     * @return Nothing, or container_error::duplicate_key if the key already exists and nothing has been inserted.
+     * @note Runtime complexity: O(log n) for ordered containers, O(1) on average for hash-based containers.
+     */
+    virtual std::expected<void, container_error> try_insert(const Key& key, const Value& value) = 0;
+
     /**
      * @brief Checks if a key exists in the container.
      * @param key The key to search for.
@@ -38,6 +38,14 @@ namespace containers::associative {
      */
     virtual bool exists(const Key& key, const Value& value) const = 0;
 
+    /**
+     * @brief Counts the values associated with the specified key.
+     * @param key The key to search for.
+     * @return The number of key-value pairs with this key, 0 if the key does not exist.
+     * @note Runtime complexity: O(log n) for ordered containers, O(1) on average for hash-based containers.
+     */
+    virtual size_t count(const Key& key) const = 0;
+
     /**
      * @brief Removes all key-value pairs associated with this key from the container.
      * @param key The key to remove.
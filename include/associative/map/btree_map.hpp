@@ -0,0 +1,136 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <utility>
+
+#include "ordered_map.hpp"
+#include "btree_map_iterator.hpp"
+#include "associative/btree_core.hpp"
+
+namespace containers::associative {
+  /**
+   * @class btree_map
+   * @brief An ordered map implemented as a B+ tree with wide nodes.
+   *
+   * Every node stores its keys in one contiguous array, so a lookup touches a few cache lines
+   * per level instead of one node per comparison as in a binary search tree. The tree is only
+   * log_Capacity(n) levels deep.
+   *
+   * @tparam Key The type of the keys, ordered by operator<.
+   * @tparam Value The type of the values associated with the keys.
+   * @tparam Capacity The maximum number of keys per node, see btree_default_capacity.
+   *
+   * @details
+   * - Key-value pairs are stored in the leaves of a btree_core, which keeps the tree balanced.
+   * - The leaves are linked in key order, so iteration and range scans walk the leaves
+   *   without going back up the tree.
+   * - Keys and values are stored in fixed arrays and must be default constructible.
+   * - Iterators are invalidated by every modification.
+   *
+   * @note This class is not thread-safe.
+   */
+  template<typename Key, typename Value, size_t Capacity = btree_default_capacity<Key>>
+  class btree_map final : public ordered_map<Key, Value> {
+  private:
+    using core_t = btree_core<Key, Value, Capacity>;
+    using leaf_node = typename core_t::leaf_node;
+
+  public:
+    using iterator_t = btree_map_iterator<leaf_node, Key, Value>;
+
+    /**
+     * @brief Constructs an empty btree_map.
+     */
+    btree_map();
+
+    virtual ~btree_map() override = default;
+    btree_map(const btree_map&) = delete;
+    btree_map& operator=(const btree_map&) = delete;
+
+    //! @copydoc associative_map::insert
+    virtual void insert(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::insert_safely
+    virtual void insert_safely(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::try_insert
+    virtual std::expected<void, container_error> try_insert(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::find_by_key
+    virtual std::optional<Value> find_by_key(const Key& key) const override;
+    //! @copydoc associative_map::find_by_key_or_throw
+    virtual Value find_by_key_or_throw(const Key& key) const override;
+    //! @copydoc associative_map::remove
+    virtual void remove(const Key& key) override;
+    //! @copydoc ordered_map::find_lower_bound
+    virtual std::optional<std::pair<Key, Value>> find_lower_bound(const Key& key) const override;
+    //! @copydoc ordered_map::find_upper_bound
+    virtual std::optional<std::pair<Key, Value>> find_upper_bound(const Key& key) const override;
+
+    /**
+     * @brief Inserts a key-value pair or replaces the value of an existing key.
+     * @param key The key to insert or update.
+     * @param value The value to associate with the key.
+     * @note Runtime complexity: O(log n).
+     */
+    void upsert(const Key& key, const Value& value);
+
+    /**
+     * @brief Replaces the contents with key-value pairs sorted by key.
+     *
+     * The leaves are filled up from left to right and the inner levels are built on top of
+     * them, without searching or splitting any node. Only the last node of a level may have
+     * to take a few entries of its neighbour to reach the minimum occupancy.
+     *
+     * @param pairs A range of key-value pairs, e.g. std::pair<Key, Value>, sorted by key.
+     * @throws duplicate_key<Key> If a key is given twice.
+     * @throws std::invalid_argument If the keys are not sorted.
+     * @note The map is left unchanged if an exception is thrown.
+     * @note Runtime complexity: O(n).
+     */
+    template<std::ranges::input_range Range>
+    void build_from_sorted(Range&& pairs);
+
+    /**
+     * @brief Removes all key-value pairs.
+     */
+    void clear();
+
+    /**
+     * @brief Returns an iterator to the first key not less than the given key.
+     * @param key The key to look up.
+     * @return The iterator, or end() if all keys are less.
+     * @note Runtime complexity: O(log n).
+     */
+    [[nodiscard]] iterator_t lower_bound(const Key& key) const;
+
+    /**
+     * @brief Returns an iterator to the first key greater than the given key.
+     * @param key The key to look up.
+     * @return The iterator, or end() if no key is greater.
+     * @note Runtime complexity: O(log n).
+     */
+    [[nodiscard]] iterator_t upper_bound(const Key& key) const;
+
+    /**
+     * @brief Returns the key-value pairs with keys in [first, last), in key order.
+     * @param first The smallest key of the range.
+     * @param last The key after the range.
+     * @return A view from lower_bound(first) to lower_bound(last).
+     * @note Runtime complexity: O(log n) plus O(1) per visited pair.
+     */
+    [[nodiscard]] std::ranges::subrange<iterator_t> range(const Key& first, const Key& last) const;
+
+    iterator_t begin() const;
+    iterator_t end() const;
+    iterator_t cbegin() const;
+    iterator_t cend() const;
+
+  private:
+    core_t tree;
+
+    [[nodiscard]] static iterator_t make_iterator(const leaf_node* leaf, const size_t& index);
+  };
+}
+
+#include "inline/btree_map.tpp"
\ No newline at end of file
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <iterator>
+#include <utility>
+
+namespace containers::associative {
+  /**
+   * @class btree_map_iterator
+   * @brief A forward iterator over the linked leaves of a btree_map, in key order.
+   *
+   * @tparam Leaf The leaf node type of the map.
+   * @tparam Key The type of the keys stored in the map.
+   * @tparam Value The type of the values associated with the keys.
+   */
+  template<typename Leaf, typename Key, typename Value>
+  class btree_map_iterator {
+  public:
+    using iterator_concept = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::pair<Key, Value>;
+
+    btree_map_iterator();
+    btree_map_iterator(const Leaf* leaf, const size_t& index);
+
+    value_type operator*() const;
+
+    /**
+     * @brief Returns the key of the current pair without copying it.
+     * @return The key.
+     */
+    [[nodiscard]] const Key& key() const;
+
+    /**
+     * @brief Returns the value of the current pair without copying it.
+     * @return The value.
+     */
+    [[nodiscard]] const Value& value() const;
+
+    // Prefix increment
+    btree_map_iterator& operator++();
+    // Postfix increment
+    btree_map_iterator operator++(int);
+
+    bool operator==(const btree_map_iterator& other) const;
+
+  private:
+    // nullptr past the last leaf
+    const Leaf* leaf;
+    size_t index;
+  };
+}
+
+#include "inline/btree_map_iterator.tpp"
\ No newline at end of file
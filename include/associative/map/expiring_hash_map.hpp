@@ -0,0 +1,191 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "container.hpp"
+#include "hash_map.hpp"
+#include "associative/timing_wheel.hpp"
+
+namespace containers::associative {
+  /**
+   * @class expiring_hash_map
+   * @brief A hash map whose entries expire after a time to live.
+   *
+   * Every entry gets an expiry time when it is written. Lookups treat expired entries as
+   * absent right away, and a timing_wheel removes them incrementally: every write, and every
+   * call of expire(), removes just the entries which expired since the previous call, instead
+   * of sweeping the whole table.
+   *
+   * @tparam Key The type of the keys.
+   * @tparam Value The type of the values.
+   *
+   * @details
+   * - Time is measured in ticks of a configurable resolution, 1 ms by default. Entries are
+   *   removed at the first tick at or after their expiry time.
+   * - Refreshing the time to live of an entry does not touch the wheel record of the old
+   *   expiry time, that record is recognized as stale and skipped once due.
+   * - size() counts expired entries until they have been removed. Read-only phases should
+   *   call expire() now and then, as lookups never remove anything.
+   * - The clock can be replaced, e.g. by a manual clock in tests.
+   * - The entries are kept in a hash_map, which walks its bucket list to the bucket of a key.
+   *   Every lookup, write and removal of a key therefore takes O(b), with b the number of
+   *   buckets, which grows linearly with size().
+   *
+   * @note This class is not thread-safe.
+   */
+  template<typename Key, typename Value>
+  class expiring_hash_map final : public container {
+  public:
+    using clock_t = std::chrono::steady_clock;
+    using time_point_t = clock_t::time_point;
+    using duration_t = clock_t::duration;
+    using now_t = std::function<time_point_t()>;
+
+    /**
+     * @brief Constructs an empty map.
+     *
+     * @param hash_function A callable object that computes the hash of a given key.
+     * @param default_ttl The time to live of entries written without one.
+     * @param resolution The length of a tick of the timing wheel.
+     * @param now Returns the current time, std::chrono::steady_clock::now by default.
+     */
+    expiring_hash_map(
+      const std::function<hash_t(const Key&)>& hash_function,
+      const duration_t& default_ttl,
+      const duration_t& resolution = std::chrono::milliseconds(1),
+      const now_t& now = clock_t::now
+    );
+
+    /**
+     * @brief Inserts a key-value pair living for the default time to live.
+     * @param key The key to insert.
+     * @param value The value to associate with the key.
+     * @throws duplicate_key<Key> If the key exists and has not expired yet.
+     * @note Runtime complexity: O(b), plus O(b) per entry expired meanwhile.
+     */
+    void insert(const Key& key, const Value& value);
+
+    /**
+     * @brief Inserts a key-value pair living for a given time.
+     * @param key The key to insert.
+     * @param value The value to associate with the key.
+     * @param ttl The time to live of the entry.
+     * @throws duplicate_key<Key> If the key exists and has not expired yet.
+     * @note Runtime complexity: O(b), plus O(b) per entry expired meanwhile.
+     */
+    void insert(const Key& key, const Value& value, const duration_t& ttl);
+
+    /**
+     * @brief Inserts or replaces a key-value pair living for the default time to live.
+     * @param key The key to insert or update.
+     * @param value The value to associate with the key.
+     * @note Runtime complexity: O(b), plus O(b) per entry expired meanwhile.
+     */
+    void upsert(const Key& key, const Value& value);
+
+    /**
+     * @brief Inserts or replaces a key-value pair living for a given time.
+     * @param key The key to insert or update.
+     * @param value The value to associate with the key.
+     * @param ttl The time to live of the entry, counted from now.
+     * @note Runtime complexity: O(b), plus O(b) per entry expired meanwhile.
+     */
+    void upsert(const Key& key, const Value& value, const duration_t& ttl);
+
+    /**
+     * @brief Restarts the default time to live of an entry which has not expired yet.
+     * @param key The key of the entry.
+     * @return True if the entry exists and has not expired, false otherwise.
+     * @note Runtime complexity: O(b), plus O(b) per entry expired meanwhile.
+     */
+    bool touch(const Key& key);
+
+    /**
+     * @brief Sets a new time to live for an entry which has not expired yet.
+     * @param key The key of the entry.
+     * @param ttl The new time to live, counted from now.
+     * @return True if the entry exists and has not expired, false otherwise.
+     * @note Runtime complexity: O(b), plus O(b) per entry expired meanwhile.
+     */
+    bool touch(const Key& key, const duration_t& ttl);
+
+    /**
+     * @brief Returns the value of a key which has not expired yet.
+     * @param key The key to look up.
+     * @return The value, or std::nullopt if the key does not exist or has expired.
+     * @note Runtime complexity: O(b).
+     */
+    [[nodiscard]] std::optional<Value> find_by_key(const Key& key) const;
+
+    /**
+     * @brief Returns the value of a key which has not expired yet.
+     * @param key The key to look up.
+     * @return The value.
+     * @throws value_not_found<Key> If the key does not exist or has expired.
+     * @note Runtime complexity: O(b).
+     */
+    [[nodiscard]] Value find_by_key_or_throw(const Key& key) const;
+
+    /**
+     * @brief Checks whether a key exists and has not expired yet.
+     * @param key The key to look up.
+     * @return True if the key is live, false otherwise.
+     * @note Runtime complexity: O(b).
+     */
+    [[nodiscard]] bool exists(const Key& key) const;
+
+    /**
+     * @brief Returns how long an entry lives on.
+     * @param key The key of the entry.
+     * @return The remaining time to live, or std::nullopt if the key does not exist or has expired.
+     * @note Runtime complexity: O(b).
+     */
+    [[nodiscard]] std::optional<duration_t> time_to_live(const Key& key) const;
+
+    /**
+     * @brief Removes an entry, whether expired or not.
+     * @param key The key to remove.
+     * @return True if a live entry has been removed, false otherwise.
+     * @note Runtime complexity: O(b), plus O(b) per entry expired meanwhile.
+     */
+    bool remove(const Key& key);
+
+    /**
+     * @brief Removes the entries which expired since the last call.
+     * @return The number of removed entries.
+     * @note Runtime complexity: O(b) per expired entry, the live entries are not visited.
+     */
+    size_t expire();
+
+    /**
+     * @brief Removes all entries.
+     * @note Runtime complexity: O(n + b).
+     */
+    void clear();
+
+  private:
+    using entry_t = std::pair<Value, time_point_t>;
+
+    const duration_t default_ttl;
+    const duration_t resolution;
+    const now_t now;
+    const time_point_t origin;
+    const std::function<hash_t(const Key&)> hash_function;
+    //! Replaced as a whole by clear()
+    std::unique_ptr<hash_map<Key, entry_t>> entries;
+    timing_wheel<Key> wheel;
+
+    [[nodiscard]] std::uint64_t tick_at_or_after(const time_point_t& time) const;
+    [[nodiscard]] std::uint64_t tick_at_or_before(const time_point_t& time) const;
+    [[nodiscard]] std::optional<entry_t> find_live(const Key& key, const time_point_t& time) const;
+    void write(const Key& key, const Value& value, const time_point_t& expires_at);
+    size_t expire_until(const time_point_t& time);
+  };
+}
+
+#include "inline/expiring_hash_map.tpp"
\ No newline at end of file
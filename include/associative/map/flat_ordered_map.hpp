@@ -0,0 +1,148 @@
+#pragma once
+
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ordered_map.hpp"
+#include "flat_ordered_map_iterator.hpp"
+
+namespace containers::associative {
+  /**
+   * @class flat_ordered_map
+   * @brief An ordered map stored as two sorted arrays, for small or rarely modified maps.
+   *
+   * Keys and values are kept in separate contiguous arrays in key order. A lookup binary searches
+   * the key array alone, so it reads a few cache lines of keys only, without any node pointers.
+   * There is no per-entry allocation or pointer overhead, which makes the map both smaller and
+   * faster to search than node-based trees, while single insertions and removals shift the
+   * arrays in O(n).
+   *
+   * @tparam Key The type of the keys, ordered by operator<.
+   * @tparam Value The type of the values associated with the keys, not bool.
+   *
+   * @details
+   * - Lookups use branchless_lower_bound.
+   * - Many insertions are best made at once with insert_batch(), which sorts them and merges
+   *   them with the existing keys in one pass.
+   * - Iterators are invalidated by every modification.
+   *
+   * @note This class is not thread-safe.
+   */
+  template<typename Key, typename Value>
+  class flat_ordered_map final : public ordered_map<Key, Value> {
+    static_assert(!std::is_same_v<Value, bool>, "flat_ordered_map needs contiguous values, which std::vector<bool> does not have");
+
+  public:
+    using iterator_t = flat_ordered_map_iterator<Key, Value>;
+
+    /**
+     * @brief Constructs an empty flat_ordered_map.
+     */
+    flat_ordered_map() = default;
+
+    /**
+     * @brief Constructs a flat_ordered_map from key-value pairs in any order.
+     *
+     * The pairs are sorted by key, of repeated keys only the first pair is kept.
+     *
+     * @param pairs A range of key-value pairs, e.g. std::pair<Key, Value>.
+     * @note Runtime complexity: O(n) if the pairs are sorted already, else O(n log n).
+     */
+    template<std::ranges::input_range Range>
+    explicit flat_ordered_map(Range&& pairs);
+
+    virtual ~flat_ordered_map() override = default;
+
+    //! @copydoc associative_map::insert
+    virtual void insert(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::insert_safely
+    virtual void insert_safely(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::try_insert
+    virtual std::expected<void, container_error> try_insert(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::find_by_key
+    virtual std::optional<Value> find_by_key(const Key& key) const override;
+    //! @copydoc associative_map::find_by_key_or_throw
+    virtual Value find_by_key_or_throw(const Key& key) const override;
+    //! @copydoc associative_map::remove
+    virtual void remove(const Key& key) override;
+    //! @copydoc ordered_map::find_lower_bound
+    virtual std::optional<std::pair<Key, Value>> find_lower_bound(const Key& key) const override;
+    //! @copydoc ordered_map::find_upper_bound
+    virtual std::optional<std::pair<Key, Value>> find_upper_bound(const Key& key) const override;
+
+    /**
+     * @brief Inserts a key-value pair or replaces the value of an existing key.
+     * @param key The key to insert or update.
+     * @param value The value to associate with the key.
+     * @note Runtime complexity: O(log n) to replace, O(n) to insert.
+     */
+    void upsert(const Key& key, const Value& value);
+
+    /**
+     * @brief Inserts many key-value pairs at once, keeping the values of existing keys.
+     *
+     * The new pairs are sorted and merged with the stored ones in one pass over both, instead of
+     * shifting the arrays once per pair. Of repeated new keys only the first pair is kept.
+     *
+     * @param pairs A range of key-value pairs in any order.
+     * @note Runtime complexity: O(n + m log m) for m new pairs.
+     */
+    template<std::ranges::input_range Range>
+    void insert_batch(Range&& pairs);
+
+    /**
+     * @brief Removes all key-value pairs.
+     */
+    void clear();
+
+    /**
+     * @brief Returns an iterator to the first key not less than the given key.
+     * @param key The key to look up.
+     * @return The iterator, or end() if all keys are less.
+     * @note Runtime complexity: O(log n).
+     */
+    [[nodiscard]] iterator_t lower_bound(const Key& key) const;
+
+    /**
+     * @brief Returns an iterator to the first key greater than the given key.
+     * @param key The key to look up.
+     * @return The iterator, or end() if no key is greater.
+     * @note Runtime complexity: O(log n).
+     */
+    [[nodiscard]] iterator_t upper_bound(const Key& key) const;
+
+    /**
+     * @brief Returns the sorted keys.
+     * @return A view of the key array, invalidated by every modification.
+     */
+    [[nodiscard]] std::span<const Key> keys() const noexcept;
+
+    /**
+     * @brief Returns the values in the order of their keys.
+     * @return A view of the value array, invalidated by every modification.
+     */
+    [[nodiscard]] std::span<const Value> values() const noexcept;
+
+    iterator_t begin() const;
+    iterator_t end() const;
+    iterator_t cbegin() const;
+    iterator_t cend() const;
+
+  private:
+    std::vector<Key> sorted_keys;
+    std::vector<Value> sorted_values;
+
+    bool insert_if_absent(const Key& key, const Value& value);
+    template<std::ranges::input_range Range>
+    static std::vector<std::pair<Key, Value>> sort_unique(Range&& pairs);
+    [[nodiscard]] size_t key_index(const Key& key) const noexcept;
+    [[nodiscard]] bool contains_at(const size_t& index, const Key& key) const noexcept;
+    [[nodiscard]] iterator_t make_iterator(const size_t& index) const;
+  };
+}
+
+#include "inline/flat_ordered_map.tpp"
\ No newline at end of file
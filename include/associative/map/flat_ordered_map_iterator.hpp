@@ -0,0 +1,51 @@
+#pragma once
+
+#include <iterator>
+#include <utility>
+
+namespace containers::associative {
+  /**
+   * @class flat_ordered_map_iterator
+   * @brief A forward iterator over the parallel key and value arrays of a flat_ordered_map, in key order.
+   *
+   * @tparam Key The type of the keys stored in the map.
+   * @tparam Value The type of the values associated with the keys.
+   */
+  template<typename Key, typename Value>
+  class flat_ordered_map_iterator {
+  public:
+    using iterator_concept = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::pair<Key, Value>;
+
+    flat_ordered_map_iterator();
+    flat_ordered_map_iterator(const Key* key_pointer, const Value* value_pointer);
+
+    value_type operator*() const;
+
+    /**
+     * @brief Returns the key of the current pair without copying it.
+     * @return The key.
+     */
+    [[nodiscard]] const Key& key() const;
+
+    /**
+     * @brief Returns the value of the current pair without copying it.
+     * @return The value.
+     */
+    [[nodiscard]] const Value& value() const;
+
+    // Prefix increment
+    flat_ordered_map_iterator& operator++();
+    // Postfix increment
+    flat_ordered_map_iterator operator++(int);
+
+    bool operator==(const flat_ordered_map_iterator& other) const;
+
+  private:
+    const Key* key_pointer;
+    const Value* value_pointer;
+  };
+}
+
+#include "inline/flat_ordered_map_iterator.tpp"
\ No newline at end of file
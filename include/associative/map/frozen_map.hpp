@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <utility>
+
+#include "container.hpp"
+#include "associative/perfect_hash.hpp"
+
+namespace containers::associative {
+  /**
+   * @class frozen_map
+   * @brief An immutable map fixed at construction, looked up through a minimal perfect hash.
+   *
+   * Replaces a hash_map that is filled once and never modified, e.g. an opcode or country
+   * code table. A lookup computes one hash, reads one pilot and compares the key in exactly
+   * one slot.
+   *
+   * @tparam Key The type of the keys.
+   * @tparam Value The type of the values.
+   * @tparam Extent The number of key-value pairs if known at compile time, else std::dynamic_extent.
+   * @tparam Hash A hash returning distinct std::uint64_t for distinct keys, see frozen_hash.
+   *
+   * @details
+   * - With a fixed Extent, the map is built from a std::array and can be a constexpr variable.
+   *   The perfect hash is then computed by the compiler.
+   * - With std::dynamic_extent, the map is built at runtime from any range of pairs.
+   * - The pairs are stored in slot order, which iteration follows.
+   * - See perfect_hash for how the slots are assigned.
+   *
+   * @note All member functions are thread-safe.
+   */
+  template<typename Key, typename Value, size_t Extent = std::dynamic_extent, typename Hash = frozen_hash<Key>>
+  class frozen_map final : public container {
+  public:
+    using value_type = std::pair<Key, Value>;
+
+    /**
+     * @brief Builds the map from a fixed number of key-value pairs, at compile time if constant evaluated.
+     *
+     * @param pairs The key-value pairs of the map.
+     * @throws duplicate_key<Key> If a key is given twice.
+     * @throws perfect_hash_error If distinct keys have the same hash.
+     * @note Runtime complexity: O(n log n) expected.
+     */
+    constexpr explicit frozen_map(const std::array<value_type, Extent>& pairs) requires (Extent != std::dynamic_extent);
+
+    /**
+     * @brief Builds the map from a range of key-value pairs, e.g. std::pair<Key, Value>.
+     *
+     * @param pairs The key-value pairs of the map.
+     * @throws duplicate_key<Key> If a key is given twice.
+     * @throws perfect_hash_error If distinct keys have the same hash.
+     * @note Runtime complexity: O(n log n) expected.
+     */
+    template<std::ranges::input_range Range>
+    explicit frozen_map(Range&& pairs) requires (Extent == std::dynamic_extent);
+
+    constexpr virtual ~frozen_map() override = default;
+
+    /**
+     * @brief Finds the value associated with the specified key.
+     * @param key The key to look up.
+     * @return The value, or std::nullopt if the key does not exist.
+     * @note Runtime complexity: O(1).
+     */
+    [[nodiscard]] constexpr std::optional<Value> find_by_key(const Key& key) const;
+
+    /**
+     * @brief Finds the value associated with the specified key or throws an exception.
+     * @param key The key to look up.
+     * @return The value associated with the key.
+     * @throws value_not_found<Key> If the key does not exist.
+     * @note Runtime complexity: O(1).
+     */
+    [[nodiscard]] constexpr const Value& find_by_key_or_throw(const Key& key) const;
+
+    /**
+     * @brief Checks whether the key exists.
+     * @param key The key to look up.
+     * @return True if the key exists, false otherwise.
+     * @note Runtime complexity: O(1).
+     */
+    [[nodiscard]] constexpr bool exists(const Key& key) const noexcept;
+
+    constexpr auto begin() const noexcept;
+    constexpr auto end() const noexcept;
+
+  private:
+    perfect_hash<Key, Extent, Hash> hash;
+    frozen_storage_t<value_type, Extent> pairs{};
+
+    [[nodiscard]] constexpr const value_type* find_pair(const Key& key) const noexcept;
+  };
+
+  template<typename Key, typename Value, size_t Extent>
+  frozen_map(const std::array<std::pair<Key, Value>, Extent>&) -> frozen_map<Key, Value, Extent>;
+}
+
+#include "inline/frozen_map.tpp"
\ No newline at end of file
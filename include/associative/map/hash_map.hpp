@@ -1,11 +1,17 @@
 #pragma once
 
 #include <functional>
+#include <ranges>
+#include <thread>
 #include <optional>
+#include <string>
 
 #include "associative_map.hpp"
 #include "hash_map_iterator.hpp"
 #include "sequential/doubly_linked_list.hpp"
+#include "associative/parallel_scan.hpp"
+#include "associative/hash_statistics.hpp"
+#include "associative/snapshot/snapshot_format.hpp"
 
 namespace containers::associative {
   /**
@@ -19,6 +25,8 @@ namespace containers::associative {
    *
    * @tparam Key The type of the keys stored in the map.
    * @tparam Value The type of the values associated with the keys.
+   * @tparam Statistics Whether lookups and rehashes are counted for stats(), free if disabled. Counting
+   *   makes concurrent lookups race, they need a lock while enabled.
    *
    * @details
    * - The map uses a doubly linked list of buckets, where each bucket is
@@ -31,7 +39,7 @@ namespace containers::associative {
    *
    * @note This class is not thread-safe.
    */
-  template<typename Key, typename Value>
+  template<typename Key, typename Value, bool Statistics = false>
   class hash_map final : public associative_map<Key, Value> {
   protected:
     using bucket_t = sequential::doubly_linked_list<std::tuple<Key, Value, hash_t>>;
@@ -59,6 +67,8 @@ namespace containers::associative {
     virtual void insert(const Key& key, const Value& value) override;
     //! @copydoc associative_map::insert_safely
     virtual void insert_safely(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::try_insert
+    virtual std::expected<void, container_error> try_insert(const Key& key, const Value& value) override;
     //! @copydoc associative_map::find_by_key
     virtual std::optional<Value> find_by_key(const Key& key) const override;
     //! @copydoc associative_map::find_by_key_or_throw
@@ -66,6 +76,64 @@ namespace containers::associative {
     //! @copydoc associative_map::remove
     virtual void remove(const Key& key) override;
 
+    /**
+     * @brief Inserts a key-value pair or replaces the value of an existing key.
+     * @param key The key to insert or update.
+     * @param value The value to associate with the key.
+     * @note Runtime complexity: O(1) on average.
+     */
+    void upsert(const Key& key, const Value& value);
+
+    /**
+     * @brief Inserts all key-value pairs of a range, distributing them over the buckets on several threads.
+     * @param range A range of key-value pairs, e.g. std::pair<Key, Value>.
+     * @param threads The number of threads to use.
+     *
+     * @details The buckets are sized once for all elements, then the elements are radix-partitioned
+     * by hash so every thread fills its own range of buckets without locking (see fill_buckets_parallel).
+     * Keys already present and repeated keys are skipped as with insert_safely(), the first occurrence wins. The hash function is called concurrently and must be thread-safe.
+     * @note Runtime complexity: O(n / threads) on average.
+     */
+    template<std::ranges::input_range Range>
+    void build_parallel(Range&& range, const size_t& threads = std::thread::hardware_concurrency());
+
+    /**
+     * @brief Calls an action for every key-value pair, on several threads.
+     * @param action Called concurrently with every key and its value.
+     * @param threads The number of threads to use.
+     *
+     * @details The buckets are split into chunks of about equal element count, which the threads
+     * take one after another (see split_buckets). The container must not be modified meanwhile.
+     */
+    void parallel_for_each(const std::function<void(const Key&, const Value&)>& action, const size_t& threads = std::thread::hardware_concurrency()) const;
+
+    /**
+     * @brief Maps every key-value pair and combines the results, on several threads.
+     * @tparam T The type of the result.
+     * @param init The initial value, combined exactly once.
+     * @param map Called concurrently with every key and its value, returns a T.
+     * @param combine An associative function combining two T into one.
+     * @param threads The number of threads to use.
+     * @return The combination of `init` with all mapped values.
+     */
+    template<typename T, typename Map, typename Combine>
+    [[nodiscard]] T parallel_reduce(T init, const Map& map, const Combine& combine, const size_t& threads = std::thread::hardware_concurrency()) const;
+
+    /**
+     * @brief Writes the map as a snapshot file, which mapped_hash_map serves without loading it.
+     * @param path The file to write, replaced atomically once complete.
+     * @throws snapshot_error If the file cannot be written.
+     * @note Only available if keys and values are trivially copyable or std::string.
+     */
+    void save_snapshot(const std::string& path) const requires snapshot_storable<Key> && snapshot_storable<Value>;
+
+    /**
+     * @brief Returns the shape of the buckets and the counted lookups and rehashes.
+     * @return The statistics, see hash_statistics.
+     * @note Only available if Statistics is enabled. Runtime complexity: O(number of buckets).
+     */
+    [[nodiscard]] hash_statistics stats() const requires Statistics;
+
     hash_map_iterator<bucket_t, Key, Value> begin();
     hash_map_iterator<bucket_t, Key, Value> end();
     hash_map_iterator<bucket_t, Key, Value> cbegin() const;
@@ -74,16 +142,16 @@ namespace containers::associative {
   private:
     const std::function<hash_t(const Key&)> hash_function;
     std::shared_ptr<sequential::doubly_linked_list<bucket_t>> buckets_ptr;
+    // Lookups in const functions count too
+    [[no_unique_address]] mutable hash_statistics_counters<Statistics> counters;
 
-    void insert_with_optional_throw(
-      const Key& key,
-      const Value& value,
-      bool throw_exception
-    );
+    bool insert_if_absent(const Key& key, const Value& value);
 
     [[nodiscard]] const bucket_t& find_bucket_by_key(const Key& key) const;
     [[nodiscard]] bucket_t& find_bucket_by_key(const Key& key);
     void redistribute_buckets(const size_t& new_size);
+    template<typename Callback>
+    static void for_each_in_bucket(const bucket_t& bucket, const Callback& callback);
     [[nodiscard]] double calculate_load_factor() const noexcept;
   };
 }
@@ -1,9 +1,15 @@
 #pragma once
 
 #include <functional>
+#include <ranges>
+#include <thread>
+#include <span>
+#include <vector>
 
 #include "associative_multi_map.hpp"
-#include "hash_map_iterator.hpp"
+#include "hash_multi_map_iterator.hpp"
+#include "associative/parallel_scan.hpp"
+#include "associative/hash_statistics.hpp"
 
 namespace containers::associative {
   /**
@@ -17,12 +23,17 @@ namespace containers::associative {
    *
    * @tparam Key The type of the keys stored in the map.
    * @tparam Value The type of the values associated with the keys.
+   * @tparam Statistics Whether lookups and rehashes are counted for stats(), free if disabled. Counting
+   *   makes concurrent lookups race, they need a lock while enabled.
    *
    * @details
    * - The multi-map uses a doubly linked list of buckets, where each bucket is
-   *   a doubly linked list of tuples containing the key, value, and the computed hash.
-   * - The number of buckets can grow dynamically to maintain a low load factor,
-   *   ensuring efficient operations.
+   *   a doubly linked list of value groups. A group is a tuple containing the key,
+   *   a contiguous array of all values associated with that key, and the computed hash.
+   * - Every distinct key owns exactly one group, so all values of a key are found
+   *   with a single probe followed by a sequential scan of the value array.
+   * - The number of buckets can grow dynamically to maintain a low load factor
+   *   (distinct keys per bucket), ensuring efficient operations.
    * - The class supports operations such as insertion, key lookup, and removal
    *   of specific key-value pairs or all values associated with a key.
    * - The hash function is provided by the user and must be a callable object
@@ -30,10 +41,12 @@ namespace containers::associative {
    *
    * @note This class is not thread-safe.
    */
-  template<typename Key, typename Value>
+  template<typename Key, typename Value, bool Statistics = false>
   class hash_multi_map final : public associative_multi_map<Key, Value> {
   protected:
-    using bucket_t = sequential::doubly_linked_list<std::tuple<Key, Value, hash_t>>;
+    using group_t = std::tuple<Key, std::vector<Value>, hash_t>;
+    using bucket_t = sequential::doubly_linked_list<group_t>;
+    using iterator_t = hash_multi_map_iterator<bucket_t, Key, Value>;
 
   public:
     /**
@@ -60,22 +73,117 @@ namespace containers::associative {
     virtual bool exists_by_key(const Key& key) const override;
     //! @copydoc associative_multi_map::exists
     virtual bool exists(const Key& key, const Value& value) const override;
+    //! @copydoc associative_multi_map::count
+    virtual size_t count(const Key& key) const override;
     //! @copydoc associative_multi_map::remove_by_key
     virtual void remove_by_key(const Key& key) override;
     //! @copydoc associative_multi_map::remove
     virtual void remove(const Key& key, const Value& value) override;
 
-    hash_map_iterator<bucket_t, Key, Value> begin();
-    hash_map_iterator<bucket_t, Key, Value> end();
-    hash_map_iterator<bucket_t, Key, Value> cbegin() const;
-    hash_map_iterator<bucket_t, Key, Value> cend() const;
+    /**
+     * @brief Returns a view of all values associated with the specified key.
+     * @param key The key to search for.
+     * @return A contiguous view of the values in insertion order, empty if the key does not exist.
+     * @note The view is invalidated by any modification of the multi-map.
+     * @note Runtime complexity: O(1) on average.
+     */
+    [[nodiscard]] std::span<const Value> values(const Key& key) const;
+
+    /**
+     * @brief Returns the range of values associated with the specified key.
+     * @param key The key to search for.
+     * @return A pair of iterators delimiting the values, both equal if the key does not exist.
+     * @note The iterators are invalidated by any modification of the multi-map.
+     * @note Runtime complexity: O(1) on average.
+     */
+    [[nodiscard]] std::pair<typename std::span<const Value>::iterator, typename std::span<const Value>::iterator>
+    equal_range(const Key& key) const;
+
+    /**
+     * @brief Returns a view of all values associated with the specified key using a precomputed hash.
+     * @param key The key to search for.
+     * @param hash The hash of the key, as computed by the hash function of this multi-map.
+     * @return A contiguous view of the values in insertion order, empty if the key does not exist.
+     * @note Allows callers to hash a batch of keys up front instead of once per lookup.
+     * @note Runtime complexity: O(1) on average.
+     */
+    [[nodiscard]] std::span<const Value> values(const Key& key, const hash_t& hash) const;
+
+    /**
+     * @brief Grows the bucket list so that the specified number of distinct keys fits without redistribution.
+     * @param key_count The number of distinct keys expected in the multi-map.
+     * @note Never shrinks the bucket list.
+     * @note Runtime complexity: O(n) if the bucket list grows, O(1) otherwise.
+     */
+    void reserve(const size_t& key_count);
+
+    /**
+     * @brief Computes the hash of a key with the hash function of this multi-map.
+     * @param key The key to hash.
+     * @return The hash of the key.
+     */
+    [[nodiscard]] hash_t hash(const Key& key) const;
+
+    /**
+     * @brief Inserts all key-value pairs of a range, distributing them over the buckets on several threads.
+     * @param range A range of key-value pairs, e.g. std::pair<Key, Value>.
+     * @param threads The number of threads to use.
+     *
+     * @details The buckets are sized once for all elements, then the elements are radix-partitioned
+     * by hash so every thread fills its own range of buckets without locking (see fill_buckets_parallel).
+     * Values of the same key are appended in input order. The hash function is called concurrently and must be thread-safe.
+     * @note Runtime complexity: O(n / threads) on average.
+     */
+    template<std::ranges::input_range Range>
+    void build_parallel(Range&& range, const size_t& threads = std::thread::hardware_concurrency());
+
+    /**
+     * @brief Calls an action for every key-value pair, on several threads.
+     * @param action Called concurrently with every key and each of its values.
+     * @param threads The number of threads to use.
+     *
+     * @details The buckets are split into chunks of about equal element count, which the threads
+     * take one after another (see split_buckets). The container must not be modified meanwhile.
+     */
+    void parallel_for_each(const std::function<void(const Key&, const Value&)>& action, const size_t& threads = std::thread::hardware_concurrency()) const;
+
+    /**
+     * @brief Maps every key-value pair and combines the results, on several threads.
+     * @tparam T The type of the result.
+     * @param init The initial value, combined exactly once.
+     * @param map Called concurrently with every key and each of its values, returns a T.
+     * @param combine An associative function combining two T into one.
+     * @param threads The number of threads to use.
+     * @return The combination of `init` with all mapped values.
+     */
+    template<typename T, typename Map, typename Combine>
+    [[nodiscard]] T parallel_reduce(T init, const Map& map, const Combine& combine, const size_t& threads = std::thread::hardware_concurrency()) const;
+
+    /**
+     * @brief Returns the shape of the buckets and the counted lookups and rehashes.
+     * @return The statistics, see hash_statistics.
+     * @note Only available if Statistics is enabled. Runtime complexity: O(number of buckets).
+     */
+    [[nodiscard]] hash_statistics stats() const requires Statistics;
+
+    iterator_t begin();
+    iterator_t end();
+    iterator_t cbegin() const;
+    iterator_t cend() const;
   private:
     const std::function<hash_t(const Key&)> hash_function;
     std::shared_ptr<sequential::doubly_linked_list<bucket_t>> buckets_ptr;
+    size_t number_keys = 0;
+    // Lookups in const functions count too
+    [[no_unique_address]] mutable hash_statistics_counters<Statistics> counters;
 
+    [[nodiscard]] const group_t* find_group_by_key(const Key& key, const hash_t& hash) const;
     [[nodiscard]] const bucket_t& find_bucket_by_key(const Key& key) const;
     [[nodiscard]] bucket_t& find_bucket_by_key(const Key& key);
+    [[nodiscard]] const bucket_t& find_bucket_by_hash(const hash_t& hash) const;
     void redistribute_buckets(const size_t& new_size);
+    template<typename Callback>
+    static void for_each_in_bucket(const bucket_t& bucket, const Callback& callback);
     [[nodiscard]] double calculate_load_factor() const noexcept;
   };
 }
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <memory>
+
+#include "sequential/doubly_linked_list.hpp"
+
+namespace containers::associative {
+  /**
+   * @brief Forward iterator over all key-value pairs of a grouped hash_multi_map.
+   *
+   * Each bucket entry is a group owning all values of one key, so the iterator
+   * tracks the bucket, the group inside the bucket and the value inside the group.
+   */
+  template<typename Bucket, typename Key, typename Value>
+  class hash_multi_map_iterator {
+  public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::pair<Key, Value>;
+
+    hash_multi_map_iterator();
+    hash_multi_map_iterator(
+      const std::shared_ptr<sequential::doubly_linked_list<Bucket>>& ptr,
+      const size_t& outer_index,
+      const size_t& inner_index,
+      const size_t& value_index
+    );
+
+    value_type operator*() const;
+
+    // Prefix increment
+    hash_multi_map_iterator& operator++();
+    // Postfix increment
+    hash_multi_map_iterator operator++(int);
+
+    bool operator==(const hash_multi_map_iterator& other) const;
+
+    /**
+     * @brief Returns the index of the first non-empty bucket with an index of at least the specified one.
+     * @return The index of the first non-empty bucket in the doubly linked list.
+     * If all buckets are empty, buckets.size() is returned.
+    */
+    [[nodiscard]] static size_t calculate_first_non_empty_bucket_index(
+      const sequential::doubly_linked_list<Bucket>& buckets,
+      const size_t& base_index
+    );
+  private:
+    std::shared_ptr<sequential::doubly_linked_list<Bucket>> ptr;
+    size_t outer_index;
+    size_t inner_index;
+    size_t value_index;
+  };
+}
+
+#include "inline/hash_multi_map_iterator.tpp"
\ No newline at end of file
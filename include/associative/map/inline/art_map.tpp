@@ -0,0 +1,653 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "associative/duplicate_key.hpp"
+#include "associative/map/value_not_found.hpp"
+
+namespace containers::associative {
+  template<typename Value>
+  const typename art_map<Value>::node* art_map<Value>::inner_node::next_child(size_t& position) const {
+    switch (this->type) {
+      case node_type::node4: {
+        const auto* sorted = static_cast<const node4*>(this);
+        return position < this->count ? sorted->children[position++].get() : nullptr;
+      }
+      case node_type::node16: {
+        const auto* sorted = static_cast<const node16*>(this);
+        return position < this->count ? sorted->children[position++].get() : nullptr;
+      }
+      case node_type::node48: {
+        const auto* indexed = static_cast<const node48*>(this);
+        for (; position < 256; ++position) {
+          if (indexed->indices[position] != 0) {
+            return indexed->children[indexed->indices[position++] - 1].get();
+          }
+        }
+        return nullptr;
+      }
+      default: {
+        const auto* direct = static_cast<const node256*>(this);
+        for (; position < 256; ++position) {
+          if (direct->children[position] != nullptr) {
+            return direct->children[position++].get();
+          }
+        }
+        return nullptr;
+      }
+    }
+  }
+
+  template<typename Value>
+  void art_map<Value>::insert(const std::string& key, const Value& value) {
+    if (!try_insert(key, value)) {
+      throw duplicate_key<std::string>(key);
+    }
+  }
+
+  template<typename Value>
+  void art_map<Value>::insert_safely(const std::string& key, const Value& value) {
+    insert_with_mode(key, value, insert_mode::keep_existing);
+  }
+
+  template<typename Value>
+  std::expected<void, container_error> art_map<Value>::try_insert(const std::string& key, const Value& value) {
+    if (!insert_with_mode(key, value, insert_mode::keep_existing)) {
+      return std::unexpected(container_error::duplicate_key);
+    }
+    return {};
+  }
+
+  template<typename Value>
+  void art_map<Value>::upsert(const std::string& key, const Value& value) {
+    insert_with_mode(key, value, insert_mode::replace_existing);
+  }
+
+  template<typename Value>
+  std::optional<Value> art_map<Value>::find_by_key(const std::string& key) const {
+    const auto* leaf = find_leaf(key);
+    if (leaf == nullptr) {
+      return std::nullopt;
+    }
+    return leaf->value;
+  }
+
+  template<typename Value>
+  Value art_map<Value>::find_by_key_or_throw(const std::string& key) const {
+    const auto& optional = find_by_key(key);
+    if (!optional.has_value()) {
+      throw value_not_found<std::string>(key);
+    }
+    return optional.value();
+  }
+
+  template<typename Value>
+  void art_map<Value>::remove(const std::string& key) {
+    if (remove_from(root, key, 0)) {
+      container::number_elements--;
+    }
+  }
+
+  template<typename Value>
+  std::optional<std::pair<std::string, Value>> art_map<Value>::find_lower_bound(const std::string& key) const {
+    const auto* leaf = lower_bound_leaf(root.get(), key, 0);
+    if (leaf == nullptr) {
+      return std::nullopt;
+    }
+    return std::make_pair(leaf->key, leaf->value);
+  }
+
+  template<typename Value>
+  std::optional<std::pair<std::string, Value>> art_map<Value>::find_upper_bound(const std::string& key) const {
+    // The smallest string greater than a key is the key followed by a zero byte
+    return find_lower_bound(key + '\0');
+  }
+
+  template<typename Value>
+  void art_map<Value>::clear() {
+    root.reset();
+    container::number_elements = 0;
+  }
+
+  template<typename Value>
+  std::ranges::subrange<typename art_map<Value>::iterator_t> art_map<Value>::prefix_scan(const std::string_view prefix) const {
+    const node* current = root.get();
+    size_t depth = 0;
+    while (current != nullptr && !current->is_leaf()) {
+      const auto* inner = static_cast<const inner_node*>(current);
+      const auto rest = prefix.substr(depth);
+      if (rest.size() <= inner->prefix.size()) {
+        // The prefix ends within the compressed path, so either all keys below match or none
+        if (!inner->prefix.starts_with(rest)) {
+          return {end(), end()};
+        }
+        return {iterator_t(current), end()};
+      }
+      if (!rest.starts_with(inner->prefix)) {
+        return {end(), end()};
+      }
+      depth += inner->prefix.size();
+      current = find_child(inner, static_cast<std::uint8_t>(prefix[depth]));
+      depth++;
+    }
+
+    if (current == nullptr || !static_cast<const leaf_node*>(current)->key.starts_with(prefix)) {
+      return {end(), end()};
+    }
+    return {iterator_t(current), end()};
+  }
+
+  template<typename Value>
+  std::optional<std::pair<std::string, Value>> art_map<Value>::longest_prefix_match(const std::string_view key) const {
+    const leaf_node* match = nullptr;
+    const node* current = root.get();
+    size_t depth = 0;
+    while (current != nullptr) {
+      if (current->is_leaf()) {
+        const auto* leaf = static_cast<const leaf_node*>(current);
+        if (key.starts_with(leaf->key)) {
+          match = leaf;
+        }
+        break;
+      }
+
+      const auto* inner = static_cast<const inner_node*>(current);
+      if (key.substr(depth, inner->prefix.size()) != inner->prefix) {
+        break;
+      }
+      depth += inner->prefix.size();
+      // The terminal key consists of the bytes matched so far, each one deeper overrides it
+      if (inner->terminal != nullptr) {
+        match = inner->terminal.get();
+      }
+      if (depth == key.size()) {
+        break;
+      }
+      current = find_child(inner, static_cast<std::uint8_t>(key[depth]));
+      depth++;
+    }
+
+    if (match == nullptr) {
+      return std::nullopt;
+    }
+    return std::make_pair(match->key, match->value);
+  }
+
+  template<typename Value>
+  typename art_map<Value>::iterator_t art_map<Value>::begin() const {
+    return iterator_t(root.get());
+  }
+
+  template<typename Value>
+  typename art_map<Value>::iterator_t art_map<Value>::end() const {
+    return iterator_t();
+  }
+
+  template<typename Value>
+  typename art_map<Value>::iterator_t art_map<Value>::cbegin() const {
+    return begin();
+  }
+
+  template<typename Value>
+  typename art_map<Value>::iterator_t art_map<Value>::cend() const {
+    return end();
+  }
+
+  template<typename Value>
+  bool art_map<Value>::insert_with_mode(const std::string& key, const Value& value, const insert_mode mode) {
+    const auto key_view = std::string_view(key);
+    auto* slot = &root;
+    size_t depth = 0;
+    while (true) {
+      if (*slot == nullptr) {
+        *slot = std::make_unique<leaf_node>(key, value);
+        break;
+      }
+
+      if ((*slot)->is_leaf()) {
+        auto* leaf = static_cast<leaf_node*>(slot->get());
+        if (leaf->key == key) {
+          if (mode == insert_mode::replace_existing) {
+            leaf->value = value;
+          }
+          return false;
+        }
+
+        // Both keys continue below a new node holding the bytes they share as its prefix
+        const auto common = common_prefix_length(std::string_view(leaf->key).substr(depth), key_view.substr(depth));
+        auto existing = std::unique_ptr<leaf_node>(static_cast<leaf_node*>(slot->release()));
+        auto parent = std::make_unique<node4>();
+        parent->prefix = key.substr(depth, common);
+        *slot = std::move(parent);
+        place_leaf(*slot, std::move(existing), depth + common);
+        place_leaf(*slot, std::make_unique<leaf_node>(key, value), depth + common);
+        break;
+      }
+
+      auto* inner = static_cast<inner_node*>(slot->get());
+      const auto matched = common_prefix_length(inner->prefix, key_view.substr(depth));
+      if (matched < inner->prefix.size()) {
+        // The key leaves the compressed path, which is split at the first differing byte
+        auto parent = std::make_unique<node4>();
+        parent->prefix = inner->prefix.substr(0, matched);
+        const auto byte = static_cast<std::uint8_t>(inner->prefix[matched]);
+        inner->prefix.erase(0, matched + 1);
+        auto child = std::move(*slot);
+        *slot = std::move(parent);
+        add_child(*slot, byte, std::move(child));
+        place_leaf(*slot, std::make_unique<leaf_node>(key, value), depth + matched);
+        break;
+      }
+
+      depth += inner->prefix.size();
+      if (depth == key.size()) {
+        if (inner->terminal != nullptr) {
+          if (mode == insert_mode::replace_existing) {
+            inner->terminal->value = value;
+          }
+          return false;
+        }
+        inner->terminal = std::make_unique<leaf_node>(key, value);
+        break;
+      }
+
+      const auto byte = static_cast<std::uint8_t>(key[depth]);
+      auto* child = find_child(inner, byte);
+      if (child == nullptr) {
+        add_child(*slot, byte, std::make_unique<leaf_node>(key, value));
+        break;
+      }
+      slot = child;
+      depth++;
+    }
+
+    container::number_elements++;
+    return true;
+  }
+
+  template<typename Value>
+  const typename art_map<Value>::leaf_node* art_map<Value>::find_leaf(const std::string_view key) const {
+    const node* current = root.get();
+    size_t depth = 0;
+    while (current != nullptr && !current->is_leaf()) {
+      const auto* inner = static_cast<const inner_node*>(current);
+      if (key.substr(depth, inner->prefix.size()) != inner->prefix) {
+        return nullptr;
+      }
+      depth += inner->prefix.size();
+      if (depth == key.size()) {
+        return inner->terminal.get();
+      }
+      current = find_child(inner, static_cast<std::uint8_t>(key[depth]));
+      depth++;
+    }
+
+    // The bytes skipped on the way down are only compared here, once per lookup
+    if (current == nullptr || static_cast<const leaf_node*>(current)->key != key) {
+      return nullptr;
+    }
+    return static_cast<const leaf_node*>(current);
+  }
+
+  template<typename Value>
+  const typename art_map<Value>::leaf_node* art_map<Value>::lower_bound_leaf(
+    const node* current,
+    const std::string_view key,
+    size_t depth
+  ) {
+    if (current == nullptr) {
+      return nullptr;
+    }
+    if (current->is_leaf()) {
+      const auto* leaf = static_cast<const leaf_node*>(current);
+      return std::string_view(leaf->key) < key ? nullptr : leaf;
+    }
+
+    // All keys below share the compressed path, so it decides unless the key continues along it
+    const auto* inner = static_cast<const inner_node*>(current);
+    const auto order = key.substr(depth, inner->prefix.size()).compare(inner->prefix);
+    if (order != 0) {
+      return order < 0 ? minimum(inner) : nullptr;
+    }
+    depth += inner->prefix.size();
+    if (depth == key.size()) {
+      // The terminal key equals the key, the keys below the children are longer
+      return minimum(inner);
+    }
+
+    const auto byte = static_cast<std::uint8_t>(key[depth]);
+    if (const auto* found = lower_bound_leaf(find_child(inner, byte), key, depth + 1); found != nullptr) {
+      return found;
+    }
+    // The terminal key is a proper prefix of the key and less, so the next greater byte decides
+    const auto* next = next_child_after(inner, byte);
+    return next == nullptr ? nullptr : minimum(next);
+  }
+
+  template<typename Value>
+  const typename art_map<Value>::leaf_node* art_map<Value>::minimum(const node* current) {
+    while (!current->is_leaf()) {
+      const auto* inner = static_cast<const inner_node*>(current);
+      if (inner->terminal != nullptr) {
+        return inner->terminal.get();
+      }
+      size_t position = 0;
+      current = inner->next_child(position);
+    }
+    return static_cast<const leaf_node*>(current);
+  }
+
+  template<typename Value>
+  const typename art_map<Value>::node* art_map<Value>::next_child_after(const inner_node* inner, const std::uint8_t& byte) {
+    // next_child takes positions in the sorted byte arrays of Node4 and Node16, and bytes otherwise
+    size_t position = byte + 1;
+    if (inner->type == node_type::node4) {
+      const auto* sorted = static_cast<const node4*>(inner);
+      position = std::upper_bound(sorted->keys.begin(), sorted->keys.begin() + inner->count, byte) - sorted->keys.begin();
+    } else if (inner->type == node_type::node16) {
+      const auto* sorted = static_cast<const node16*>(inner);
+      position = std::upper_bound(sorted->keys.begin(), sorted->keys.begin() + inner->count, byte) - sorted->keys.begin();
+    }
+    return inner->next_child(position);
+  }
+
+  template<typename Value>
+  bool art_map<Value>::remove_from(std::unique_ptr<node>& slot, const std::string_view key, size_t depth) {
+    if (slot == nullptr) {
+      return false;
+    }
+    if (slot->is_leaf()) {
+      if (static_cast<leaf_node*>(slot.get())->key != key) {
+        return false;
+      }
+      slot.reset();
+      return true;
+    }
+
+    auto* inner = static_cast<inner_node*>(slot.get());
+    if (key.substr(depth, inner->prefix.size()) != inner->prefix) {
+      return false;
+    }
+    depth += inner->prefix.size();
+    if (depth == key.size()) {
+      if (inner->terminal == nullptr) {
+        return false;
+      }
+      inner->terminal.reset();
+      shrink(slot);
+      return true;
+    }
+
+    const auto byte = static_cast<std::uint8_t>(key[depth]);
+    auto* child = find_child(inner, byte);
+    if (child == nullptr || !remove_from(*child, key, depth + 1)) {
+      return false;
+    }
+    if (*child == nullptr) {
+      remove_child(inner, byte);
+      shrink(slot);
+    }
+    return true;
+  }
+
+  template<typename Value>
+  void art_map<Value>::place_leaf(std::unique_ptr<node>& slot, std::unique_ptr<leaf_node> leaf, const size_t& depth) {
+    if (leaf->key.size() == depth) {
+      static_cast<inner_node*>(slot.get())->terminal = std::move(leaf);
+      return;
+    }
+    const auto byte = static_cast<std::uint8_t>(leaf->key[depth]);
+    add_child(slot, byte, std::move(leaf));
+  }
+
+  template<typename Value>
+  std::unique_ptr<typename art_map<Value>::node>* art_map<Value>::find_child(inner_node* inner, const std::uint8_t& byte) {
+    switch (inner->type) {
+      case node_type::node4: {
+        auto* sorted = static_cast<node4*>(inner);
+        for (size_t index = 0; index < inner->count; ++index) {
+          if (sorted->keys[index] == byte) {
+            return &sorted->children[index];
+          }
+        }
+        return nullptr;
+      }
+      case node_type::node16: {
+        auto* sorted = static_cast<node16*>(inner);
+#if defined(__SSE2__)
+        // Compares the byte with all 16 keys at once, the lowest set bit of the mask is the match
+        const auto keys = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sorted->keys.data()));
+        const auto equal = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(byte)), keys);
+        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(equal)) & ((1U << inner->count) - 1);
+        return mask == 0 ? nullptr : &sorted->children[std::countr_zero(mask)];
+#else
+        for (size_t index = 0; index < inner->count; ++index) {
+          if (sorted->keys[index] == byte) {
+            return &sorted->children[index];
+          }
+        }
+        return nullptr;
+#endif
+      }
+      case node_type::node48: {
+        auto* indexed = static_cast<node48*>(inner);
+        const auto index = indexed->indices[byte];
+        return index == 0 ? nullptr : &indexed->children[index - 1];
+      }
+      default: {
+        auto* direct = static_cast<node256*>(inner);
+        return direct->children[byte] == nullptr ? nullptr : &direct->children[byte];
+      }
+    }
+  }
+
+  template<typename Value>
+  const typename art_map<Value>::node* art_map<Value>::find_child(const inner_node* inner, const std::uint8_t& byte) {
+    const auto* child = find_child(const_cast<inner_node*>(inner), byte);
+    return child == nullptr ? nullptr : child->get();
+  }
+
+  template<typename Value>
+  void art_map<Value>::add_child(std::unique_ptr<node>& slot, const std::uint8_t& byte, std::unique_ptr<node> child) {
+    auto* inner = static_cast<inner_node*>(slot.get());
+    const auto full = (inner->type == node_type::node4 && inner->count == 4)
+      || (inner->type == node_type::node16 && inner->count == 16)
+      || (inner->type == node_type::node48 && inner->count == 48);
+    if (full) {
+      grow(slot);
+      inner = static_cast<inner_node*>(slot.get());
+    }
+
+    // Node4 and Node16 keep their bytes sorted, so iteration visits the children in key order
+    const auto insert_sorted = [&](auto* sorted) {
+      const auto end = sorted->keys.begin() + inner->count;
+      const auto position = static_cast<size_t>(std::upper_bound(sorted->keys.begin(), end, byte) - sorted->keys.begin());
+      std::move_backward(sorted->keys.begin() + position, end, end + 1);
+      std::move_backward(sorted->children.begin() + position, sorted->children.begin() + inner->count, sorted->children.begin() + inner->count + 1);
+      sorted->keys[position] = byte;
+      sorted->children[position] = std::move(child);
+    };
+
+    switch (inner->type) {
+      case node_type::node4:
+        insert_sorted(static_cast<node4*>(inner));
+        break;
+      case node_type::node16:
+        insert_sorted(static_cast<node16*>(inner));
+        break;
+      case node_type::node48: {
+        auto* indexed = static_cast<node48*>(inner);
+        const auto free = std::ranges::find(indexed->children, nullptr, &std::unique_ptr<node>::get) - indexed->children.begin();
+        indexed->children[free] = std::move(child);
+        indexed->indices[byte] = static_cast<std::uint8_t>(free + 1);
+        break;
+      }
+      default:
+        static_cast<node256*>(inner)->children[byte] = std::move(child);
+        break;
+    }
+    inner->count++;
+  }
+
+  template<typename Value>
+  void art_map<Value>::remove_child(inner_node* inner, const std::uint8_t& byte) {
+    const auto remove_sorted = [&](auto* sorted) {
+      const auto end = sorted->keys.begin() + inner->count;
+      const auto position = std::find(sorted->keys.begin(), end, byte) - sorted->keys.begin();
+      std::move(sorted->keys.begin() + position + 1, end, sorted->keys.begin() + position);
+      std::move(sorted->children.begin() + position + 1, sorted->children.begin() + inner->count, sorted->children.begin() + position);
+    };
+
+    switch (inner->type) {
+      case node_type::node4:
+        remove_sorted(static_cast<node4*>(inner));
+        break;
+      case node_type::node16:
+        remove_sorted(static_cast<node16*>(inner));
+        break;
+      case node_type::node48: {
+        auto* indexed = static_cast<node48*>(inner);
+        indexed->children[indexed->indices[byte] - 1].reset();
+        indexed->indices[byte] = 0;
+        break;
+      }
+      default:
+        static_cast<node256*>(inner)->children[byte].reset();
+        break;
+    }
+    inner->count--;
+  }
+
+  template<typename Value>
+  void art_map<Value>::grow(std::unique_ptr<node>& slot) {
+    auto* inner = static_cast<inner_node*>(slot.get());
+    switch (inner->type) {
+      case node_type::node4: {
+        auto* old = static_cast<node4*>(inner);
+        auto grown = std::make_unique<node16>();
+        std::ranges::copy(old->keys, grown->keys.begin());
+        std::ranges::move(old->children, grown->children.begin());
+        move_header(old, grown.get());
+        slot = std::move(grown);
+        break;
+      }
+      case node_type::node16: {
+        auto* old = static_cast<node16*>(inner);
+        auto grown = std::make_unique<node48>();
+        for (size_t index = 0; index < old->count; ++index) {
+          grown->indices[old->keys[index]] = static_cast<std::uint8_t>(index + 1);
+          grown->children[index] = std::move(old->children[index]);
+        }
+        move_header(old, grown.get());
+        slot = std::move(grown);
+        break;
+      }
+      default: {
+        auto* old = static_cast<node48*>(inner);
+        auto grown = std::make_unique<node256>();
+        for (size_t byte = 0; byte < 256; ++byte) {
+          if (old->indices[byte] != 0) {
+            grown->children[byte] = std::move(old->children[old->indices[byte] - 1]);
+          }
+        }
+        move_header(old, grown.get());
+        slot = std::move(grown);
+        break;
+      }
+    }
+  }
+
+  template<typename Value>
+  void art_map<Value>::shrink(std::unique_ptr<node>& slot) {
+    // Nodes shrink well below the size they grow at, so alternating inserts and removals do not convert them back and forth
+    auto* inner = static_cast<inner_node*>(slot.get());
+    switch (inner->type) {
+      case node_type::node4:
+        collapse(slot);
+        break;
+      case node_type::node16: {
+        if (inner->count > 3) {
+          break;
+        }
+        auto* old = static_cast<node16*>(inner);
+        auto shrunk = std::make_unique<node4>();
+        std::copy_n(old->keys.begin(), old->count, shrunk->keys.begin());
+        std::move(old->children.begin(), old->children.begin() + old->count, shrunk->children.begin());
+        move_header(old, shrunk.get());
+        slot = std::move(shrunk);
+        break;
+      }
+      case node_type::node48: {
+        if (inner->count > 12) {
+          break;
+        }
+        auto* old = static_cast<node48*>(inner);
+        auto shrunk = std::make_unique<node16>();
+        size_t index = 0;
+        for (size_t byte = 0; byte < 256; ++byte) {
+          if (old->indices[byte] != 0) {
+            shrunk->keys[index] = static_cast<std::uint8_t>(byte);
+            shrunk->children[index++] = std::move(old->children[old->indices[byte] - 1]);
+          }
+        }
+        move_header(old, shrunk.get());
+        slot = std::move(shrunk);
+        break;
+      }
+      default: {
+        if (inner->count > 37) {
+          break;
+        }
+        auto* old = static_cast<node256*>(inner);
+        auto shrunk = std::make_unique<node48>();
+        size_t index = 0;
+        for (size_t byte = 0; byte < 256; ++byte) {
+          if (old->children[byte] != nullptr) {
+            shrunk->indices[byte] = static_cast<std::uint8_t>(index + 1);
+            shrunk->children[index++] = std::move(old->children[byte]);
+          }
+        }
+        move_header(old, shrunk.get());
+        slot = std::move(shrunk);
+        break;
+      }
+    }
+  }
+
+  template<typename Value>
+  void art_map<Value>::collapse(std::unique_ptr<node>& slot) {
+    // A Node4 left with a single entry is replaced by it, which keeps the paths compressed
+    auto* inner = static_cast<node4*>(slot.get());
+    if (inner->count == 0) {
+      slot = std::move(inner->terminal);
+      return;
+    }
+    if (inner->count > 1 || inner->terminal != nullptr) {
+      return;
+    }
+
+    auto child = std::move(inner->children[0]);
+    if (!child->is_leaf()) {
+      auto* child_inner = static_cast<inner_node*>(child.get());
+      child_inner->prefix = inner->prefix + static_cast<char>(inner->keys[0]) + child_inner->prefix;
+    }
+    slot = std::move(child);
+  }
+
+  template<typename Value>
+  void art_map<Value>::move_header(inner_node* from, inner_node* to) {
+    to->count = from->count;
+    to->prefix = std::move(from->prefix);
+    to->terminal = std::move(from->terminal);
+  }
+
+  template<typename Value>
+  size_t art_map<Value>::common_prefix_length(const std::string_view first, const std::string_view second) noexcept {
+    return static_cast<size_t>(std::ranges::mismatch(first, second).in1 - first.begin());
+  }
+}
\ No newline at end of file
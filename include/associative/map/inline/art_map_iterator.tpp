@@ -0,0 +1,69 @@
+#pragma once
+
+namespace containers::associative {
+  template<typename Node, typename Inner, typename Leaf, typename Value>
+  art_map_iterator<Node, Inner, Leaf, Value>::art_map_iterator() : current(nullptr) {}
+
+  template<typename Node, typename Inner, typename Leaf, typename Value>
+  art_map_iterator<Node, Inner, Leaf, Value>::art_map_iterator(const Node* root) : current(nullptr) {
+    if (root != nullptr) {
+      descend(root);
+    }
+  }
+
+  template<typename Node, typename Inner, typename Leaf, typename Value>
+  typename art_map_iterator<Node, Inner, Leaf, Value>::value_type art_map_iterator<Node, Inner, Leaf, Value>::operator*() const {
+    return std::make_pair(current->key, current->value);
+  }
+
+  template<typename Node, typename Inner, typename Leaf, typename Value>
+  const std::string& art_map_iterator<Node, Inner, Leaf, Value>::key() const {
+    return current->key;
+  }
+
+  template<typename Node, typename Inner, typename Leaf, typename Value>
+  const Value& art_map_iterator<Node, Inner, Leaf, Value>::value() const {
+    return current->value;
+  }
+
+  template<typename Node, typename Inner, typename Leaf, typename Value>
+  art_map_iterator<Node, Inner, Leaf, Value>& art_map_iterator<Node, Inner, Leaf, Value>::operator++() {
+    while (!path.empty()) {
+      auto& top = path.back();
+      if (const auto* child = top.inner->next_child(top.position); child != nullptr) {
+        descend(child);
+        return *this;
+      }
+      path.pop_back();
+    }
+    current = nullptr;
+    return *this;
+  }
+
+  template<typename Node, typename Inner, typename Leaf, typename Value>
+  art_map_iterator<Node, Inner, Leaf, Value> art_map_iterator<Node, Inner, Leaf, Value>::operator++(int) {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  template<typename Node, typename Inner, typename Leaf, typename Value>
+  bool art_map_iterator<Node, Inner, Leaf, Value>::operator==(const art_map_iterator& other) const {
+    return current == other.current;
+  }
+
+  template<typename Node, typename Inner, typename Leaf, typename Value>
+  void art_map_iterator<Node, Inner, Leaf, Value>::descend(const Node* node) {
+    // The key ending at an inner node is smaller than all keys of its children
+    while (!node->is_leaf()) {
+      const auto* inner = static_cast<const Inner*>(node);
+      path.push_back(frame{inner, 0});
+      if (inner->terminal != nullptr) {
+        current = inner->terminal.get();
+        return;
+      }
+      node = inner->next_child(path.back().position);
+    }
+    current = static_cast<const Leaf*>(node);
+  }
+}
\ No newline at end of file
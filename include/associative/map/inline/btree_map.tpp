@@ -0,0 +1,151 @@
+#pragma once
+
+#include "associative/duplicate_key.hpp"
+#include "associative/map/value_not_found.hpp"
+
+namespace containers::associative {
+  template<typename Key, typename Value, size_t Capacity>
+  btree_map<Key, Value, Capacity>::btree_map() = default;
+
+  template<typename Key, typename Value, size_t Capacity>
+  void btree_map<Key, Value, Capacity>::insert(const Key& key, const Value& value) {
+    if (!try_insert(key, value)) {
+      throw duplicate_key<Key>(key);
+    }
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  void btree_map<Key, Value, Capacity>::insert_safely(const Key& key, const Value& value) {
+    if (tree.insert(key, value, [](Value&) {})) {
+      container::number_elements++;
+    }
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  std::expected<void, container_error> btree_map<Key, Value, Capacity>::try_insert(const Key& key, const Value& value) {
+    if (!tree.insert(key, value, [](Value&) {})) {
+      return std::unexpected(container_error::duplicate_key);
+    }
+    container::number_elements++;
+    return {};
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  void btree_map<Key, Value, Capacity>::upsert(const Key& key, const Value& value) {
+    if (tree.insert(key, value, [&value](Value& existing) { existing = value; })) {
+      container::number_elements++;
+    }
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  std::optional<Value> btree_map<Key, Value, Capacity>::find_by_key(const Key& key) const {
+    const auto* leaf = tree.find_leaf(key);
+    const auto position = core_t::key_index(leaf, key);
+    if (position == leaf->count || key < leaf->keys[position]) {
+      return std::nullopt;
+    }
+    return leaf->payloads[position];
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  Value btree_map<Key, Value, Capacity>::find_by_key_or_throw(const Key& key) const {
+    const auto& optional = find_by_key(key);
+    if (!optional.has_value()) {
+      throw value_not_found<Key>(key);
+    }
+    return optional.value();
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  void btree_map<Key, Value, Capacity>::remove(const Key& key) {
+    if (tree.remove(key, [](Value&) { return true; })) {
+      container::number_elements--;
+    }
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  std::optional<std::pair<Key, Value>> btree_map<Key, Value, Capacity>::find_lower_bound(const Key& key) const {
+    const auto iterator = lower_bound(key);
+    if (iterator == end()) {
+      return std::nullopt;
+    }
+    return *iterator;
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  std::optional<std::pair<Key, Value>> btree_map<Key, Value, Capacity>::find_upper_bound(const Key& key) const {
+    const auto iterator = upper_bound(key);
+    if (iterator == end()) {
+      return std::nullopt;
+    }
+    return *iterator;
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  template<std::ranges::input_range Range>
+  void btree_map<Key, Value, Capacity>::build_from_sorted(Range&& pairs) {
+    container::number_elements = tree.build_from_sorted(std::forward<Range>(pairs));
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  void btree_map<Key, Value, Capacity>::clear() {
+    tree.clear();
+    container::number_elements = 0;
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  typename btree_map<Key, Value, Capacity>::iterator_t btree_map<Key, Value, Capacity>::lower_bound(const Key& key) const {
+    const auto* leaf = tree.find_leaf(key);
+    return make_iterator(leaf, core_t::key_index(leaf, key));
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  typename btree_map<Key, Value, Capacity>::iterator_t btree_map<Key, Value, Capacity>::upper_bound(const Key& key) const {
+    const auto* leaf = tree.find_leaf(key);
+    const auto position = std::upper_bound(leaf->keys.begin(), leaf->keys.begin() + leaf->count, key) - leaf->keys.begin();
+    return make_iterator(leaf, position);
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  std::ranges::subrange<typename btree_map<Key, Value, Capacity>::iterator_t> btree_map<Key, Value, Capacity>::range(
+    const Key& first,
+    const Key& last
+  ) const {
+    if (!(first < last)) {
+      return {end(), end()};
+    }
+    return {lower_bound(first), lower_bound(last)};
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  typename btree_map<Key, Value, Capacity>::iterator_t btree_map<Key, Value, Capacity>::begin() const {
+    return make_iterator(tree.first_leaf(), 0);
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  typename btree_map<Key, Value, Capacity>::iterator_t btree_map<Key, Value, Capacity>::end() const {
+    return iterator_t();
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  typename btree_map<Key, Value, Capacity>::iterator_t btree_map<Key, Value, Capacity>::cbegin() const {
+    return begin();
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  typename btree_map<Key, Value, Capacity>::iterator_t btree_map<Key, Value, Capacity>::cend() const {
+    return end();
+  }
+
+  template<typename Key, typename Value, size_t Capacity>
+  typename btree_map<Key, Value, Capacity>::iterator_t btree_map<Key, Value, Capacity>::make_iterator(
+    const leaf_node* leaf,
+    const size_t& index
+  ) {
+    // Only an empty root is an empty leaf, so the next leaf always starts with a pair
+    if (index == leaf->count) {
+      return leaf->next != nullptr ? iterator_t(leaf->next, 0) : iterator_t();
+    }
+    return iterator_t(leaf, index);
+  }
+}
\ No newline at end of file
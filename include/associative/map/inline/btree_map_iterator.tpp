@@ -0,0 +1,49 @@
+#pragma once
+
+namespace containers::associative {
+  template<typename Leaf, typename Key, typename Value>
+  btree_map_iterator<Leaf, Key, Value>::btree_map_iterator()
+    : leaf(nullptr), index(0) {}
+
+  template<typename Leaf, typename Key, typename Value>
+  btree_map_iterator<Leaf, Key, Value>::btree_map_iterator(
+    const Leaf* leaf,
+    const size_t& index
+  ) : leaf(leaf), index(index) {}
+
+  template<typename Leaf, typename Key, typename Value>
+  typename btree_map_iterator<Leaf, Key, Value>::value_type btree_map_iterator<Leaf, Key, Value>::operator*() const {
+    return std::make_pair(leaf->keys[index], leaf->payloads[index]);
+  }
+
+  template<typename Leaf, typename Key, typename Value>
+  const Key& btree_map_iterator<Leaf, Key, Value>::key() const {
+    return leaf->keys[index];
+  }
+
+  template<typename Leaf, typename Key, typename Value>
+  const Value& btree_map_iterator<Leaf, Key, Value>::value() const {
+    return leaf->payloads[index];
+  }
+
+  template<typename Leaf, typename Key, typename Value>
+  btree_map_iterator<Leaf, Key, Value>& btree_map_iterator<Leaf, Key, Value>::operator++() {
+    if (++index == leaf->count) {
+      leaf = leaf->next;
+      index = 0;
+    }
+    return *this;
+  }
+
+  template<typename Leaf, typename Key, typename Value>
+  btree_map_iterator<Leaf, Key, Value> btree_map_iterator<Leaf, Key, Value>::operator++(int) {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  template<typename Leaf, typename Key, typename Value>
+  bool btree_map_iterator<Leaf, Key, Value>::operator==(const btree_map_iterator& other) const {
+    return leaf == other.leaf && index == other.index;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,168 @@
+#pragma once
+
+#include "associative/duplicate_key.hpp"
+#include "associative/map/value_not_found.hpp"
+
+namespace containers::associative {
+  template<typename Key, typename Value>
+  expiring_hash_map<Key, Value>::expiring_hash_map(
+    const std::function<hash_t(const Key&)>& hash_function,
+    const duration_t& default_ttl,
+    const duration_t& resolution,
+    const now_t& now
+  ) :
+    default_ttl(default_ttl),
+    resolution(resolution),
+    now(now),
+    origin(now()),
+    hash_function(hash_function),
+    entries(std::make_unique<hash_map<Key, entry_t>>(hash_function))
+  {}
+
+  template<typename Key, typename Value>
+  void expiring_hash_map<Key, Value>::insert(const Key& key, const Value& value) {
+    insert(key, value, default_ttl);
+  }
+
+  template<typename Key, typename Value>
+  void expiring_hash_map<Key, Value>::insert(const Key& key, const Value& value, const duration_t& ttl) {
+    const auto time = now();
+    expire_until(time);
+    if (find_live(key, time).has_value()) {
+      throw duplicate_key<Key>(key);
+    }
+    write(key, value, time + ttl);
+  }
+
+  template<typename Key, typename Value>
+  void expiring_hash_map<Key, Value>::upsert(const Key& key, const Value& value) {
+    upsert(key, value, default_ttl);
+  }
+
+  template<typename Key, typename Value>
+  void expiring_hash_map<Key, Value>::upsert(const Key& key, const Value& value, const duration_t& ttl) {
+    const auto time = now();
+    expire_until(time);
+    write(key, value, time + ttl);
+  }
+
+  template<typename Key, typename Value>
+  bool expiring_hash_map<Key, Value>::touch(const Key& key) {
+    return touch(key, default_ttl);
+  }
+
+  template<typename Key, typename Value>
+  bool expiring_hash_map<Key, Value>::touch(const Key& key, const duration_t& ttl) {
+    const auto time = now();
+    expire_until(time);
+    const auto entry = find_live(key, time);
+    if (!entry.has_value()) {
+      return false;
+    }
+    write(key, entry->first, time + ttl);
+    return true;
+  }
+
+  template<typename Key, typename Value>
+  std::optional<Value> expiring_hash_map<Key, Value>::find_by_key(const Key& key) const {
+    const auto entry = find_live(key, now());
+    return entry.has_value() ? std::optional{entry->first} : std::nullopt;
+  }
+
+  template<typename Key, typename Value>
+  Value expiring_hash_map<Key, Value>::find_by_key_or_throw(const Key& key) const {
+    const auto& optional = find_by_key(key);
+    if (!optional.has_value()) {
+      throw value_not_found<Key>(key);
+    }
+    return optional.value();
+  }
+
+  template<typename Key, typename Value>
+  bool expiring_hash_map<Key, Value>::exists(const Key& key) const {
+    return find_live(key, now()).has_value();
+  }
+
+  template<typename Key, typename Value>
+  std::optional<typename expiring_hash_map<Key, Value>::duration_t> expiring_hash_map<Key, Value>::time_to_live(
+    const Key& key
+  ) const {
+    const auto time = now();
+    const auto entry = find_live(key, time);
+    return entry.has_value() ? std::optional{entry->second - time} : std::nullopt;
+  }
+
+  template<typename Key, typename Value>
+  bool expiring_hash_map<Key, Value>::remove(const Key& key) {
+    const auto time = now();
+    expire_until(time);
+    const auto removed = find_live(key, time).has_value();
+    entries->remove(key);
+    container::number_elements = entries->size();
+    return removed;
+  }
+
+  template<typename Key, typename Value>
+  size_t expiring_hash_map<Key, Value>::expire() {
+    return expire_until(now());
+  }
+
+  template<typename Key, typename Value>
+  void expiring_hash_map<Key, Value>::clear() {
+    // A fresh map frees the old one in a single pass instead of looking up every key to remove it
+    entries = std::make_unique<hash_map<Key, entry_t>>(hash_function);
+    wheel.clear();
+    container::number_elements = 0;
+  }
+
+  template<typename Key, typename Value>
+  std::uint64_t expiring_hash_map<Key, Value>::tick_at_or_after(const time_point_t& time) const {
+    if (time <= origin) {
+      return 0;
+    }
+    return static_cast<std::uint64_t>((time - origin + resolution - duration_t(1)) / resolution);
+  }
+
+  template<typename Key, typename Value>
+  std::uint64_t expiring_hash_map<Key, Value>::tick_at_or_before(const time_point_t& time) const {
+    if (time <= origin) {
+      return 0;
+    }
+    return static_cast<std::uint64_t>((time - origin) / resolution);
+  }
+
+  template<typename Key, typename Value>
+  std::optional<typename expiring_hash_map<Key, Value>::entry_t> expiring_hash_map<Key, Value>::find_live(
+    const Key& key,
+    const time_point_t& time
+  ) const {
+    const auto entry = entries->find_by_key(key);
+    if (!entry.has_value() || entry->second <= time) {
+      return std::nullopt;
+    }
+    return entry;
+  }
+
+  template<typename Key, typename Value>
+  void expiring_hash_map<Key, Value>::write(const Key& key, const Value& value, const time_point_t& expires_at) {
+    entries->upsert(key, entry_t(value, expires_at));
+    wheel.schedule(key, tick_at_or_after(expires_at));
+    container::number_elements = entries->size();
+  }
+
+  template<typename Key, typename Value>
+  size_t expiring_hash_map<Key, Value>::expire_until(const time_point_t& time) {
+    auto removed = size_t{0};
+    // Every entry due at or before the tick containing `time` has expired by then
+    wheel.advance(tick_at_or_before(time), [this, &removed](const Key& key, const std::uint64_t& deadline) {
+      const auto entry = entries->find_by_key(key);
+      // Records of expiry times which have been replaced since are stale
+      if (entry.has_value() && tick_at_or_after(entry->second) == deadline) {
+        entries->remove(key);
+        ++removed;
+      }
+    });
+    container::number_elements = entries->size();
+    return removed;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,221 @@
+#pragma once
+
+#include <algorithm>
+
+#include "associative/branchless_search.hpp"
+#include "associative/duplicate_key.hpp"
+#include "associative/map/value_not_found.hpp"
+
+namespace containers::associative {
+  template<typename Key, typename Value>
+  template<std::ranges::input_range Range>
+  flat_ordered_map<Key, Value>::flat_ordered_map(Range&& pairs) {
+    insert_batch(std::forward<Range>(pairs));
+  }
+
+  template<typename Key, typename Value>
+  void flat_ordered_map<Key, Value>::insert(const Key& key, const Value& value) {
+    if (!insert_if_absent(key, value)) {
+      throw duplicate_key<Key>(key);
+    }
+  }
+
+  template<typename Key, typename Value>
+  void flat_ordered_map<Key, Value>::insert_safely(const Key& key, const Value& value) {
+    insert_if_absent(key, value);
+  }
+
+  template<typename Key, typename Value>
+  std::expected<void, container_error> flat_ordered_map<Key, Value>::try_insert(const Key& key, const Value& value) {
+    if (!insert_if_absent(key, value)) {
+      return std::unexpected(container_error::duplicate_key);
+    }
+    return {};
+  }
+
+  template<typename Key, typename Value>
+  std::optional<Value> flat_ordered_map<Key, Value>::find_by_key(const Key& key) const {
+    const auto index = key_index(key);
+    if (!contains_at(index, key)) {
+      return std::nullopt;
+    }
+    return sorted_values[index];
+  }
+
+  template<typename Key, typename Value>
+  Value flat_ordered_map<Key, Value>::find_by_key_or_throw(const Key& key) const {
+    const auto& optional = find_by_key(key);
+    if (!optional.has_value()) {
+      throw value_not_found<Key>(key);
+    }
+    return optional.value();
+  }
+
+  template<typename Key, typename Value>
+  void flat_ordered_map<Key, Value>::remove(const Key& key) {
+    const auto index = key_index(key);
+    if (!contains_at(index, key)) {
+      return;
+    }
+    sorted_keys.erase(sorted_keys.begin() + index);
+    sorted_values.erase(sorted_values.begin() + index);
+    container::number_elements--;
+  }
+
+  template<typename Key, typename Value>
+  std::optional<std::pair<Key, Value>> flat_ordered_map<Key, Value>::find_lower_bound(const Key& key) const {
+    const auto iterator = lower_bound(key);
+    if (iterator == end()) {
+      return std::nullopt;
+    }
+    return *iterator;
+  }
+
+  template<typename Key, typename Value>
+  std::optional<std::pair<Key, Value>> flat_ordered_map<Key, Value>::find_upper_bound(const Key& key) const {
+    const auto iterator = upper_bound(key);
+    if (iterator == end()) {
+      return std::nullopt;
+    }
+    return *iterator;
+  }
+
+  template<typename Key, typename Value>
+  void flat_ordered_map<Key, Value>::upsert(const Key& key, const Value& value) {
+    const auto index = key_index(key);
+    if (contains_at(index, key)) {
+      sorted_values[index] = value;
+      return;
+    }
+    sorted_keys.insert(sorted_keys.begin() + index, key);
+    sorted_values.insert(sorted_values.begin() + index, value);
+    container::number_elements++;
+  }
+
+  template<typename Key, typename Value>
+  template<std::ranges::input_range Range>
+  void flat_ordered_map<Key, Value>::insert_batch(Range&& pairs) {
+    const auto added = sort_unique(std::forward<Range>(pairs));
+    auto keys = std::vector<Key>();
+    auto values = std::vector<Value>();
+    keys.reserve(sorted_keys.size() + added.size());
+    values.reserve(sorted_keys.size() + added.size());
+
+    // Merges both sorted sequences, a key in both is taken from the stored ones
+    auto existing = size_t{0};
+    auto next = added.begin();
+    while (existing < sorted_keys.size() || next != added.end()) {
+      if (next == added.end() || (existing < sorted_keys.size() && !(next->first < sorted_keys[existing]))) {
+        if (next != added.end() && !(sorted_keys[existing] < next->first)) {
+          ++next;
+        }
+        keys.push_back(std::move(sorted_keys[existing]));
+        values.push_back(std::move(sorted_values[existing]));
+        ++existing;
+      } else {
+        keys.push_back(next->first);
+        values.push_back(next->second);
+        ++next;
+      }
+    }
+
+    sorted_keys = std::move(keys);
+    sorted_values = std::move(values);
+    container::number_elements = sorted_keys.size();
+  }
+
+  template<typename Key, typename Value>
+  void flat_ordered_map<Key, Value>::clear() {
+    sorted_keys.clear();
+    sorted_values.clear();
+    container::number_elements = 0;
+  }
+
+  template<typename Key, typename Value>
+  typename flat_ordered_map<Key, Value>::iterator_t flat_ordered_map<Key, Value>::lower_bound(const Key& key) const {
+    return make_iterator(key_index(key));
+  }
+
+  template<typename Key, typename Value>
+  typename flat_ordered_map<Key, Value>::iterator_t flat_ordered_map<Key, Value>::upper_bound(const Key& key) const {
+    const auto index = key_index(key);
+    return make_iterator(contains_at(index, key) ? index + 1 : index);
+  }
+
+  template<typename Key, typename Value>
+  std::span<const Key> flat_ordered_map<Key, Value>::keys() const noexcept {
+    return sorted_keys;
+  }
+
+  template<typename Key, typename Value>
+  std::span<const Value> flat_ordered_map<Key, Value>::values() const noexcept {
+    return sorted_values;
+  }
+
+  template<typename Key, typename Value>
+  typename flat_ordered_map<Key, Value>::iterator_t flat_ordered_map<Key, Value>::begin() const {
+    return make_iterator(0);
+  }
+
+  template<typename Key, typename Value>
+  typename flat_ordered_map<Key, Value>::iterator_t flat_ordered_map<Key, Value>::end() const {
+    return make_iterator(sorted_keys.size());
+  }
+
+  template<typename Key, typename Value>
+  typename flat_ordered_map<Key, Value>::iterator_t flat_ordered_map<Key, Value>::cbegin() const {
+    return begin();
+  }
+
+  template<typename Key, typename Value>
+  typename flat_ordered_map<Key, Value>::iterator_t flat_ordered_map<Key, Value>::cend() const {
+    return end();
+  }
+
+  template<typename Key, typename Value>
+  bool flat_ordered_map<Key, Value>::insert_if_absent(const Key& key, const Value& value) {
+    const auto index = key_index(key);
+    if (contains_at(index, key)) {
+      return false;
+    }
+    sorted_keys.insert(sorted_keys.begin() + index, key);
+    sorted_values.insert(sorted_values.begin() + index, value);
+    container::number_elements++;
+    return true;
+  }
+
+  template<typename Key, typename Value>
+  template<std::ranges::input_range Range>
+  std::vector<std::pair<Key, Value>> flat_ordered_map<Key, Value>::sort_unique(Range&& pairs) {
+    auto sorted = std::vector<std::pair<Key, Value>>();
+    for (auto&& pair : pairs) {
+      sorted.emplace_back(std::get<0>(pair), std::get<1>(pair));
+    }
+
+    // Stable, so the first of several pairs with the same key stays in front and is kept
+    const auto by_key = [](const auto& pair) -> const Key& { return pair.first; };
+    if (!std::ranges::is_sorted(sorted, {}, by_key)) {
+      std::ranges::stable_sort(sorted, {}, by_key);
+    }
+    const auto repeated = std::ranges::unique(sorted, [](const auto& first, const auto& second) {
+      return !(first.first < second.first);
+    });
+    sorted.erase(repeated.begin(), repeated.end());
+    return sorted;
+  }
+
+  template<typename Key, typename Value>
+  size_t flat_ordered_map<Key, Value>::key_index(const Key& key) const noexcept {
+    return branchless_lower_bound(std::span<const Key>(sorted_keys), key);
+  }
+
+  template<typename Key, typename Value>
+  bool flat_ordered_map<Key, Value>::contains_at(const size_t& index, const Key& key) const noexcept {
+    return index < sorted_keys.size() && !(key < sorted_keys[index]);
+  }
+
+  template<typename Key, typename Value>
+  typename flat_ordered_map<Key, Value>::iterator_t flat_ordered_map<Key, Value>::make_iterator(const size_t& index) const {
+    return iterator_t(sorted_keys.data() + index, sorted_values.data() + index);
+  }
+}
\ No newline at end of file
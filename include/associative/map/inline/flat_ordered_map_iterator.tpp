@@ -0,0 +1,47 @@
+#pragma once
+
+namespace containers::associative {
+  template<typename Key, typename Value>
+  flat_ordered_map_iterator<Key, Value>::flat_ordered_map_iterator()
+    : key_pointer(nullptr), value_pointer(nullptr) {}
+
+  template<typename Key, typename Value>
+  flat_ordered_map_iterator<Key, Value>::flat_ordered_map_iterator(
+    const Key* key_pointer,
+    const Value* value_pointer
+  ) : key_pointer(key_pointer), value_pointer(value_pointer) {}
+
+  template<typename Key, typename Value>
+  typename flat_ordered_map_iterator<Key, Value>::value_type flat_ordered_map_iterator<Key, Value>::operator*() const {
+    return std::make_pair(*key_pointer, *value_pointer);
+  }
+
+  template<typename Key, typename Value>
+  const Key& flat_ordered_map_iterator<Key, Value>::key() const {
+    return *key_pointer;
+  }
+
+  template<typename Key, typename Value>
+  const Value& flat_ordered_map_iterator<Key, Value>::value() const {
+    return *value_pointer;
+  }
+
+  template<typename Key, typename Value>
+  flat_ordered_map_iterator<Key, Value>& flat_ordered_map_iterator<Key, Value>::operator++() {
+    ++key_pointer;
+    ++value_pointer;
+    return *this;
+  }
+
+  template<typename Key, typename Value>
+  flat_ordered_map_iterator<Key, Value> flat_ordered_map_iterator<Key, Value>::operator++(int) {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  template<typename Key, typename Value>
+  bool flat_ordered_map_iterator<Key, Value>::operator==(const flat_ordered_map_iterator& other) const {
+    return key_pointer == other.key_pointer;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <vector>
+
+#include "associative/map/value_not_found.hpp"
+
+namespace containers::associative {
+  template<typename Key, typename Value, size_t Extent, typename Hash>
+  constexpr frozen_map<Key, Value, Extent, Hash>::frozen_map(const std::array<value_type, Extent>& pairs) requires (Extent != std::dynamic_extent) {
+    const auto slots = hash.build(pairs, [](const value_type& pair) -> const Key& { return pair.first; });
+    for (size_t index = 0; index < Extent; ++index) {
+      this->pairs[slots[index]] = pairs[index];
+    }
+    container::number_elements = Extent;
+  }
+
+  template<typename Key, typename Value, size_t Extent, typename Hash>
+  template<std::ranges::input_range Range>
+  frozen_map<Key, Value, Extent, Hash>::frozen_map(Range&& pairs) requires (Extent == std::dynamic_extent) {
+    auto elements = std::vector<value_type>();
+    for (auto&& [key, value] : pairs) {
+      elements.emplace_back(key, value);
+    }
+    const auto slots = hash.build(elements, [](const value_type& pair) -> const Key& { return pair.first; });
+    this->pairs.resize(elements.size());
+    for (size_t index = 0; index < elements.size(); ++index) {
+      this->pairs[slots[index]] = std::move(elements[index]);
+    }
+    container::number_elements = elements.size();
+  }
+
+  template<typename Key, typename Value, size_t Extent, typename Hash>
+  constexpr std::optional<Value> frozen_map<Key, Value, Extent, Hash>::find_by_key(const Key& key) const {
+    const auto* pair = find_pair(key);
+    return pair != nullptr ? std::optional<Value>(pair->second) : std::nullopt;
+  }
+
+  template<typename Key, typename Value, size_t Extent, typename Hash>
+  constexpr const Value& frozen_map<Key, Value, Extent, Hash>::find_by_key_or_throw(const Key& key) const {
+    const auto* pair = find_pair(key);
+    if (pair == nullptr) {
+      throw value_not_found<Key>(key);
+    }
+    return pair->second;
+  }
+
+  template<typename Key, typename Value, size_t Extent, typename Hash>
+  constexpr bool frozen_map<Key, Value, Extent, Hash>::exists(const Key& key) const noexcept {
+    return find_pair(key) != nullptr;
+  }
+
+  template<typename Key, typename Value, size_t Extent, typename Hash>
+  constexpr auto frozen_map<Key, Value, Extent, Hash>::begin() const noexcept {
+    return pairs.begin();
+  }
+
+  template<typename Key, typename Value, size_t Extent, typename Hash>
+  constexpr auto frozen_map<Key, Value, Extent, Hash>::end() const noexcept {
+    return pairs.end();
+  }
+
+  template<typename Key, typename Value, size_t Extent, typename Hash>
+  constexpr const typename frozen_map<Key, Value, Extent, Hash>::value_type* frozen_map<Key, Value, Extent, Hash>::find_pair(const Key& key) const noexcept {
+    if (pairs.empty()) {
+      return nullptr;
+    }
+    const auto& pair = pairs[hash.slot(key)];
+    return pair.first == key ? &pair : nullptr;
+  }
+}
\ No newline at end of file
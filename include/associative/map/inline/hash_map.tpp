@@ -8,8 +8,8 @@
 #include "associative/duplicate_key.hpp"
 
 namespace containers::associative {
-  template<typename Key, typename Value>
-  hash_map<Key, Value>::hash_map(
+  template<typename Key, typename Value, bool Statistics>
+  hash_map<Key, Value, Statistics>::hash_map(
     const std::function<hash_t(const Key&)>& hash_function,
     const size_t& bucket_count
   ) :
@@ -23,8 +23,8 @@ namespace containers::associative {
     }
   }
 
-  template<typename Key, typename Value>
-  hash_map<Key, Value>::hash_map(
+  template<typename Key, typename Value, bool Statistics>
+  hash_map<Key, Value, Statistics>::hash_map(
     const std::function<hash_t(const Key&)>& hash_function
   ) : hash_function(hash_function),
     buckets_ptr(std::make_shared<sequential::doubly_linked_list<bucket_t>>(sequential::doubly_linked_list<bucket_t>()))
@@ -32,50 +32,72 @@ namespace containers::associative {
     buckets_ptr->push_front(sequential::doubly_linked_list<std::tuple<Key, Value, hash_t>>());
   }
 
-  template<typename Key, typename Value>
-  void hash_map<Key, Value>::insert(const Key& key, const Value& value) {
-    insert_with_optional_throw(key, value, true);
+  template<typename Key, typename Value, bool Statistics>
+  void hash_map<Key, Value, Statistics>::insert(const Key& key, const Value& value) {
+    if (!insert_if_absent(key, value)) {
+      throw duplicate_key<Key>(key);
+    }
   }
 
-  template<typename Key, typename Value>
-  void hash_map<Key, Value>::insert_safely(const Key& key, const Value& value) {
-    insert_with_optional_throw(key, value, false);
+  template<typename Key, typename Value, bool Statistics>
+  void hash_map<Key, Value, Statistics>::insert_safely(const Key& key, const Value& value) {
+    insert_if_absent(key, value);
   }
 
-  template<typename Key, typename Value>
-  void hash_map<Key, Value>::insert_with_optional_throw(
-    const Key& key,
-    const Value& value,
-    const bool throw_exception
-  ) {
+  template<typename Key, typename Value, bool Statistics>
+  std::expected<void, container_error> hash_map<Key, Value, Statistics>::try_insert(const Key& key, const Value& value) {
+    if (!insert_if_absent(key, value)) {
+      return std::unexpected(container_error::duplicate_key);
+    }
+    return {};
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  bool hash_map<Key, Value, Statistics>::insert_if_absent(const Key& key, const Value& value) {
     auto& bucket = find_bucket_by_key(key);
     const auto exists = std::ranges::find_if(bucket, [&key](const auto& tuple_pointer) {
       return std::get<0>(tuple_pointer->data) == key;
     });
-
-    if (exists == bucket.end()) {
-      bucket.push_back(std::make_tuple(key, value, hash_function(key)));
-      container::number_elements++;
-    } else if (throw_exception) {
-      throw duplicate_key<Key>(key);
+    if (exists != bucket.end()) {
+      return false;
     }
 
+    bucket.push_back(std::make_tuple(key, value, hash_function(key)));
+    container::number_elements++;
     if (calculate_load_factor() >= 0.75) {
       redistribute_buckets(buckets_ptr->size() * 2);
     }
+    return true;
   }
 
-  template<typename Key, typename Value>
-  std::optional<Value> hash_map<Key, Value>::find_by_key(const Key& key) const {
+  template<typename Key, typename Value, bool Statistics>
+  void hash_map<Key, Value, Statistics>::upsert(const Key& key, const Value& value) {
     auto& bucket = find_bucket_by_key(key);
-    const auto it = std::ranges::find_if(bucket, [&key](const auto& tuple_pointer) {
+    const auto exists = std::ranges::find_if(bucket, [&key](const auto& tuple_pointer) {
       return std::get<0>(tuple_pointer->data) == key;
     });
+
+    if (exists != bucket.end()) {
+      std::get<1>((*exists)->data) = value;
+      return;
+    }
+    insert_if_absent(key, value);
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  std::optional<Value> hash_map<Key, Value, Statistics>::find_by_key(const Key& key) const {
+    auto& bucket = find_bucket_by_key(key);
+    auto probes = size_t{0};
+    const auto it = std::ranges::find_if(bucket, [&key, &probes](const auto& tuple_pointer) {
+      ++probes;
+      return std::get<0>(tuple_pointer->data) == key;
+    });
+    counters.count_lookup(it != bucket.end(), probes);
     return it != bucket.end() ? std::optional{std::get<1>((*it)->data)} : std::nullopt;
   }
 
-  template<typename Key, typename Value>
-  Value hash_map<Key, Value>::find_by_key_or_throw(const Key& key) const {
+  template<typename Key, typename Value, bool Statistics>
+  Value hash_map<Key, Value, Statistics>::find_by_key_or_throw(const Key& key) const {
     const auto& optional = find_by_key(key);
     if (!optional.has_value()) {
       throw value_not_found<Key>(key);
@@ -83,8 +105,8 @@ namespace containers::associative {
     return optional.value();
   }
 
-  template<typename Key, typename Value>
-  void hash_map<Key, Value>::remove(const Key& key) {
+  template<typename Key, typename Value, bool Statistics>
+  void hash_map<Key, Value, Statistics>::remove(const Key& key) {
     auto& bucket = find_bucket_by_key(key);
     const auto initial_size = bucket.size();
     for (const auto& tuple_pointer : bucket) {
@@ -99,8 +121,8 @@ namespace containers::associative {
     }
   }
 
-  template<typename Key, typename Value>
-  typename hash_map<Key, Value>::bucket_t& hash_map<Key, Value>::find_bucket_by_key(
+  template<typename Key, typename Value, bool Statistics>
+  typename hash_map<Key, Value, Statistics>::bucket_t& hash_map<Key, Value, Statistics>::find_bucket_by_key(
     const Key& key
   ) {
     const auto hash = hash_function(key);
@@ -108,21 +130,22 @@ namespace containers::associative {
     return buckets_ptr->at(bucket_index)->data;
   }
 
-  template<typename Key, typename Value>
-  const typename hash_map<Key, Value>::bucket_t& hash_map<Key, Value>::find_bucket_by_key(
+  template<typename Key, typename Value, bool Statistics>
+  const typename hash_map<Key, Value, Statistics>::bucket_t& hash_map<Key, Value, Statistics>::find_bucket_by_key(
     const Key& key
   ) const {
     return const_cast<hash_map*>(this)->find_bucket_by_key(key);
   }
 
-  template<typename Key, typename Value>
-  double hash_map<Key, Value>::calculate_load_factor() const noexcept {
+  template<typename Key, typename Value, bool Statistics>
+  double hash_map<Key, Value, Statistics>::calculate_load_factor() const noexcept {
     return static_cast<double>(container::number_elements)
       / static_cast<double>(buckets_ptr->size());
   }
 
-  template<typename Key, typename Value>
-  void hash_map<Key, Value>::redistribute_buckets(const size_t& new_size) {
+  template<typename Key, typename Value, bool Statistics>
+  void hash_map<Key, Value, Statistics>::redistribute_buckets(const size_t& new_size) {
+    const auto rehash_start = counters.start_rehash();
     bucket_t existing;
     for (const auto& bucket_ptr : *buckets_ptr) {
       for (const auto& element : bucket_ptr->data) {
@@ -141,27 +164,112 @@ namespace containers::associative {
       const auto bucket_index = hash % buckets_ptr->size();
       buckets_ptr->at(bucket_index)->data.push_back(tuple);
     }
+    counters.count_rehash(rehash_start);
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  hash_statistics hash_map<Key, Value, Statistics>::stats() const requires Statistics {
+    return collect_hash_statistics(*buckets_ptr, container::number_elements, 0, counters);
   }
 
-  template<typename Key, typename Value>
-  hash_map_iterator<typename hash_map<Key, Value>::bucket_t, Key, Value> hash_map<Key, Value>::begin() {
+  template<typename Key, typename Value, bool Statistics>
+  hash_map_iterator<typename hash_map<Key, Value, Statistics>::bucket_t, Key, Value> hash_map<Key, Value, Statistics>::begin() {
     const auto first_non_empty = hash_map_iterator<bucket_t, Key, Value>::calculate_next_non_empty_bucket_index(*buckets_ptr, 0);
     return hash_map_iterator<bucket_t, Key, Value>(buckets_ptr, first_non_empty, 0);
   }
 
-  template<typename Key, typename Value>
-  hash_map_iterator<typename hash_map<Key, Value>::bucket_t, Key, Value> hash_map<Key, Value>::end() {
+  template<typename Key, typename Value, bool Statistics>
+  hash_map_iterator<typename hash_map<Key, Value, Statistics>::bucket_t, Key, Value> hash_map<Key, Value, Statistics>::end() {
     return hash_map_iterator<bucket_t, Key, Value>(buckets_ptr, buckets_ptr->size(), 0);
   }
 
-  template<typename Key, typename Value>
-  hash_map_iterator<typename hash_map<Key, Value>::bucket_t, Key, Value> hash_map<Key, Value>::cbegin() const {
+  template<typename Key, typename Value, bool Statistics>
+  hash_map_iterator<typename hash_map<Key, Value, Statistics>::bucket_t, Key, Value> hash_map<Key, Value, Statistics>::cbegin() const {
     const auto first_non_empty = hash_map_iterator<bucket_t, Key, Value>::calculate_next_non_empty_bucket_index(*buckets_ptr, 0);
     return hash_map_iterator<bucket_t, Key, Value>(buckets_ptr, first_non_empty, 0);
   }
 
-  template<typename Key, typename Value>
-  hash_map_iterator<typename hash_map<Key, Value>::bucket_t, Key, Value> hash_map<Key, Value>::cend() const {
+  template<typename Key, typename Value, bool Statistics>
+  hash_map_iterator<typename hash_map<Key, Value, Statistics>::bucket_t, Key, Value> hash_map<Key, Value, Statistics>::cend() const {
     return hash_map_iterator<bucket_t, Key, Value>(buckets_ptr, buckets_ptr->size(), 0);
   }
+
+  template<typename Key, typename Value, bool Statistics>
+  template<std::ranges::input_range Range>
+  void hash_map<Key, Value, Statistics>::build_parallel(Range&& range, const size_t& threads) {
+    const auto rehash_start = counters.start_rehash();
+    auto entries = std::vector<std::tuple<Key, Value, hash_t>>();
+    entries.reserve(container::number_elements);
+    for (const auto& bucket_ptr : *buckets_ptr) {
+      for (const auto& element : bucket_ptr->data) {
+        entries.push_back(element->data);
+      }
+    }
+    for (const auto& [key, value] : range) {
+      entries.emplace_back(key, value, 0);
+    }
+
+    const auto bucket_count = calculate_bucket_count(entries.size(), buckets_ptr->size());
+    auto buckets = std::make_shared<sequential::doubly_linked_list<bucket_t>>(sequential::doubly_linked_list<bucket_t>());
+    for (size_t index = 0; index < bucket_count; ++index) {
+      buckets->push_front(bucket_t());
+    }
+
+    const auto added = fill_buckets_parallel(*buckets, entries, [this](auto& entry) {
+      return std::get<2>(entry) = hash_function(std::get<0>(entry));
+    }, [](bucket_t& bucket, auto&& entry) -> size_t {
+      const auto exists = std::ranges::find_if(bucket, [&entry](const auto& tuple_pointer) {
+        return std::get<0>(tuple_pointer->data) == std::get<0>(entry);
+      });
+      if (exists != bucket.end()) {
+        return 0;
+      }
+      bucket.push_back(std::move(entry));
+      return 1;
+    }, threads);
+
+    buckets_ptr = std::move(buckets);
+    container::number_elements = added;
+    counters.count_rehash(rehash_start);
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  void hash_map<Key, Value, Statistics>::parallel_for_each(const std::function<void(const Key&, const Value&)>& action, const size_t& threads) const {
+    const auto chunks = split_buckets(*buckets_ptr, [](const bucket_t& bucket) { return bucket.size(); }, std::max<size_t>(threads, 1) * chunks_per_thread);
+    for_each_parallel(chunks, threads, [](const bucket_t& bucket, const auto& callback) {
+      for_each_in_bucket(bucket, callback);
+    }, action);
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  template<typename T, typename Map, typename Combine>
+  T hash_map<Key, Value, Statistics>::parallel_reduce(T init, const Map& map, const Combine& combine, const size_t& threads) const {
+    const auto chunks = split_buckets(*buckets_ptr, [](const bucket_t& bucket) { return bucket.size(); }, std::max<size_t>(threads, 1) * chunks_per_thread);
+    return reduce_parallel(chunks, threads, std::move(init), [](const bucket_t& bucket, const auto& callback) {
+      for_each_in_bucket(bucket, callback);
+    }, map, combine);
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  template<typename Callback>
+  void hash_map<Key, Value, Statistics>::for_each_in_bucket(const bucket_t& bucket, const Callback& callback) {
+    for (const auto& tuple_pointer : bucket) {
+      callback(std::get<0>(tuple_pointer->data), std::get<1>(tuple_pointer->data));
+    }
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  void hash_map<Key, Value, Statistics>::save_snapshot(const std::string& path) const
+    requires snapshot_storable<Key> && snapshot_storable<Value>
+  {
+    auto elements = std::vector<std::tuple<const Key*, const Value*, hash_t>>();
+    elements.reserve(container::number_elements);
+    for (const auto& bucket_ptr : *buckets_ptr) {
+      for (const auto& element : bucket_ptr->data) {
+        const auto& [key, value, hash] = element->data;
+        elements.emplace_back(&key, &value, hash);
+      }
+    }
+    write_snapshot<Key, Value>(path, elements);
+  }
 }
\ No newline at end of file
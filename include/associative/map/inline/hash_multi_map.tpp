@@ -5,8 +5,8 @@
 #include <algorithm>
 
 namespace containers::associative {
-  template<typename Key, typename Value>
-  hash_multi_map<Key, Value>::hash_multi_map(
+  template<typename Key, typename Value, bool Statistics>
+  hash_multi_map<Key, Value, Statistics>::hash_multi_map(
     const std::function<hash_t(const Key&)>& hash_function,
     const size_t& bucket_count
   ) :
@@ -16,87 +16,151 @@ namespace containers::associative {
     const auto bucket_count_log_2 = std::ceil(std::log2(bucket_count));
     const auto adjusted_bucket_count = std::pow(2, bucket_count_log_2);
     for (auto index = 0; index < adjusted_bucket_count; ++index) {
-      buckets_ptr->push_front(sequential::doubly_linked_list<std::tuple<Key, Value, hash_t>>());
+      buckets_ptr->push_front(bucket_t());
     }
   }
 
-  template<typename Key, typename Value>
-  hash_multi_map<Key, Value>::hash_multi_map(
+  template<typename Key, typename Value, bool Statistics>
+  hash_multi_map<Key, Value, Statistics>::hash_multi_map(
     const std::function<hash_t(const Key&)>& hash_function
   ) :
     hash_function(hash_function),
     buckets_ptr(std::make_shared<sequential::doubly_linked_list<bucket_t>>(sequential::doubly_linked_list<bucket_t>()))
   {
-    buckets_ptr->push_front(sequential::doubly_linked_list<std::tuple<Key, Value, hash_t>>());
+    buckets_ptr->push_front(bucket_t());
   }
 
-  template<typename Key, typename Value>
-  void hash_multi_map<Key, Value>::insert(const Key& key, const Value& value) {
+  template<typename Key, typename Value, bool Statistics>
+  void hash_multi_map<Key, Value, Statistics>::insert(const Key& key, const Value& value) {
     auto& bucket = find_bucket_by_key(key);
-    bucket.push_back(std::make_tuple(key, value, hash_function(key)));
+    const auto group = std::ranges::find_if(bucket, [&key](const auto& group_pointer) {
+      return std::get<0>(group_pointer->data) == key;
+    });
+    container::number_elements++;
+
+    if (group != bucket.end()) {
+      std::get<1>((*group)->data).push_back(value);
+      return;
+    }
 
+    bucket.push_back(std::make_tuple(key, std::vector{value}, hash_function(key)));
+    number_keys++;
     if (calculate_load_factor() >= 0.75) {
       redistribute_buckets(buckets_ptr->size() * 2);
     }
-    container::number_elements++;
   }
 
-  template<typename Key, typename Value>
-  bool hash_multi_map<Key, Value>::exists_by_key(const Key& key) const {
-    auto& bucket = find_bucket_by_key(key);
-    return std::ranges::find_if(bucket, [&key](const auto& other) {
-      return std::get<0>(other->data) == key;
-    }) != bucket.end();
+  template<typename Key, typename Value, bool Statistics>
+  bool hash_multi_map<Key, Value, Statistics>::exists_by_key(const Key& key) const {
+    return find_group_by_key(key, hash_function(key)) != nullptr;
   }
 
-  template<typename Key, typename Value>
-  bool hash_multi_map<Key, Value>::exists(const Key& key, const Value& value) const {
-    auto& bucket = find_bucket_by_key(key);
-    return std::ranges::find_if(bucket, [&key, &value](const auto& other) {
-      return std::get<0>(other->data) == key && std::get<1>(other->data) == value;
-    }) != bucket.end();
+  template<typename Key, typename Value, bool Statistics>
+  bool hash_multi_map<Key, Value, Statistics>::exists(const Key& key, const Value& value) const {
+    const auto& values = this->values(key);
+    return std::ranges::find(values, value) != values.end();
   }
 
-  template<typename Key, typename Value>
-  void hash_multi_map<Key, Value>::remove_by_key(const Key& key) {
-    auto& bucket = find_bucket_by_key(key);
-    const auto initial_size = bucket.size();
-    auto to_remove = sequential::doubly_linked_list<typename sequential::abstract_doubly_linked_list<std::tuple<Key, Value, hash_t>>::node_t>{};
-    for (const auto& tuple_pointer : bucket) {
-      if (std::get<0>(tuple_pointer->data) == key) {
-        to_remove.push_back(tuple_pointer);
-      }
+  template<typename Key, typename Value, bool Statistics>
+  size_t hash_multi_map<Key, Value, Statistics>::count(const Key& key) const {
+    return values(key).size();
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  std::span<const Value> hash_multi_map<Key, Value, Statistics>::values(const Key& key) const {
+    return values(key, hash_function(key));
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  std::span<const Value> hash_multi_map<Key, Value, Statistics>::values(const Key& key, const hash_t& hash) const {
+    const auto* group = find_group_by_key(key, hash);
+    if (group == nullptr) {
+      return {};
+    }
+    return std::span<const Value>(std::get<1>(*group));
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  void hash_multi_map<Key, Value, Statistics>::reserve(const size_t& key_count) {
+    size_t new_size = buckets_ptr->size();
+    while (static_cast<double>(key_count) / static_cast<double>(new_size) >= 0.75) {
+      new_size *= 2;
     }
-    for (const auto& tuple_pointer : to_remove) {
-      bucket.erase(tuple_pointer->data);
+    if (new_size != buckets_ptr->size()) {
+      redistribute_buckets(new_size);
+    }
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  hash_t hash_multi_map<Key, Value, Statistics>::hash(const Key& key) const {
+    return hash_function(key);
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  std::pair<typename std::span<const Value>::iterator, typename std::span<const Value>::iterator>
+  hash_multi_map<Key, Value, Statistics>::equal_range(const Key& key) const {
+    const auto& values = this->values(key);
+    return std::make_pair(values.begin(), values.end());
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  void hash_multi_map<Key, Value, Statistics>::remove_by_key(const Key& key) {
+    auto& bucket = find_bucket_by_key(key);
+    const auto group = std::ranges::find_if(bucket, [&key](const auto& group_pointer) {
+      return std::get<0>(group_pointer->data) == key;
+    });
+    if (group == bucket.end()) {
+      return;
     }
 
-    container::number_elements -= initial_size - bucket.size();
+    container::number_elements -= std::get<1>((*group)->data).size();
+    number_keys--;
+    bucket.erase(*group);
     if (calculate_load_factor() <= 0.25) {
       redistribute_buckets(std::max(static_cast<int>(buckets_ptr->size() / 2), 1));
     }
   }
 
-  template<typename Key, typename Value>
-  void hash_multi_map<Key, Value>::remove(const Key& key, const Value& value) {
+  template<typename Key, typename Value, bool Statistics>
+  void hash_multi_map<Key, Value, Statistics>::remove(const Key& key, const Value& value) {
     auto& bucket = find_bucket_by_key(key);
-    const auto initial_size = bucket.size();
-    for (const auto& tuple_pointer : bucket) {
-      if (std::get<0>(tuple_pointer->data) == key
-        && std::get<1>(tuple_pointer->data) == value
-      ) {
-        bucket.erase(tuple_pointer);
-      }
+    const auto group = std::ranges::find_if(bucket, [&key](const auto& group_pointer) {
+      return std::get<0>(group_pointer->data) == key;
+    });
+    if (group == bucket.end()) {
+      return;
+    }
+
+    auto& values = std::get<1>((*group)->data);
+    container::number_elements -= std::erase(values, value);
+    if (!values.empty()) {
+      return;
     }
 
-    container::number_elements -= initial_size - bucket.size();
+    number_keys--;
+    bucket.erase(*group);
     if (calculate_load_factor() <= 0.25) {
       redistribute_buckets(std::max(static_cast<int>(buckets_ptr->size() / 2), 1));
     }
   }
 
-  template<typename Key, typename Value>
-  typename hash_multi_map<Key, Value>::bucket_t& hash_multi_map<Key, Value>::find_bucket_by_key(
+  template<typename Key, typename Value, bool Statistics>
+  const typename hash_multi_map<Key, Value, Statistics>::group_t* hash_multi_map<Key, Value, Statistics>::find_group_by_key(
+    const Key& key,
+    const hash_t& hash
+  ) const {
+    const auto& bucket = find_bucket_by_hash(hash);
+    auto probes = size_t{0};
+    const auto group = std::ranges::find_if(bucket, [&key, &probes](const auto& group_pointer) {
+      ++probes;
+      return std::get<0>(group_pointer->data) == key;
+    });
+    counters.count_lookup(group != bucket.end(), probes);
+    return group != bucket.end() ? &(*group)->data : nullptr;
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  typename hash_multi_map<Key, Value, Statistics>::bucket_t& hash_multi_map<Key, Value, Statistics>::find_bucket_by_key(
     const Key& key
   ) {
     const auto hash = hash_function(key);
@@ -104,21 +168,30 @@ namespace containers::associative {
     return buckets_ptr->at(bucket_index)->data;
   }
 
-  template<typename Key, typename Value>
-  const typename hash_multi_map<Key, Value>::bucket_t& hash_multi_map<Key, Value>::find_bucket_by_key(
+  template<typename Key, typename Value, bool Statistics>
+  const typename hash_multi_map<Key, Value, Statistics>::bucket_t& hash_multi_map<Key, Value, Statistics>::find_bucket_by_hash(
+    const hash_t& hash
+  ) const {
+    const auto bucket_index = hash % buckets_ptr->size();
+    return buckets_ptr->at(bucket_index)->data;
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  const typename hash_multi_map<Key, Value, Statistics>::bucket_t& hash_multi_map<Key, Value, Statistics>::find_bucket_by_key(
     const Key& key
     ) const {
     return const_cast<hash_multi_map*>(this)->find_bucket_by_key(key);
   }
 
-  template<typename Key, typename Value>
-  double hash_multi_map<Key, Value>::calculate_load_factor() const noexcept {
-    return static_cast<double>(container::number_elements)
+  template<typename Key, typename Value, bool Statistics>
+  double hash_multi_map<Key, Value, Statistics>::calculate_load_factor() const noexcept {
+    return static_cast<double>(number_keys)
       / static_cast<double>(buckets_ptr->size());
   }
 
-  template<typename Key, typename Value>
-  void hash_multi_map<Key, Value>::redistribute_buckets(const size_t& new_size) {
+  template<typename Key, typename Value, bool Statistics>
+  void hash_multi_map<Key, Value, Statistics>::redistribute_buckets(const size_t& new_size) {
+    const auto rehash_start = counters.start_rehash();
     bucket_t existing;
     for (const auto& bucket_ptr : *buckets_ptr) {
       for (const auto& element : bucket_ptr->data) {
@@ -128,36 +201,131 @@ namespace containers::associative {
 
     buckets_ptr = std::make_shared<sequential::doubly_linked_list<bucket_t>>(sequential::doubly_linked_list<bucket_t>());
     for (auto index = 0; index < new_size; ++index) {
-      buckets_ptr->push_front(sequential::doubly_linked_list<std::tuple<Key, Value, hash_t>>());
+      buckets_ptr->push_front(bucket_t());
     }
-    for (const auto& tuple_pointer : existing) {
-      const auto& tuple = tuple_pointer->data;
-      const auto& key = std::get<0>(tuple);
-      const auto& hash = std::get<2>(tuple);
+    for (const auto& group_pointer : existing) {
+      const auto& group = group_pointer->data;
+      const auto& hash = std::get<2>(group);
       const auto bucket_index = hash % buckets_ptr->size();
-      buckets_ptr->at(bucket_index)->data.push_back(tuple);
+      buckets_ptr->at(bucket_index)->data.push_back(group);
+    }
+    counters.count_rehash(rehash_start);
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  hash_statistics hash_multi_map<Key, Value, Statistics>::stats() const requires Statistics {
+    auto value_bytes = size_t{0};
+    for (const auto& bucket_ptr : *buckets_ptr) {
+      for (const auto& group_pointer : bucket_ptr->data) {
+        value_bytes += std::get<1>(group_pointer->data).capacity() * sizeof(Value);
+      }
     }
+    return collect_hash_statistics(*buckets_ptr, container::number_elements, value_bytes, counters);
   }
 
-  template<typename Key, typename Value>
-  hash_map_iterator<typename hash_multi_map<Key, Value>::bucket_t, Key, Value> hash_multi_map<Key, Value>::begin() {
-    const auto first_non_empty = hash_map_iterator<bucket_t, Key, Value>::calculate_next_non_empty_bucket_index(*buckets_ptr, 0);
-    return hash_map_iterator<bucket_t, Key, Value>(buckets_ptr, first_non_empty, 0);
+  template<typename Key, typename Value, bool Statistics>
+  typename hash_multi_map<Key, Value, Statistics>::iterator_t hash_multi_map<Key, Value, Statistics>::begin() {
+    return cbegin();
   }
 
-  template<typename Key, typename Value>
-  hash_map_iterator<typename hash_multi_map<Key, Value>::bucket_t, Key, Value> hash_multi_map<Key, Value>::end() {
-    return hash_map_iterator<bucket_t, Key, Value>(buckets_ptr, buckets_ptr->size(), 0);
+  template<typename Key, typename Value, bool Statistics>
+  typename hash_multi_map<Key, Value, Statistics>::iterator_t hash_multi_map<Key, Value, Statistics>::end() {
+    return cend();
   }
 
-  template<typename Key, typename Value>
-  hash_map_iterator<typename hash_multi_map<Key, Value>::bucket_t, Key, Value> hash_multi_map<Key, Value>::cbegin() const {
-    const auto first_non_empty = hash_map_iterator<bucket_t, Key, Value>::calculate_next_non_empty_bucket_index(*buckets_ptr, 0);
-    return hash_map_iterator<bucket_t, Key, Value>(buckets_ptr, first_non_empty, 0);
+  template<typename Key, typename Value, bool Statistics>
+  typename hash_multi_map<Key, Value, Statistics>::iterator_t hash_multi_map<Key, Value, Statistics>::cbegin() const {
+    const auto first_non_empty = iterator_t::calculate_first_non_empty_bucket_index(*buckets_ptr, 0);
+    return iterator_t(buckets_ptr, first_non_empty, 0, 0);
   }
 
-  template<typename Key, typename Value>
-  hash_map_iterator<typename hash_multi_map<Key, Value>::bucket_t, Key, Value> hash_multi_map<Key, Value>::cend() const {
-    return hash_map_iterator<bucket_t, Key, Value>(buckets_ptr, buckets_ptr->size(), 0);
+  template<typename Key, typename Value, bool Statistics>
+  typename hash_multi_map<Key, Value, Statistics>::iterator_t hash_multi_map<Key, Value, Statistics>::cend() const {
+    return iterator_t(buckets_ptr, buckets_ptr->size(), 0, 0);
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  template<std::ranges::input_range Range>
+  void hash_multi_map<Key, Value, Statistics>::build_parallel(Range&& range, const size_t& threads) {
+    const auto rehash_start = counters.start_rehash();
+    auto entries = std::vector<group_t>();
+    entries.reserve(number_keys);
+    for (const auto& bucket_ptr : *buckets_ptr) {
+      for (const auto& group : bucket_ptr->data) {
+        entries.push_back(group->data);
+      }
+    }
+    size_t element_count = container::number_elements;
+    for (const auto& [key, value] : range) {
+      entries.emplace_back(key, std::vector{value}, 0);
+      element_count++;
+    }
+
+    // Sized for the worst case of distinct keys, the load factor only counts keys
+    const auto bucket_count = calculate_bucket_count(entries.size(), buckets_ptr->size());
+    auto buckets = std::make_shared<sequential::doubly_linked_list<bucket_t>>(sequential::doubly_linked_list<bucket_t>());
+    for (size_t index = 0; index < bucket_count; ++index) {
+      buckets->push_front(bucket_t());
+    }
+
+    const auto added_keys = fill_buckets_parallel(*buckets, entries, [this](auto& entry) {
+      return std::get<2>(entry) = hash_function(std::get<0>(entry));
+    }, [](bucket_t& bucket, auto&& entry) -> size_t {
+      const auto group = std::ranges::find_if(bucket, [&entry](const auto& group_pointer) {
+        return std::get<0>(group_pointer->data) == std::get<0>(entry);
+      });
+      if (group == bucket.end()) {
+        bucket.push_back(std::move(entry));
+        return 1;
+      }
+      auto& values = std::get<1>((*group)->data);
+      std::ranges::move(std::get<1>(entry), std::back_inserter(values));
+      return 0;
+    }, threads);
+
+    buckets_ptr = std::move(buckets);
+    number_keys = added_keys;
+    container::number_elements = element_count;
+    counters.count_rehash(rehash_start);
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  void hash_multi_map<Key, Value, Statistics>::parallel_for_each(const std::function<void(const Key&, const Value&)>& action, const size_t& threads) const {
+    const auto chunks = split_buckets(*buckets_ptr, [](const bucket_t& bucket) {
+      size_t values = 0;
+      for (const auto& group_pointer : bucket) {
+        values += std::get<1>(group_pointer->data).size();
+      }
+      return values;
+    }, std::max<size_t>(threads, 1) * chunks_per_thread);
+    for_each_parallel(chunks, threads, [](const bucket_t& bucket, const auto& callback) {
+      for_each_in_bucket(bucket, callback);
+    }, action);
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  template<typename T, typename Map, typename Combine>
+  T hash_multi_map<Key, Value, Statistics>::parallel_reduce(T init, const Map& map, const Combine& combine, const size_t& threads) const {
+    const auto chunks = split_buckets(*buckets_ptr, [](const bucket_t& bucket) {
+      size_t values = 0;
+      for (const auto& group_pointer : bucket) {
+        values += std::get<1>(group_pointer->data).size();
+      }
+      return values;
+    }, std::max<size_t>(threads, 1) * chunks_per_thread);
+    return reduce_parallel(chunks, threads, std::move(init), [](const bucket_t& bucket, const auto& callback) {
+      for_each_in_bucket(bucket, callback);
+    }, map, combine);
+  }
+
+  template<typename Key, typename Value, bool Statistics>
+  template<typename Callback>
+  void hash_multi_map<Key, Value, Statistics>::for_each_in_bucket(const bucket_t& bucket, const Callback& callback) {
+    for (const auto& group_pointer : bucket) {
+      const auto& [key, values, hash] = group_pointer->data;
+      for (const auto& value : values) {
+        callback(key, value);
+      }
+    }
   }
 }
\ No newline at end of file
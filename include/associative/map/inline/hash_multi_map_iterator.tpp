@@ -0,0 +1,70 @@
+#pragma once
+
+namespace containers::associative {
+  template<typename Bucket, typename Key, typename Value>
+  hash_multi_map_iterator<Bucket, Key, Value>::hash_multi_map_iterator()
+    : ptr(nullptr), outer_index(0), inner_index(0), value_index(0) {}
+
+  template<typename Bucket, typename Key, typename Value>
+  hash_multi_map_iterator<Bucket, Key, Value>::hash_multi_map_iterator(
+    const std::shared_ptr<sequential::doubly_linked_list<Bucket>>& ptr,
+    const size_t& outer_index,
+    const size_t& inner_index,
+    const size_t& value_index
+  ) : ptr(ptr), outer_index(outer_index), inner_index(inner_index), value_index(value_index) {}
+
+  template<typename Bucket, typename Key, typename Value>
+  typename hash_multi_map_iterator<Bucket, Key, Value>::value_type hash_multi_map_iterator<Bucket, Key, Value>::operator*() const {
+    const auto& group = ptr->at(outer_index)->data.at(inner_index)->data;
+    return std::make_pair(std::get<0>(group), std::get<1>(group)[value_index]);
+  }
+
+  template<typename Bucket, typename Key, typename Value>
+  hash_multi_map_iterator<Bucket, Key, Value>& hash_multi_map_iterator<Bucket, Key, Value>::operator++() {
+    const auto& bucket = ptr->at(outer_index)->data;
+    if (value_index + 1 < std::get<1>(bucket.at(inner_index)->data).size()) {
+      ++value_index;
+      return *this;
+    }
+
+    value_index = 0;
+    if (inner_index + 1 < bucket.size()) {
+      ++inner_index;
+      return *this;
+    }
+
+    inner_index = 0;
+    outer_index = calculate_first_non_empty_bucket_index(*ptr, outer_index + 1);
+    return *this;
+  }
+
+  template<typename Bucket, typename Key, typename Value>
+  hash_multi_map_iterator<Bucket, Key, Value> hash_multi_map_iterator<Bucket, Key, Value>::operator++(int) {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  template<typename Bucket, typename Key, typename Value>
+  bool hash_multi_map_iterator<Bucket, Key, Value>::operator==(const hash_multi_map_iterator& other) const {
+    return ptr == other.ptr
+      && outer_index == other.outer_index
+      && inner_index == other.inner_index
+      && value_index == other.value_index;
+  }
+
+  template<typename Bucket, typename Key, typename Value>
+  size_t hash_multi_map_iterator<Bucket, Key, Value>::calculate_first_non_empty_bucket_index(
+    const sequential::doubly_linked_list<Bucket>& buckets,
+    const size_t& base_index
+  ) {
+    size_t index = 0;
+    for (const auto& bucket_ptr : buckets) {
+      if (index >= base_index && !bucket_ptr->data.empty()) {
+        return index;
+      }
+      ++index;
+    }
+    return buckets.size();
+  }
+}
\ No newline at end of file
@@ -0,0 +1,449 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+
+#include "associative/map/value_not_found.hpp"
+#include "associative/duplicate_key.hpp"
+
+namespace containers::associative {
+  template<typename Key, typename Value>
+  persistent_hash_map<Key, Value>::persistent_hash_map(
+    const std::function<hash_t(const Key&)>& hash_function
+  ) : hash_function(hash_function), root(std::make_shared<node>()) {}
+
+  template<typename Key, typename Value>
+  persistent_hash_map<Key, Value>::persistent_hash_map(
+    const std::function<hash_t(const Key&)>& hash_function,
+    const std::shared_ptr<node>& root,
+    const size_t& number_elements
+  ) : hash_function(hash_function), root(root) {
+    container::number_elements = number_elements;
+  }
+
+  template<typename Key, typename Value>
+  void persistent_hash_map<Key, Value>::insert(const Key& key, const Value& value) {
+    if (!try_insert(key, value)) {
+      throw duplicate_key<Key>(key);
+    }
+  }
+
+  template<typename Key, typename Value>
+  void persistent_hash_map<Key, Value>::insert_safely(const Key& key, const Value& value) {
+    insert_into_root(root, container::number_elements, hash_function, key, value, insert_mode::keep_existing, 0);
+  }
+
+  template<typename Key, typename Value>
+  std::expected<void, container_error> persistent_hash_map<Key, Value>::try_insert(const Key& key, const Value& value) {
+    const auto initial_size = container::number_elements;
+    insert_into_root(root, container::number_elements, hash_function, key, value, insert_mode::keep_existing, 0);
+    if (container::number_elements == initial_size) {
+      return std::unexpected(container_error::duplicate_key);
+    }
+    return {};
+  }
+
+  template<typename Key, typename Value>
+  void persistent_hash_map<Key, Value>::upsert(const Key& key, const Value& value) {
+    insert_into_root(root, container::number_elements, hash_function, key, value, insert_mode::replace_existing, 0);
+  }
+
+  template<typename Key, typename Value>
+  std::optional<Value> persistent_hash_map<Key, Value>::find_by_key(const Key& key) const {
+    const auto* entry = find_entry(root.get(), key, hash_function(key));
+    if (entry == nullptr) {
+      return std::nullopt;
+    }
+    return std::get<1>(*entry);
+  }
+
+  template<typename Key, typename Value>
+  Value persistent_hash_map<Key, Value>::find_by_key_or_throw(const Key& key) const {
+    const auto& optional = find_by_key(key);
+    if (!optional.has_value()) {
+      throw value_not_found<Key>(key);
+    }
+    return optional.value();
+  }
+
+  template<typename Key, typename Value>
+  void persistent_hash_map<Key, Value>::remove(const Key& key) {
+    remove_from_root(root, container::number_elements, hash_function, key, 0);
+  }
+
+  template<typename Key, typename Value>
+  persistent_hash_map<Key, Value> persistent_hash_map<Key, Value>::with(const Key& key, const Value& value) const {
+    auto modified = *this;
+    modified.upsert(key, value);
+    return modified;
+  }
+
+  template<typename Key, typename Value>
+  persistent_hash_map<Key, Value> persistent_hash_map<Key, Value>::without(const Key& key) const {
+    auto modified = *this;
+    modified.remove(key);
+    return modified;
+  }
+
+  template<typename Key, typename Value>
+  typename persistent_hash_map<Key, Value>::transient persistent_hash_map<Key, Value>::as_transient() const {
+    return transient(hash_function, root, container::number_elements);
+  }
+
+  template<typename Key, typename Value>
+  typename persistent_hash_map<Key, Value>::iterator_t persistent_hash_map<Key, Value>::begin() const {
+    return iterator_t(root);
+  }
+
+  template<typename Key, typename Value>
+  typename persistent_hash_map<Key, Value>::iterator_t persistent_hash_map<Key, Value>::end() const {
+    return iterator_t();
+  }
+
+  template<typename Key, typename Value>
+  typename persistent_hash_map<Key, Value>::iterator_t persistent_hash_map<Key, Value>::cbegin() const {
+    return begin();
+  }
+
+  template<typename Key, typename Value>
+  typename persistent_hash_map<Key, Value>::iterator_t persistent_hash_map<Key, Value>::cend() const {
+    return end();
+  }
+
+  template<typename Key, typename Value>
+  persistent_hash_map<Key, Value>::transient::transient(
+    const std::function<hash_t(const Key&)>& hash_function,
+    const std::shared_ptr<node>& root,
+    const size_t& number_elements
+  ) :
+    hash_function(hash_function),
+    root(root),
+    number_elements(number_elements),
+    owner(next_owner())
+  {}
+
+  template<typename Key, typename Value>
+  persistent_hash_map<Key, Value>::transient::transient(transient&& other) noexcept :
+    hash_function(std::move(other.hash_function)),
+    root(std::move(other.root)),
+    number_elements(std::exchange(other.number_elements, 0)),
+    owner(std::exchange(other.owner, 0))
+  {}
+
+  template<typename Key, typename Value>
+  typename persistent_hash_map<Key, Value>::transient& persistent_hash_map<Key, Value>::transient::operator=(
+    transient&& other
+  ) noexcept {
+    hash_function = std::move(other.hash_function);
+    root = std::move(other.root);
+    number_elements = std::exchange(other.number_elements, 0);
+    // Owner 0 never matches a node, so the moved-from transient could not modify any in place
+    owner = std::exchange(other.owner, 0);
+    return *this;
+  }
+
+  template<typename Key, typename Value>
+  void persistent_hash_map<Key, Value>::transient::insert(const Key& key, const Value& value) {
+    if (!try_insert(key, value)) {
+      throw duplicate_key<Key>(key);
+    }
+  }
+
+  template<typename Key, typename Value>
+  void persistent_hash_map<Key, Value>::transient::insert_safely(const Key& key, const Value& value) {
+    insert_into_root(root, number_elements, hash_function, key, value, insert_mode::keep_existing, owner);
+  }
+
+  template<typename Key, typename Value>
+  std::expected<void, container_error> persistent_hash_map<Key, Value>::transient::try_insert(const Key& key, const Value& value) {
+    const auto initial_size = number_elements;
+    insert_into_root(root, number_elements, hash_function, key, value, insert_mode::keep_existing, owner);
+    if (number_elements == initial_size) {
+      return std::unexpected(container_error::duplicate_key);
+    }
+    return {};
+  }
+
+  template<typename Key, typename Value>
+  void persistent_hash_map<Key, Value>::transient::upsert(const Key& key, const Value& value) {
+    insert_into_root(root, number_elements, hash_function, key, value, insert_mode::replace_existing, owner);
+  }
+
+  template<typename Key, typename Value>
+  std::optional<Value> persistent_hash_map<Key, Value>::transient::find_by_key(const Key& key) const {
+    const auto* entry = find_entry(root.get(), key, hash_function(key));
+    if (entry == nullptr) {
+      return std::nullopt;
+    }
+    return std::get<1>(*entry);
+  }
+
+  template<typename Key, typename Value>
+  void persistent_hash_map<Key, Value>::transient::remove(const Key& key) {
+    remove_from_root(root, number_elements, hash_function, key, owner);
+  }
+
+  template<typename Key, typename Value>
+  size_t persistent_hash_map<Key, Value>::transient::size() const noexcept {
+    return number_elements;
+  }
+
+  template<typename Key, typename Value>
+  persistent_hash_map<Key, Value> persistent_hash_map<Key, Value>::transient::persistent() {
+    // Nodes owned so far become part of the returned version and must not be modified anymore
+    owner = next_owner();
+    return persistent_hash_map(hash_function, root, number_elements);
+  }
+
+  template<typename Key, typename Value>
+  void persistent_hash_map<Key, Value>::insert_into_root(
+    std::shared_ptr<node>& root,
+    size_t& number_elements,
+    const std::function<hash_t(const Key&)>& hash_function,
+    const Key& key,
+    const Value& value,
+    const insert_mode mode,
+    const std::uint64_t& owner
+  ) {
+    bool added = false;
+    root = insert_into(root, entry_t(key, value, hash_function(key)), 0, mode, owner, added);
+    number_elements += added;
+  }
+
+  template<typename Key, typename Value>
+  void persistent_hash_map<Key, Value>::remove_from_root(
+    std::shared_ptr<node>& root,
+    size_t& number_elements,
+    const std::function<hash_t(const Key&)>& hash_function,
+    const Key& key,
+    const std::uint64_t& owner
+  ) {
+    bool removed = false;
+    root = remove_from(root, key, hash_function(key), 0, owner, removed);
+    number_elements -= removed;
+  }
+
+  template<typename Key, typename Value>
+  const typename persistent_hash_map<Key, Value>::entry_t* persistent_hash_map<Key, Value>::find_entry(
+    const node* current,
+    const Key& key,
+    const hash_t& hash
+  ) {
+    for (unsigned shift = 0; shift < hash_bits; shift += bits_per_level) {
+      const auto bit = calculate_bit(hash, shift);
+      if (current->entry_map & bit) {
+        const auto& entry = current->entries[calculate_index(current->entry_map, bit)];
+        return std::get<0>(entry) == key ? &entry : nullptr;
+      }
+      if (!(current->child_map & bit)) {
+        return nullptr;
+      }
+      current = current->children[calculate_index(current->child_map, bit)].get();
+    }
+
+    const auto position = std::ranges::find_if(current->entries, [&key](const auto& entry) {
+      return std::get<0>(entry) == key;
+    });
+    return position != current->entries.end() ? &*position : nullptr;
+  }
+
+  template<typename Key, typename Value>
+  std::shared_ptr<typename persistent_hash_map<Key, Value>::node> persistent_hash_map<Key, Value>::insert_into(
+    const std::shared_ptr<node>& current,
+    entry_t&& entry,
+    const unsigned& shift,
+    const insert_mode mode,
+    const std::uint64_t& owner,
+    bool& added
+  ) {
+    const auto& key = std::get<0>(entry);
+    if (shift >= hash_bits) {
+      // Collision node, all keys share the full hash
+      const auto position = std::ranges::find_if(current->entries, [&key](const auto& existing) {
+        return std::get<0>(existing) == key;
+      });
+      if (position != current->entries.end()) {
+        return replace_value(current, position - current->entries.begin(), std::move(entry), mode, owner);
+      }
+      auto edited = make_editable(current, owner);
+      edited->entries.push_back(std::move(entry));
+      added = true;
+      return edited;
+    }
+
+    const auto bit = calculate_bit(std::get<2>(entry), shift);
+    if (current->entry_map & bit) {
+      const auto index = calculate_index(current->entry_map, bit);
+      if (std::get<0>(current->entries[index]) == key) {
+        return replace_value(current, index, std::move(entry), mode, owner);
+      }
+
+      // Both entries share the slot, so they move one level down
+      auto child = merge(entry_t(current->entries[index]), std::move(entry), shift + bits_per_level, owner);
+      auto edited = make_editable(current, owner);
+      edited->entries.erase(edited->entries.begin() + index);
+      edited->entry_map ^= bit;
+      edited->children.insert(edited->children.begin() + calculate_index(edited->child_map, bit), std::move(child));
+      edited->child_map |= bit;
+      added = true;
+      return edited;
+    }
+
+    if (current->child_map & bit) {
+      const auto index = calculate_index(current->child_map, bit);
+      auto child = insert_into(current->children[index], std::move(entry), shift + bits_per_level, mode, owner, added);
+      if (child == current->children[index]) {
+        return current;
+      }
+      auto edited = make_editable(current, owner);
+      edited->children[index] = std::move(child);
+      return edited;
+    }
+
+    auto edited = make_editable(current, owner);
+    edited->entries.insert(edited->entries.begin() + calculate_index(edited->entry_map, bit), std::move(entry));
+    edited->entry_map |= bit;
+    added = true;
+    return edited;
+  }
+
+  template<typename Key, typename Value>
+  std::shared_ptr<typename persistent_hash_map<Key, Value>::node> persistent_hash_map<Key, Value>::remove_from(
+    const std::shared_ptr<node>& current,
+    const Key& key,
+    const hash_t& hash,
+    const unsigned& shift,
+    const std::uint64_t& owner,
+    bool& removed
+  ) {
+    if (shift >= hash_bits) {
+      const auto position = std::ranges::find_if(current->entries, [&key](const auto& entry) {
+        return std::get<0>(entry) == key;
+      });
+      if (position == current->entries.end()) {
+        return current;
+      }
+      const auto index = position - current->entries.begin();
+      auto edited = make_editable(current, owner);
+      edited->entries.erase(edited->entries.begin() + index);
+      removed = true;
+      return edited;
+    }
+
+    const auto bit = calculate_bit(hash, shift);
+    if (current->entry_map & bit) {
+      const auto index = calculate_index(current->entry_map, bit);
+      if (std::get<0>(current->entries[index]) != key) {
+        return current;
+      }
+      auto edited = make_editable(current, owner);
+      edited->entries.erase(edited->entries.begin() + index);
+      edited->entry_map ^= bit;
+      removed = true;
+      return edited;
+    }
+
+    if (!(current->child_map & bit)) {
+      return current;
+    }
+
+    const auto index = calculate_index(current->child_map, bit);
+    auto child = remove_from(current->children[index], key, hash, shift + bits_per_level, owner, removed);
+    if (!removed) {
+      return current;
+    }
+
+    auto edited = make_editable(current, owner);
+    if (child->child_map == 0 && child->entries.size() <= 1) {
+      // Keep the trie canonical by inlining a child that holds a single entry
+      edited->children.erase(edited->children.begin() + index);
+      edited->child_map ^= bit;
+      if (!child->entries.empty()) {
+        edited->entries.insert(edited->entries.begin() + calculate_index(edited->entry_map, bit), child->entries.front());
+        edited->entry_map |= bit;
+      }
+    } else {
+      edited->children[index] = std::move(child);
+    }
+    return edited;
+  }
+
+  template<typename Key, typename Value>
+  std::shared_ptr<typename persistent_hash_map<Key, Value>::node> persistent_hash_map<Key, Value>::replace_value(
+    const std::shared_ptr<node>& current,
+    const size_t& index,
+    entry_t&& entry,
+    const insert_mode mode,
+    const std::uint64_t& owner
+  ) {
+    if (mode == insert_mode::keep_existing) {
+      return current;
+    }
+    auto edited = make_editable(current, owner);
+    std::get<1>(edited->entries[index]) = std::move(std::get<1>(entry));
+    return edited;
+  }
+
+  template<typename Key, typename Value>
+  std::shared_ptr<typename persistent_hash_map<Key, Value>::node> persistent_hash_map<Key, Value>::merge(
+    entry_t&& first,
+    entry_t&& second,
+    const unsigned& shift,
+    const std::uint64_t& owner
+  ) {
+    auto created = std::make_shared<node>();
+    created->owner = owner;
+    if (shift >= hash_bits) {
+      created->entries.push_back(std::move(first));
+      created->entries.push_back(std::move(second));
+      return created;
+    }
+
+    const auto first_bit = calculate_bit(std::get<2>(first), shift);
+    const auto second_bit = calculate_bit(std::get<2>(second), shift);
+    if (first_bit == second_bit) {
+      created->child_map = first_bit;
+      created->children.push_back(merge(std::move(first), std::move(second), shift + bits_per_level, owner));
+      return created;
+    }
+
+    created->entry_map = first_bit | second_bit;
+    if (first_bit < second_bit) {
+      created->entries.push_back(std::move(first));
+      created->entries.push_back(std::move(second));
+    } else {
+      created->entries.push_back(std::move(second));
+      created->entries.push_back(std::move(first));
+    }
+    return created;
+  }
+
+  template<typename Key, typename Value>
+  std::shared_ptr<typename persistent_hash_map<Key, Value>::node> persistent_hash_map<Key, Value>::make_editable(
+    const std::shared_ptr<node>& current,
+    const std::uint64_t& owner
+  ) {
+    if (owner != 0 && current->owner == owner) {
+      return current;
+    }
+    auto copy = std::make_shared<node>(*current);
+    copy->owner = owner;
+    return copy;
+  }
+
+  template<typename Key, typename Value>
+  std::uint32_t persistent_hash_map<Key, Value>::calculate_bit(const hash_t& hash, const unsigned& shift) noexcept {
+    return std::uint32_t{1} << ((static_cast<std::uint32_t>(hash) >> shift) & ((1U << bits_per_level) - 1));
+  }
+
+  template<typename Key, typename Value>
+  size_t persistent_hash_map<Key, Value>::calculate_index(const std::uint32_t& bitmap, const std::uint32_t& bit) noexcept {
+    return static_cast<size_t>(std::popcount(bitmap & (bit - 1)));
+  }
+
+  template<typename Key, typename Value>
+  std::uint64_t persistent_hash_map<Key, Value>::next_owner() noexcept {
+    static std::atomic<std::uint64_t> owners{0};
+    return ++owners;
+  }
+}
\ No newline at end of file
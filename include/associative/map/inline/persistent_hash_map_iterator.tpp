@@ -0,0 +1,64 @@
+#pragma once
+
+namespace containers::associative {
+  template<typename Node, typename Key, typename Value>
+  persistent_hash_map_iterator<Node, Key, Value>::persistent_hash_map_iterator()
+    : root(nullptr) {}
+
+  template<typename Node, typename Key, typename Value>
+  persistent_hash_map_iterator<Node, Key, Value>::persistent_hash_map_iterator(
+    const std::shared_ptr<Node>& root
+  ) : root(root) {
+    path.push_back(frame{root.get(), 0});
+    descend_to_entry();
+  }
+
+  template<typename Node, typename Key, typename Value>
+  typename persistent_hash_map_iterator<Node, Key, Value>::value_type persistent_hash_map_iterator<Node, Key, Value>::operator*() const {
+    const auto& [node, index] = path.back();
+    const auto& tuple = node->entries[index];
+    return std::make_pair(std::get<0>(tuple), std::get<1>(tuple));
+  }
+
+  template<typename Node, typename Key, typename Value>
+  persistent_hash_map_iterator<Node, Key, Value>& persistent_hash_map_iterator<Node, Key, Value>::operator++() {
+    ++path.back().index;
+    descend_to_entry();
+    return *this;
+  }
+
+  template<typename Node, typename Key, typename Value>
+  persistent_hash_map_iterator<Node, Key, Value> persistent_hash_map_iterator<Node, Key, Value>::operator++(int) {
+    auto tmp = *this;
+    ++*this;
+    return tmp;
+  }
+
+  template<typename Node, typename Key, typename Value>
+  bool persistent_hash_map_iterator<Node, Key, Value>::operator==(const persistent_hash_map_iterator& other) const {
+    if (path.empty() || other.path.empty()) {
+      return path.empty() && other.path.empty();
+    }
+    return path.size() == other.path.size()
+      && path.back().node == other.path.back().node
+      && path.back().index == other.path.back().index;
+  }
+
+  template<typename Node, typename Key, typename Value>
+  void persistent_hash_map_iterator<Node, Key, Value>::descend_to_entry() {
+    while (!path.empty()) {
+      auto& [node, index] = path.back();
+      if (index < node->entries.size()) {
+        return;
+      }
+
+      const auto child_index = index - node->entries.size();
+      if (child_index < node->children.size()) {
+        ++index;
+        path.push_back(frame{node->children[child_index].get(), 0});
+      } else {
+        path.pop_back();
+      }
+    }
+  }
+}
\ No newline at end of file
@@ -1,11 +1,34 @@
 #pragma once
 
+#include <optional>
+#include <utility>
+
 #include "associative_map.hpp"
 
 namespace containers::associative {
+  /**
+   * @class ordered_map
+   * @brief An associative_map which keeps its keys sorted by operator<, e.g. btree_map.
+   */
   template<typename Key, typename Value>
   class ordered_map : public associative_map<Key, Value> {
-    // Adding a virtual destructor, because this class is not going to be implemented
+  public:
     virtual ~ordered_map() override = default;
+
+    /**
+     * @brief Finds the key-value pair with the smallest key not less than a key.
+     * @param key The key to look up, which does not need to be stored.
+     * @return The key-value pair, or std::nullopt if all keys are less.
+     * @note Runtime complexity: O(log n).
+     */
+    virtual std::optional<std::pair<Key, Value>> find_lower_bound(const Key& key) const = 0;
+
+    /**
+     * @brief Finds the key-value pair with the smallest key greater than a key.
+     * @param key The key to look up, which does not need to be stored.
+     * @return The key-value pair, or std::nullopt if no key is greater.
+     * @note Runtime complexity: O(log n).
+     */
+    virtual std::optional<std::pair<Key, Value>> find_upper_bound(const Key& key) const = 0;
   };
 }
\ No newline at end of file
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+#include "associative_map.hpp"
+#include "persistent_hash_map_iterator.hpp"
+
+namespace containers::associative {
+  /**
+   * @class persistent_hash_map
+   * @brief A hash map with structural sharing, implemented as a hash array mapped trie.
+   *
+   * This class provides the associative_map interface on top of an immutable trie. Every
+   * modification copies only the nodes on the path to the changed key and shares all
+   * other nodes with the previous version, so copying the map yields a point-in-time
+   * snapshot in O(1) that later modifications of either map never affect.
+   *
+   * @tparam Key The type of the keys stored in the map.
+   * @tparam Value The type of the values associated with the keys.
+   *
+   * @details
+   * - Every trie level consumes 5 bits of the hash. A node stores a bitmap of the slots
+   *   holding entries and a bitmap of the slots holding child nodes; the position of a slot
+   *   inside the compact entry or child array is the population count of the lower bits.
+   * - Keys whose 32 hash bits are all equal are kept in a collision node at the bottom of the trie.
+   * - Removing keeps the trie canonical: a child left with a single entry is inlined into its parent.
+   * - with() and without() return a modified version and leave the map untouched.
+   * - as_transient() returns a transient, which modifies the nodes it has already copied in
+   *   place, so bulk updates only copy each node once.
+   *
+   * @note Snapshots can be read from multiple threads, but a single map or transient must not be
+   * modified concurrently.
+   */
+  template<typename Key, typename Value>
+  class persistent_hash_map final : public associative_map<Key, Value> {
+  private:
+    using entry_t = std::tuple<Key, Value, hash_t>;
+
+    struct node {
+      std::uint32_t entry_map = 0;
+      std::uint32_t child_map = 0;
+      std::vector<entry_t> entries;
+      std::vector<std::shared_ptr<node>> children;
+      // The transient allowed to modify this node in place, 0 if the node is immutable
+      std::uint64_t owner = 0;
+    };
+
+  public:
+    using iterator_t = persistent_hash_map_iterator<node, Key, Value>;
+
+    /**
+     * @class transient
+     * @brief A mutable view of a persistent_hash_map for bulk updates.
+     *
+     * A transient starts from a version of a persistent_hash_map without copying it. Nodes
+     * it copies are marked as its own and modified in place by later updates. persistent()
+     * returns the result as a new version; the transient stays usable, but copies nodes
+     * again from then on, so the returned version is never modified.
+     *
+     * A transient cannot be copied, since a copy would share its ownership and modify nodes
+     * of a returned version in place. A moved-from transient owns no nodes.
+     */
+    class transient final {
+    public:
+      transient(const transient&) = delete;
+      transient& operator=(const transient&) = delete;
+      transient(transient&& other) noexcept;
+      transient& operator=(transient&& other) noexcept;
+
+      //! @copydoc associative_map::insert
+      void insert(const Key& key, const Value& value);
+      //! @copydoc associative_map::insert_safely
+      void insert_safely(const Key& key, const Value& value);
+      //! @copydoc associative_map::try_insert
+      std::expected<void, container_error> try_insert(const Key& key, const Value& value);
+      //! @copydoc persistent_hash_map::upsert
+      void upsert(const Key& key, const Value& value);
+      //! @copydoc associative_map::find_by_key
+      [[nodiscard]] std::optional<Value> find_by_key(const Key& key) const;
+      //! @copydoc associative_map::remove
+      void remove(const Key& key);
+
+      /**
+       * @brief Returns the number of elements in the transient.
+       * @return The number of elements.
+       */
+      [[nodiscard]] size_t size() const noexcept;
+
+      /**
+       * @brief Returns the current contents as a persistent_hash_map.
+       * @return A new version that later updates of the transient do not modify.
+       * @note Runtime complexity: O(1).
+       */
+      [[nodiscard]] persistent_hash_map persistent();
+
+    private:
+      friend class persistent_hash_map;
+
+      std::function<hash_t(const Key&)> hash_function;
+      std::shared_ptr<node> root;
+      size_t number_elements;
+      std::uint64_t owner;
+
+      transient(const std::function<hash_t(const Key&)>& hash_function, const std::shared_ptr<node>& root, const size_t& number_elements);
+    };
+
+    /**
+     * @brief Constructs an empty persistent_hash_map.
+     * @param hash_function A callable object that computes the hash of a given key.
+     */
+    explicit persistent_hash_map(const std::function<hash_t(const Key&)>& hash_function);
+
+    //! @copydoc associative_map::insert
+    virtual void insert(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::insert_safely
+    virtual void insert_safely(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::try_insert
+    virtual std::expected<void, container_error> try_insert(const Key& key, const Value& value) override;
+    //! @copydoc associative_map::find_by_key
+    virtual std::optional<Value> find_by_key(const Key& key) const override;
+    //! @copydoc associative_map::find_by_key_or_throw
+    virtual Value find_by_key_or_throw(const Key& key) const override;
+    //! @copydoc associative_map::remove
+    virtual void remove(const Key& key) override;
+
+    /**
+     * @brief Inserts a key-value pair or replaces the value of an existing key.
+     * @param key The key to insert or update.
+     * @param value The value to associate with the key.
+     * @note Runtime complexity: O(log32 n).
+     */
+    void upsert(const Key& key, const Value& value);
+
+    /**
+     * @brief Returns a new version in which the key is associated with the value.
+     * @param key The key to insert or update.
+     * @param value The value to associate with the key.
+     * @return The new version; this map is not modified.
+     * @note Runtime complexity: O(log32 n).
+     */
+    [[nodiscard]] persistent_hash_map with(const Key& key, const Value& value) const;
+
+    /**
+     * @brief Returns a new version without the key.
+     * @param key The key to remove.
+     * @return The new version; this map is not modified.
+     * @note Runtime complexity: O(log32 n).
+     */
+    [[nodiscard]] persistent_hash_map without(const Key& key) const;
+
+    /**
+     * @brief Starts a batch of updates on the current version.
+     * @return A transient sharing all nodes with this map.
+     * @note Runtime complexity: O(1).
+     */
+    [[nodiscard]] transient as_transient() const;
+
+    iterator_t begin() const;
+    iterator_t end() const;
+    iterator_t cbegin() const;
+    iterator_t cend() const;
+
+  private:
+    enum class insert_mode { keep_existing, replace_existing };
+
+    static constexpr unsigned bits_per_level = 5;
+    static constexpr unsigned hash_bits = 32;
+
+    std::function<hash_t(const Key&)> hash_function;
+    std::shared_ptr<node> root;
+
+    persistent_hash_map(const std::function<hash_t(const Key&)>& hash_function, const std::shared_ptr<node>& root, const size_t& number_elements);
+
+    static void insert_into_root(
+      std::shared_ptr<node>& root,
+      size_t& number_elements,
+      const std::function<hash_t(const Key&)>& hash_function,
+      const Key& key,
+      const Value& value,
+      insert_mode mode,
+      const std::uint64_t& owner
+    );
+    static void remove_from_root(
+      std::shared_ptr<node>& root,
+      size_t& number_elements,
+      const std::function<hash_t(const Key&)>& hash_function,
+      const Key& key,
+      const std::uint64_t& owner
+    );
+    [[nodiscard]] static const entry_t* find_entry(const node* current, const Key& key, const hash_t& hash);
+
+    [[nodiscard]] static std::shared_ptr<node> insert_into(
+      const std::shared_ptr<node>& current,
+      entry_t&& entry,
+      const unsigned& shift,
+      insert_mode mode,
+      const std::uint64_t& owner,
+      bool& added
+    );
+    [[nodiscard]] static std::shared_ptr<node> remove_from(
+      const std::shared_ptr<node>& current,
+      const Key& key,
+      const hash_t& hash,
+      const unsigned& shift,
+      const std::uint64_t& owner,
+      bool& removed
+    );
+    [[nodiscard]] static std::shared_ptr<node> replace_value(
+      const std::shared_ptr<node>& current,
+      const size_t& index,
+      entry_t&& entry,
+      insert_mode mode,
+      const std::uint64_t& owner
+    );
+    [[nodiscard]] static std::shared_ptr<node> merge(entry_t&& first, entry_t&& second, const unsigned& shift, const std::uint64_t& owner);
+    [[nodiscard]] static std::shared_ptr<node> make_editable(const std::shared_ptr<node>& current, const std::uint64_t& owner);
+    [[nodiscard]] static std::uint32_t calculate_bit(const hash_t& hash, const unsigned& shift) noexcept;
+    [[nodiscard]] static size_t calculate_index(const std::uint32_t& bitmap, const std::uint32_t& bit) noexcept;
+    [[nodiscard]] static std::uint64_t next_owner() noexcept;
+  };
+}
+
+#include "inline/persistent_hash_map.tpp"
\ No newline at end of file
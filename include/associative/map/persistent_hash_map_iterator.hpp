@@ -0,0 +1,51 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace containers::associative {
+  /**
+   * @class persistent_hash_map_iterator
+   * @brief A forward iterator over one version of a persistent_hash_map.
+   *
+   * The iterator keeps the root of its version alive, so it stays valid no matter how
+   * the map it has been created from is modified afterwards.
+   *
+   * @tparam Node The trie node type of the map.
+   * @tparam Key The type of the keys stored in the map.
+   * @tparam Value The type of the values associated with the keys.
+   */
+  template<typename Node, typename Key, typename Value>
+  class persistent_hash_map_iterator {
+  public:
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::pair<Key, Value>;
+
+    persistent_hash_map_iterator();
+    explicit persistent_hash_map_iterator(const std::shared_ptr<Node>& root);
+
+    value_type operator*() const;
+
+    // Prefix increment
+    persistent_hash_map_iterator& operator++();
+    // Postfix increment
+    persistent_hash_map_iterator operator++(int);
+
+    bool operator==(const persistent_hash_map_iterator& other) const;
+
+  private:
+    // A node on the path from the root, with the position inside its entries followed by its children
+    struct frame {
+      const Node* node;
+      size_t index;
+    };
+
+    std::shared_ptr<Node> root;
+    std::vector<frame> path;
+
+    void descend_to_entry();
+  };
+}
+
+#include "inline/persistent_hash_map_iterator.tpp"
\ No newline at end of file
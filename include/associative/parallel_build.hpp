@@ -0,0 +1,126 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "container.hpp"
+#include "sequential/doubly_linked_list.hpp"
+
+namespace containers::associative {
+  /**
+   * @brief Calculates the bucket count that keeps the load factor below 0.75 for the given number of elements.
+   * @param element_count The number of elements the buckets must hold.
+   * @param minimum_bucket_count The bucket count to start from, a power of 2.
+   * @return The smallest power of 2 not less than `minimum_bucket_count` with a load factor below 0.75.
+   */
+  [[nodiscard]] inline size_t calculate_bucket_count(const size_t& element_count, const size_t& minimum_bucket_count) noexcept {
+    auto bucket_count = std::max<size_t>(minimum_bucket_count, 1);
+    while (static_cast<double>(element_count) / static_cast<double>(bucket_count) >= 0.75) {
+      bucket_count *= 2;
+    }
+    return bucket_count;
+  }
+
+  /**
+   * @brief Runs an action on several threads and waits for all of them.
+   * @param threads The number of threads.
+   * @param action Called with the index of the thread, from 0 to `threads - 1`.
+   * @throws The first exception thrown by any action, after all threads have finished.
+   */
+  template<typename Action>
+  void run_on_threads(const size_t& threads, const Action& action) {
+    std::exception_ptr exception;
+    std::mutex exception_mutex;
+    auto workers = std::vector<std::thread>();
+    workers.reserve(threads);
+    for (size_t thread = 0; thread < threads; ++thread) {
+      workers.emplace_back([&, thread] {
+        try {
+          action(thread);
+        } catch (...) {
+          std::scoped_lock lock(exception_mutex);
+          if (exception == nullptr) {
+            exception = std::current_exception();
+          }
+        }
+      });
+    }
+    std::ranges::for_each(workers, [](auto& worker) { worker.join(); });
+    if (exception != nullptr) {
+      std::rethrow_exception(exception);
+    }
+  }
+
+  /**
+   * @brief Distributes entries over empty buckets using several threads without locking.
+   *
+   * Entries are radix-partitioned by the high bits of their bucket index, so every partition
+   * covers a contiguous range of buckets that a single thread fills on its own:
+   * - First, every thread hashes a slice of the entries and sorts their positions into partitions.
+   * - Then, every thread places the entries of its partitions into their buckets, in input order.
+   *
+   * @tparam Bucket The bucket type of the container.
+   * @tparam Entry The type of the entries to distribute.
+   * @param buckets The buckets to fill, their number must be a power of 2.
+   * @param entries The entries, moved into the buckets.
+   * @param hash_entry Returns the hash of an entry, called concurrently.
+   * @param place Moves an entry into a bucket and returns the number of elements it added.
+   * @param threads The number of threads to use.
+   * @return The total number of elements added by place.
+   */
+  template<typename Bucket, typename Entry, typename HashEntry, typename Place>
+  size_t fill_buckets_parallel(
+    sequential::doubly_linked_list<Bucket>& buckets,
+    std::vector<Entry>& entries,
+    const HashEntry& hash_entry,
+    const Place& place,
+    size_t threads
+  ) {
+    // Random access to the buckets, the list itself only offers linear access
+    auto bucket_pointers = std::vector<Bucket*>();
+    bucket_pointers.reserve(buckets.size());
+    for (const auto& bucket_ptr : buckets) {
+      bucket_pointers.push_back(&bucket_ptr->data);
+    }
+
+    const auto bucket_count = bucket_pointers.size();
+    threads = std::clamp<size_t>(threads, 1, std::max<size_t>(entries.size(), 1));
+    const auto partitions = std::min(std::bit_ceil(threads), bucket_count);
+    const auto partition_shift = std::countr_zero(bucket_count) - std::countr_zero(partitions);
+
+    auto bucket_indices = std::vector<size_t>(entries.size());
+    // positions[thread][partition] holds the entries of a partition found by a thread
+    auto positions = std::vector(threads, std::vector<std::vector<size_t>>(partitions));
+    run_on_threads(threads, [&](const size_t& thread) {
+      const auto begin = entries.size() * thread / threads;
+      const auto end = entries.size() * (thread + 1) / threads;
+      for (auto position = begin; position < end; ++position) {
+        const auto bucket_index = static_cast<size_t>(hash_entry(entries[position])) % bucket_count;
+        bucket_indices[position] = bucket_index;
+        positions[thread][bucket_index >> partition_shift].push_back(position);
+      }
+    });
+
+    auto added = std::vector<size_t>(partitions, 0);
+    const auto placing_threads = std::min(threads, partitions);
+    run_on_threads(placing_threads, [&](const size_t& thread) {
+      for (auto partition = thread; partition < partitions; partition += placing_threads) {
+        for (const auto& thread_positions : positions) {
+          for (const auto& position : thread_positions[partition]) {
+            added[partition] += place(*bucket_pointers[bucket_indices[position]], std::move(entries[position]));
+          }
+        }
+      }
+    });
+
+    size_t total = 0;
+    for (const auto& count : added) {
+      total += count;
+    }
+    return total;
+  }
+}
\ No newline at end of file
@@ -0,0 +1,144 @@
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <vector>
+
+#include "associative/parallel_build.hpp"
+
+namespace containers::associative {
+  /**
+   * @brief The buckets of a container, split into chunks of about equal element count.
+   * @tparam Bucket The bucket type of the container.
+   */
+  template<typename Bucket>
+  struct bucket_chunks {
+    std::vector<const Bucket*> buckets;
+    // Chunk i covers buckets [bounds[i], bounds[i + 1])
+    std::vector<size_t> bounds{0};
+
+    [[nodiscard]] size_t size() const noexcept {
+      return bounds.size() - 1;
+    }
+  };
+
+  // Chunks per thread, more chunks let threads that finish early take over work of slower ones
+  constexpr size_t chunks_per_thread = 4;
+
+  /**
+   * @brief Splits buckets into chunks balanced by the number of elements, not the number of buckets.
+   *
+   * Chains can be skewed, so a chunk ends as soon as it holds its share of the elements.
+   * A single bucket is never split.
+   *
+   * @param buckets The buckets of the container.
+   * @param weigh Returns the number of elements of a bucket.
+   * @param chunk_count The desired number of chunks.
+   * @return The chunks, at most `chunk_count` and none holding only empty buckets.
+   */
+  template<typename Bucket, typename Weigh>
+  [[nodiscard]] bucket_chunks<Bucket> split_buckets(
+    const sequential::doubly_linked_list<Bucket>& buckets,
+    const Weigh& weigh,
+    const size_t& chunk_count
+  ) {
+    auto chunks = bucket_chunks<Bucket>();
+    auto weights = std::vector<size_t>();
+    size_t total_weight = 0;
+    for (const auto& bucket_ptr : buckets) {
+      chunks.buckets.push_back(&bucket_ptr->data);
+      weights.push_back(weigh(bucket_ptr->data));
+      total_weight += weights.back();
+    }
+
+    const auto chunks_wanted = std::max<size_t>(chunk_count, 1);
+    const auto target_weight = std::max<size_t>((total_weight + chunks_wanted - 1) / chunks_wanted, 1);
+    size_t chunk_weight = 0;
+    for (size_t index = 0; index < weights.size(); ++index) {
+      chunk_weight += weights[index];
+      if (chunk_weight >= target_weight) {
+        chunks.bounds.push_back(index + 1);
+        chunk_weight = 0;
+      }
+    }
+    if (chunk_weight > 0) {
+      chunks.bounds.push_back(weights.size());
+    }
+    return chunks;
+  }
+
+  /**
+   * @brief Calls an action for every element of the chunks, on several threads.
+   *
+   * Threads take the next unprocessed chunk until all chunks are done.
+   *
+   * @param chunks The chunks to process.
+   * @param threads The number of threads to use.
+   * @param for_each_element Calls a callback with every element of a bucket.
+   * @param action Called concurrently with the arguments for_each_element passes to the callback.
+   */
+  template<typename Bucket, typename ForEachElement, typename Action>
+  void for_each_parallel(
+    const bucket_chunks<Bucket>& chunks,
+    const size_t& threads,
+    const ForEachElement& for_each_element,
+    const Action& action
+  ) {
+    std::atomic<size_t> next_chunk = 0;
+    run_on_threads(std::clamp<size_t>(threads, 1, std::max<size_t>(chunks.size(), 1)), [&](const size_t&) {
+      for (auto chunk = next_chunk++; chunk < chunks.size(); chunk = next_chunk++) {
+        for (auto index = chunks.bounds[chunk]; index < chunks.bounds[chunk + 1]; ++index) {
+          for_each_element(*chunks.buckets[index], action);
+        }
+      }
+    });
+  }
+
+  /**
+   * @brief Maps every element of the chunks and combines the results, on several threads.
+   *
+   * Every chunk is reduced on its own, then the results of the chunks are combined with
+   * `init` in bucket order. `combine` must be associative, but need not be commutative.
+   *
+   * @param chunks The chunks to process.
+   * @param threads The number of threads to use.
+   * @param init The initial value, combined exactly once.
+   * @param for_each_element Calls a callback with every element of a bucket.
+   * @param map Called concurrently with the arguments for_each_element passes to the callback, returns a T.
+   * @param combine Combines two T into one.
+   * @return The combined result.
+   */
+  template<typename T, typename Bucket, typename ForEachElement, typename Map, typename Combine>
+  [[nodiscard]] T reduce_parallel(
+    const bucket_chunks<Bucket>& chunks,
+    const size_t& threads,
+    T init,
+    const ForEachElement& for_each_element,
+    const Map& map,
+    const Combine& combine
+  ) {
+    auto results = std::vector<std::optional<T>>(chunks.size());
+    std::atomic<size_t> next_chunk = 0;
+    run_on_threads(std::clamp<size_t>(threads, 1, std::max<size_t>(chunks.size(), 1)), [&](const size_t&) {
+      for (auto chunk = next_chunk++; chunk < chunks.size(); chunk = next_chunk++) {
+        auto& result = results[chunk];
+        for (auto index = chunks.bounds[chunk]; index < chunks.bounds[chunk + 1]; ++index) {
+          for_each_element(*chunks.buckets[index], [&](const auto&... element) {
+            if (result.has_value()) {
+              result = combine(std::move(*result), map(element...));
+            } else {
+              result.emplace(map(element...));
+            }
+          });
+        }
+      }
+    });
+
+    for (auto& result : results) {
+      if (result.has_value()) {
+        init = combine(std::move(init), std::move(*result));
+      }
+    }
+    return init;
+  }
+}
\ No newline at end of file
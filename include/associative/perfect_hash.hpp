@@ -0,0 +1,119 @@
+#pragma once
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "container.hpp"
+
+namespace containers::associative {
+  /**
+   * @brief The default hash of frozen_set and frozen_map, usable in constant expressions.
+   *
+   * Integers and enumerations hash to their value, strings to their FNV-1a hash. The hash
+   * is mixed by perfect_hash before use, so it need not be well distributed, only distinct
+   * for distinct keys.
+   *
+   * @tparam Key The type of the keys.
+   */
+  template<typename Key>
+  struct frozen_hash;
+
+  template<typename Key> requires std::is_integral_v<Key> || std::is_enum_v<Key>
+  struct frozen_hash<Key> {
+    [[nodiscard]] constexpr std::uint64_t operator()(const Key& key) const noexcept {
+      return static_cast<std::uint64_t>(key);
+    }
+  };
+
+  template<typename Key> requires std::is_convertible_v<const Key&, std::string_view>
+  struct frozen_hash<Key> {
+    [[nodiscard]] constexpr std::uint64_t operator()(const Key& key) const noexcept {
+      std::uint64_t hash = 0xcbf29ce484222325ULL;
+      for (const auto& character : std::string_view(key)) {
+        hash = (hash ^ static_cast<unsigned char>(character)) * 0x100000001b3ULL;
+      }
+      return hash;
+    }
+  };
+
+  /**
+   * @brief The number of perfect_hash buckets for a number of keys, about 4 keys per bucket.
+   * @param key_count The number of keys.
+   * @return The bucket count, at least 1.
+   */
+  [[nodiscard]] constexpr size_t calculate_perfect_hash_bucket_count(const size_t& key_count) noexcept {
+    return key_count / 4 + 1;
+  }
+
+  /**
+   * @brief Storage of a frozen container, a std::array if the number of elements is known at compile time.
+   */
+  template<typename T, size_t Extent>
+  using frozen_storage_t = std::conditional_t<Extent == std::dynamic_extent, std::vector<T>, std::array<T, Extent>>;
+
+  /**
+   * @class perfect_hash
+   * @brief A minimal perfect hash function for a fixed set of keys (PTHash).
+   *
+   * Maps each of the n keys it has been built for to a distinct slot in [0, n), so a lookup
+   * needs one hash, one pilot and one slot access and no probing.
+   *
+   * @tparam Key The type of the keys.
+   * @tparam Extent The number of keys, or std::dynamic_extent if only known at runtime.
+   * @tparam Hash A hash returning distinct std::uint64_t for distinct keys, constexpr for compile-time use.
+   *
+   * @details
+   * - The mixed hash of a key selects a bucket of about 4 keys. Each bucket stores a pilot
+   *   value, and a key lands in slot `mix(hash ^ pilot) % n`. Mixing again after the xor
+   *   matters for small n: without it, the parity of two slots of a bucket never changes.
+   * - Buckets are placed from the largest to the smallest. For each, pilots are tried in
+   *   order until all keys of the bucket land in free slots, so late small buckets fill the
+   *   few remaining slots.
+   * - If some bucket finds no pilot, the build starts over with another seed.
+   * - Keys not in the set map to some slot too, the caller compares the key stored there.
+   */
+  template<typename Key, size_t Extent, typename Hash>
+  class perfect_hash final {
+  public:
+    /**
+     * @brief Builds the function for the keys of some elements.
+     *
+     * @param elements The elements, all keys distinct.
+     * @param key_of Returns the key of an element.
+     * @return The slot of every element, in the order of `elements`.
+     * @throws duplicate_key<Key> If two elements have the same key.
+     * @throws perfect_hash_error If distinct keys have the same hash.
+     * @note Runtime complexity: O(n log n) expected.
+     */
+    template<typename Elements, typename KeyOf>
+    [[nodiscard]] constexpr frozen_storage_t<size_t, Extent> build(const Elements& elements, const KeyOf& key_of);
+
+    /**
+     * @brief Returns the slot of a key.
+     * @param key The key to look up.
+     * @return The slot the key has been placed in if it is one of the keys built for, else some slot.
+     * @note Runtime complexity: O(1).
+     */
+    [[nodiscard]] constexpr size_t slot(const Key& key) const noexcept;
+
+  private:
+    static constexpr std::uint32_t max_pilot = std::uint32_t{1} << 24;
+    static constexpr std::uint64_t max_seed = 64;
+
+    std::uint64_t seed = 0;
+    size_t slot_count = 0;
+    frozen_storage_t<std::uint32_t, Extent == std::dynamic_extent ? Extent : calculate_perfect_hash_bucket_count(Extent)> pilots{};
+
+    [[nodiscard]] static constexpr std::uint64_t mix(std::uint64_t value) noexcept;
+    [[nodiscard]] constexpr std::uint64_t hash(const Key& key) const noexcept;
+    [[nodiscard]] constexpr size_t bucket(const std::uint64_t& hash) const noexcept;
+    [[nodiscard]] constexpr bool try_build(const std::vector<std::uint64_t>& raw_hashes, std::vector<size_t>& slots);
+  };
+}
+
+#include "inline/perfect_hash.tpp"
\ No newline at end of file
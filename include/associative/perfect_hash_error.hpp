@@ -0,0 +1,19 @@
+#pragma once
+
+#include <exception>
+#include <string>
+
+namespace containers::associative {
+  /**
+   * @class perfect_hash_error
+   * @brief Thrown when no perfect hash function can be built for a set of keys.
+   */
+  class perfect_hash_error final : public std::exception {
+  public:
+    explicit perfect_hash_error(const std::string& message);
+
+    virtual const char* what() const noexcept override;
+  private:
+    const std::string message;
+  };
+}
\ No newline at end of file
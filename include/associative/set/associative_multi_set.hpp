@@ -23,6 +23,14 @@ namespace containers::associative {
      */
     virtual bool exists(const Key& key) const = 0;
 
+    /**
+     * @brief Counts the occurrences of a key in the container.
+     * @param key The key to search for.
+     * @return The number of times the key is stored, 0 if the key does not exist.
+     * @note Runtime complexity: O(log n) for ordered containers, O(1) on average for hash-based containers.
+     */
+    virtual size_t count(const Key& key) const = 0;
+
     /**
      * @brief Removes a key from the container.
      * @param key The key to remove.
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <expected>
+
 #include <container.hpp>
+#include <container_error.hpp>
 
 namespace containers::associative {
   template<typename Key>
@@ -23,6 +26,14 @@ namespace containers::associative {
      */
     virtual void insert_safely(const Key& key) = 0;
 
+    /**
+     * @brief Inserts a key into the container if it does not exist yet.
+     * @param key The key to insert.
+     * @return Nothing, or container_error::duplicate_key if the key already exists.
+     * @note Runtime complexity: O(log n) for ordered containers, O(1) on average for hash-based containers.
+     */
+    virtual std::expected<void, container_error> try_insert(const Key& key) = 0;
+
     /**
      * @brief Checks if a key exists in the container.
      * @param key The key to search for.
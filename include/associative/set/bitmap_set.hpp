@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "ordered_set.hpp"
+
+namespace containers::associative {
+  /**
+   * @class bitmap_set
+   * @brief An ordered set of integers below a fixed universe, stored as a hierarchy of 64-bit bitmaps.
+   *
+   * Meant for bounded integer keys such as time slots or dense IDs, queried for the next or
+   * previous stored key, e.g. the next free slot after a tick. Each query tests one word per
+   * level with std::countr_zero or std::countl_zero instead of comparing keys along a path.
+   *
+   * @details
+   * - Level 0 holds one bit per key of the universe. Bit i of level l + 1 is set if word i of
+   *   level l is not zero, up to a top level of a single word.
+   * - A universe of 2^32 keys needs 6 levels, 2^20 keys 4 levels, so every operation reads or
+   *   writes at most one word per level. insert() and remove() stop as soon as a word above
+   *   does not change.
+   * - The bitmaps are allocated at construction, about universe / 8 bytes: 512 MiB for all
+   *   32-bit keys, 128 KiB for 2^20 keys.
+   *
+   * @note This class is not thread-safe.
+   */
+  class bitmap_set final : public ordered_set<std::uint32_t> {
+  public:
+    using key_t = std::uint32_t;
+
+    /**
+     * @brief Constructs an empty bitmap_set for the keys in [0, universe).
+     * @param universe The number of possible keys, at most 2^32.
+     * @throws std::invalid_argument If universe is 0 or greater than 2^32.
+     */
+    explicit bitmap_set(const std::uint64_t& universe);
+
+    virtual ~bitmap_set() override = default;
+
+    /**
+     * @copydoc associative_set::insert
+     * @throws std::out_of_range If the key is not less than universe().
+     * @note Runtime complexity: O(log_64 universe).
+     */
+    virtual void insert(const key_t& key) override;
+
+    /**
+     * @copydoc associative_set::insert_safely
+     * @throws std::out_of_range If the key is not less than universe().
+     * @note Runtime complexity: O(log_64 universe).
+     */
+    virtual void insert_safely(const key_t& key) override;
+
+    /**
+     * @copydoc associative_set::try_insert
+     * @throws std::out_of_range If the key is not less than universe().
+     * @note Runtime complexity: O(log_64 universe).
+     */
+    virtual std::expected<void, container_error> try_insert(const key_t& key) override;
+
+    /**
+     * @copydoc associative_set::exists
+     * @note Runtime complexity: O(1).
+     */
+    virtual bool exists(const key_t& key) const override;
+
+    /**
+     * @copydoc associative_set::remove
+     * @note Runtime complexity: O(log_64 universe).
+     */
+    virtual void remove(const key_t& key) override;
+
+    /**
+     * @copydoc ordered_set::find_lower_bound
+     * @note Runtime complexity: O(log_64 universe), the same as lower_bound().
+     */
+    virtual std::optional<key_t> find_lower_bound(const key_t& key) const override;
+
+    /**
+     * @copydoc ordered_set::find_upper_bound
+     * @note Runtime complexity: O(log_64 universe), the same as successor().
+     */
+    virtual std::optional<key_t> find_upper_bound(const key_t& key) const override;
+
+    /**
+     * @brief Removes all keys.
+     * @note Runtime complexity: O(universe / 64).
+     */
+    void clear();
+
+    /**
+     * @brief Returns the smallest stored key greater than the given key.
+     * @param key Any key, which does not need to be stored.
+     * @return The key, or std::nullopt if there is none.
+     * @note Runtime complexity: O(log_64 universe).
+     */
+    [[nodiscard]] std::optional<key_t> successor(const key_t& key) const;
+
+    /**
+     * @brief Returns the greatest stored key less than the given key.
+     * @param key Any key, which does not need to be stored.
+     * @return The key, or std::nullopt if there is none.
+     * @note Runtime complexity: O(log_64 universe).
+     */
+    [[nodiscard]] std::optional<key_t> predecessor(const key_t& key) const;
+
+    /**
+     * @brief Returns the smallest stored key not less than the given key, e.g. the next free slot at or after a tick.
+     * @param key Any key, which does not need to be stored.
+     * @return The key, or std::nullopt if there is none.
+     * @note Runtime complexity: O(log_64 universe).
+     */
+    [[nodiscard]] std::optional<key_t> lower_bound(const key_t& key) const;
+
+    /**
+     * @brief Returns the smallest stored key.
+     * @return The key, or std::nullopt if the set is empty.
+     */
+    [[nodiscard]] std::optional<key_t> min() const;
+
+    /**
+     * @brief Returns the greatest stored key.
+     * @return The key, or std::nullopt if the set is empty.
+     */
+    [[nodiscard]] std::optional<key_t> max() const;
+
+    /**
+     * @brief Returns the number of possible keys.
+     * @return The universe given at construction.
+     */
+    [[nodiscard]] std::uint64_t universe() const noexcept;
+
+  private:
+    static constexpr int word_bits = 64;
+    static constexpr int level_shift = 6;
+
+    std::uint64_t key_universe;
+    // levels.front() holds one bit per key, levels.back() is a single word
+    std::vector<std::vector<std::uint64_t>> levels;
+
+    bool insert_if_absent(const key_t& key);
+    [[nodiscard]] std::optional<key_t> next_from(std::uint64_t position) const;
+    [[nodiscard]] std::optional<key_t> previous_from(std::uint64_t position) const;
+  };
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <optional>
+
+#include "ordered_multi_set.hpp"
+#include "associative/btree_core.hpp"
+
+namespace containers::associative {
+  /**
+   * @class btree_multi_set
+   * @brief An ordered multi-set implemented as a B+ tree with subtree counts, answering order statistics.
+   *
+   * Besides membership, the multi-set finds the rank of a key and the key of a rank in
+   * O(log n), so percentiles of a changing collection need neither sorting nor copying.
+   *
+   * @tparam Key The type of the keys, ordered by operator<.
+   * @tparam Capacity The maximum number of distinct keys per node, see btree_default_capacity.
+   *
+   * @details
+   * - Every distinct key is stored once in a leaf of a counted btree_core with its number of
+   *   occurrences as payload, so repeated keys such as latencies in whole microseconds cost no
+   *   additional space.
+   * - Inner nodes store the number of elements below each child next to the child pointers.
+   *   A rank query sums the counts left of its path, a select query descends by subtracting
+   *   them, both touch one node per level.
+   * - Keys must be default constructible.
+   *
+   * @note This class is not thread-safe.
+   */
+  template<typename Key, size_t Capacity = btree_default_capacity<Key>>
+  class btree_multi_set final : public ordered_multi_set<Key> {
+  private:
+    using core_t = btree_core<Key, size_t, Capacity, true>;
+    using leaf_node = typename core_t::leaf_node;
+    using inner_node = typename core_t::inner_node;
+
+  public:
+    /**
+     * @brief Constructs an empty btree_multi_set.
+     */
+    btree_multi_set();
+
+    virtual ~btree_multi_set() override = default;
+    btree_multi_set(const btree_multi_set&) = delete;
+    btree_multi_set& operator=(const btree_multi_set&) = delete;
+
+    //! @copydoc associative_multi_set::insert
+    virtual void insert(const Key& key) override;
+    //! @copydoc associative_multi_set::exists
+    virtual bool exists(const Key& key) const override;
+    //! @copydoc associative_multi_set::count
+    virtual size_t count(const Key& key) const override;
+    //! @copydoc ordered_multi_set::find_lower_bound
+    virtual std::optional<Key> find_lower_bound(const Key& key) const override;
+    //! @copydoc ordered_multi_set::find_upper_bound
+    virtual std::optional<Key> find_upper_bound(const Key& key) const override;
+
+    /**
+     * @brief Removes all occurrences of a key.
+     * @param key The key to remove.
+     * @note If the key does not exist in the container, the method has no effect.
+     * @note Runtime complexity: O(log n).
+     */
+    virtual void remove(const Key& key) override;
+
+    /**
+     * @brief Removes a single occurrence of a key, e.g. the oldest sample leaving a sliding window.
+     * @param key The key to remove.
+     * @note If the key does not exist in the container, the method has no effect.
+     * @note Runtime complexity: O(log n).
+     */
+    void remove_one(const Key& key);
+
+    /**
+     * @brief Removes all keys.
+     */
+    void clear();
+
+    /**
+     * @brief Counts the elements less than a key.
+     * @param key The key, which does not need to be stored.
+     * @return The number of elements less than the key, the index select() returns the key at if it is stored.
+     * @note Runtime complexity: O(log n).
+     */
+    [[nodiscard]] size_t rank(const Key& key) const;
+
+    /**
+     * @brief Returns the element at a position in sorted order, repeated keys taking one position each.
+     * @param index The zero-based position.
+     * @return The key at the position.
+     * @throws std::out_of_range If index is not less than size().
+     * @note Runtime complexity: O(log n).
+     */
+    [[nodiscard]] Key select(const size_t& index) const;
+
+    /**
+     * @brief Counts the elements in [first, last).
+     * @param first The smallest key of the range.
+     * @param last The key after the range.
+     * @return The number of elements not less than first and less than last.
+     * @note Runtime complexity: O(log n).
+     */
+    [[nodiscard]] size_t count_range(const Key& first, const Key& last) const;
+
+    /**
+     * @brief Returns a percentile by the nearest-rank method.
+     * @param percent The percentile in [0, 100], e.g. 99 for the p99 latency.
+     * @return The smallest key with at least percent % of the elements less than or equal to it.
+     * @throws std::invalid_argument If percent is outside [0, 100].
+     * @throws std::out_of_range If the multi-set is empty.
+     * @note Runtime complexity: O(log n).
+     */
+    [[nodiscard]] Key percentile(const double& percent) const;
+
+  private:
+    core_t tree;
+
+    [[nodiscard]] static std::optional<Key> key_at(const leaf_node* leaf, const size_t& position);
+  };
+}
+
+#include "inline/btree_multi_set.tpp"
\ No newline at end of file
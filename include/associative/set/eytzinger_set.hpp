@@ -0,0 +1,89 @@
+#pragma once
+
+#include <new>
+#include <optional>
+#include <ranges>
+#include <vector>
+
+#include "container.hpp"
+
+namespace containers::associative {
+  /**
+   * @class eytzinger_set
+   * @brief An immutable ordered set stored in Eytzinger layout, for keys built once and searched very often.
+   *
+   * The keys form an implicit binary search tree stored level by level: the root at index 1,
+   * the children of index k at 2k and 2k + 1. The first levels of the tree, visited by every
+   * search, share a few cache lines, and the 16 descendants 4 levels below a node are
+   * consecutive, so a search prefetches them while comparing the levels between. The layout
+   * starts on a cache line, so for keys of 4 bytes these descendants fill exactly one. A sorted
+   * array instead spreads the first probes of a binary search over distant cache lines.
+   *
+   * @tparam Key The type of the keys, ordered by operator<.
+   *
+   * @details
+   * - Usually built by flat_ordered_set::freeze(), or from any range of keys.
+   * - The search descends without a branch on the comparison, and recovers the lower bound
+   *   from the path it took once it leaves the tree.
+   * - Pays off once the keys no longer fit into the caches. Smaller sets are searched about as
+   *   fast by flat_ordered_set, whose branchless binary search needs no prefetching.
+   *
+   * @note All member functions are thread-safe.
+   */
+  template<typename Key>
+  class eytzinger_set final : public container {
+  public:
+    /**
+     * @brief Builds the set from keys in any order, repeated keys are stored once.
+     * @param keys A range of keys.
+     * @note Runtime complexity: O(n) if the keys are sorted already, else O(n log n).
+     */
+    template<std::ranges::input_range Range>
+    explicit eytzinger_set(Range&& keys);
+
+    virtual ~eytzinger_set() override = default;
+
+    /**
+     * @brief Checks whether the key is in the set.
+     * @param key The key to look up.
+     * @return True if the key is in the set, false otherwise.
+     * @note Runtime complexity: O(log n).
+     */
+    [[nodiscard]] bool exists(const Key& key) const noexcept;
+
+    /**
+     * @brief Returns the smallest key not less than the given key.
+     * @param key The key to look up, which does not need to be stored.
+     * @return The key, or std::nullopt if all keys are less.
+     * @note Runtime complexity: O(log n).
+     */
+    [[nodiscard]] std::optional<Key> lower_bound(const Key& key) const;
+
+  private:
+    static constexpr size_t cache_line_size = 64;
+
+    // Places the layout on a cache line boundary, so that index 16k starts a cache line for keys of 4 bytes
+    template<typename T>
+    struct cache_line_allocator {
+      using value_type = T;
+
+      cache_line_allocator() noexcept = default;
+      template<typename U>
+      cache_line_allocator(const cache_line_allocator<U>&) noexcept {}
+
+      [[nodiscard]] T* allocate(size_t count);
+      void deallocate(T* pointer, size_t count) noexcept;
+
+      template<typename U>
+      bool operator==(const cache_line_allocator<U>&) const noexcept { return true; }
+    };
+
+    // Index 0 is unused, so the children of index k are 2k and 2k + 1
+    std::vector<Key, cache_line_allocator<Key>> layout;
+
+    void place(const std::vector<Key>& sorted, size_t& next, const size_t& index);
+    [[nodiscard]] size_t lower_bound_index(const Key& key) const noexcept;
+  };
+}
+
+#include "inline/eytzinger_set.tpp"
\ No newline at end of file
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <ranges>
+#include <span>
+#include <vector>
+
+#include "ordered_set.hpp"
+#include "eytzinger_set.hpp"
+
+namespace containers::associative {
+  /**
+   * @class flat_ordered_set
+   * @brief An ordered set stored as one sorted array, for small or rarely modified sets.
+   *
+   * The keys are kept in a contiguous array in order, so a lookup binary searches a few cache
+   * lines without any node pointers. There is no per-key allocation or pointer overhead, while
+   * single insertions and removals shift the array in O(n).
+   *
+   * @tparam Key The type of the keys, ordered by operator<.
+   *
+   * @details
+   * - Lookups use branchless_lower_bound.
+   * - Many insertions are best made at once with insert_batch(), which sorts them and merges
+   *   them with the existing keys in one pass.
+   * - Iterators are invalidated by every modification.
+   *
+   * @note This class is not thread-safe.
+   */
+  template<typename Key>
+  class flat_ordered_set final : public ordered_set<Key> {
+  public:
+    using iterator_t = typename std::vector<Key>::const_iterator;
+
+    /**
+     * @brief Constructs an empty flat_ordered_set.
+     */
+    flat_ordered_set() = default;
+
+    /**
+     * @brief Constructs a flat_ordered_set from keys in any order, repeated keys are stored once.
+     * @param keys A range of keys.
+     * @note Runtime complexity: O(n) if the keys are sorted already, else O(n log n).
+     */
+    template<std::ranges::input_range Range>
+    explicit flat_ordered_set(Range&& keys);
+
+    virtual ~flat_ordered_set() override = default;
+
+    //! @copydoc associative_set::insert
+    virtual void insert(const Key& key) override;
+    //! @copydoc associative_set::insert_safely
+    virtual void insert_safely(const Key& key) override;
+    //! @copydoc associative_set::try_insert
+    virtual std::expected<void, container_error> try_insert(const Key& key) override;
+    //! @copydoc associative_set::exists
+    virtual bool exists(const Key& key) const override;
+    //! @copydoc associative_set::remove
+    virtual void remove(const Key& key) override;
+    //! @copydoc ordered_set::find_lower_bound
+    virtual std::optional<Key> find_lower_bound(const Key& key) const override;
+    //! @copydoc ordered_set::find_upper_bound
+    virtual std::optional<Key> find_upper_bound(const Key& key) const override;
+
+    /**
+     * @brief Inserts many keys at once, sorting them and merging them with the stored ones in one pass.
+     * @param keys A range of keys in any order, keys already stored or repeated are skipped.
+     * @note Runtime complexity: O(n + m log m) for m new keys.
+     */
+    template<std::ranges::input_range Range>
+    void insert_batch(Range&& keys);
+
+    /**
+     * @brief Removes all keys.
+     */
+    void clear();
+
+    /**
+     * @brief Returns an iterator to the first key not less than the given key.
+     * @param key The key to look up.
+     * @return The iterator, or end() if all keys are less.
+     * @note Runtime complexity: O(log n).
+     */
+    [[nodiscard]] iterator_t lower_bound(const Key& key) const;
+
+    /**
+     * @brief Returns an iterator to the first key greater than the given key.
+     * @param key The key to look up.
+     * @return The iterator, or end() if no key is greater.
+     * @note Runtime complexity: O(log n).
+     */
+    [[nodiscard]] iterator_t upper_bound(const Key& key) const;
+
+    /**
+     * @brief Returns the sorted keys.
+     * @return A view of the key array, invalidated by every modification.
+     */
+    [[nodiscard]] std::span<const Key> keys() const noexcept;
+
+    /**
+     * @brief Copies the keys into an immutable eytzinger_set, which searches faster once the keys stop changing.
+     * @return The eytzinger_set of all keys.
+     * @note Runtime complexity: O(n).
+     */
+    [[nodiscard]] eytzinger_set<Key> freeze() const;
+
+    iterator_t begin() const;
+    iterator_t end() const;
+    iterator_t cbegin() const;
+    iterator_t cend() const;
+
+  private:
+    std::vector<Key> sorted_keys;
+
+    bool insert_if_absent(const Key& key);
+    [[nodiscard]] size_t key_index(const Key& key) const noexcept;
+    [[nodiscard]] bool contains_at(const size_t& index, const Key& key) const noexcept;
+  };
+}
+
+#include "inline/flat_ordered_set.tpp"
\ No newline at end of file
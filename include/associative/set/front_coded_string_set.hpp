@@ -0,0 +1,179 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "container.hpp"
+#include "front_coded_string_set_iterator.hpp"
+#include "associative/snapshot/mapped_file.hpp"
+
+namespace containers::associative {
+  /**
+   * @class front_coded_string_set
+   * @brief An immutable ordered set of strings, compressed by front coding, which can be served from a memory-mapped file.
+   *
+   * Meant for large sorted vocabularies whose neighbouring strings share long prefixes, e.g.
+   * URLs or paths. Instead of a node and a heap allocation per string, the strings are packed
+   * into one byte array, most of them as the length of the prefix shared with the previous
+   * string and the remaining suffix.
+   *
+   * @details
+   * - The strings are grouped into blocks of block_size() strings. The first string of a block
+   *   is stored whole, the others front coded against their predecessor, with lengths as
+   *   variable-length integers.
+   * - An index of the block offsets lets a search binary search the first strings of the
+   *   blocks in place and then decode a single block.
+   * - The image in memory is the file written by save(), so open() maps the file and serves
+   *   lookups from it without decoding anything up front.
+   * - Iterators decode one string per increment.
+   * - Like mapped_hash_map, offsets read from a mapped file are checked on every access.
+   *
+   * @note All member functions are thread-safe.
+   */
+  class front_coded_string_set final : public container {
+  public:
+    using iterator_t = front_coded_string_set_iterator;
+
+    static constexpr size_t default_block_size = 16;
+
+    /**
+     * @brief Builds the set from strings in any order, repeated strings are stored once.
+     * @param keys A range of strings, or of anything std::string is constructible from.
+     * @param block_size The number of strings per block. Larger blocks are smaller, but searched slower.
+     * @throws std::invalid_argument If block_size is 0.
+     * @note Runtime complexity: O(total length) if the strings are sorted already, else O(n log n) comparisons.
+     */
+    template<std::ranges::input_range Range>
+    explicit front_coded_string_set(Range&& keys, const size_t& block_size = default_block_size);
+
+    /**
+     * @brief Maps a file written by save().
+     * @param path The file to map.
+     * @return The set, valid as long as it lives, even if the file is removed.
+     * @throws snapshot_error If the file cannot be mapped, is not a front-coded string set of
+     * this version, or its sections do not fit into the file.
+     * @note Runtime complexity: O(1).
+     */
+    [[nodiscard]] static front_coded_string_set open(const std::string& path);
+
+    virtual ~front_coded_string_set() override = default;
+    front_coded_string_set(const front_coded_string_set&) = delete;
+    front_coded_string_set& operator=(const front_coded_string_set&) = delete;
+    front_coded_string_set(front_coded_string_set&&) noexcept = default;
+    front_coded_string_set& operator=(front_coded_string_set&&) noexcept = default;
+
+    /**
+     * @brief Writes the set to a file, which open() maps.
+     * @param path The file to write, replaced atomically once complete.
+     * @throws snapshot_error If the file cannot be written.
+     */
+    void save(const std::string& path) const;
+
+    /**
+     * @brief Checks whether the string is in the set.
+     * @param key The string to look up.
+     * @return True if the string is in the set, false otherwise.
+     * @note Runtime complexity: O(log(n / block_size) + block_size) string comparisons.
+     */
+    [[nodiscard]] bool exists(const std::string_view& key) const;
+
+    /**
+     * @brief Returns an iterator to the first string not less than the given string.
+     * @param key The string to look up, which does not need to be stored.
+     * @return The iterator, or end() if all strings are less.
+     * @note Runtime complexity: O(log(n / block_size) + block_size) string comparisons.
+     */
+    [[nodiscard]] iterator_t lower_bound(const std::string_view& key) const;
+
+    /**
+     * @brief Counts the strings less than the given string.
+     * @param key The string, which does not need to be stored.
+     * @return The number of strings less than it, the index select() returns it at if it is stored.
+     * @note Runtime complexity: O(log(n / block_size) + block_size) string comparisons.
+     */
+    [[nodiscard]] size_t rank(const std::string_view& key) const;
+
+    /**
+     * @brief Returns the string at a position in sorted order.
+     * @param index The zero-based position.
+     * @return The string.
+     * @throws std::out_of_range If index is not less than size().
+     * @note Runtime complexity: O(block_size).
+     */
+    [[nodiscard]] std::string select(const size_t& index) const;
+
+    /**
+     * @brief Returns the number of strings per block.
+     * @return The block size given at construction.
+     */
+    [[nodiscard]] size_t block_size() const noexcept;
+
+    /**
+     * @brief Returns the size of the compressed image, which is also the size of the file written by save().
+     * @return The number of bytes.
+     */
+    [[nodiscard]] size_t size_in_bytes() const noexcept;
+
+    iterator_t begin() const;
+    iterator_t end() const;
+    iterator_t cbegin() const;
+    iterator_t cend() const;
+
+  private:
+    friend class front_coded_string_set_iterator;
+
+    // The start of the image, followed by the block offsets and the blob, each aligned to 8 bytes
+    struct header_t {
+      std::array<char, 8> magic;
+      std::uint32_t version;
+      std::uint32_t endianness;
+      std::uint64_t element_count;
+      std::uint64_t block_size;
+      std::uint64_t block_count;
+      std::uint64_t offsets_offset;
+      std::uint64_t blob_offset;
+      std::uint64_t blob_size;
+    };
+
+    // The position of the first string not less than a searched one
+    struct position_t {
+      size_t index;
+      size_t next_offset;
+      std::string key;
+    };
+
+    static constexpr std::array<char, 8> magic{'C', 'T', 'N', 'R', 'F', 'C', 'S', 'S'};
+    static constexpr std::uint32_t version = 1;
+
+    // Either the image built in memory, or the mapped file holding it
+    std::vector<char> bytes;
+    std::optional<mapped_file> file;
+
+    front_coded_string_set() = default;
+
+    void build(const std::vector<std::string>& sorted, const size_t& block_size);
+    void validate(const std::string& path) const;
+
+    [[nodiscard]] const char* image() const noexcept;
+    [[nodiscard]] const header_t& header() const noexcept;
+    [[nodiscard]] size_t block_offset(const size_t& block) const noexcept;
+    [[nodiscard]] std::string_view first_key(const size_t& block) const;
+    [[nodiscard]] size_t decode(const size_t& offset, const bool& block_start, std::string& key) const;
+    [[nodiscard]] size_t read_length(size_t& offset) const;
+    [[nodiscard]] position_t find_lower_bound(const std::string_view& key) const;
+  };
+
+  template<std::ranges::input_range Range>
+  front_coded_string_set::front_coded_string_set(Range&& keys, const size_t& block_size) {
+    auto sorted = std::vector<std::string>();
+    for (auto&& key : keys) {
+      sorted.emplace_back(std::forward<decltype(key)>(key));
+    }
+    build(sorted, block_size);
+  }
+}
\ No newline at end of file
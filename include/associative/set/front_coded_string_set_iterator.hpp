@@ -0,0 +1,41 @@
+#pragma once
+
+#include <iterator>
+#include <string>
+
+namespace containers::associative {
+  class front_coded_string_set;
+
+  /**
+   * @class front_coded_string_set_iterator
+   * @brief A forward iterator over a front_coded_string_set in sorted order, decoding one string per increment.
+   *
+   * The iterator holds the decoded string, which the next string is decoded on top of.
+   */
+  class front_coded_string_set_iterator {
+  public:
+    using iterator_concept = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = std::string;
+
+    front_coded_string_set_iterator();
+    front_coded_string_set_iterator(const front_coded_string_set* set, const size_t& index, const size_t& next_offset, std::string&& key);
+
+    const std::string& operator*() const;
+    const std::string* operator->() const;
+
+    // Prefix increment
+    front_coded_string_set_iterator& operator++();
+    // Postfix increment
+    front_coded_string_set_iterator operator++(int);
+
+    bool operator==(const front_coded_string_set_iterator& other) const;
+
+  private:
+    const front_coded_string_set* set;
+    size_t index;
+    // The offset of the string after the current one in the blob of the set
+    size_t next_offset;
+    std::string key;
+  };
+}
\ No newline at end of file
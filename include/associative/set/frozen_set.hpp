@@ -0,0 +1,78 @@
+#pragma once
+
+#include <array>
+#include <ranges>
+#include <span>
+
+#include "container.hpp"
+#include "associative/perfect_hash.hpp"
+
+namespace containers::associative {
+  /**
+   * @class frozen_set
+   * @brief An immutable set of keys fixed at construction, looked up through a minimal perfect hash.
+   *
+   * Replaces a hash_set that is filled once and never modified. A lookup computes one hash,
+   * reads one pilot and compares the key in exactly one slot. There are no buckets, no empty
+   * slots and no probing.
+   *
+   * @tparam Key The type of the keys.
+   * @tparam Extent The number of keys if known at compile time, else std::dynamic_extent.
+   * @tparam Hash A hash returning distinct std::uint64_t for distinct keys, see frozen_hash.
+   *
+   * @details
+   * - With a fixed Extent, the set is built from a std::array and can be a constexpr variable,
+   *   e.g. a keyword table. The perfect hash is then computed by the compiler.
+   * - With std::dynamic_extent, the set is built at runtime from any range of keys.
+   * - The keys are stored in slot order, which iteration follows.
+   * - See perfect_hash for how the slots are assigned.
+   *
+   * @note All member functions are thread-safe.
+   */
+  template<typename Key, size_t Extent = std::dynamic_extent, typename Hash = frozen_hash<Key>>
+  class frozen_set final : public container {
+  public:
+    /**
+     * @brief Builds the set from a fixed number of keys, at compile time if constant evaluated.
+     *
+     * @param keys The keys of the set.
+     * @throws duplicate_key<Key> If a key is given twice.
+     * @throws perfect_hash_error If distinct keys have the same hash.
+     * @note Runtime complexity: O(n log n) expected.
+     */
+    constexpr explicit frozen_set(const std::array<Key, Extent>& keys) requires (Extent != std::dynamic_extent);
+
+    /**
+     * @brief Builds the set from a range of keys.
+     *
+     * @param keys The keys of the set.
+     * @throws duplicate_key<Key> If a key is given twice.
+     * @throws perfect_hash_error If distinct keys have the same hash.
+     * @note Runtime complexity: O(n log n) expected.
+     */
+    template<std::ranges::input_range Range>
+    explicit frozen_set(Range&& keys) requires (Extent == std::dynamic_extent);
+
+    constexpr virtual ~frozen_set() override = default;
+
+    /**
+     * @brief Checks whether the key is in the set.
+     * @param key The key to look up.
+     * @return True if the key is in the set, false otherwise.
+     * @note Runtime complexity: O(1).
+     */
+    [[nodiscard]] constexpr bool exists(const Key& key) const noexcept;
+
+    constexpr auto begin() const noexcept;
+    constexpr auto end() const noexcept;
+
+  private:
+    perfect_hash<Key, Extent, Hash> hash;
+    frozen_storage_t<Key, Extent> keys{};
+  };
+
+  template<typename Key, size_t Extent>
+  frozen_set(const std::array<Key, Extent>&) -> frozen_set<Key, Extent>;
+}
+
+#include "inline/frozen_set.tpp"
\ No newline at end of file
@@ -1,10 +1,15 @@
 #pragma once
 
 #include <functional>
+#include <ranges>
+#include <thread>
 
 #include "associative_set.hpp"
 #include "hash_set_iterator.hpp"
+#include "associative/filter/bloom_filter.hpp"
 #include "sequential/doubly_linked_list.hpp"
+#include "associative/parallel_scan.hpp"
+#include "associative/hash_statistics.hpp"
 
 namespace containers::associative {
   /**
@@ -17,6 +22,8 @@ namespace containers::associative {
    * and removal operations.
    *
    * @tparam Key The type of the keys stored in the set.
+   * @tparam Statistics Whether lookups and rehashes are counted for stats(), free if disabled. Counting
+   *   makes concurrent lookups race, they need a lock while enabled.
    *
    * @details
    * - The set uses a doubly linked list of buckets, where each bucket is
@@ -28,10 +35,12 @@ namespace containers::associative {
    *   that takes a key and returns a hash value.
    * - The load factor is used to determine when to resize the bucket doubly linked list.
    * - Buckets are resized when the load factor exceeds 0.75 (grow) or drops below 0.25 (shrink).
+   * - Optionally, a bloom_filter can be placed in front of the buckets (see enable_filter()),
+   *   so lookups of absent keys usually return without touching any bucket.
    *
    * @note This class is not thread-safe.
    */
-  template<typename Key>
+  template<typename Key, bool Statistics = false>
   class hash_set final : public associative_set<Key> {
   protected:
     using bucket_t = sequential::doubly_linked_list<std::pair<Key, hash_t>>;
@@ -60,11 +69,79 @@ namespace containers::associative {
     virtual void insert(const Key& key) override;
     //! @copydoc associative_set::insert_safely
     virtual void insert_safely(const Key& key) override;
+    //! @copydoc associative_set::try_insert
+    virtual std::expected<void, container_error> try_insert(const Key& key) override;
     //! @copydoc associative_set::exists
     virtual bool exists(const Key& key) const override;
     //! @copydoc associative_set::remove
     virtual void remove(const Key& key) override;
 
+    /**
+     * @brief Places a bloom filter in front of the buckets.
+     *
+     * @param bits_per_key The number of filter bits reserved per key, more bits lower the false-positive rate.
+     *
+     * @details While enabled, exists() first queries the filter and only searches the bucket
+     * if the key may be present. The filter is rebuilt whenever the buckets are redistributed,
+     * which also drops the keys removed since the last rebuild.
+     * @note Runtime complexity: O(n).
+     */
+    void enable_filter(const size_t& bits_per_key = 10);
+
+    /**
+     * @brief Removes the bloom filter in front of the buckets.
+     * @note Runtime complexity: O(1).
+     */
+    void disable_filter() noexcept;
+
+    /**
+     * @brief Returns whether a bloom filter is placed in front of the buckets.
+     * @return True if the filter is enabled, false otherwise.
+     */
+    [[nodiscard]] bool filter_enabled() const noexcept;
+
+    /**
+     * @brief Inserts all keys of a range, distributing them over the buckets on several threads.
+     * @param range A range of keys.
+     * @param threads The number of threads to use.
+     *
+     * @details The buckets are sized once for all elements, then the elements are radix-partitioned
+     * by hash so every thread fills its own range of buckets without locking (see fill_buckets_parallel).
+     * Keys already present and repeated keys are skipped as with insert_safely(). The hash function is called concurrently and must be thread-safe.
+     * @note Runtime complexity: O(n / threads) on average.
+     */
+    template<std::ranges::input_range Range>
+    void build_parallel(Range&& range, const size_t& threads = std::thread::hardware_concurrency());
+
+    /**
+     * @brief Calls an action for every key, on several threads.
+     * @param action Called concurrently with every key.
+     * @param threads The number of threads to use.
+     *
+     * @details The buckets are split into chunks of about equal element count, which the threads
+     * take one after another (see split_buckets). The container must not be modified meanwhile.
+     */
+    void parallel_for_each(const std::function<void(const Key&)>& action, const size_t& threads = std::thread::hardware_concurrency()) const;
+
+    /**
+     * @brief Maps every key and combines the results, on several threads.
+     * @tparam T The type of the result.
+     * @param init The initial value, combined exactly once.
+     * @param map Called concurrently with every key, returns a T.
+     * @param combine An associative function combining two T into one.
+     * @param threads The number of threads to use.
+     * @return The combination of `init` with all mapped values.
+     */
+    template<typename T, typename Map, typename Combine>
+    [[nodiscard]] T parallel_reduce(T init, const Map& map, const Combine& combine, const size_t& threads = std::thread::hardware_concurrency()) const;
+
+    /**
+     * @brief Returns the shape of the buckets and the counted lookups and rehashes.
+     * @return The statistics, see hash_statistics.
+     * @note Only available if Statistics is enabled. Runtime complexity: O(number of buckets).
+     */
+    [[nodiscard]] hash_statistics stats() const requires Statistics;
+
     hash_set_iterator<bucket_t, Key> begin();
     hash_set_iterator<bucket_t, Key> end();
     hash_set_iterator<bucket_t, Key> cbegin() const;
@@ -73,11 +150,20 @@ namespace containers::associative {
   private:
     const std::function<hash_t(const Key&)> hash_function;
     std::shared_ptr<sequential::doubly_linked_list<bucket_t>> buckets_ptr;
+    std::shared_ptr<bloom_filter<Key>> filter_ptr;
+    size_t filter_bits_per_key = 0;
+    // Lookups in const functions count too
+    [[no_unique_address]] mutable hash_statistics_counters<Statistics> counters;
 
-    void insert_with_optional_throw(const Key& key, bool throw_exception);
+    bool insert_if_absent(const Key& key);
 
     [[nodiscard]] const bucket_t& find_bucket_by_key(const Key& key) const;
     [[nodiscard]] bucket_t& find_bucket_by_key(const Key& key);
+    [[nodiscard]] const bucket_t& find_bucket_by_hash(const hash_t& hash) const;
+    [[nodiscard]] bucket_t& find_bucket_by_hash(const hash_t& hash);
+    void rebuild_filter();
+    template<typename Callback>
+    static void for_each_in_bucket(const bucket_t& bucket, const Callback& callback);
     void redistribute_buckets(const size_t& new_size);
     [[nodiscard]] double calculate_load_factor() const noexcept;
   };
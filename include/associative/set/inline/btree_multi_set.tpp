@@ -0,0 +1,138 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+
+namespace containers::associative {
+  template<typename Key, size_t Capacity>
+  btree_multi_set<Key, Capacity>::btree_multi_set() = default;
+
+  template<typename Key, size_t Capacity>
+  void btree_multi_set<Key, Capacity>::insert(const Key& key) {
+    tree.insert(key, 1, [](size_t& multiplicity) { multiplicity++; });
+    container::number_elements++;
+  }
+
+  template<typename Key, size_t Capacity>
+  bool btree_multi_set<Key, Capacity>::exists(const Key& key) const {
+    return count(key) > 0;
+  }
+
+  template<typename Key, size_t Capacity>
+  size_t btree_multi_set<Key, Capacity>::count(const Key& key) const {
+    const auto* leaf = tree.find_leaf(key);
+    const auto position = core_t::key_index(leaf, key);
+    if (position == leaf->count || key < leaf->keys[position]) {
+      return 0;
+    }
+    return leaf->payloads[position];
+  }
+
+  template<typename Key, size_t Capacity>
+  std::optional<Key> btree_multi_set<Key, Capacity>::find_lower_bound(const Key& key) const {
+    const auto* leaf = tree.find_leaf(key);
+    return key_at(leaf, core_t::key_index(leaf, key));
+  }
+
+  template<typename Key, size_t Capacity>
+  std::optional<Key> btree_multi_set<Key, Capacity>::find_upper_bound(const Key& key) const {
+    const auto* leaf = tree.find_leaf(key);
+    const auto position = std::upper_bound(leaf->keys.begin(), leaf->keys.begin() + leaf->count, key) - leaf->keys.begin();
+    return key_at(leaf, position);
+  }
+
+  template<typename Key, size_t Capacity>
+  void btree_multi_set<Key, Capacity>::remove(const Key& key) {
+    tree.remove(key, [this](size_t& multiplicity) {
+      container::number_elements -= multiplicity;
+      return true;
+    });
+  }
+
+  template<typename Key, size_t Capacity>
+  void btree_multi_set<Key, Capacity>::remove_one(const Key& key) {
+    tree.remove(key, [this](size_t& multiplicity) {
+      container::number_elements--;
+      return --multiplicity == 0;
+    });
+  }
+
+  template<typename Key, size_t Capacity>
+  void btree_multi_set<Key, Capacity>::clear() {
+    tree.clear();
+    container::number_elements = 0;
+  }
+
+  template<typename Key, size_t Capacity>
+  size_t btree_multi_set<Key, Capacity>::rank(const Key& key) const {
+    auto less = size_t{0};
+    const auto* current = tree.root();
+    while (!current->leaf) {
+      const auto* inner = static_cast<const inner_node*>(current);
+      const auto index = core_t::child_index(inner, key);
+      less = std::accumulate(inner->totals.begin(), inner->totals.begin() + index, less);
+      current = inner->children[index].get();
+    }
+
+    const auto* leaf = static_cast<const leaf_node*>(current);
+    return std::accumulate(leaf->payloads.begin(), leaf->payloads.begin() + core_t::key_index(leaf, key), less);
+  }
+
+  template<typename Key, size_t Capacity>
+  Key btree_multi_set<Key, Capacity>::select(const size_t& index) const {
+    if (index >= container::number_elements) {
+      throw std::out_of_range("btree_multi_set::select index is out of range");
+    }
+
+    auto remaining = index;
+    const auto* current = tree.root();
+    while (!current->leaf) {
+      const auto* inner = static_cast<const inner_node*>(current);
+      auto child = size_t{0};
+      while (remaining >= inner->totals[child]) {
+        remaining -= inner->totals[child++];
+      }
+      current = inner->children[child].get();
+    }
+
+    const auto* leaf = static_cast<const leaf_node*>(current);
+    auto position = size_t{0};
+    while (remaining >= leaf->payloads[position]) {
+      remaining -= leaf->payloads[position++];
+    }
+    return leaf->keys[position];
+  }
+
+  template<typename Key, size_t Capacity>
+  size_t btree_multi_set<Key, Capacity>::count_range(const Key& first, const Key& last) const {
+    if (!(first < last)) {
+      return 0;
+    }
+    return rank(last) - rank(first);
+  }
+
+  template<typename Key, size_t Capacity>
+  Key btree_multi_set<Key, Capacity>::percentile(const double& percent) const {
+    if (!(percent >= 0 && percent <= 100)) {
+      throw std::invalid_argument("btree_multi_set::percentile expects a percentile in [0, 100]");
+    }
+    if (container::number_elements == 0) {
+      throw std::out_of_range("btree_multi_set::percentile of an empty multi-set");
+    }
+
+    // The nearest rank is the 1-based position ceil(percent / 100 * n), the 0th percentile is the minimum
+    const auto nearest_rank = static_cast<size_t>(std::ceil(percent / 100 * static_cast<double>(container::number_elements)));
+    return select(std::clamp<size_t>(nearest_rank, 1, container::number_elements) - 1);
+  }
+
+  template<typename Key, size_t Capacity>
+  std::optional<Key> btree_multi_set<Key, Capacity>::key_at(const leaf_node* leaf, const size_t& position) {
+    // Only an empty root is an empty leaf, so the next leaf always starts with a key
+    if (position == leaf->count) {
+      return leaf->next != nullptr ? std::optional<Key>(leaf->next->keys[0]) : std::nullopt;
+    }
+    return leaf->keys[position];
+  }
+}
\ No newline at end of file
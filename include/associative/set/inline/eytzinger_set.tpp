@@ -0,0 +1,85 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+
+namespace containers::associative {
+  template<typename Key>
+  template<std::ranges::input_range Range>
+  eytzinger_set<Key>::eytzinger_set(Range&& keys) {
+    auto sorted = std::vector<Key>();
+    for (auto&& key : keys) {
+      sorted.emplace_back(std::forward<decltype(key)>(key));
+    }
+    if (!std::ranges::is_sorted(sorted)) {
+      std::ranges::sort(sorted);
+    }
+    const auto repeated = std::ranges::unique(sorted, [](const Key& first, const Key& second) {
+      return !(first < second);
+    });
+    sorted.erase(repeated.begin(), repeated.end());
+
+    layout.resize(sorted.size() + 1);
+    auto next = size_t{0};
+    place(sorted, next, 1);
+    container::number_elements = sorted.size();
+  }
+
+  template<typename Key>
+  bool eytzinger_set<Key>::exists(const Key& key) const noexcept {
+    const auto index = lower_bound_index(key);
+    return index != 0 && !(key < layout[index]);
+  }
+
+  template<typename Key>
+  std::optional<Key> eytzinger_set<Key>::lower_bound(const Key& key) const {
+    const auto index = lower_bound_index(key);
+    if (index == 0) {
+      return std::nullopt;
+    }
+    return layout[index];
+  }
+
+  template<typename Key>
+  template<typename T>
+  T* eytzinger_set<Key>::cache_line_allocator<T>::allocate(const size_t count) {
+    return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{cache_line_size}));
+  }
+
+  template<typename Key>
+  template<typename T>
+  void eytzinger_set<Key>::cache_line_allocator<T>::deallocate(T* pointer, const size_t) noexcept {
+    ::operator delete(pointer, std::align_val_t{cache_line_size});
+  }
+
+  template<typename Key>
+  void eytzinger_set<Key>::place(const std::vector<Key>& sorted, size_t& next, const size_t& index) {
+    // An in-order walk of the implicit tree visits its indices in key order
+    if (index >= layout.size()) {
+      return;
+    }
+    place(sorted, next, 2 * index);
+    layout[index] = sorted[next++];
+    place(sorted, next, 2 * index + 1);
+  }
+
+  template<typename Key>
+  size_t eytzinger_set<Key>::lower_bound_index(const Key& key) const noexcept {
+    // The descendants 4 levels below node k are the consecutive indices 16k to 16k + 15, which
+    // for keys of 4 bytes are exactly the cache line the aligned layout has at 16k
+    constexpr auto prefetch_levels = 4;
+    const auto* keys = layout.data();
+    const auto size = layout.size();
+    auto index = size_t{1};
+    while (index < size) {
+#if defined(__GNUC__)
+      if (const auto ahead = index << prefetch_levels; ahead < size) {
+        __builtin_prefetch(keys + ahead);
+      }
+#endif
+      index = 2 * index + (keys[index] < key);
+    }
+    // Every right turn appended a 1, the lower bound is where the path last turned left
+    return index >> (std::countr_one(index) + 1);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <algorithm>
+
+#include "associative/branchless_search.hpp"
+#include "associative/duplicate_key.hpp"
+
+namespace containers::associative {
+  template<typename Key>
+  template<std::ranges::input_range Range>
+  flat_ordered_set<Key>::flat_ordered_set(Range&& keys) {
+    insert_batch(std::forward<Range>(keys));
+  }
+
+  template<typename Key>
+  void flat_ordered_set<Key>::insert(const Key& key) {
+    if (!insert_if_absent(key)) {
+      throw duplicate_key<Key>(key);
+    }
+  }
+
+  template<typename Key>
+  void flat_ordered_set<Key>::insert_safely(const Key& key) {
+    insert_if_absent(key);
+  }
+
+  template<typename Key>
+  std::expected<void, container_error> flat_ordered_set<Key>::try_insert(const Key& key) {
+    if (!insert_if_absent(key)) {
+      return std::unexpected(container_error::duplicate_key);
+    }
+    return {};
+  }
+
+  template<typename Key>
+  bool flat_ordered_set<Key>::exists(const Key& key) const {
+    return contains_at(key_index(key), key);
+  }
+
+  template<typename Key>
+  void flat_ordered_set<Key>::remove(const Key& key) {
+    const auto index = key_index(key);
+    if (!contains_at(index, key)) {
+      return;
+    }
+    sorted_keys.erase(sorted_keys.begin() + index);
+    container::number_elements--;
+  }
+
+  template<typename Key>
+  std::optional<Key> flat_ordered_set<Key>::find_lower_bound(const Key& key) const {
+    const auto iterator = lower_bound(key);
+    if (iterator == end()) {
+      return std::nullopt;
+    }
+    return *iterator;
+  }
+
+  template<typename Key>
+  std::optional<Key> flat_ordered_set<Key>::find_upper_bound(const Key& key) const {
+    const auto iterator = upper_bound(key);
+    if (iterator == end()) {
+      return std::nullopt;
+    }
+    return *iterator;
+  }
+
+  template<typename Key>
+  template<std::ranges::input_range Range>
+  void flat_ordered_set<Key>::insert_batch(Range&& keys) {
+    auto added = std::vector<Key>();
+    for (auto&& key : keys) {
+      added.push_back(key);
+    }
+    if (!std::ranges::is_sorted(added)) {
+      std::ranges::sort(added);
+    }
+
+    // std::ranges::set_union takes a key in both ranges once, and repeated new keys are dropped afterwards
+    auto merged = std::vector<Key>();
+    merged.reserve(sorted_keys.size() + added.size());
+    std::ranges::set_union(sorted_keys, added, std::back_inserter(merged));
+    const auto repeated = std::ranges::unique(merged, [](const Key& first, const Key& second) {
+      return !(first < second);
+    });
+    merged.erase(repeated.begin(), repeated.end());
+
+    sorted_keys = std::move(merged);
+    container::number_elements = sorted_keys.size();
+  }
+
+  template<typename Key>
+  void flat_ordered_set<Key>::clear() {
+    sorted_keys.clear();
+    container::number_elements = 0;
+  }
+
+  template<typename Key>
+  typename flat_ordered_set<Key>::iterator_t flat_ordered_set<Key>::lower_bound(const Key& key) const {
+    return sorted_keys.begin() + key_index(key);
+  }
+
+  template<typename Key>
+  typename flat_ordered_set<Key>::iterator_t flat_ordered_set<Key>::upper_bound(const Key& key) const {
+    const auto index = key_index(key);
+    return sorted_keys.begin() + (contains_at(index, key) ? index + 1 : index);
+  }
+
+  template<typename Key>
+  std::span<const Key> flat_ordered_set<Key>::keys() const noexcept {
+    return sorted_keys;
+  }
+
+  template<typename Key>
+  eytzinger_set<Key> flat_ordered_set<Key>::freeze() const {
+    return eytzinger_set<Key>(sorted_keys);
+  }
+
+  template<typename Key>
+  typename flat_ordered_set<Key>::iterator_t flat_ordered_set<Key>::begin() const {
+    return sorted_keys.begin();
+  }
+
+  template<typename Key>
+  typename flat_ordered_set<Key>::iterator_t flat_ordered_set<Key>::end() const {
+    return sorted_keys.end();
+  }
+
+  template<typename Key>
+  typename flat_ordered_set<Key>::iterator_t flat_ordered_set<Key>::cbegin() const {
+    return begin();
+  }
+
+  template<typename Key>
+  typename flat_ordered_set<Key>::iterator_t flat_ordered_set<Key>::cend() const {
+    return end();
+  }
+
+  template<typename Key>
+  bool flat_ordered_set<Key>::insert_if_absent(const Key& key) {
+    const auto index = key_index(key);
+    if (contains_at(index, key)) {
+      return false;
+    }
+    sorted_keys.insert(sorted_keys.begin() + index, key);
+    container::number_elements++;
+    return true;
+  }
+
+  template<typename Key>
+  size_t flat_ordered_set<Key>::key_index(const Key& key) const noexcept {
+    return branchless_lower_bound(std::span<const Key>(sorted_keys), key);
+  }
+
+  template<typename Key>
+  bool flat_ordered_set<Key>::contains_at(const size_t& index, const Key& key) const noexcept {
+    return index < sorted_keys.size() && !(key < sorted_keys[index]);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vector>
+
+namespace containers::associative {
+  template<typename Key, size_t Extent, typename Hash>
+  constexpr frozen_set<Key, Extent, Hash>::frozen_set(const std::array<Key, Extent>& keys) requires (Extent != std::dynamic_extent) {
+    const auto slots = hash.build(keys, [](const Key& key) -> const Key& { return key; });
+    for (size_t index = 0; index < Extent; ++index) {
+      this->keys[slots[index]] = keys[index];
+    }
+    container::number_elements = Extent;
+  }
+
+  template<typename Key, size_t Extent, typename Hash>
+  template<std::ranges::input_range Range>
+  frozen_set<Key, Extent, Hash>::frozen_set(Range&& keys) requires (Extent == std::dynamic_extent) {
+    auto elements = std::vector<Key>();
+    for (auto&& key : keys) {
+      elements.emplace_back(std::forward<decltype(key)>(key));
+    }
+    const auto slots = hash.build(elements, [](const Key& key) -> const Key& { return key; });
+    this->keys.resize(elements.size());
+    for (size_t index = 0; index < elements.size(); ++index) {
+      this->keys[slots[index]] = std::move(elements[index]);
+    }
+    container::number_elements = elements.size();
+  }
+
+  template<typename Key, size_t Extent, typename Hash>
+  constexpr bool frozen_set<Key, Extent, Hash>::exists(const Key& key) const noexcept {
+    return !keys.empty() && keys[hash.slot(key)] == key;
+  }
+
+  template<typename Key, size_t Extent, typename Hash>
+  constexpr auto frozen_set<Key, Extent, Hash>::begin() const noexcept {
+    return keys.begin();
+  }
+
+  template<typename Key, size_t Extent, typename Hash>
+  constexpr auto frozen_set<Key, Extent, Hash>::end() const noexcept {
+    return keys.end();
+  }
+}
\ No newline at end of file
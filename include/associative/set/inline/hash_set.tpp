@@ -7,8 +7,8 @@
 #include "associative/duplicate_key.hpp"
 
 namespace containers::associative {
-  template<typename Key>
-  hash_set<Key>::hash_set(
+  template<typename Key, bool Statistics>
+  hash_set<Key, Statistics>::hash_set(
     const std::function<hash_t(const Key&)>& hash_function,
     const size_t& bucket_count
   ) :
@@ -22,8 +22,8 @@ namespace containers::associative {
     }
   }
 
-  template<typename Key>
-  hash_set<Key>::hash_set(
+  template<typename Key, bool Statistics>
+  hash_set<Key, Statistics>::hash_set(
     const std::function<hash_t(const Key&)>& hash_function
   ) :
     hash_function(hash_function),
@@ -32,48 +32,68 @@ namespace containers::associative {
     buckets_ptr->push_front(sequential::doubly_linked_list<std::pair<Key, hash_t>>());
   }
 
-  template<typename Key>
-  void hash_set<Key>::insert(const Key& key) {
-    insert_with_optional_throw(key, true);
+  template<typename Key, bool Statistics>
+  void hash_set<Key, Statistics>::insert(const Key& key) {
+    if (!insert_if_absent(key)) {
+      throw duplicate_key<Key>(key);
+    }
   }
 
-  template<typename Key>
-  void hash_set<Key>::insert_safely(const Key& key) {
-    insert_with_optional_throw(key, false);
+  template<typename Key, bool Statistics>
+  void hash_set<Key, Statistics>::insert_safely(const Key& key) {
+    insert_if_absent(key);
   }
 
-  template<typename Key>
-  void hash_set<Key>::insert_with_optional_throw(
-    const Key& key,
-    const bool throw_exception
-  ) {
-    auto& bucket = find_bucket_by_key(key);
+  template<typename Key, bool Statistics>
+  std::expected<void, container_error> hash_set<Key, Statistics>::try_insert(const Key& key) {
+    if (!insert_if_absent(key)) {
+      return std::unexpected(container_error::duplicate_key);
+    }
+    return {};
+  }
+
+  template<typename Key, bool Statistics>
+  bool hash_set<Key, Statistics>::insert_if_absent(const Key& key) {
+    const auto hash = hash_function(key);
+    auto& bucket = find_bucket_by_hash(hash);
     const auto exists = std::ranges::find_if(bucket, [&key](const auto& other_pointer) {
       return std::get<0>(other_pointer->data) == key;
     });
-
-    if (exists == bucket.end()) {
-      bucket.push_back(std::make_pair(key, hash_function(key)));
-      container::number_elements++;
-    } else if (throw_exception) {
-      throw duplicate_key<Key>(key);
+    if (exists != bucket.end()) {
+      return false;
     }
 
+    bucket.push_back(std::make_pair(key, hash));
+    if (filter_ptr != nullptr) {
+      filter_ptr->insert_hash(hash);
+    }
+    container::number_elements++;
     if (calculate_load_factor() >= 0.75) {
       redistribute_buckets(buckets_ptr->size() * 2);
     }
+    return true;
   }
 
-  template<typename Key>
-  bool hash_set<Key>::exists(const Key& key) const {
-    auto& bucket = find_bucket_by_key(key);
-    return std::ranges::find_if(bucket, [&key](const auto& other) {
+  template<typename Key, bool Statistics>
+  bool hash_set<Key, Statistics>::exists(const Key& key) const {
+    const auto hash = hash_function(key);
+    if (filter_ptr != nullptr && !filter_ptr->might_contain_hash(hash)) {
+      counters.count_lookup(false, 0);
+      return false;
+    }
+
+    const auto& bucket = find_bucket_by_hash(hash);
+    auto probes = size_t{0};
+    const auto found = std::ranges::find_if(bucket, [&key, &probes](const auto& other) {
+      ++probes;
       return std::get<0>(other->data) == key;
     }) != bucket.end();
+    counters.count_lookup(found, probes);
+    return found;
   }
 
-  template<typename Key>
-  void hash_set<Key>::remove(const Key& key) {
+  template<typename Key, bool Statistics>
+  void hash_set<Key, Statistics>::remove(const Key& key) {
     auto& bucket = find_bucket_by_key(key);
     const auto initial_size = bucket.size();
     for (const auto& pair_pointer : bucket) {
@@ -88,30 +108,45 @@ namespace containers::associative {
     }
   }
 
-  template<typename Key>
-  typename hash_set<Key>::bucket_t& hash_set<Key>::find_bucket_by_key(
+  template<typename Key, bool Statistics>
+  typename hash_set<Key, Statistics>::bucket_t& hash_set<Key, Statistics>::find_bucket_by_key(
     const Key& key
   ) {
-    const auto hash = hash_function(key);
+    return find_bucket_by_hash(hash_function(key));
+  }
+
+  template<typename Key, bool Statistics>
+  typename hash_set<Key, Statistics>::bucket_t& hash_set<Key, Statistics>::find_bucket_by_hash(
+    const hash_t& hash
+  ) {
     const auto bucket_index = hash % buckets_ptr->size();
     return buckets_ptr->at(bucket_index)->data;
   }
 
-  template<typename Key>
-  const typename hash_set<Key>::bucket_t& hash_set<Key>::find_bucket_by_key(
+  template<typename Key, bool Statistics>
+  const typename hash_set<Key, Statistics>::bucket_t& hash_set<Key, Statistics>::find_bucket_by_key(
     const Key& key
     ) const {
-    return const_cast<hash_set*>(this)->find_bucket_by_key(key);
+    return find_bucket_by_hash(hash_function(key));
+  }
+
+  template<typename Key, bool Statistics>
+  const typename hash_set<Key, Statistics>::bucket_t& hash_set<Key, Statistics>::find_bucket_by_hash(
+    const hash_t& hash
+  ) const {
+    const auto bucket_index = hash % buckets_ptr->size();
+    return buckets_ptr->at(bucket_index)->data;
   }
 
-  template<typename Key>
-  double hash_set<Key>::calculate_load_factor() const noexcept {
+  template<typename Key, bool Statistics>
+  double hash_set<Key, Statistics>::calculate_load_factor() const noexcept {
     return static_cast<double>(container::number_elements)
       / static_cast<double>(buckets_ptr->size());
   }
 
-  template<typename Key>
-  void hash_set<Key>::redistribute_buckets(const size_t& new_size) {
+  template<typename Key, bool Statistics>
+  void hash_set<Key, Statistics>::redistribute_buckets(const size_t& new_size) {
+    const auto rehash_start = counters.start_rehash();
     bucket_t existing;
     for (const auto& bucket_ptr : *buckets_ptr) {
       for (const auto& element : bucket_ptr->data) {
@@ -130,27 +165,133 @@ namespace containers::associative {
       const auto bucket_index = hash % buckets_ptr->size();
       buckets_ptr->at(bucket_index)->data.push_back(pair);
     }
+
+    if (filter_ptr != nullptr) {
+      rebuild_filter();
+    }
+    counters.count_rehash(rehash_start);
+  }
+
+  template<typename Key, bool Statistics>
+  void hash_set<Key, Statistics>::enable_filter(const size_t& bits_per_key) {
+    filter_bits_per_key = bits_per_key;
+    rebuild_filter();
+  }
+
+  template<typename Key, bool Statistics>
+  void hash_set<Key, Statistics>::disable_filter() noexcept {
+    filter_ptr = nullptr;
+    filter_bits_per_key = 0;
+  }
+
+  template<typename Key, bool Statistics>
+  bool hash_set<Key, Statistics>::filter_enabled() const noexcept {
+    return filter_ptr != nullptr;
+  }
+
+  template<typename Key, bool Statistics>
+  void hash_set<Key, Statistics>::rebuild_filter() {
+    // The load factor stays below 0.75, so the bucket count bounds the number of keys until the next rebuild
+    const auto expected_elements = std::max(container::number_elements, buckets_ptr->size());
+    filter_ptr = std::make_shared<bloom_filter<Key>>(hash_function, expected_elements, filter_bits_per_key);
+    for (const auto& bucket_ptr : *buckets_ptr) {
+      for (const auto& element : bucket_ptr->data) {
+        filter_ptr->insert_hash(std::get<1>(element->data));
+      }
+    }
   }
 
-  template<typename Key>
-  hash_set_iterator<typename hash_set<Key>::bucket_t, Key> hash_set<Key>::begin() {
+  template<typename Key, bool Statistics>
+  hash_statistics hash_set<Key, Statistics>::stats() const requires Statistics {
+    return collect_hash_statistics(*buckets_ptr, container::number_elements, 0, counters);
+  }
+
+  template<typename Key, bool Statistics>
+  hash_set_iterator<typename hash_set<Key, Statistics>::bucket_t, Key> hash_set<Key, Statistics>::begin() {
     const auto first_non_empty = hash_set_iterator<bucket_t, Key>::calculate_next_non_empty_bucket_index(*buckets_ptr, 0);
     return hash_set_iterator<bucket_t, Key>(buckets_ptr, first_non_empty, 0);
   }
 
-  template<typename Key>
-  hash_set_iterator<typename hash_set<Key>::bucket_t, Key> hash_set<Key>::end() {
+  template<typename Key, bool Statistics>
+  hash_set_iterator<typename hash_set<Key, Statistics>::bucket_t, Key> hash_set<Key, Statistics>::end() {
     return hash_set_iterator<bucket_t, Key>(buckets_ptr, buckets_ptr->size(), 0);
   }
 
-  template<typename Key>
-  hash_set_iterator<typename hash_set<Key>::bucket_t, Key> hash_set<Key>::cbegin() const {
+  template<typename Key, bool Statistics>
+  hash_set_iterator<typename hash_set<Key, Statistics>::bucket_t, Key> hash_set<Key, Statistics>::cbegin() const {
     const auto first_non_empty = hash_set_iterator<bucket_t, Key>::calculate_next_non_empty_bucket_index(*buckets_ptr, 0);
     return hash_set_iterator<bucket_t, Key>(buckets_ptr, first_non_empty, 0);
   }
 
-  template<typename Key>
-  hash_set_iterator<typename hash_set<Key>::bucket_t, Key> hash_set<Key>::cend() const {
+  template<typename Key, bool Statistics>
+  hash_set_iterator<typename hash_set<Key, Statistics>::bucket_t, Key> hash_set<Key, Statistics>::cend() const {
     return hash_set_iterator<bucket_t, Key>(buckets_ptr, buckets_ptr->size(), 0);
   }
+
+  template<typename Key, bool Statistics>
+  template<std::ranges::input_range Range>
+  void hash_set<Key, Statistics>::build_parallel(Range&& range, const size_t& threads) {
+    const auto rehash_start = counters.start_rehash();
+    auto entries = std::vector<std::pair<Key, hash_t>>();
+    entries.reserve(container::number_elements);
+    for (const auto& bucket_ptr : *buckets_ptr) {
+      for (const auto& element : bucket_ptr->data) {
+        entries.push_back(element->data);
+      }
+    }
+    for (const auto& key : range) {
+      entries.emplace_back(key, 0);
+    }
+
+    const auto bucket_count = calculate_bucket_count(entries.size(), buckets_ptr->size());
+    auto buckets = std::make_shared<sequential::doubly_linked_list<bucket_t>>(sequential::doubly_linked_list<bucket_t>());
+    for (size_t index = 0; index < bucket_count; ++index) {
+      buckets->push_front(bucket_t());
+    }
+
+    const auto added = fill_buckets_parallel(*buckets, entries, [this](auto& entry) {
+      return std::get<1>(entry) = hash_function(std::get<0>(entry));
+    }, [](bucket_t& bucket, auto&& entry) -> size_t {
+      const auto exists = std::ranges::find_if(bucket, [&entry](const auto& other_pointer) {
+        return std::get<0>(other_pointer->data) == std::get<0>(entry);
+      });
+      if (exists != bucket.end()) {
+        return 0;
+      }
+      bucket.push_back(std::move(entry));
+      return 1;
+    }, threads);
+
+    buckets_ptr = std::move(buckets);
+    container::number_elements = added;
+    if (filter_ptr != nullptr) {
+      rebuild_filter();
+    }
+    counters.count_rehash(rehash_start);
+  }
+
+  template<typename Key, bool Statistics>
+  void hash_set<Key, Statistics>::parallel_for_each(const std::function<void(const Key&)>& action, const size_t& threads) const {
+    const auto chunks = split_buckets(*buckets_ptr, [](const bucket_t& bucket) { return bucket.size(); }, std::max<size_t>(threads, 1) * chunks_per_thread);
+    for_each_parallel(chunks, threads, [](const bucket_t& bucket, const auto& callback) {
+      for_each_in_bucket(bucket, callback);
+    }, action);
+  }
+
+  template<typename Key, bool Statistics>
+  template<typename T, typename Map, typename Combine>
+  T hash_set<Key, Statistics>::parallel_reduce(T init, const Map& map, const Combine& combine, const size_t& threads) const {
+    const auto chunks = split_buckets(*buckets_ptr, [](const bucket_t& bucket) { return bucket.size(); }, std::max<size_t>(threads, 1) * chunks_per_thread);
+    return reduce_parallel(chunks, threads, std::move(init), [](const bucket_t& bucket, const auto& callback) {
+      for_each_in_bucket(bucket, callback);
+    }, map, combine);
+  }
+
+  template<typename Key, bool Statistics>
+  template<typename Callback>
+  void hash_set<Key, Statistics>::for_each_in_bucket(const bucket_t& bucket, const Callback& callback) {
+    for (const auto& pair_pointer : bucket) {
+      callback(std::get<0>(pair_pointer->data));
+    }
+  }
 }
\ No newline at end of file
@@ -1,11 +1,33 @@
 #pragma once
 
+#include <optional>
+
 #include "associative_multi_set.hpp"
 
 namespace containers::associative {
+  /**
+   * @class ordered_multi_set
+   * @brief An associative_multi_set which keeps its keys sorted by operator<, e.g. btree_multi_set.
+   */
   template<typename Key>
   class ordered_multi_set : public associative_multi_set<Key> {
-    // Adding a virtual destructor, because this class is not going to be implemented
+  public:
     virtual ~ordered_multi_set() override = default;
+
+    /**
+     * @brief Finds the smallest key not less than a key.
+     * @param key The key to look up, which does not need to be stored.
+     * @return The key, or std::nullopt if all keys are less.
+     * @note Runtime complexity: O(log n).
+     */
+    virtual std::optional<Key> find_lower_bound(const Key& key) const = 0;
+
+    /**
+     * @brief Finds the smallest key greater than a key, skipping all occurrences of the key itself.
+     * @param key The key to look up, which does not need to be stored.
+     * @return The key, or std::nullopt if no key is greater.
+     * @note Runtime complexity: O(log n).
+     */
+    virtual std::optional<Key> find_upper_bound(const Key& key) const = 0;
   };
 }
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "container.hpp"
+
+namespace containers::associative {
+  /**
+   * @class count_min_sketch
+   * @brief A fixed-size frequency estimator for streams of keys.
+   *
+   * A count-min sketch estimates how often each key has been added, using a fixed
+   * amount of memory independent of the number of distinct keys. Estimates never
+   * undercount; they overcount by at most e/width times the total count with a
+   * probability of at least 1 - e^-depth.
+   *
+   * @tparam Key The type of the counted keys.
+   *
+   * @details
+   * - The sketch consists of depth rows of width counters. Every row maps a key to
+   *   one counter by mixing the key's hash with a per-row seed.
+   * - With conservative update, adding a key only raises its counters up to the new
+   *   minimum estimate instead of incrementing all of them, which reduces overcounting.
+   * - Sketches with the same dimensions and hash function can be merged, so every
+   *   thread can count into its own sketch.
+   * - size() returns the total count of all added keys.
+   *
+   * @note This class is not thread-safe.
+   */
+  template<typename Key>
+  class count_min_sketch final : public container {
+  public:
+    using counter_t = std::uint64_t;
+
+    /**
+     * @brief Constructs an empty count-min sketch.
+     *
+     * @param hash_function A callable object that computes the hash of a given key.
+     * @param width The number of counters per row, at least 1.
+     * @param depth The number of rows, at least 1.
+     * @param conservative_update Whether to use conservative update when adding keys.
+     */
+    count_min_sketch(
+      const std::function<hash_t(const Key&)>& hash_function,
+      const size_t& width,
+      const size_t& depth,
+      bool conservative_update = true
+    );
+
+    /**
+     * @brief Adds occurrences of a key.
+     * @param key The key to add.
+     * @param count The number of occurrences to add.
+     * @note Runtime complexity: O(depth).
+     */
+    void add(const Key& key, const counter_t& count = 1);
+
+    /**
+     * @brief Estimates how often a key has been added.
+     * @param key The key to search for.
+     * @return An estimate that is never lower than the true count.
+     * @note Runtime complexity: O(depth).
+     */
+    [[nodiscard]] counter_t estimate(const Key& key) const;
+
+    /**
+     * @brief Adds all counts of another sketch to this sketch.
+     * @param other A sketch with the same dimensions and hash function.
+     * @throws std::invalid_argument If the dimensions of both sketches differ.
+     * @note Runtime complexity: O(width * depth).
+     */
+    void merge(const count_min_sketch& other);
+
+    /**
+     * @brief Resets all counters.
+     * @note Runtime complexity: O(width * depth).
+     */
+    void clear() noexcept;
+
+    [[nodiscard]] size_t width() const noexcept;
+    [[nodiscard]] size_t depth() const noexcept;
+
+    /**
+     * @brief Returns the memory used by the counters.
+     * @return The size of all counters in bytes.
+     */
+    [[nodiscard]] size_t memory_usage() const noexcept;
+
+  private:
+    const std::function<hash_t(const Key&)> hash_function;
+    const size_t row_width;
+    const size_t row_count;
+    const bool conservative_update;
+    std::vector<counter_t> counters;
+
+    [[nodiscard]] size_t calculate_counter_index(const hash_t& hash, const size_t& row) const noexcept;
+  };
+}
+
+#include "inline/count_min_sketch.tpp"
\ No newline at end of file
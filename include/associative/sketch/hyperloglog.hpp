@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "container.hpp"
+
+namespace containers::associative {
+  /**
+   * @class hyperloglog
+   * @brief A fixed-size estimator for the number of distinct keys in a stream.
+   *
+   * HyperLogLog estimates the cardinality of a stream with a relative standard error
+   * of about 1.04 / sqrt(2^precision), using 2^precision bytes of memory regardless
+   * of the number of distinct keys.
+   *
+   * @tparam Key The type of the counted keys.
+   *
+   * @details
+   * - The first precision bits of a key's mixed hash select a register, which keeps
+   *   the longest run of leading zeros seen in the remaining bits.
+   * - Small cardinalities are corrected with linear counting over the empty registers.
+   * - Estimators with the same precision and hash function can be merged, so every
+   *   thread can count into its own estimator.
+   * - size() returns the number of added keys, including duplicates.
+   *
+   * @note This class is not thread-safe.
+   */
+  template<typename Key>
+  class hyperloglog final : public container {
+  public:
+    static constexpr std::uint8_t min_precision = 4;
+    static constexpr std::uint8_t max_precision = 18;
+
+    /**
+     * @brief Constructs an empty estimator.
+     *
+     * @param hash_function A callable object that computes the hash of a given key.
+     * @param precision The number of bits used to select a register.
+     * @throws std::invalid_argument If the precision is outside of [min_precision, max_precision].
+     */
+    hyperloglog(const std::function<hash_t(const Key&)>& hash_function, const std::uint8_t& precision = 14);
+
+    /**
+     * @brief Adds a key to the stream.
+     * @param key The key to add.
+     * @note Runtime complexity: O(1).
+     */
+    void add(const Key& key);
+
+    /**
+     * @brief Estimates the number of distinct keys added.
+     * @return The estimated cardinality.
+     * @note Runtime complexity: O(2^precision).
+     */
+    [[nodiscard]] double estimate() const;
+
+    /**
+     * @brief Merges the registers of another estimator into this estimator.
+     * @param other An estimator with the same precision and hash function.
+     * @throws std::invalid_argument If the precisions of both estimators differ.
+     * @note Runtime complexity: O(2^precision).
+     */
+    void merge(const hyperloglog& other);
+
+    /**
+     * @brief Resets all registers.
+     * @note Runtime complexity: O(2^precision).
+     */
+    void clear() noexcept;
+
+    [[nodiscard]] std::uint8_t precision() const noexcept;
+
+    /**
+     * @brief Returns the memory used by the registers.
+     * @return The size of all registers in bytes.
+     */
+    [[nodiscard]] size_t memory_usage() const noexcept;
+
+  private:
+    const std::function<hash_t(const Key&)> hash_function;
+    const std::uint8_t register_bits;
+    std::vector<std::uint8_t> registers;
+  };
+}
+
+#include "inline/hyperloglog.tpp"
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "associative/hash_mix.hpp"
+
+namespace containers::associative {
+  template<typename Key>
+  count_min_sketch<Key>::count_min_sketch(
+    const std::function<hash_t(const Key&)>& hash_function,
+    const size_t& width,
+    const size_t& depth,
+    const bool conservative_update
+  ) :
+    hash_function(hash_function),
+    row_width(std::max<size_t>(width, 1)),
+    row_count(std::max<size_t>(depth, 1)),
+    conservative_update(conservative_update),
+    counters(row_width * row_count, 0)
+  {}
+
+  template<typename Key>
+  void count_min_sketch<Key>::add(const Key& key, const counter_t& count) {
+    const auto hash = hash_function(key);
+    container::number_elements += count;
+
+    if (!conservative_update) {
+      for (size_t row = 0; row < row_count; ++row) {
+        counters[calculate_counter_index(hash, row)] += count;
+      }
+      return;
+    }
+
+    auto minimum = std::numeric_limits<counter_t>::max();
+    for (size_t row = 0; row < row_count; ++row) {
+      minimum = std::min(minimum, counters[calculate_counter_index(hash, row)]);
+    }
+    const auto target = minimum + count;
+    for (size_t row = 0; row < row_count; ++row) {
+      auto& counter = counters[calculate_counter_index(hash, row)];
+      counter = std::max(counter, target);
+    }
+  }
+
+  template<typename Key>
+  typename count_min_sketch<Key>::counter_t count_min_sketch<Key>::estimate(const Key& key) const {
+    const auto hash = hash_function(key);
+    auto minimum = std::numeric_limits<counter_t>::max();
+    for (size_t row = 0; row < row_count; ++row) {
+      minimum = std::min(minimum, counters[calculate_counter_index(hash, row)]);
+    }
+    return minimum;
+  }
+
+  template<typename Key>
+  void count_min_sketch<Key>::merge(const count_min_sketch& other) {
+    if (row_width != other.row_width || row_count != other.row_count) {
+      throw std::invalid_argument("count-min sketches with different dimensions cannot be merged");
+    }
+    for (size_t index = 0; index < counters.size(); ++index) {
+      counters[index] += other.counters[index];
+    }
+    container::number_elements += other.number_elements;
+  }
+
+  template<typename Key>
+  void count_min_sketch<Key>::clear() noexcept {
+    std::ranges::fill(counters, 0);
+    container::number_elements = 0;
+  }
+
+  template<typename Key>
+  size_t count_min_sketch<Key>::width() const noexcept {
+    return row_width;
+  }
+
+  template<typename Key>
+  size_t count_min_sketch<Key>::depth() const noexcept {
+    return row_count;
+  }
+
+  template<typename Key>
+  size_t count_min_sketch<Key>::memory_usage() const noexcept {
+    return counters.size() * sizeof(counter_t);
+  }
+
+  template<typename Key>
+  size_t count_min_sketch<Key>::calculate_counter_index(const hash_t& hash, const size_t& row) const noexcept {
+    const auto mixed_hash = mix_hash(hash, row);
+    return row * row_width + static_cast<size_t>(((mixed_hash >> 32) * row_width) >> 32);
+  }
+}
\ No newline at end of file
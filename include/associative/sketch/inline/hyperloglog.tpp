@@ -0,0 +1,85 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <stdexcept>
+
+#include "associative/hash_mix.hpp"
+
+namespace containers::associative {
+  template<typename Key>
+  hyperloglog<Key>::hyperloglog(
+    const std::function<hash_t(const Key&)>& hash_function,
+    const std::uint8_t& precision
+  ) :
+    hash_function(hash_function),
+    register_bits(precision)
+  {
+    if (precision < min_precision || precision > max_precision) {
+      throw std::invalid_argument("the precision of a hyperloglog must be between 4 and 18");
+    }
+    registers.resize(size_t{1} << precision, 0);
+  }
+
+  template<typename Key>
+  void hyperloglog<Key>::add(const Key& key) {
+    const auto mixed_hash = mix_hash(hash_function(key));
+    const auto index = static_cast<size_t>(mixed_hash >> (64 - register_bits));
+    const auto remaining = mixed_hash << register_bits;
+    const auto rank = static_cast<std::uint8_t>(
+      std::min<int>(std::countl_zero(remaining), 64 - register_bits) + 1
+    );
+    registers[index] = std::max(registers[index], rank);
+    container::number_elements++;
+  }
+
+  template<typename Key>
+  double hyperloglog<Key>::estimate() const {
+    const auto register_count = static_cast<double>(registers.size());
+    double sum = 0;
+    size_t empty_registers = 0;
+    for (const auto& value : registers) {
+      sum += std::ldexp(1.0, -value);
+      empty_registers += value == 0;
+    }
+
+    const auto alpha = register_bits == 4 ? 0.673
+      : register_bits == 5 ? 0.697
+      : register_bits == 6 ? 0.709
+      : 0.7213 / (1.0 + 1.079 / register_count);
+    const auto raw_estimate = alpha * register_count * register_count / sum;
+
+    if (raw_estimate <= 2.5 * register_count && empty_registers > 0) {
+      return register_count * std::log(register_count / static_cast<double>(empty_registers));
+    }
+    return raw_estimate;
+  }
+
+  template<typename Key>
+  void hyperloglog<Key>::merge(const hyperloglog& other) {
+    if (register_bits != other.register_bits) {
+      throw std::invalid_argument("hyperloglogs with different precisions cannot be merged");
+    }
+    for (size_t index = 0; index < registers.size(); ++index) {
+      registers[index] = std::max(registers[index], other.registers[index]);
+    }
+    container::number_elements += other.number_elements;
+  }
+
+  template<typename Key>
+  void hyperloglog<Key>::clear() noexcept {
+    std::ranges::fill(registers, 0);
+    container::number_elements = 0;
+  }
+
+  template<typename Key>
+  std::uint8_t hyperloglog<Key>::precision() const noexcept {
+    return register_bits;
+  }
+
+  template<typename Key>
+  size_t hyperloglog<Key>::memory_usage() const noexcept {
+    return registers.size() * sizeof(std::uint8_t);
+  }
+}
\ No newline at end of file
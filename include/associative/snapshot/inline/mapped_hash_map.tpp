@@ -0,0 +1,148 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+
+#include "associative/map/value_not_found.hpp"
+#include "associative/snapshot/snapshot_error.hpp"
+
+namespace containers::associative {
+  template<snapshot_storable Key, snapshot_storable Value>
+  mapped_hash_map<Key, Value> mapped_hash_map<Key, Value>::open(
+    const std::string& path,
+    const std::function<hash_t(const Key&)>& hash_function
+  ) {
+    auto file = mapped_file(path);
+    if (file.size() < sizeof(snapshot_header)) {
+      throw snapshot_error(path + " is too small to be a snapshot");
+    }
+
+    auto map = mapped_hash_map(std::move(file), hash_function);
+    map.validate(path);
+    // Only derived once validate() has checked that the sections fit into the file
+    map.bounds = reinterpret_cast<const std::uint64_t*>(map.file.data() + map.header->bounds_offset);
+    map.entries = reinterpret_cast<const snapshot_entry*>(map.file.data() + map.header->entries_offset);
+    map.blob = map.file.data() + map.header->blob_offset;
+    map.container::number_elements = map.header->element_count;
+    return map;
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  mapped_hash_map<Key, Value>::mapped_hash_map(
+    mapped_file&& file,
+    const std::function<hash_t(const Key&)>& hash_function
+  ) :
+    file(std::move(file)),
+    hash_function(hash_function),
+    header(reinterpret_cast<const snapshot_header*>(this->file.data())),
+    bounds(nullptr),
+    entries(nullptr),
+    blob(nullptr)
+  {}
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  std::optional<Value> mapped_hash_map<Key, Value>::find_by_key(const Key& key) const {
+    const auto view = find_view(key);
+    if (!view.has_value()) {
+      return std::nullopt;
+    }
+    return Value(*view);
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  Value mapped_hash_map<Key, Value>::find_by_key_or_throw(const Key& key) const {
+    const auto& optional = find_by_key(key);
+    if (!optional.has_value()) {
+      throw value_not_found<Key>(key);
+    }
+    return optional.value();
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  std::optional<typename mapped_hash_map<Key, Value>::value_view_t> mapped_hash_map<Key, Value>::find_view(
+    const Key& key
+  ) const {
+    const auto* entry = find_entry(key);
+    if (entry == nullptr) {
+      return std::nullopt;
+    }
+    return snapshot_codec<Value>::decode(blob + entry->value_offset, entry->value_size);
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  bool mapped_hash_map<Key, Value>::exists(const Key& key) const {
+    return find_entry(key) != nullptr;
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  size_t mapped_hash_map<Key, Value>::bucket_count() const noexcept {
+    return header->bucket_count;
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  const snapshot_entry* mapped_hash_map<Key, Value>::find_entry(const Key& key) const {
+    const auto hash = hash_function(key);
+    const auto bucket = calculate_snapshot_bucket(hash, header->bucket_count);
+    const auto key_bytes = snapshot_codec<Key>::encode(key);
+    // Bounds and blob ranges are checked on every access instead of once on open,
+    // which would read the whole file and defeat the purpose of mapping it
+    const auto end = std::min(bounds[bucket + 1], header->element_count);
+    for (auto index = bounds[bucket]; index < end; ++index) {
+      const auto& entry = entries[index];
+      if (!contains_blob_range(entry.key_offset, entry.key_size) || !contains_blob_range(entry.value_offset, entry.value_size)
+        || (snapshot_codec<Value>::fixed_size != 0 && entry.value_size != snapshot_codec<Value>::fixed_size)
+      ) {
+        throw snapshot_error("snapshot entry points outside of the blob");
+      }
+      if (entry.hash == hash
+        && entry.key_size == key_bytes.size()
+        && std::equal(key_bytes.begin(), key_bytes.end(), blob + entry.key_offset)
+      ) {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  bool mapped_hash_map<Key, Value>::contains_blob_range(const std::uint64_t& offset, const std::uint64_t& size) const noexcept {
+    return offset <= header->blob_size && size <= header->blob_size - offset;
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void mapped_hash_map<Key, Value>::validate(const std::string& path) const {
+    if (header->magic != snapshot_magic) {
+      throw snapshot_error(path + " is not a snapshot");
+    }
+    if (header->endianness != snapshot_endianness) {
+      throw snapshot_error(path + " has been written on a machine of different byte order");
+    }
+    if (header->version != snapshot_version) {
+      throw snapshot_error(path + " has unsupported snapshot version " + std::to_string(header->version));
+    }
+    if (header->key_kind != snapshot_codec<Key>::kind || header->key_size != snapshot_codec<Key>::fixed_size
+      || header->value_kind != snapshot_codec<Value>::kind || header->value_size != snapshot_codec<Value>::fixed_size
+    ) {
+      throw snapshot_error(path + " holds other key or value types");
+    }
+
+    const auto file_size = static_cast<std::uint64_t>(file.size());
+    const auto bucket_count = header->bucket_count;
+    const auto element_count = header->element_count;
+    const auto fits = [&file_size](const std::uint64_t& offset, const std::uint64_t& count, const std::uint64_t& size) {
+      return offset % 8 == 0 && offset <= file_size && count <= (file_size - offset) / size;
+    };
+    if (!std::has_single_bit(bucket_count)
+      || !fits(header->bounds_offset, bucket_count + 1, sizeof(std::uint64_t))
+      || !fits(header->entries_offset, element_count, sizeof(snapshot_entry))
+      || !fits(header->blob_offset, header->blob_size, 1)
+    ) {
+      throw snapshot_error(path + " is truncated or corrupt");
+    }
+
+    const auto* file_bounds = reinterpret_cast<const std::uint64_t*>(file.data() + header->bounds_offset);
+    if (file_bounds[0] != 0 || file_bounds[bucket_count] != element_count) {
+      throw snapshot_error(path + " is truncated or corrupt");
+    }
+  }
+}
\ No newline at end of file
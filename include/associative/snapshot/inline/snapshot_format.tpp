@@ -0,0 +1,104 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <filesystem>
+#include <fstream>
+
+#include "associative/snapshot/snapshot_error.hpp"
+
+namespace containers::associative {
+  namespace snapshot_detail {
+    [[nodiscard]] constexpr std::uint64_t align(const std::uint64_t& offset) noexcept {
+      return (offset + 7) & ~std::uint64_t{7};
+    }
+
+    inline void write_bytes(std::ofstream& stream, const void* data, const size_t& size) {
+      stream.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+    }
+
+    inline void write_padding(std::ofstream& stream, const std::uint64_t& written) {
+      constexpr std::array<char, 8> zeros{};
+      write_bytes(stream, zeros.data(), align(written) - written);
+    }
+  }
+
+  template<snapshot_storable Key, snapshot_storable Value>
+  void write_snapshot(const std::string& path, const std::vector<std::tuple<const Key*, const Value*, hash_t>>& elements) {
+    const auto bucket_count = std::bit_ceil(std::max<size_t>(elements.size(), 1));
+
+    // Group the elements by bucket, keeping their order inside a bucket
+    auto bounds = std::vector<std::uint64_t>(bucket_count + 1, 0);
+    for (const auto& element : elements) {
+      ++bounds[calculate_snapshot_bucket(std::get<2>(element), bucket_count) + 1];
+    }
+    for (size_t index = 1; index < bounds.size(); ++index) {
+      bounds[index] += bounds[index - 1];
+    }
+    auto order = std::vector<size_t>(elements.size());
+    auto next = std::vector<std::uint64_t>(bounds.begin(), bounds.end() - 1);
+    for (size_t index = 0; index < elements.size(); ++index) {
+      order[next[calculate_snapshot_bucket(std::get<2>(elements[index]), bucket_count)]++] = index;
+    }
+
+    auto entries = std::vector<snapshot_entry>();
+    entries.reserve(elements.size());
+    std::uint64_t blob_size = 0;
+    for (const auto& index : order) {
+      const auto& [key, value, hash] = elements[index];
+      auto entry = snapshot_entry{};
+      entry.key_offset = blob_size;
+      entry.key_size = snapshot_codec<Key>::encode(*key).size();
+      entry.value_offset = snapshot_detail::align(entry.key_offset + entry.key_size);
+      entry.value_size = snapshot_codec<Value>::encode(*value).size();
+      entry.hash = hash;
+      blob_size = snapshot_detail::align(entry.value_offset + entry.value_size);
+      entries.push_back(entry);
+    }
+
+    auto header = snapshot_header{};
+    header.magic = snapshot_magic;
+    header.version = snapshot_version;
+    header.endianness = snapshot_endianness;
+    header.key_kind = snapshot_codec<Key>::kind;
+    header.key_size = snapshot_codec<Key>::fixed_size;
+    header.value_kind = snapshot_codec<Value>::kind;
+    header.value_size = snapshot_codec<Value>::fixed_size;
+    header.element_count = elements.size();
+    header.bucket_count = bucket_count;
+    header.bounds_offset = snapshot_detail::align(sizeof(snapshot_header));
+    header.entries_offset = header.bounds_offset + bounds.size() * sizeof(std::uint64_t);
+    header.blob_offset = header.entries_offset + entries.size() * sizeof(snapshot_entry);
+    header.blob_size = blob_size;
+
+    const auto temporary_path = path + ".tmp";
+    {
+      auto stream = std::ofstream(temporary_path, std::ios::binary | std::ios::trunc);
+      if (!stream) {
+        throw snapshot_error("cannot create " + temporary_path);
+      }
+      snapshot_detail::write_bytes(stream, &header, sizeof(header));
+      snapshot_detail::write_padding(stream, sizeof(header));
+      snapshot_detail::write_bytes(stream, bounds.data(), bounds.size() * sizeof(std::uint64_t));
+      snapshot_detail::write_bytes(stream, entries.data(), entries.size() * sizeof(snapshot_entry));
+      for (size_t position = 0; position < order.size(); ++position) {
+        const auto& [key, value, hash] = elements[order[position]];
+        const auto key_bytes = snapshot_codec<Key>::encode(*key);
+        const auto value_bytes = snapshot_codec<Value>::encode(*value);
+        snapshot_detail::write_bytes(stream, key_bytes.data(), key_bytes.size());
+        snapshot_detail::write_padding(stream, key_bytes.size());
+        snapshot_detail::write_bytes(stream, value_bytes.data(), value_bytes.size());
+        snapshot_detail::write_padding(stream, value_bytes.size());
+      }
+      if (!stream.flush()) {
+        throw snapshot_error("cannot write " + temporary_path);
+      }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary_path, path, error);
+    if (error) {
+      throw snapshot_error("cannot rename " + temporary_path + " to " + path + ": " + error.message());
+    }
+  }
+}
\ No newline at end of file
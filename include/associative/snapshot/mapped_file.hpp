@@ -0,0 +1,45 @@
+#pragma once
+
+#include <string>
+
+#include "container.hpp"
+
+namespace containers::associative {
+  /**
+   * @class mapped_file
+   * @brief A file mapped read-only into memory.
+   *
+   * The mapping is shared with every other process mapping the same file, so the pages
+   * are read from the page cache and only loaded once.
+   *
+   * @throws snapshot_error If the file cannot be opened or mapped.
+   */
+  class mapped_file final {
+  public:
+    explicit mapped_file(const std::string& path);
+    ~mapped_file();
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+    mapped_file(mapped_file&& other) noexcept;
+    mapped_file& operator=(mapped_file&& other) noexcept;
+
+    /**
+     * @brief Returns the first byte of the mapping.
+     * @return The mapped bytes, nullptr for an empty file.
+     */
+    [[nodiscard]] const char* data() const noexcept;
+
+    /**
+     * @brief Returns the size of the file.
+     * @return The number of mapped bytes.
+     */
+    [[nodiscard]] size_t size() const noexcept;
+
+  private:
+    const char* mapping = nullptr;
+    size_t mapping_size = 0;
+
+    void unmap() noexcept;
+  };
+}
\ No newline at end of file
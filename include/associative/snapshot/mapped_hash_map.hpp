@@ -0,0 +1,102 @@
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <string>
+
+#include "container.hpp"
+#include "associative/snapshot/mapped_file.hpp"
+#include "associative/snapshot/snapshot_format.hpp"
+
+namespace containers::associative {
+  /**
+   * @class mapped_hash_map
+   * @brief A read-only hash map served directly from a memory-mapped snapshot.
+   *
+   * The snapshot is written by hash_map::save_snapshot(). Opening only maps and validates
+   * the file, lookups read the bucket bounds, entries and blob in place, so nothing is
+   * deserialized up front and all processes mapping the same snapshot share its pages.
+   *
+   * @tparam Key The type of the keys, trivially copyable or std::string.
+   * @tparam Value The type of the values, trivially copyable or std::string.
+   *
+   * @details
+   * - The hash function must be the one the snapshot has been written with.
+   * - find_view() returns a view into the mapping for strings and avoids any copy.
+   *
+   * @note All member functions are thread-safe.
+   */
+  template<snapshot_storable Key, snapshot_storable Value>
+  class mapped_hash_map final : public container {
+  public:
+    using value_view_t = typename snapshot_codec<Value>::view_t;
+
+    /**
+     * @brief Maps a snapshot file.
+     *
+     * @param path The snapshot written by hash_map::save_snapshot().
+     * @param hash_function The hash function the snapshot has been written with.
+     * @return The map, valid as long as it lives, even if the file is removed.
+     * @throws snapshot_error If the file cannot be mapped, is not a snapshot of this version,
+     * holds other key or value types or its sections do not fit into the file. The entries
+     * themselves are only checked when a lookup reads them.
+     * @note Runtime complexity: O(1).
+     */
+    [[nodiscard]] static mapped_hash_map open(
+      const std::string& path,
+      const std::function<hash_t(const Key&)>& hash_function
+    );
+
+    /**
+     * @brief Finds the value associated with the specified key.
+     * @param key The key to look up.
+     * @return The value, or std::nullopt if the key does not exist.
+     * @note Runtime complexity: O(1) on average.
+     */
+    [[nodiscard]] std::optional<Value> find_by_key(const Key& key) const;
+
+    /**
+     * @brief Finds the value associated with the specified key or throws an exception.
+     * @param key The key to look up.
+     * @return The value associated with the key.
+     * @throws value_not_found<Key> If the key does not exist.
+     */
+    [[nodiscard]] Value find_by_key_or_throw(const Key& key) const;
+
+    /**
+     * @brief Finds the value associated with the specified key without copying it.
+     * @param key The key to look up.
+     * @return A view of the value inside the mapping, or std::nullopt if the key does not exist.
+     */
+    [[nodiscard]] std::optional<value_view_t> find_view(const Key& key) const;
+
+    /**
+     * @brief Checks whether the key exists.
+     * @param key The key to look up.
+     * @return True if the key exists, false otherwise.
+     */
+    [[nodiscard]] bool exists(const Key& key) const;
+
+    /**
+     * @brief Returns the number of buckets of the snapshot.
+     * @return The bucket count.
+     */
+    [[nodiscard]] size_t bucket_count() const noexcept;
+
+  private:
+    mapped_file file;
+    std::function<hash_t(const Key&)> hash_function;
+    const snapshot_header* header;
+    const std::uint64_t* bounds;
+    const snapshot_entry* entries;
+    const char* blob;
+
+    mapped_hash_map(mapped_file&& file, const std::function<hash_t(const Key&)>& hash_function);
+
+    [[nodiscard]] const snapshot_entry* find_entry(const Key& key) const;
+    [[nodiscard]] bool contains_blob_range(const std::uint64_t& offset, const std::uint64_t& size) const noexcept;
+    void validate(const std::string& path) const;
+  };
+}
+
+#include "inline/mapped_hash_map.tpp"
\ No newline at end of file
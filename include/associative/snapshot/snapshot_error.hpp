@@ -0,0 +1,19 @@
+#pragma once
+
+#include <exception>
+#include <string>
+
+namespace containers::associative {
+  /**
+   * @class snapshot_error
+   * @brief Thrown when a snapshot cannot be written, read or does not match the expected format.
+   */
+  class snapshot_error final : public std::exception {
+  public:
+    explicit snapshot_error(const std::string& message);
+
+    virtual const char* what() const noexcept override;
+  private:
+    const std::string message;
+  };
+}
\ No newline at end of file
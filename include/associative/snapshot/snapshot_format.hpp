@@ -0,0 +1,137 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "container.hpp"
+
+namespace containers::associative {
+  /**
+   * @brief Fixed-size header at the start of every snapshot file.
+   *
+   * A snapshot is position independent: all sections are addressed by offsets from the
+   * start of the file and all offsets inside the blob are relative to the blob.
+   *
+   * @details The file consists of, in this order and each aligned to 8 bytes:
+   * - the header,
+   * - `bucket_count + 1` uint64 entry indices; the entries of bucket i are [bounds[i], bounds[i + 1]),
+   * - `element_count` snapshot_entry records, grouped by bucket,
+   * - the blob holding the bytes of all keys and values.
+   */
+  struct snapshot_header {
+    std::array<char, 8> magic;
+    std::uint32_t version;
+    // Written as snapshot_endianness, reads back differently on a machine of other byte order
+    std::uint32_t endianness;
+    std::uint32_t key_kind;
+    std::uint32_t key_size;
+    std::uint32_t value_kind;
+    std::uint32_t value_size;
+    std::uint64_t element_count;
+    std::uint64_t bucket_count;
+    std::uint64_t bounds_offset;
+    std::uint64_t entries_offset;
+    std::uint64_t blob_offset;
+    std::uint64_t blob_size;
+  };
+
+  /**
+   * @brief Location of one key-value pair inside the blob of a snapshot.
+   */
+  struct snapshot_entry {
+    std::uint64_t key_offset;
+    std::uint64_t key_size;
+    std::uint64_t value_offset;
+    std::uint64_t value_size;
+    std::int32_t hash;
+    std::uint32_t reserved;
+  };
+
+  constexpr std::array<char, 8> snapshot_magic{'C', 'T', 'N', 'R', 'S', 'N', 'A', 'P'};
+  constexpr std::uint32_t snapshot_version = 1;
+  constexpr std::uint32_t snapshot_endianness = 0x01020304;
+
+  /**
+   * @brief Converts values to and from the bytes stored in a snapshot.
+   *
+   * Specializations exist for trivially copyable types, stored as their object representation,
+   * and for std::string, stored as its characters.
+   *
+   * @tparam T The type to convert.
+   */
+  template<typename T>
+  struct snapshot_codec;
+
+  template<typename T> requires std::is_trivially_copyable_v<T>
+  struct snapshot_codec<T> {
+    using view_t = T;
+    static constexpr std::uint32_t kind = 1;
+    static constexpr std::uint32_t fixed_size = sizeof(T);
+
+    [[nodiscard]] static std::string_view encode(const T& value) noexcept {
+      return {reinterpret_cast<const char*>(&value), sizeof(T)};
+    }
+
+    // Copied out, because the bytes inside the blob need not be aligned for T
+    [[nodiscard]] static T decode(const char* data, const size_t&) noexcept {
+      T value;
+      std::memcpy(&value, data, sizeof(T));
+      return value;
+    }
+  };
+
+  template<>
+  struct snapshot_codec<std::string> {
+    using view_t = std::string_view;
+    static constexpr std::uint32_t kind = 2;
+    static constexpr std::uint32_t fixed_size = 0;
+
+    [[nodiscard]] static std::string_view encode(const std::string& value) noexcept {
+      return value;
+    }
+
+    [[nodiscard]] static std::string_view decode(const char* data, const size_t& size) noexcept {
+      return {data, size};
+    }
+  };
+
+  /**
+   * @brief Types that can be stored in a snapshot.
+   */
+  template<typename T>
+  concept snapshot_storable = requires(const T& value, const char* data, const size_t& size) {
+    { snapshot_codec<T>::encode(value) } -> std::same_as<std::string_view>;
+    { snapshot_codec<T>::decode(data, size) } -> std::same_as<typename snapshot_codec<T>::view_t>;
+  };
+
+  /**
+   * @brief Calculates the snapshot bucket of a hash.
+   * @param hash The hash of a key.
+   * @param bucket_count The number of buckets, a power of 2.
+   * @return The bucket index.
+   */
+  [[nodiscard]] inline size_t calculate_snapshot_bucket(const hash_t& hash, const size_t& bucket_count) noexcept {
+    return static_cast<std::uint32_t>(hash) & (bucket_count - 1);
+  }
+
+  /**
+   * @brief Writes key-value pairs as a snapshot file.
+   *
+   * The file is written next to `path` and renamed into place once complete, so readers
+   * never observe a partially written snapshot.
+   *
+   * @param path The file to write.
+   * @param elements Pointers to the key, the value and the hash of every element.
+   * @throws snapshot_error If the file cannot be written.
+   */
+  template<snapshot_storable Key, snapshot_storable Value>
+  void write_snapshot(const std::string& path, const std::vector<std::tuple<const Key*, const Value*, hash_t>>& elements);
+}
+
+#include "inline/snapshot_format.tpp"
\ No newline at end of file
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+#include "container.hpp"
+
+namespace containers::associative {
+  /**
+   * @class timing_wheel
+   * @brief A hierarchical timing wheel scheduling keys to become due at some tick.
+   *
+   * Used by expiring_hash_map to find expired entries without sweeping the whole table:
+   * advancing the wheel only touches the records which are due, plus a bounded number of
+   * slots per elapsed tick.
+   *
+   * @tparam Key The type of the scheduled keys.
+   *
+   * @details
+   * - The wheel has 4 levels of 64 slots. Level 0 covers the next 64 ticks with one slot per
+   *   tick, level l the next 64^(l+1) ticks with one slot per 64^l ticks.
+   * - When the current tick reaches the start of a slot of level l > 0, the records of that
+   *   slot cascade into the lower levels, so a record is moved at most once per level.
+   * - Deadlines beyond the 64^4 ticks of the top level are parked in its farthest slot and
+   *   placed again when it cascades.
+   * - While the lower levels are empty, advance() jumps straight to the next cascade instead
+   *   of visiting every tick, so long idle periods cost no more than busy ones.
+   * - Records cannot be cancelled. The owner compares the deadline of a due record with its
+   *   own state and ignores records which have been superseded.
+   *
+   * @note This class is not thread-safe.
+   */
+  template<typename Key>
+  class timing_wheel final {
+  public:
+    using callback_t = std::function<void(const Key& key, const std::uint64_t& deadline)>;
+
+    /**
+     * @brief Constructs an empty wheel.
+     * @param start_tick The current tick, records due at or before it are due on the next tick.
+     */
+    explicit timing_wheel(const std::uint64_t& start_tick = 0);
+
+    /**
+     * @brief Schedules a key.
+     * @param key The key to report once due.
+     * @param deadline The tick at which the key becomes due.
+     * @note Runtime complexity: O(1).
+     */
+    void schedule(const Key& key, const std::uint64_t& deadline);
+
+    /**
+     * @brief Advances the current tick, reporting every record that became due.
+     * @param tick The new current tick, nothing happens if it is not after the current one.
+     * @param on_due Called with every due record, tick by tick.
+     * @note Runtime complexity: O(number of due records + number of cascaded records), plus at
+     * most 64 slots visited per level between cascades.
+     */
+    void advance(const std::uint64_t& tick, const callback_t& on_due);
+
+    /**
+     * @brief Removes all records without reporting them.
+     */
+    void clear();
+
+    /**
+     * @brief Returns the number of scheduled records, including superseded ones.
+     * @return The record count.
+     */
+    [[nodiscard]] size_t scheduled() const noexcept;
+
+    /**
+     * @brief Returns the current tick.
+     * @return The tick passed to the last advance(), or the start tick.
+     */
+    [[nodiscard]] std::uint64_t current_tick() const noexcept;
+
+  private:
+    using record_t = std::pair<Key, std::uint64_t>;
+
+    static constexpr size_t slot_bits = 6;
+    static constexpr size_t slot_count = size_t{1} << slot_bits;
+    static constexpr size_t level_count = 4;
+
+    std::uint64_t current;
+    std::array<std::array<std::vector<record_t>, slot_count>, level_count> slots;
+    std::array<size_t, level_count> level_sizes{};
+
+    [[nodiscard]] static constexpr std::uint64_t level_span(const size_t& level) noexcept;
+    void place(record_t&& record, const std::uint64_t& earliest);
+    void cascade(const size_t& level);
+  };
+}
+
+#include "inline/timing_wheel.tpp"
\ No newline at end of file
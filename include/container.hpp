@@ -16,8 +16,9 @@ namespace containers {
      * @brief Returns the number of elements in the container.
      * @return The size of the container.
      * @note This method has a runtime complexity of O(1).
+     * @note Containers modified by several threads at once override it to read their own atomic counter.
      */
-    [[nodiscard]] size_t size() const noexcept;
+    [[nodiscard]] virtual size_t size() const noexcept;
 
     /**
     * @brief Returns whether the container is empty or not
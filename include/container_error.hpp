@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+
+namespace containers {
+  /**
+   * @brief Why an operation failed, returned by the non-throwing try_ functions in a std::expected.
+   *
+   * Each error matches the exception the throwing counterpart of the function throws, which is
+   * a thin wrapper around it. Failures expected on hot paths, such as inserting an existing key,
+   * then cost a branch rather than an exception.
+   */
+  enum class container_error : std::uint8_t {
+    //! The key exists already, the throwing functions throw associative::duplicate_key.
+    duplicate_key,
+    //! The container is empty, the throwing functions throw sequential::empty_container.
+    empty_container
+  };
+}
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <expected>
+
 #include "../container.hpp"
+#include "../container_error.hpp"
 
 namespace containers::sequential {
     template<typename T>
@@ -19,6 +22,12 @@ namespace containers::sequential {
          * @return a value of Type data
          */
         virtual T dequeue() = 0;
+
+        /**
+         * @brief Deletes & returns the value at front of the container, without throwing if it is empty
+         * @return a value of Type T, or container_error::empty_container
+         */
+        virtual std::expected<T, container_error> try_dequeue() = 0;
         /**
          *  @brief Returns the value at front of the container
          *  @return The first value (Type T) of the container
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <expected>
+#include <functional>
+
 #include "../container.hpp"
+#include "../container_error.hpp"
 
 namespace containers::sequential {
     template<typename T>
@@ -20,10 +24,22 @@ namespace containers::sequential {
          */
         virtual T pop() = 0;
 
+        /**
+         * @brief Deletes & returns the value at front of the container, without throwing if it is empty
+         * @return a value of Type T, or container_error::empty_container
+         */
+        virtual std::expected<T, container_error> try_pop() = 0;
+
         /**
          * @brief Returns the value at front of the container without deleting
          * @return A value of Type T
          */
         virtual const T& top() const = 0;
+
+        /**
+         * @brief Returns the value at front of the container without deleting or throwing
+         * @return A reference to the value, or container_error::empty_container
+         */
+        virtual std::expected<std::reference_wrapper<const T>, container_error> try_top() const = 0;
     };
 }
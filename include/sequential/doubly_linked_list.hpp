@@ -103,6 +103,15 @@ protected:
    */
   virtual void pop_front() = 0;
 
+  /**
+   * @brief Moves a node of the list to the front without reallocating it.
+   *
+   * @param pos The node to move.
+   * @throws containers::sequential::invalid_node if pos is a nullptr.
+   * @note This method has constant time complexity (O(1)).
+   */
+  virtual void move_to_front(node_t pos) = 0;
+
   /**
    * @brief Returns a reference to the element at the specified index.
    *
@@ -145,6 +154,20 @@ public:
    */
   doubly_linked_list();
 
+  /**
+   * @brief Destroys the list, releasing its nodes one after another.
+   *
+   * Releasing the head would otherwise free the whole chain recursively, which
+   * overflows the stack for long lists. Nodes still referenced elsewhere, e.g.
+   * by a copy of the list, are left to their other owners.
+   */
+  ~doubly_linked_list() override;
+
+  doubly_linked_list(const doubly_linked_list &) = default;
+  doubly_linked_list(doubly_linked_list &&) noexcept = default;
+  doubly_linked_list &operator=(const doubly_linked_list &) = default;
+  doubly_linked_list &operator=(doubly_linked_list &&) noexcept = default;
+
   /// @copydoc abstract_doubly_linked_list::front
   node_t front() const noexcept override;
 
@@ -172,6 +195,9 @@ public:
   /// @copydoc abstract_doubly_linked_list::pop_front
   void pop_front() override;
 
+  /// @copydoc abstract_doubly_linked_list::move_to_front
+  void move_to_front(node_t pos) override;
+
   /// @copydoc abstract_doubly_linked_list::at
   node_t at(size_t idx) const override;
 
@@ -6,6 +6,14 @@ namespace containers::sequential {
 
 template <typename T> doubly_linked_list<T>::doubly_linked_list() = default;
 
+template <typename T> doubly_linked_list<T>::~doubly_linked_list() {
+  tail_pointer = nullptr;
+  auto current = std::move(head_pointer);
+  while (current != nullptr && current.use_count() == 1) {
+    current = std::move(current->next);
+  }
+}
+
 template <typename T>
 abstract_doubly_linked_list<T>::node::node(T value) : data(value){};
 
@@ -57,6 +65,11 @@ doubly_linked_list<T>::node_t doubly_linked_list<T>::erase(node_t pos) {
   if (pos == head_pointer) {
     head_pointer = pos->next;
     pos->next = nullptr;
+    if (head_pointer == nullptr) {
+      tail_pointer = nullptr;
+    } else {
+      head_pointer->prev.reset();
+    }
     return head_pointer;
   } else if (pos == tail_pointer) {
     tail_pointer = pos->prev.lock();
@@ -118,9 +131,36 @@ template <typename T> void doubly_linked_list<T>::pop_front() {
   }
 
   head_pointer = head_pointer->next;
+  if (head_pointer == nullptr) {
+    tail_pointer = nullptr;
+  } else {
+    head_pointer->prev.reset();
+  }
   container::number_elements--;
 }
 
+template <typename T> void doubly_linked_list<T>::move_to_front(node_t pos) {
+  if (pos == nullptr) {
+    throw invalid_node();
+  }
+  if (pos == head_pointer) {
+    return;
+  }
+
+  const auto prev = pos->prev.lock();
+  prev->next = pos->next;
+  if (pos == tail_pointer) {
+    tail_pointer = prev;
+  } else {
+    pos->next->prev = prev;
+  }
+
+  pos->prev.reset();
+  pos->next = head_pointer;
+  head_pointer->prev = pos;
+  head_pointer = pos;
+}
+
 template <typename T>
 doubly_linked_list<T>::node_t doubly_linked_list<T>::at(size_t idx) const {
   if (idx >= container::number_elements) {
@@ -10,9 +10,16 @@ namespace containers::sequential {
         container::number_elements++;
     }
     template <typename T> T list_queue<T>::dequeue(){
-        if (m_list.empty()){
+        auto result = try_dequeue();
+        if (!result){
             throw empty_container();
         }
+        return std::move(*result);
+    }
+    template <typename T> std::expected<T, container_error> list_queue<T>::try_dequeue(){
+        if (m_list.empty()){
+            return std::unexpected(container_error::empty_container);
+        }
         const auto& tmp = m_list.front();
         m_list.pop_front();
         container::number_elements--;
@@ -10,18 +10,32 @@ namespace containers::sequential {
         container::number_elements++;
     }
     template <typename T> T list_stack<T>::pop() {
-        if (m_list.empty()){
+        auto result = try_pop();
+        if (!result){
             throw empty_container();
         }
+        return std::move(*result);
+    }
+    template <typename T> std::expected<T, container_error> list_stack<T>::try_pop() {
+        if (m_list.empty()){
+            return std::unexpected(container_error::empty_container);
+        }
         const auto& tmp = m_list.front();
         m_list.pop_front();
         container::number_elements--;
         return tmp->data;
     }
     template <typename T> const T& list_stack<T>::top() const {
-        if (m_list.empty()){
+        const auto result = try_top();
+        if (!result){
             throw empty_container();
         }
-        return m_list.front()->data;
+        return result->get();
+    }
+    template <typename T> std::expected<std::reference_wrapper<const T>, container_error> list_stack<T>::try_top() const {
+        if (m_list.empty()){
+            return std::unexpected(container_error::empty_container);
+        }
+        return std::cref(m_list.front()->data);
     }
 }
@@ -35,16 +35,24 @@ void priority_queue<T>::push(const T &value) {
 
 template <typename T>
 void priority_queue<T>::pop() {
-  if (!root) {
+  if (!try_pop()) {
     throw std::out_of_range("PriorityQueue is empty.");
   }
+}
+
+
+template <typename T>
+std::expected<void, container_error> priority_queue<T>::try_pop() {
+  if (!root) {
+    return std::unexpected(container_error::empty_container);
+  }
 
   using node_ptr = typename abstract_priority_queue<T>::heap_node_t;
 
   if (container::number_elements == 1) {
     root.reset();  // Easier case if just one elemen
     container::number_elements--;
-    return;
+    return {};
   }
   auto last = find_last_node();
   auto parent_of_last = last->parent.lock();
@@ -63,14 +71,24 @@ void priority_queue<T>::pop() {
 
   // Heapify down
   heapify_down(root);
+  return {};
 }
 
 
 template <typename T> const T &priority_queue<T>::top() const {
-  if (!root) {
+  const auto result = try_top();
+  if (!result) {
     throw std::out_of_range("PriorityQueue is empty.");
   }
-  return root->data;
+  return result->get();
+}
+
+template <typename T>
+std::expected<std::reference_wrapper<const T>, container_error> priority_queue<T>::try_top() const {
+  if (!root) {
+    return std::unexpected(container_error::empty_container);
+  }
+  return std::cref(root->data);
 }
 
 template <typename T>
@@ -26,6 +26,9 @@ namespace containers::sequential{
         //! @copydoc abstract_queue::dequeue
         T dequeue() override;
 
+        //! @copydoc abstract_queue::try_dequeue
+        std::expected<T, container_error> try_dequeue() override;
+
         //! @copydoc abstract_queue::front
         const T& front() const override;
 
@@ -21,8 +21,14 @@ namespace containers::sequential {
         //! @copydoc abtract_stack::pop
         T pop() override;
 
+        //! @copydoc abstract_stack::try_pop
+        std::expected<T, container_error> try_pop() override;
+
         //! @copydoc abstract_stack::top
         const T& top() const override;
+
+        //! @copydoc abstract_stack::try_top
+        std::expected<std::reference_wrapper<const T>, container_error> try_top() const override;
     };
 }
 
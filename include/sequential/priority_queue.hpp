@@ -1,6 +1,9 @@
 #pragma once
 
 #include <container.hpp>
+#include <container_error.hpp>
+#include <expected>
+#include <functional>
 #include <memory>
 
 namespace containers::sequential {
@@ -49,6 +52,13 @@ protected:
    */
   [[nodiscard]] virtual const T &top() const = 0;
 
+  /**
+   * @brief Access the top (highest priority) element without throwing.
+   * 
+   * @return Reference to the top element, or container_error::empty_container.
+   */
+  [[nodiscard]] virtual std::expected<std::reference_wrapper<const T>, container_error> try_top() const = 0;
+
   /**
    * @brief Insert an element into the priority queue.
    * 
@@ -62,6 +72,13 @@ protected:
    * @throws std::out_of_range if the priority queue is empty.
    */
   virtual void pop() = 0;
+
+  /**
+   * @brief Remove the top (highest priority) element from the queue without throwing.
+   * 
+   * @return Nothing, or container_error::empty_container if the queue is empty.
+   */
+  virtual std::expected<void, container_error> try_pop() = 0;
 };
 
 /**
@@ -87,12 +104,18 @@ public:
   // @copydoc abstract_priority_queue::top
   [[nodiscard]] const T &top() const override;
 
+  // @copydoc abstract_priority_queue::try_top
+  [[nodiscard]] std::expected<std::reference_wrapper<const T>, container_error> try_top() const override;
+
   // @copydoc abstract_priority_queue::push
   void push(const T &value) override;
 
   //@copydoc abstract_priority_queue::pop
   void pop() override;
 
+  // @copydoc abstract_priority_queue::try_pop
+  std::expected<void, container_error> try_pop() override;
+
 private:
   /**
    * @brief Maintains the heap property after insertion by bubbling the element up.
@@ -0,0 +1,139 @@
+#include "associative/concurrent/epoch_domain.hpp"
+
+#include <algorithm>
+
+namespace containers::associative {
+  namespace {
+    // Releases the record of a thread when the thread exits
+    struct record_holder {
+      epoch_domain* domain = nullptr;
+      void* thread_record = nullptr;
+      void (*release)(epoch_domain*, void*) = nullptr;
+
+      ~record_holder() {
+        if (thread_record != nullptr) {
+          release(domain, thread_record);
+        }
+      }
+    };
+
+    thread_local record_holder holder;
+  }
+
+  epoch_domain::guard::guard() {
+    auto& domain = instance();
+    auto& thread_record = domain.current_record();
+    if (thread_record.nesting++ == 0) {
+      thread_record.active.store(true);
+      thread_record.epoch.store(domain.global_epoch.load());
+    }
+  }
+
+  epoch_domain::guard::~guard() {
+    auto& thread_record = instance().current_record();
+    if (--thread_record.nesting == 0) {
+      thread_record.active.store(false);
+    }
+  }
+
+  epoch_domain& epoch_domain::instance() {
+    static epoch_domain domain;
+    return domain;
+  }
+
+  void epoch_domain::retire(void* pointer, const deleter_t deleter) {
+    auto& thread_record = current_record();
+    thread_record.retired.push_back(retired_node{pointer, deleter, global_epoch.load()});
+    if (thread_record.retired.size() >= collect_threshold) {
+      collect();
+    }
+  }
+
+  void epoch_domain::collect() {
+    try_advance();
+    free_safe_nodes(current_record().retired);
+
+    if (std::unique_lock lock(orphans_mutex, std::try_to_lock); lock.owns_lock()) {
+      free_safe_nodes(orphans);
+    }
+  }
+
+  std::uint64_t epoch_domain::epoch() const noexcept {
+    return global_epoch.load();
+  }
+
+  epoch_domain::~epoch_domain() {
+    // Only reached after all other threads have exited, so every node can be freed
+    auto* thread_record = records.load();
+    while (thread_record != nullptr) {
+      for (const auto& node : thread_record->retired) {
+        node.deleter(node.pointer);
+      }
+      const auto* next = thread_record->next;
+      delete thread_record;
+      thread_record = const_cast<record*>(next);
+    }
+    for (const auto& node : orphans) {
+      node.deleter(node.pointer);
+    }
+  }
+
+  epoch_domain::record& epoch_domain::current_record() {
+    if (holder.thread_record == nullptr) {
+      holder.domain = this;
+      holder.thread_record = acquire_record();
+      holder.release = [](epoch_domain* domain, void* thread_record) {
+        domain->release_record(static_cast<record*>(thread_record));
+      };
+    }
+    return *static_cast<record*>(holder.thread_record);
+  }
+
+  epoch_domain::record* epoch_domain::acquire_record() {
+    for (auto* thread_record = records.load(); thread_record != nullptr; thread_record = thread_record->next) {
+      auto in_use = false;
+      if (thread_record->in_use.compare_exchange_strong(in_use, true)) {
+        return thread_record;
+      }
+    }
+
+    auto* thread_record = new record();
+    thread_record->next = records.load();
+    while (!records.compare_exchange_weak(thread_record->next, thread_record)) {}
+    return thread_record;
+  }
+
+  void epoch_domain::release_record(record* thread_record) {
+    if (!thread_record->retired.empty()) {
+      std::scoped_lock lock(orphans_mutex);
+      orphans.insert(orphans.end(), thread_record->retired.begin(), thread_record->retired.end());
+      thread_record->retired.clear();
+    }
+    thread_record->active.store(false);
+    thread_record->in_use.store(false);
+  }
+
+  bool epoch_domain::try_advance() {
+    auto current_epoch = global_epoch.load();
+    for (auto* thread_record = records.load(); thread_record != nullptr; thread_record = thread_record->next) {
+      if (thread_record->in_use.load()
+        && thread_record->active.load()
+        && thread_record->epoch.load() != current_epoch
+      ) {
+        return false;
+      }
+    }
+    return global_epoch.compare_exchange_strong(current_epoch, current_epoch + 1);
+  }
+
+  void epoch_domain::free_safe_nodes(std::vector<retired_node>& nodes) const {
+    const auto current_epoch = global_epoch.load();
+    const auto safe = std::ranges::partition(nodes, [current_epoch](const retired_node& node) {
+      return node.epoch + 2 > current_epoch;
+    });
+    for (auto it = safe.begin(); it != safe.end(); ++it) {
+      it->deleter(it->pointer);
+    }
+    nodes.erase(safe.begin(), safe.end());
+  }
+}
\ No newline at end of file
@@ -0,0 +1,9 @@
+#include "associative/durable/durability_error.hpp"
+
+namespace containers::associative {
+  durability_error::durability_error(const std::string& message) : message(message) {}
+
+  const char* durability_error::what() const noexcept {
+    return message.c_str();
+  }
+}
\ No newline at end of file
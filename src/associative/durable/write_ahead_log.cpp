@@ -0,0 +1,372 @@
+#include "associative/durable/write_ahead_log.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "associative/durable/durability_error.hpp"
+#include "associative/snapshot/mapped_file.hpp"
+#include "associative/snapshot/snapshot_error.hpp"
+#include "associative/snapshot/snapshot_format.hpp"
+
+namespace containers::associative {
+  namespace {
+    // Checkpoint records are flushed to the file in chunks of about this size
+    constexpr size_t checkpoint_chunk_size = 1 << 20;
+
+    [[nodiscard]] std::string describe_error(const std::string& action, const std::filesystem::path& path) {
+      return "cannot " + action + " " + path.string() + ": " + std::strerror(errno);
+    }
+
+#ifdef _WIN32
+    [[nodiscard]] int open_descriptor(const std::filesystem::path& path, const bool truncate) {
+      return ::_wopen(path.c_str(), _O_WRONLY | _O_CREAT | _O_BINARY | (truncate ? _O_TRUNC : 0), _S_IREAD | _S_IWRITE);
+    }
+
+    [[nodiscard]] bool sync_descriptor(const int descriptor) {
+      return ::_commit(descriptor) == 0;
+    }
+
+    [[nodiscard]] bool truncate_descriptor(const int descriptor, const std::uint64_t& size) {
+      return ::_chsize_s(descriptor, static_cast<__int64>(size)) == 0
+        && ::_lseeki64(descriptor, static_cast<__int64>(size), SEEK_SET) >= 0;
+    }
+
+    void close_descriptor(const int descriptor) {
+      ::_close(descriptor);
+    }
+
+    // Renames are durable once MoveFileEx returns, there is no directory to sync
+    void sync_directory(const std::filesystem::path&) {}
+#else
+    [[nodiscard]] int open_descriptor(const std::filesystem::path& path, const bool truncate) {
+      return ::open(path.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC | (truncate ? O_TRUNC : 0), 0644);
+    }
+
+    [[nodiscard]] bool sync_descriptor(const int descriptor) {
+      return ::fsync(descriptor) == 0;
+    }
+
+    [[nodiscard]] bool truncate_descriptor(const int descriptor, const std::uint64_t& size) {
+      return ::ftruncate(descriptor, static_cast<off_t>(size)) == 0
+        && ::lseek(descriptor, static_cast<off_t>(size), SEEK_SET) >= 0;
+    }
+
+    void close_descriptor(const int descriptor) {
+      ::close(descriptor);
+    }
+
+    // A rename only survives a power loss once the directory entry itself is fsync'd
+    void sync_directory(const std::filesystem::path& directory) {
+      const auto descriptor = ::open(directory.c_str(), O_RDONLY | O_CLOEXEC);
+      if (descriptor < 0) {
+        throw durability_error(describe_error("open", directory));
+      }
+      const auto synced = ::fsync(descriptor) == 0;
+      ::close(descriptor);
+      if (!synced) {
+        throw durability_error(describe_error("sync", directory));
+      }
+    }
+#endif
+
+    void write_descriptor(const int descriptor, const char* data, size_t size, const std::filesystem::path& path) {
+      while (size > 0) {
+#ifdef _WIN32
+        const auto written = ::_write(descriptor, data, static_cast<unsigned int>(std::min<size_t>(size, 1 << 30)));
+#else
+        const auto written = ::write(descriptor, data, size);
+#endif
+        if (written < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          throw durability_error(describe_error("write", path));
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+      }
+    }
+
+    // FNV-1a, enough to recognize torn writes, which is all the checksum is for
+    [[nodiscard]] std::uint32_t calculate_checksum(const log_record_header& header, std::string_view payload) noexcept {
+      std::uint32_t checksum = 2166136261u;
+      const auto add = [&checksum](const void* data, const size_t& size) {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+        for (size_t index = 0; index < size; ++index) {
+          checksum = (checksum ^ bytes[index]) * 16777619u;
+        }
+      };
+      add(&header.sequence, sizeof(header.sequence));
+      add(&header.payload_size, sizeof(header.payload_size));
+      add(&header.operation, sizeof(header.operation));
+      add(payload.data(), payload.size());
+      return checksum;
+    }
+
+    void encode_record(std::string& output, const std::uint64_t& sequence, const std::uint8_t& operation, std::string_view payload) {
+      auto header = log_record_header{};
+      header.sequence = sequence;
+      header.payload_size = static_cast<std::uint32_t>(payload.size());
+      header.operation = operation;
+      header.checksum = calculate_checksum(header, payload);
+      output.append(reinterpret_cast<const char*>(&header), sizeof(header));
+      output.append(payload);
+    }
+
+    [[nodiscard]] std::string encode_file_header(const std::array<char, 8>& magic, const std::uint64_t& sequence) {
+      auto header = log_file_header{};
+      header.magic = magic;
+      header.version = log_version;
+      header.endianness = snapshot_endianness;
+      header.sequence = sequence;
+      return {reinterpret_cast<const char*>(&header), sizeof(header)};
+    }
+
+    [[nodiscard]] bool is_valid_file_header(const log_file_header& header, const std::array<char, 8>& magic) noexcept {
+      return header.magic == magic && header.version == log_version && header.endianness == snapshot_endianness;
+    }
+
+    /**
+     * Calls `visit` with the header and payload of every intact record from `offset` on,
+     * until a record is torn, corrupt or `visit` rejects it.
+     * Returns the offset behind the last accepted record.
+     */
+    template<typename Visit>
+    size_t read_records(const char* data, const size_t& size, size_t offset, const Visit& visit) {
+      while (size - offset >= sizeof(log_record_header)) {
+        auto header = log_record_header{};
+        std::memcpy(&header, data + offset, sizeof(header));
+        if (header.payload_size > size - offset - sizeof(header)) {
+          break;
+        }
+        const auto payload = std::string_view(data + offset + sizeof(header), header.payload_size);
+        if (header.checksum != calculate_checksum(header, payload) || !visit(header, payload)) {
+          break;
+        }
+        offset += sizeof(header) + header.payload_size;
+      }
+      return offset;
+    }
+
+    [[nodiscard]] mapped_file map_file(const std::filesystem::path& path) {
+      try {
+        return mapped_file(path.string());
+      } catch (const snapshot_error& error) {
+        throw durability_error(error.what());
+      }
+    }
+  }
+
+  write_ahead_log::write_ahead_log(
+    const std::filesystem::path& directory,
+    const durability_options& options,
+    const apply_t& apply
+  ) : directory(directory), options(options) {
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) {
+      throw durability_error("cannot create " + directory.string() + ": " + error.message());
+    }
+
+    const auto checkpoint_sequence = recover_checkpoint(apply);
+    recover_log(checkpoint_sequence, apply);
+  }
+
+  write_ahead_log::~write_ahead_log() {
+    try {
+      sync();
+    } catch (const durability_error&) {
+      // Nothing to report the failure to, the records are lost as in a crash
+    }
+    close_descriptor(descriptor);
+  }
+
+  void write_ahead_log::append(const std::uint8_t& operation, std::string_view payload) {
+    if (unsynced_records == 0) {
+      oldest_unsynced = std::chrono::steady_clock::now();
+    }
+    encode_record(pending, ++sequence, operation, payload);
+    ++unsynced_records;
+    ++records_since_checkpoint;
+
+    // Only the fsync is batched, so records never wait in the process for the next append
+    write_pending();
+    switch (options.level) {
+      case durability_level::none:
+        break;
+      case durability_level::group_commit:
+        if (unsynced_records >= options.group_size || std::chrono::steady_clock::now() - oldest_unsynced >= options.group_delay) {
+          sync();
+        }
+        break;
+      case durability_level::every_operation:
+        sync();
+        break;
+    }
+  }
+
+  void write_ahead_log::sync() {
+    write_pending();
+    if (!sync_descriptor(descriptor)) {
+      throw durability_error(describe_error("sync", log_path()));
+    }
+    unsynced_records = 0;
+  }
+
+  void write_ahead_log::checkpoint(const std::function<void(const emit_t&)>& write_state) {
+    sync();
+
+    auto temporary_path = checkpoint_path();
+    temporary_path += ".tmp";
+    const auto checkpoint_descriptor = open_descriptor(temporary_path, true);
+    if (checkpoint_descriptor < 0) {
+      throw durability_error(describe_error("create", temporary_path));
+    }
+
+    try {
+      auto buffer = encode_file_header(checkpoint_magic, sequence);
+      write_state([&buffer, &checkpoint_descriptor, &temporary_path](const std::uint8_t& operation, std::string_view payload) {
+        encode_record(buffer, 0, operation, payload);
+        if (buffer.size() >= checkpoint_chunk_size) {
+          write_descriptor(checkpoint_descriptor, buffer.data(), buffer.size(), temporary_path);
+          buffer.clear();
+        }
+      });
+      write_descriptor(checkpoint_descriptor, buffer.data(), buffer.size(), temporary_path);
+      if (!sync_descriptor(checkpoint_descriptor)) {
+        throw durability_error(describe_error("sync", temporary_path));
+      }
+    } catch (...) {
+      close_descriptor(checkpoint_descriptor);
+      std::filesystem::remove(temporary_path);
+      throw;
+    }
+    close_descriptor(checkpoint_descriptor);
+
+    std::error_code error;
+    std::filesystem::rename(temporary_path, checkpoint_path(), error);
+    if (error) {
+      throw durability_error("cannot rename " + temporary_path.string() + ": " + error.message());
+    }
+    sync_directory(directory);
+
+    // From here on the log only repeats the checkpoint, losing it in a crash loses nothing
+    const auto header = encode_file_header(log_magic, sequence);
+    if (!truncate_descriptor(descriptor, 0)) {
+      throw durability_error(describe_error("truncate", log_path()));
+    }
+    write_descriptor(descriptor, header.data(), header.size(), log_path());
+    if (!sync_descriptor(descriptor)) {
+      throw durability_error(describe_error("sync", log_path()));
+    }
+    records_since_checkpoint = 0;
+  }
+
+  bool write_ahead_log::checkpoint_due() const noexcept {
+    return options.checkpoint_interval > 0 && records_since_checkpoint >= options.checkpoint_interval;
+  }
+
+  std::uint64_t write_ahead_log::last_sequence() const noexcept {
+    return sequence;
+  }
+
+  std::filesystem::path write_ahead_log::log_path() const {
+    return directory / "log";
+  }
+
+  std::filesystem::path write_ahead_log::checkpoint_path() const {
+    return directory / "checkpoint";
+  }
+
+  std::uint64_t write_ahead_log::recover_checkpoint(const apply_t& apply) {
+    if (!std::filesystem::exists(checkpoint_path())) {
+      return 0;
+    }
+
+    // Checkpoints are renamed into place only once complete, so any damage is an error
+    const auto file = map_file(checkpoint_path());
+    auto header = log_file_header{};
+    if (file.size() < sizeof(header)) {
+      throw durability_error(checkpoint_path().string() + " is truncated");
+    }
+    std::memcpy(&header, file.data(), sizeof(header));
+    if (!is_valid_file_header(header, checkpoint_magic)) {
+      throw durability_error(checkpoint_path().string() + " is not a checkpoint of this version");
+    }
+
+    const auto end = read_records(file.data(), file.size(), sizeof(header), [&apply](const log_record_header& record, std::string_view payload) {
+      apply(record.operation, payload);
+      return true;
+    });
+    if (end != file.size()) {
+      throw durability_error(checkpoint_path().string() + " is corrupt at offset " + std::to_string(end));
+    }
+    return header.sequence;
+  }
+
+  void write_ahead_log::recover_log(const std::uint64_t& checkpoint_sequence, const apply_t& apply) {
+    sequence = checkpoint_sequence;
+    size_t end = 0;
+
+    if (std::filesystem::exists(log_path())) {
+      const auto file = map_file(log_path());
+      auto header = log_file_header{};
+      if (file.size() >= sizeof(header)) {
+        std::memcpy(&header, file.data(), sizeof(header));
+        if (!is_valid_file_header(header, log_magic)) {
+          throw durability_error(log_path().string() + " is not a log of this version");
+        }
+        std::uint64_t previous = 0;
+        end = read_records(file.data(), file.size(), sizeof(header), [&](const log_record_header& record, std::string_view payload) {
+          // Sequence numbers only grow, anything else is a leftover behind a torn record
+          if (record.sequence <= previous) {
+            return false;
+          }
+          previous = record.sequence;
+          if (record.sequence > checkpoint_sequence) {
+            sequence = record.sequence;
+            ++records_since_checkpoint;
+            apply(record.operation, payload);
+          }
+          return true;
+        });
+      }
+    }
+
+    descriptor = open_descriptor(log_path(), false);
+    if (descriptor < 0) {
+      throw durability_error(describe_error("open", log_path()));
+    }
+    if (end == 0) {
+      // A new log, or one whose header never reached the disk
+      const auto header = encode_file_header(log_magic, sequence);
+      if (!truncate_descriptor(descriptor, 0)) {
+        throw durability_error(describe_error("truncate", log_path()));
+      }
+      write_descriptor(descriptor, header.data(), header.size(), log_path());
+    } else if (!truncate_descriptor(descriptor, end)) {
+      throw durability_error(describe_error("truncate", log_path()));
+    }
+    if (!sync_descriptor(descriptor)) {
+      throw durability_error(describe_error("sync", log_path()));
+    }
+  }
+
+  void write_ahead_log::write_pending() {
+    if (pending.empty()) {
+      return;
+    }
+    write_descriptor(descriptor, pending.data(), pending.size(), log_path());
+    pending.clear();
+  }
+}
\ No newline at end of file
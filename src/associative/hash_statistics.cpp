@@ -0,0 +1,31 @@
+#include "associative/hash_statistics.hpp"
+
+namespace containers::associative {
+  void hash_statistics_counters<true>::count_lookup(const bool& hit, const size_t& probes) noexcept {
+    if (hit) {
+      ++hit_count;
+      hit_probe_count += probes;
+    } else {
+      ++miss_count;
+      miss_probe_count += probes;
+    }
+  }
+
+  hash_statistics_counters<true>::rehash_start hash_statistics_counters<true>::start_rehash() const noexcept {
+    return std::chrono::steady_clock::now();
+  }
+
+  void hash_statistics_counters<true>::count_rehash(const rehash_start& start) noexcept {
+    ++rehash_count;
+    rehash_time += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  }
+
+  void hash_statistics_counters<true>::write_to(hash_statistics& statistics) const noexcept {
+    statistics.rehash_count = rehash_count;
+    statistics.rehash_time = rehash_time;
+    statistics.hit_count = hit_count;
+    statistics.miss_count = miss_count;
+    statistics.hit_probe_count = hit_probe_count;
+    statistics.miss_probe_count = miss_probe_count;
+  }
+}
\ No newline at end of file
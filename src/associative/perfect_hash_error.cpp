@@ -0,0 +1,9 @@
+#include "associative/perfect_hash_error.hpp"
+
+namespace containers::associative {
+  perfect_hash_error::perfect_hash_error(const std::string& message) : message(message) {}
+
+  const char* perfect_hash_error::what() const noexcept {
+    return message.c_str();
+  }
+}
\ No newline at end of file
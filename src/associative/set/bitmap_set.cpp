@@ -0,0 +1,168 @@
+#include "associative/set/bitmap_set.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+#include <string>
+
+#include "associative/duplicate_key.hpp"
+
+namespace containers::associative {
+  bitmap_set::bitmap_set(const std::uint64_t& universe) : key_universe(universe) {
+    if (universe == 0 || universe > (std::uint64_t{1} << 32)) {
+      throw std::invalid_argument("The universe of a bitmap_set must be in [1, 2^32]");
+    }
+    auto words = universe;
+    do {
+      words = (words + word_bits - 1) >> level_shift;
+      levels.emplace_back(words, 0);
+    } while (words > 1);
+  }
+
+  void bitmap_set::insert(const key_t& key) {
+    if (!insert_if_absent(key)) {
+      throw duplicate_key<key_t>(key);
+    }
+  }
+
+  void bitmap_set::insert_safely(const key_t& key) {
+    insert_if_absent(key);
+  }
+
+  std::expected<void, container_error> bitmap_set::try_insert(const key_t& key) {
+    if (!insert_if_absent(key)) {
+      return std::unexpected(container_error::duplicate_key);
+    }
+    return {};
+  }
+
+  bool bitmap_set::exists(const key_t& key) const {
+    return key < key_universe && (levels.front()[key >> level_shift] >> (key & (word_bits - 1)) & 1) != 0;
+  }
+
+  void bitmap_set::remove(const key_t& key) {
+    if (!exists(key)) {
+      return;
+    }
+    // Clears the bit of the key, and the bit of every word above which became zero
+    auto position = std::uint64_t{key};
+    for (auto& level : levels) {
+      auto& word = level[position >> level_shift];
+      word &= ~(std::uint64_t{1} << (position & (word_bits - 1)));
+      if (word != 0) {
+        break;
+      }
+      position >>= level_shift;
+    }
+    container::number_elements--;
+  }
+
+  std::optional<bitmap_set::key_t> bitmap_set::find_lower_bound(const key_t& key) const {
+    return lower_bound(key);
+  }
+
+  std::optional<bitmap_set::key_t> bitmap_set::find_upper_bound(const key_t& key) const {
+    return successor(key);
+  }
+
+  void bitmap_set::clear() {
+    for (auto& level : levels) {
+      std::ranges::fill(level, 0);
+    }
+    container::number_elements = 0;
+  }
+
+  std::optional<bitmap_set::key_t> bitmap_set::successor(const key_t& key) const {
+    return next_from(std::uint64_t{key} + 1);
+  }
+
+  std::optional<bitmap_set::key_t> bitmap_set::predecessor(const key_t& key) const {
+    if (key == 0) {
+      return std::nullopt;
+    }
+    return previous_from(std::min<std::uint64_t>(key - 1, key_universe - 1));
+  }
+
+  std::optional<bitmap_set::key_t> bitmap_set::lower_bound(const key_t& key) const {
+    return next_from(key);
+  }
+
+  std::optional<bitmap_set::key_t> bitmap_set::min() const {
+    return next_from(0);
+  }
+
+  std::optional<bitmap_set::key_t> bitmap_set::max() const {
+    return previous_from(key_universe - 1);
+  }
+
+  std::uint64_t bitmap_set::universe() const noexcept {
+    return key_universe;
+  }
+
+  bool bitmap_set::insert_if_absent(const key_t& key) {
+    if (key >= key_universe) {
+      throw std::out_of_range("Key " + std::to_string(key) + " is outside the universe of the bitmap_set");
+    }
+    if (exists(key)) {
+      return false;
+    }
+    // Sets the bit of the key, and the bit of every word above which was zero before
+    auto position = std::uint64_t{key};
+    for (auto& level : levels) {
+      auto& word = level[position >> level_shift];
+      const auto was_empty = word == 0;
+      word |= std::uint64_t{1} << (position & (word_bits - 1));
+      if (!was_empty) {
+        break;
+      }
+      position >>= level_shift;
+    }
+    container::number_elements++;
+    return true;
+  }
+
+  std::optional<bitmap_set::key_t> bitmap_set::next_from(std::uint64_t position) const {
+    // Climbs until a word has a set bit at or after the position, then descends to the first key below it
+    auto level = size_t{0};
+    while (true) {
+      const auto index = position >> level_shift;
+      if (index >= levels[level].size()) {
+        return std::nullopt;
+      }
+      const auto bits = levels[level][index] & (~std::uint64_t{0} << (position & (word_bits - 1)));
+      if (bits != 0) {
+        position = (index << level_shift) | std::countr_zero(bits);
+        break;
+      }
+      if (++level == levels.size()) {
+        return std::nullopt;
+      }
+      position = index + 1;
+    }
+    while (level-- > 0) {
+      position = (position << level_shift) | std::countr_zero(levels[level][position]);
+    }
+    return static_cast<key_t>(position);
+  }
+
+  std::optional<bitmap_set::key_t> bitmap_set::previous_from(std::uint64_t position) const {
+    // Climbs until a word has a set bit at or before the position, then descends to the last key below it
+    auto level = size_t{0};
+    while (true) {
+      const auto index = position >> level_shift;
+      const auto bits = levels[level][index] & (~std::uint64_t{0} >> (word_bits - 1 - (position & (word_bits - 1))));
+      if (bits != 0) {
+        position = (index << level_shift) | (word_bits - 1 - std::countl_zero(bits));
+        break;
+      }
+      if (index == 0 || ++level == levels.size()) {
+        return std::nullopt;
+      }
+      position = index - 1;
+    }
+    while (level-- > 0) {
+      position = (position << level_shift) | (word_bits - 1 - std::countl_zero(levels[level][position]));
+    }
+    return static_cast<key_t>(position);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,280 @@
+#include "associative/set/front_coded_string_set.hpp"
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include "associative/snapshot/snapshot_error.hpp"
+#include "associative/snapshot/snapshot_format.hpp"
+
+namespace containers::associative {
+  namespace {
+    [[nodiscard]] constexpr std::uint64_t align(const std::uint64_t& offset) noexcept {
+      return (offset + 7) & ~std::uint64_t{7};
+    }
+
+    // Lengths are stored as variable-length integers, 7 bits per byte, the high bit set on all but the last
+    void write_length(std::string& blob, size_t length) {
+      while (length >= 0x80) {
+        blob.push_back(static_cast<char>((length & 0x7f) | 0x80));
+        length >>= 7;
+      }
+      blob.push_back(static_cast<char>(length));
+    }
+  }
+
+  front_coded_string_set front_coded_string_set::open(const std::string& path) {
+    auto set = front_coded_string_set();
+    set.file.emplace(path);
+    if (set.file->size() < sizeof(header_t)) {
+      throw snapshot_error(path + " is too small to be a front-coded string set");
+    }
+    set.validate(path);
+    set.container::number_elements = set.header().element_count;
+    return set;
+  }
+
+  void front_coded_string_set::save(const std::string& path) const {
+    const auto temporary_path = path + ".tmp";
+    {
+      auto stream = std::ofstream(temporary_path, std::ios::binary | std::ios::trunc);
+      if (!stream) {
+        throw snapshot_error("cannot create " + temporary_path);
+      }
+      stream.write(image(), static_cast<std::streamsize>(size_in_bytes()));
+      if (!stream.flush()) {
+        throw snapshot_error("cannot write " + temporary_path);
+      }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporary_path, path, error);
+    if (error) {
+      throw snapshot_error("cannot rename " + temporary_path + " to " + path + ": " + error.message());
+    }
+  }
+
+  bool front_coded_string_set::exists(const std::string_view& key) const {
+    const auto position = find_lower_bound(key);
+    return position.index < size() && position.key == key;
+  }
+
+  front_coded_string_set::iterator_t front_coded_string_set::lower_bound(const std::string_view& key) const {
+    auto position = find_lower_bound(key);
+    return {this, position.index, position.next_offset, std::move(position.key)};
+  }
+
+  size_t front_coded_string_set::rank(const std::string_view& key) const {
+    return find_lower_bound(key).index;
+  }
+
+  std::string front_coded_string_set::select(const size_t& index) const {
+    if (index >= size()) {
+      throw std::out_of_range("Index " + std::to_string(index) + " is out of range for " + std::to_string(size()) + " strings");
+    }
+    const auto block = index / block_size();
+    auto key = std::string();
+    auto offset = decode(block_offset(block), true, key);
+    for (auto current = block * block_size() + 1; current <= index; ++current) {
+      offset = decode(offset, false, key);
+    }
+    return key;
+  }
+
+  size_t front_coded_string_set::block_size() const noexcept {
+    return header().block_size;
+  }
+
+  size_t front_coded_string_set::size_in_bytes() const noexcept {
+    return file.has_value() ? file->size() : bytes.size();
+  }
+
+  front_coded_string_set::iterator_t front_coded_string_set::begin() const {
+    if (empty()) {
+      return end();
+    }
+    auto key = std::string();
+    const auto next_offset = decode(block_offset(0), true, key);
+    return {this, 0, next_offset, std::move(key)};
+  }
+
+  front_coded_string_set::iterator_t front_coded_string_set::end() const {
+    return {this, size(), 0, std::string()};
+  }
+
+  front_coded_string_set::iterator_t front_coded_string_set::cbegin() const {
+    return begin();
+  }
+
+  front_coded_string_set::iterator_t front_coded_string_set::cend() const {
+    return end();
+  }
+
+  void front_coded_string_set::build(const std::vector<std::string>& sorted, const size_t& block_size) {
+    if (block_size == 0) {
+      throw std::invalid_argument("The block size of a front_coded_string_set must be positive");
+    }
+    // Sorts a copy only if needed, sorted input is encoded as it is
+    auto sorted_copy = std::vector<std::string>();
+    const auto* keys = &sorted;
+    if (!std::ranges::is_sorted(sorted)) {
+      sorted_copy = sorted;
+      std::ranges::sort(sorted_copy);
+      keys = &sorted_copy;
+    }
+
+    auto blob = std::string();
+    auto offsets = std::vector<std::uint64_t>();
+    const std::string* previous = nullptr;
+    for (const auto& key : *keys) {
+      if (previous != nullptr && *previous == key) {
+        continue;
+      }
+      const auto count = container::number_elements;
+      if (count % block_size == 0) {
+        offsets.push_back(blob.size());
+        write_length(blob, key.size());
+        blob.append(key);
+      } else {
+        const auto shared = static_cast<size_t>(std::ranges::mismatch(*previous, key).in2 - key.begin());
+        write_length(blob, shared);
+        write_length(blob, key.size() - shared);
+        blob.append(key, shared);
+      }
+      previous = &key;
+      container::number_elements++;
+    }
+
+    auto header = header_t{};
+    header.magic = magic;
+    header.version = version;
+    header.endianness = snapshot_endianness;
+    header.element_count = container::number_elements;
+    header.block_size = block_size;
+    header.block_count = offsets.size();
+    header.offsets_offset = align(sizeof(header_t));
+    header.blob_offset = header.offsets_offset + offsets.size() * sizeof(std::uint64_t);
+    header.blob_size = blob.size();
+
+    bytes.resize(header.blob_offset + blob.size());
+    std::ranges::copy_n(reinterpret_cast<const char*>(&header), sizeof(header), bytes.begin());
+    std::ranges::copy_n(reinterpret_cast<const char*>(offsets.data()), offsets.size() * sizeof(std::uint64_t), bytes.begin() + header.offsets_offset);
+    std::ranges::copy(blob, bytes.begin() + header.blob_offset);
+  }
+
+  void front_coded_string_set::validate(const std::string& path) const {
+    const auto& header = this->header();
+    if (header.magic != magic) {
+      throw snapshot_error(path + " is not a front-coded string set");
+    }
+    if (header.endianness != snapshot_endianness) {
+      throw snapshot_error(path + " has been written on a machine of different byte order");
+    }
+    if (header.version != version) {
+      throw snapshot_error(path + " has unsupported front-coded string set version " + std::to_string(header.version));
+    }
+
+    const auto file_size = static_cast<std::uint64_t>(file->size());
+    if (header.block_size == 0
+      || header.block_count != (header.element_count + header.block_size - 1) / header.block_size
+      || header.offsets_offset % 8 != 0 || header.offsets_offset > file_size
+      || header.block_count > (file_size - header.offsets_offset) / sizeof(std::uint64_t)
+      || header.blob_offset != header.offsets_offset + header.block_count * sizeof(std::uint64_t)
+      || header.blob_size != file_size - header.blob_offset
+    ) {
+      throw snapshot_error(path + " is truncated or corrupt");
+    }
+  }
+
+  const char* front_coded_string_set::image() const noexcept {
+    return file.has_value() ? file->data() : bytes.data();
+  }
+
+  const front_coded_string_set::header_t& front_coded_string_set::header() const noexcept {
+    return *reinterpret_cast<const header_t*>(image());
+  }
+
+  size_t front_coded_string_set::block_offset(const size_t& block) const noexcept {
+    return reinterpret_cast<const std::uint64_t*>(image() + header().offsets_offset)[block];
+  }
+
+  std::string_view front_coded_string_set::first_key(const size_t& block) const {
+    auto offset = block_offset(block);
+    const auto length = read_length(offset);
+    if (length > header().blob_size - offset) {
+      throw snapshot_error("front-coded string points outside of the blob");
+    }
+    return {image() + header().blob_offset + offset, length};
+  }
+
+  size_t front_coded_string_set::decode(const size_t& offset, const bool& block_start, std::string& key) const {
+    auto next = offset;
+    const auto shared = block_start ? 0 : read_length(next);
+    const auto length = read_length(next);
+    if (shared > key.size() || length > header().blob_size - next) {
+      throw snapshot_error("front-coded string points outside of the blob");
+    }
+    key.resize(shared);
+    key.append(image() + header().blob_offset + next, length);
+    return next + length;
+  }
+
+  size_t front_coded_string_set::read_length(size_t& offset) const {
+    const auto& header = this->header();
+    const auto* blob = image() + header.blob_offset;
+    auto length = size_t{0};
+    for (auto shift = 0; shift < 64; shift += 7) {
+      if (offset >= header.blob_size) {
+        break;
+      }
+      const auto byte = static_cast<unsigned char>(blob[offset++]);
+      length |= static_cast<size_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) {
+        return length;
+      }
+    }
+    throw snapshot_error("front-coded string points outside of the blob");
+  }
+
+  front_coded_string_set::position_t front_coded_string_set::find_lower_bound(const std::string_view& key) const {
+    const auto& header = this->header();
+    // The first block whose first string is greater than the key, the lower bound is in the block before
+    auto first = size_t{0};
+    auto count = static_cast<size_t>(header.block_count);
+    while (count > 0) {
+      const auto half = count / 2;
+      if (!(key < first_key(first + half))) {
+        first += half + 1;
+        count -= half + 1;
+      } else {
+        count = half;
+      }
+    }
+
+    auto position = position_t{0, 0, std::string()};
+    if (first == 0) {
+      if (header.element_count > 0) {
+        position.next_offset = decode(block_offset(0), true, position.key);
+      }
+      return position;
+    }
+
+    const auto block = first - 1;
+    position.index = block * header.block_size;
+    position.next_offset = decode(block_offset(block), true, position.key);
+    const auto block_end = std::min<size_t>(position.index + header.block_size, header.element_count);
+    while (position.key < key) {
+      if (++position.index == block_end) {
+        if (block_end == header.element_count) {
+          position.key.clear();
+          return position;
+        }
+        position.next_offset = decode(block_offset(first), true, position.key);
+        return position;
+      }
+      position.next_offset = decode(position.next_offset, false, position.key);
+    }
+    return position;
+  }
+}
\ No newline at end of file
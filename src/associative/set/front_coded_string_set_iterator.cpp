@@ -0,0 +1,45 @@
+#include "associative/set/front_coded_string_set_iterator.hpp"
+
+#include <utility>
+
+#include "associative/set/front_coded_string_set.hpp"
+
+namespace containers::associative {
+  front_coded_string_set_iterator::front_coded_string_set_iterator() : set(nullptr), index(0), next_offset(0) {}
+
+  front_coded_string_set_iterator::front_coded_string_set_iterator(
+    const front_coded_string_set* set,
+    const size_t& index,
+    const size_t& next_offset,
+    std::string&& key
+  ) : set(set), index(index), next_offset(next_offset), key(std::move(key)) {}
+
+  const std::string& front_coded_string_set_iterator::operator*() const {
+    return key;
+  }
+
+  const std::string* front_coded_string_set_iterator::operator->() const {
+    return &key;
+  }
+
+  front_coded_string_set_iterator& front_coded_string_set_iterator::operator++() {
+    if (++index == set->size()) {
+      key.clear();
+    } else if (index % set->block_size() == 0) {
+      next_offset = set->decode(set->block_offset(index / set->block_size()), true, key);
+    } else {
+      next_offset = set->decode(next_offset, false, key);
+    }
+    return *this;
+  }
+
+  front_coded_string_set_iterator front_coded_string_set_iterator::operator++(int) {
+    auto old = *this;
+    ++(*this);
+    return old;
+  }
+
+  bool front_coded_string_set_iterator::operator==(const front_coded_string_set_iterator& other) const {
+    return set == other.set && index == other.index;
+  }
+}
\ No newline at end of file
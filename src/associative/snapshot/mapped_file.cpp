@@ -0,0 +1,112 @@
+#include "associative/snapshot/mapped_file.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "associative/snapshot/snapshot_error.hpp"
+
+namespace containers::associative {
+#ifdef _WIN32
+  mapped_file::mapped_file(const std::string& path) {
+    const auto file = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+      throw snapshot_error("cannot open " + path);
+    }
+
+    LARGE_INTEGER file_size{};
+    if (!::GetFileSizeEx(file, &file_size)) {
+      ::CloseHandle(file);
+      throw snapshot_error("cannot stat " + path);
+    }
+
+    mapping_size = static_cast<size_t>(file_size.QuadPart);
+    if (mapping_size > 0) {
+      const auto mapping_handle = ::CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      const auto* address = mapping_handle != nullptr ? ::MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0) : nullptr;
+      if (mapping_handle != nullptr) {
+        ::CloseHandle(mapping_handle);
+      }
+      if (address == nullptr) {
+        ::CloseHandle(file);
+        throw snapshot_error("cannot map " + path);
+      }
+      mapping = static_cast<const char*>(address);
+    }
+    // The view stays valid after the handles are closed
+    ::CloseHandle(file);
+  }
+#else
+  mapped_file::mapped_file(const std::string& path) {
+    const auto descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (descriptor < 0) {
+      throw snapshot_error("cannot open " + path + ": " + std::strerror(errno));
+    }
+
+    struct stat status{};
+    if (::fstat(descriptor, &status) != 0) {
+      const auto error = errno;
+      ::close(descriptor);
+      throw snapshot_error("cannot stat " + path + ": " + std::strerror(error));
+    }
+
+    mapping_size = static_cast<size_t>(status.st_size);
+    if (mapping_size > 0) {
+      auto* address = ::mmap(nullptr, mapping_size, PROT_READ, MAP_SHARED, descriptor, 0);
+      if (address == MAP_FAILED) {
+        const auto error = errno;
+        ::close(descriptor);
+        throw snapshot_error("cannot map " + path + ": " + std::strerror(error));
+      }
+      mapping = static_cast<const char*>(address);
+    }
+    // The mapping stays valid after the descriptor is closed
+    ::close(descriptor);
+  }
+#endif
+
+  mapped_file::~mapped_file() {
+    unmap();
+  }
+
+  mapped_file::mapped_file(mapped_file&& other) noexcept
+    : mapping(std::exchange(other.mapping, nullptr)), mapping_size(std::exchange(other.mapping_size, 0)) {}
+
+  mapped_file& mapped_file::operator=(mapped_file&& other) noexcept {
+    if (this != &other) {
+      unmap();
+      mapping = std::exchange(other.mapping, nullptr);
+      mapping_size = std::exchange(other.mapping_size, 0);
+    }
+    return *this;
+  }
+
+  const char* mapped_file::data() const noexcept {
+    return mapping;
+  }
+
+  size_t mapped_file::size() const noexcept {
+    return mapping_size;
+  }
+
+  void mapped_file::unmap() noexcept {
+    if (mapping != nullptr) {
+#ifdef _WIN32
+      ::UnmapViewOfFile(mapping);
+#else
+      ::munmap(const_cast<char*>(mapping), mapping_size);
+#endif
+      mapping = nullptr;
+      mapping_size = 0;
+    }
+  }
+}
\ No newline at end of file
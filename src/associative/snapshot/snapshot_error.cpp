@@ -0,0 +1,9 @@
+#include "associative/snapshot/snapshot_error.hpp"
+
+namespace containers::associative {
+  snapshot_error::snapshot_error(const std::string& message) : message(message) {}
+
+  const char* snapshot_error::what() const noexcept {
+    return message.c_str();
+  }
+}
\ No newline at end of file
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "associative/duplicate_key.hpp"
+#include "associative/map/art_map.hpp"
+#include "associative/map/value_not_found.hpp"
+
+class art_map_test : public testing::Test {
+protected:
+  using value_t = int;
+  using art_map_t = containers::associative::art_map<value_t>;
+
+  art_map_t art_map;
+
+  void SetUp() override {
+    art_map.insert("/api", 1);
+    art_map.insert("/api/users", 2);
+    art_map.insert("/static", 3);
+  }
+
+  static std::vector<std::pair<std::string, value_t>> collect(const auto& range) {
+    auto pairs = std::vector<std::pair<std::string, value_t>>();
+    for (const auto& pair : range) {
+      pairs.push_back(pair);
+    }
+    return pairs;
+  }
+};
+
+static_assert(std::forward_iterator<containers::associative::art_map<int>::iterator_t>);
+
+TEST_F(art_map_test, CorrectContainerSize) {
+  EXPECT_EQ(art_map.size(), 3);
+}
+
+TEST_F(art_map_test, InsertDuplicateThrowsException) {
+  EXPECT_THROW(art_map.insert("/api", 4), containers::associative::duplicate_key<std::string>);
+  EXPECT_EQ(art_map.try_insert("/api/users", 4).error(), containers::container_error::duplicate_key);
+  art_map.insert_safely("/api", 4);
+  EXPECT_EQ(art_map.find_by_key("/api"), 1);
+  EXPECT_EQ(art_map.size(), 3);
+}
+
+TEST_F(art_map_test, FindDistinguishesPrefixesOfKeys) {
+  EXPECT_EQ(art_map.find_by_key_or_throw("/api/users"), 2);
+  EXPECT_FALSE(art_map.find_by_key("/ap").has_value());
+  EXPECT_FALSE(art_map.find_by_key("/api/").has_value());
+  EXPECT_FALSE(art_map.find_by_key("/api/users/1").has_value());
+  EXPECT_FALSE(art_map.find_by_key("").has_value());
+  EXPECT_THROW(static_cast<void>(art_map.find_by_key_or_throw("/")), containers::associative::value_not_found<std::string>);
+
+  art_map.upsert("", 0);
+  art_map.upsert("/api", 10);
+  EXPECT_EQ(art_map.find_by_key(""), 0);
+  EXPECT_EQ(art_map.find_by_key("/api"), 10);
+  EXPECT_EQ(art_map.size(), 4);
+}
+
+TEST_F(art_map_test, KeysMayContainAnyByte) {
+  const auto zero = std::string("a\0b", 3);
+  const auto high = std::string("a\xff", 2);
+  art_map.insert(zero, 4);
+  art_map.insert(high, 5);
+  art_map.insert("a", 6);
+
+  EXPECT_EQ(art_map.find_by_key(zero), 4);
+  EXPECT_EQ(art_map.find_by_key(high), 5);
+  EXPECT_FALSE(art_map.find_by_key(std::string("a\0", 2)).has_value());
+  const auto pairs = collect(art_map.prefix_scan("a"));
+  ASSERT_EQ(pairs.size(), 3);
+  EXPECT_EQ(pairs[0].first, "a");
+  EXPECT_EQ(pairs[1].first, zero);
+  EXPECT_EQ(pairs[2].first, high);
+}
+
+TEST_F(art_map_test, RemoveKeepsOtherKeys) {
+  art_map.remove("/api");
+  art_map.remove("/missing");
+  EXPECT_FALSE(art_map.find_by_key("/api").has_value());
+  EXPECT_EQ(art_map.find_by_key("/api/users"), 2);
+  EXPECT_EQ(art_map.size(), 2);
+
+  art_map.remove("/api/users");
+  art_map.remove("/static");
+  EXPECT_TRUE(art_map.empty());
+  EXPECT_EQ(art_map.begin(), art_map.end());
+}
+
+TEST_F(art_map_test, PrefixScanReturnsMatchingKeysInOrder) {
+  art_map.insert("/api/orders", 4);
+  art_map.insert("/api/users/1", 5);
+  art_map.insert("/apiary", 6);
+
+  auto keys = std::vector<std::string>();
+  for (const auto& [key, value] : collect(art_map.prefix_scan("/api/"))) {
+    keys.push_back(key);
+  }
+  EXPECT_EQ(keys, std::vector<std::string>({"/api/orders", "/api/users", "/api/users/1"}));
+  EXPECT_EQ(collect(art_map.prefix_scan("/api")).size(), 5);
+  EXPECT_EQ(collect(art_map.prefix_scan("/a")).size(), 5);
+  EXPECT_EQ(collect(art_map.prefix_scan("/api/users/1")).size(), 1);
+  EXPECT_EQ(collect(art_map.prefix_scan("")).size(), art_map.size());
+  EXPECT_TRUE(art_map.prefix_scan("/api/x").empty());
+  EXPECT_TRUE(art_map.prefix_scan("/api/users/12").empty());
+  EXPECT_TRUE(art_map.prefix_scan("/b").empty());
+}
+
+TEST_F(art_map_test, LongestPrefixMatchFindsMostSpecificKey) {
+  art_map.insert("/", 0);
+
+  EXPECT_EQ(art_map.longest_prefix_match("/api/users/7"), std::make_pair(std::string("/api/users"), 2));
+  EXPECT_EQ(art_map.longest_prefix_match("/api/orders"), std::make_pair(std::string("/api"), 1));
+  EXPECT_EQ(art_map.longest_prefix_match("/api"), std::make_pair(std::string("/api"), 1));
+  EXPECT_EQ(art_map.longest_prefix_match("/ap"), std::make_pair(std::string("/"), 0));
+  EXPECT_FALSE(art_map.longest_prefix_match("api").has_value());
+}
+
+TEST_F(art_map_test, FindBoundsThroughOrderedMap) {
+  const containers::associative::ordered_map<std::string, value_t>& ordered = art_map;
+  EXPECT_EQ(ordered.find_lower_bound("/api"), std::make_pair(std::string("/api"), 1));
+  EXPECT_EQ(ordered.find_upper_bound("/api"), std::make_pair(std::string("/api/users"), 2));
+  EXPECT_EQ(ordered.find_lower_bound("/api/"), std::make_pair(std::string("/api/users"), 2));
+  EXPECT_EQ(ordered.find_lower_bound("/b"), std::make_pair(std::string("/static"), 3));
+  EXPECT_EQ(ordered.find_lower_bound(""), std::make_pair(std::string("/api"), 1));
+  EXPECT_EQ(ordered.find_upper_bound("/static"), std::nullopt);
+}
+
+TEST_F(art_map_test, FindBoundsMatchStdMap) {
+  auto generator = std::mt19937(7);
+  auto byte = std::uniform_int_distribution<int>('a', 'e');
+  auto length = std::uniform_int_distribution<int>(0, 5);
+  const auto random_key = [&] {
+    auto key = std::string();
+    for (int index = length(generator); index > 0; --index) {
+      key += static_cast<char>(byte(generator));
+    }
+    return key;
+  };
+
+  auto expected = std::map<std::string, value_t>();
+  art_map.clear();
+  for (int round = 0; round < 300; ++round) {
+    const auto key = random_key();
+    art_map.upsert(key, round);
+    expected[key] = round;
+  }
+
+  const auto as_optional = [&](const auto iterator) {
+    using pair_t = std::pair<std::string, value_t>;
+    return iterator == expected.end() ? std::nullopt : std::optional<pair_t>(*iterator);
+  };
+  for (int round = 0; round < 2000; ++round) {
+    const auto key = random_key();
+    ASSERT_EQ(art_map.find_lower_bound(key), as_optional(expected.lower_bound(key))) << key;
+    ASSERT_EQ(art_map.find_upper_bound(key), as_optional(expected.upper_bound(key))) << key;
+  }
+}
+
+TEST_F(art_map_test, BehavesLikeStdMap) {
+  // Few distinct bytes make deep paths, many make wide nodes which grow up to Node256 and shrink back
+  for (const auto& alphabet : {std::string("ab"), std::string("0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ")}) {
+    auto generator = std::mt19937(42);
+    auto byte = std::uniform_int_distribution<size_t>(0, alphabet.size() - 1);
+    auto length = std::uniform_int_distribution<int>(0, alphabet.size() == 2 ? 8 : 3);
+    auto operation = std::uniform_int_distribution<int>(0, 2);
+    auto expected = std::map<std::string, value_t>();
+    art_map.clear();
+
+    for (int round = 0; round < 20000; ++round) {
+      auto key = std::string();
+      for (int index = length(generator); index > 0; --index) {
+        key += alphabet[byte(generator)];
+      }
+      if (operation(generator) == 0) {
+        art_map.remove(key);
+        expected.erase(key);
+      } else {
+        art_map.upsert(key, round);
+        expected[key] = round;
+      }
+      ASSERT_EQ(art_map.size(), expected.size());
+    }
+
+    EXPECT_EQ(collect(art_map), collect(expected));
+    for (const auto& [key, value] : std::map(expected)) {
+      EXPECT_EQ(art_map.find_by_key(key), value);
+      art_map.remove(key);
+    }
+    EXPECT_TRUE(art_map.empty());
+  }
+}
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <stdexcept>
+
+#include "associative/duplicate_key.hpp"
+#include "associative/set/bitmap_set.hpp"
+
+class bitmap_set_test : public testing::Test {
+protected:
+  using key_t = containers::associative::bitmap_set::key_t;
+
+  // Three levels: 4096 bits, 64 bits and a single word
+  containers::associative::bitmap_set bitmap_set{100000};
+
+  void SetUp() override {
+    bitmap_set.insert(20);
+    bitmap_set.insert(10);
+    bitmap_set.insert(70000);
+  }
+};
+
+TEST_F(bitmap_set_test, CorrectContainerSize) {
+  EXPECT_EQ(bitmap_set.size(), 3);
+  EXPECT_EQ(bitmap_set.universe(), 100000);
+}
+
+TEST_F(bitmap_set_test, InsertDuplicateThrowsException) {
+  EXPECT_THROW(bitmap_set.insert(10), containers::associative::duplicate_key<key_t>);
+  EXPECT_EQ(bitmap_set.try_insert(10).error(), containers::container_error::duplicate_key);
+  bitmap_set.insert_safely(10);
+  EXPECT_TRUE(bitmap_set.try_insert(11).has_value());
+  EXPECT_EQ(bitmap_set.size(), 4);
+}
+
+TEST_F(bitmap_set_test, KeysOutsideUniverse) {
+  EXPECT_THROW(bitmap_set.insert(100000), std::out_of_range);
+  EXPECT_THROW(static_cast<void>(bitmap_set.try_insert(200000)), std::out_of_range);
+  EXPECT_FALSE(bitmap_set.exists(100000));
+  bitmap_set.remove(100000);
+  EXPECT_EQ(bitmap_set.predecessor(4000000000), 70000);
+  EXPECT_FALSE(bitmap_set.successor(4000000000).has_value());
+  EXPECT_EQ(bitmap_set.size(), 3);
+
+  EXPECT_THROW(containers::associative::bitmap_set(0), std::invalid_argument);
+  EXPECT_THROW(containers::associative::bitmap_set((std::uint64_t{1} << 32) + 1), std::invalid_argument);
+}
+
+TEST_F(bitmap_set_test, SuccessorAndPredecessorSkipEmptyWords) {
+  EXPECT_EQ(bitmap_set.successor(10), 20);
+  EXPECT_EQ(bitmap_set.successor(20), 70000);
+  EXPECT_FALSE(bitmap_set.successor(70000).has_value());
+  EXPECT_EQ(bitmap_set.lower_bound(20), 20);
+  EXPECT_EQ(bitmap_set.lower_bound(21), 70000);
+
+  EXPECT_EQ(bitmap_set.predecessor(70000), 20);
+  EXPECT_EQ(bitmap_set.predecessor(20), 10);
+  EXPECT_FALSE(bitmap_set.predecessor(10).has_value());
+  EXPECT_FALSE(bitmap_set.predecessor(0).has_value());
+
+  EXPECT_EQ(bitmap_set.min(), 10);
+  EXPECT_EQ(bitmap_set.max(), 70000);
+}
+
+TEST_F(bitmap_set_test, FindBoundsThroughOrderedSet) {
+  const containers::associative::ordered_set<key_t>& ordered = bitmap_set;
+  EXPECT_EQ(ordered.find_lower_bound(20), 20);
+  EXPECT_EQ(ordered.find_lower_bound(21), 70000);
+  EXPECT_EQ(ordered.find_upper_bound(20), 70000);
+  EXPECT_EQ(ordered.find_upper_bound(70000), std::nullopt);
+}
+
+TEST_F(bitmap_set_test, RemoveClearsEmptyWordsAbove) {
+  bitmap_set.remove(70000);
+  bitmap_set.remove(15);
+  EXPECT_FALSE(bitmap_set.exists(70000));
+  EXPECT_FALSE(bitmap_set.successor(20).has_value());
+  EXPECT_EQ(bitmap_set.max(), 20);
+  EXPECT_EQ(bitmap_set.size(), 2);
+
+  bitmap_set.clear();
+  EXPECT_TRUE(bitmap_set.empty());
+  EXPECT_FALSE(bitmap_set.min().has_value());
+  EXPECT_FALSE(bitmap_set.max().has_value());
+}
+
+TEST_F(bitmap_set_test, UniverseBoundaries) {
+  // One key past a full top word, so every level has a second, almost empty word
+  auto bounded = containers::associative::bitmap_set(262145);
+  bounded.insert(0);
+  bounded.insert(262144);
+  EXPECT_EQ(bounded.successor(0), 262144);
+  EXPECT_EQ(bounded.predecessor(262144), 0);
+  EXPECT_FALSE(bounded.successor(262144).has_value());
+  EXPECT_EQ(bounded.max(), 262144);
+
+  auto single = containers::associative::bitmap_set(1);
+  single.insert(0);
+  EXPECT_EQ(single.min(), 0);
+  EXPECT_FALSE(single.successor(0).has_value());
+}
+
+TEST_F(bitmap_set_test, BehavesLikeStdSet) {
+  auto small = containers::associative::bitmap_set(5000);
+  auto generator = std::mt19937(42);
+  auto key = std::uniform_int_distribution<key_t>(0, 4999);
+  auto operation = std::uniform_int_distribution<int>(0, 3);
+  auto expected = std::set<key_t>();
+
+  for (int round = 0; round < 20000; ++round) {
+    const auto current = key(generator);
+    switch (operation(generator)) {
+      case 0:
+        small.remove(current);
+        expected.erase(current);
+        break;
+      case 1: {
+        const auto next = expected.upper_bound(current);
+        EXPECT_EQ(small.successor(current), next == expected.end() ? std::nullopt : std::optional{*next});
+        const auto previous = expected.lower_bound(current);
+        EXPECT_EQ(small.predecessor(current), previous == expected.begin() ? std::nullopt : std::optional{*std::prev(previous)});
+        break;
+      }
+      default:
+        small.insert_safely(current);
+        expected.insert(current);
+        break;
+    }
+    ASSERT_EQ(small.size(), expected.size());
+  }
+
+  for (auto current = small.min(); current.has_value(); current = small.successor(*current)) {
+    ASSERT_FALSE(expected.empty());
+    EXPECT_EQ(*current, *expected.begin());
+    expected.erase(expected.begin());
+  }
+  EXPECT_TRUE(expected.empty());
+}
\ No newline at end of file
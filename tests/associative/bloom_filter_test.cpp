@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <string>
+
+#include "associative/filter/bloom_filter.hpp"
+
+class bloom_filter_test : public ::testing::Test {
+protected:
+  using key_t = std::string;
+  using bloom_filter_t = containers::associative::bloom_filter<key_t>;
+
+  bloom_filter_t bloom_filter;
+
+  bloom_filter_test() : bloom_filter(std::hash<key_t>(), 1000) {}
+
+  void SetUp() override {
+    for (int index = 0; index < 1000; ++index) {
+      bloom_filter.insert("key" + std::to_string(index));
+    }
+  }
+};
+
+TEST_F(bloom_filter_test, CorrectContainerSize) {
+  EXPECT_EQ(bloom_filter.size(), 1000);
+}
+
+TEST_F(bloom_filter_test, InsertedKeysAreAlwaysContained) {
+  for (int index = 0; index < 1000; ++index) {
+    EXPECT_TRUE(bloom_filter.might_contain("key" + std::to_string(index)));
+  }
+}
+
+TEST_F(bloom_filter_test, FalsePositiveRateIsLow) {
+  int false_positives = 0;
+  for (int index = 0; index < 10000; ++index) {
+    false_positives += bloom_filter.might_contain("missing" + std::to_string(index));
+  }
+  // 10 bits per key result in roughly 1% false positives
+  EXPECT_LT(false_positives, 500);
+}
+
+TEST_F(bloom_filter_test, ClearRemovesAllKeys) {
+  bloom_filter.clear();
+  EXPECT_TRUE(bloom_filter.empty());
+  EXPECT_FALSE(bloom_filter.might_contain("key1"));
+}
+
+TEST_F(bloom_filter_test, MemoryUsageIsCacheLineMultiple) {
+  EXPECT_EQ(bloom_filter.memory_usage() % 64, 0);
+  EXPECT_GE(bloom_filter.memory_usage() * 8, 1000 * 10);
+}
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+#include <iterator>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "associative/duplicate_key.hpp"
+#include "associative/map/btree_map.hpp"
+#include "associative/map/value_not_found.hpp"
+
+class btree_map_test : public testing::Test {
+protected:
+  using key_t = int;
+  using value_t = std::string;
+  // Small nodes, so a few hundred keys already need several levels
+  using btree_map_t = containers::associative::btree_map<key_t, value_t, 4>;
+
+  static constexpr int number_keys = 500;
+
+  btree_map_t btree_map;
+
+  void SetUp() override {
+    btree_map.insert(20, "twenty");
+    btree_map.insert(10, "ten");
+    btree_map.insert(30, "thirty");
+  }
+
+  static std::vector<std::pair<key_t, value_t>> collect(const auto& range) {
+    auto pairs = std::vector<std::pair<key_t, value_t>>();
+    for (const auto& pair : range) {
+      pairs.push_back(pair);
+    }
+    return pairs;
+  }
+};
+
+static_assert(std::forward_iterator<containers::associative::btree_map<int, int>::iterator_t>);
+
+TEST_F(btree_map_test, CorrectContainerSize) {
+  EXPECT_EQ(btree_map.size(), 3);
+}
+
+TEST_F(btree_map_test, InsertDuplicateThrowsException) {
+  EXPECT_THROW(btree_map.insert(10, "other"), containers::associative::duplicate_key<key_t>);
+  EXPECT_EQ(btree_map.try_insert(10, "other").error(), containers::container_error::duplicate_key);
+  btree_map.insert_safely(10, "other");
+  EXPECT_EQ(btree_map.find_by_key(10), "ten");
+  EXPECT_EQ(btree_map.size(), 3);
+}
+
+TEST_F(btree_map_test, UpsertReplacesValue) {
+  btree_map.upsert(10, "TEN");
+  btree_map.upsert(40, "forty");
+  EXPECT_EQ(btree_map.find_by_key(10), "TEN");
+  EXPECT_EQ(btree_map.find_by_key_or_throw(40), "forty");
+  EXPECT_THROW(static_cast<void>(btree_map.find_by_key_or_throw(15)), containers::associative::value_not_found<key_t>);
+  EXPECT_EQ(btree_map.size(), 4);
+}
+
+TEST_F(btree_map_test, IteratesInKeyOrder) {
+  for (int key = number_keys; key > 30; --key) {
+    btree_map.insert(key, std::to_string(key));
+  }
+
+  auto previous = 0;
+  auto count = size_t{0};
+  for (auto iterator = btree_map.begin(); iterator != btree_map.end(); ++iterator) {
+    EXPECT_LT(previous, iterator.key());
+    previous = iterator.key();
+    ++count;
+  }
+  EXPECT_EQ(count, btree_map.size());
+}
+
+TEST_F(btree_map_test, BoundsAndRanges) {
+  EXPECT_EQ(btree_map.lower_bound(10).key(), 10);
+  EXPECT_EQ(btree_map.lower_bound(11).key(), 20);
+  EXPECT_EQ(btree_map.upper_bound(10).key(), 20);
+  EXPECT_EQ(btree_map.upper_bound(30), btree_map.end());
+  EXPECT_EQ(btree_map.lower_bound(5), btree_map.begin());
+
+  for (int key = 31; key < number_keys; ++key) {
+    btree_map.insert(key, std::to_string(key));
+  }
+  const auto pairs = collect(btree_map.range(100, 110));
+  ASSERT_EQ(pairs.size(), 10);
+  EXPECT_EQ(pairs.front(), std::make_pair(100, std::string("100")));
+  EXPECT_EQ(pairs.back().first, 109);
+
+  EXPECT_TRUE(btree_map.range(110, 100).empty());
+  EXPECT_EQ(collect(btree_map.range(0, 31)).size(), 3);
+  EXPECT_EQ(collect(btree_map.range(number_keys - 5, number_keys + 5)).size(), 5);
+}
+
+TEST_F(btree_map_test, FindBoundsThroughOrderedMap) {
+  const containers::associative::ordered_map<key_t, value_t>& ordered = btree_map;
+  EXPECT_EQ(ordered.find_lower_bound(10), std::make_pair(10, std::string("ten")));
+  EXPECT_EQ(ordered.find_lower_bound(11), std::make_pair(20, std::string("twenty")));
+  EXPECT_EQ(ordered.find_upper_bound(10), std::make_pair(20, std::string("twenty")));
+  EXPECT_EQ(ordered.find_upper_bound(30), std::nullopt);
+  EXPECT_EQ(ordered.find_lower_bound(31), std::nullopt);
+}
+
+TEST_F(btree_map_test, BuildFromSortedMatchesInserts) {
+  auto pairs = std::vector<std::pair<key_t, value_t>>();
+  for (int key = 0; key < number_keys; ++key) {
+    pairs.emplace_back(2 * key, std::to_string(key));
+  }
+  btree_map.build_from_sorted(pairs);
+
+  EXPECT_EQ(btree_map.size(), number_keys);
+  EXPECT_EQ(collect(btree_map), pairs);
+  EXPECT_EQ(btree_map.find_by_key(998), "499");
+  EXPECT_FALSE(btree_map.find_by_key(999).has_value());
+
+  // The bulk loaded tree is a regular tree, which updates split and merge as usual
+  for (int key = 0; key < number_keys; key += 2) {
+    btree_map.remove(2 * key);
+    btree_map.insert(2 * key + 1, "odd");
+  }
+  EXPECT_EQ(btree_map.size(), number_keys);
+  EXPECT_EQ(btree_map.lower_bound(1).value(), "odd");
+}
+
+TEST_F(btree_map_test, BuildFromSortedRejectsUnsortedInput) {
+  const auto unsorted = std::vector<std::pair<key_t, value_t>>{{1, "one"}, {3, "three"}, {2, "two"}};
+  const auto duplicate = std::vector<std::pair<key_t, value_t>>{{1, "one"}, {1, "uno"}};
+
+  EXPECT_THROW(btree_map.build_from_sorted(unsorted), std::invalid_argument);
+  EXPECT_THROW(btree_map.build_from_sorted(duplicate), containers::associative::duplicate_key<key_t>);
+  EXPECT_EQ(btree_map.size(), 3);
+  EXPECT_EQ(btree_map.find_by_key(20), "twenty");
+
+  btree_map.build_from_sorted(std::vector<std::pair<key_t, value_t>>());
+  EXPECT_TRUE(btree_map.empty());
+  EXPECT_EQ(btree_map.begin(), btree_map.end());
+}
+
+TEST_F(btree_map_test, BehavesLikeStdMap) {
+  auto generator = std::mt19937(42);
+  auto key = std::uniform_int_distribution<int>(0, 999);
+  auto operation = std::uniform_int_distribution<int>(0, 2);
+  auto expected = std::map<key_t, value_t>();
+  btree_map.clear();
+
+  for (int round = 0; round < 20000; ++round) {
+    const auto current = key(generator);
+    if (operation(generator) == 0) {
+      btree_map.remove(current);
+      expected.erase(current);
+    } else {
+      btree_map.upsert(current, std::to_string(round));
+      expected[current] = std::to_string(round);
+    }
+    ASSERT_EQ(btree_map.size(), expected.size());
+  }
+
+  EXPECT_EQ(collect(btree_map), collect(expected));
+  for (int current = 0; current < 1000; ++current) {
+    const auto found = expected.find(current);
+    EXPECT_EQ(btree_map.find_by_key(current), found == expected.end() ? std::nullopt : std::optional{found->second});
+  }
+
+  for (const auto& [current, value] : std::map(expected)) {
+    btree_map.remove(current);
+  }
+  EXPECT_TRUE(btree_map.empty());
+  EXPECT_EQ(btree_map.begin(), btree_map.end());
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "associative/set/btree_multi_set.hpp"
+
+class btree_multi_set_test : public testing::Test {
+protected:
+  using key_t = int;
+  // Small nodes, so a few hundred keys already need several levels
+  using btree_multi_set_t = containers::associative::btree_multi_set<key_t, 4>;
+
+  btree_multi_set_t btree_multi_set;
+
+  void SetUp() override {
+    btree_multi_set.insert(20);
+    btree_multi_set.insert(10);
+    btree_multi_set.insert(20);
+    btree_multi_set.insert(30);
+  }
+};
+
+TEST_F(btree_multi_set_test, CorrectContainerSize) {
+  EXPECT_EQ(btree_multi_set.size(), 4);
+}
+
+TEST_F(btree_multi_set_test, CountsRepeatedKeys) {
+  EXPECT_TRUE(btree_multi_set.exists(20));
+  EXPECT_FALSE(btree_multi_set.exists(15));
+  EXPECT_EQ(btree_multi_set.count(20), 2);
+  EXPECT_EQ(btree_multi_set.count(10), 1);
+  EXPECT_EQ(btree_multi_set.count(15), 0);
+}
+
+TEST_F(btree_multi_set_test, RemoveDeletesAllOccurrences) {
+  btree_multi_set.remove(20);
+  btree_multi_set.remove(15);
+  EXPECT_FALSE(btree_multi_set.exists(20));
+  EXPECT_EQ(btree_multi_set.size(), 2);
+}
+
+TEST_F(btree_multi_set_test, RemoveOneDeletesSingleOccurrence) {
+  btree_multi_set.remove_one(20);
+  EXPECT_EQ(btree_multi_set.count(20), 1);
+  btree_multi_set.remove_one(20);
+  btree_multi_set.remove_one(20);
+  EXPECT_FALSE(btree_multi_set.exists(20));
+  EXPECT_EQ(btree_multi_set.size(), 2);
+}
+
+TEST_F(btree_multi_set_test, RankAndSelectAreInverse) {
+  EXPECT_EQ(btree_multi_set.rank(5), 0);
+  EXPECT_EQ(btree_multi_set.rank(10), 0);
+  EXPECT_EQ(btree_multi_set.rank(20), 1);
+  EXPECT_EQ(btree_multi_set.rank(25), 3);
+  EXPECT_EQ(btree_multi_set.rank(35), 4);
+
+  EXPECT_EQ(btree_multi_set.select(0), 10);
+  EXPECT_EQ(btree_multi_set.select(1), 20);
+  EXPECT_EQ(btree_multi_set.select(2), 20);
+  EXPECT_EQ(btree_multi_set.select(3), 30);
+  EXPECT_THROW(static_cast<void>(btree_multi_set.select(4)), std::out_of_range);
+}
+
+TEST_F(btree_multi_set_test, CountRangeIsHalfOpen) {
+  EXPECT_EQ(btree_multi_set.count_range(10, 30), 3);
+  EXPECT_EQ(btree_multi_set.count_range(11, 31), 3);
+  EXPECT_EQ(btree_multi_set.count_range(20, 21), 2);
+  EXPECT_EQ(btree_multi_set.count_range(30, 10), 0);
+}
+
+TEST_F(btree_multi_set_test, PercentileUsesNearestRank) {
+  btree_multi_set.clear();
+  for (int key = 100; key >= 1; --key) {
+    btree_multi_set.insert(key);
+  }
+
+  EXPECT_EQ(btree_multi_set.percentile(0), 1);
+  EXPECT_EQ(btree_multi_set.percentile(50), 50);
+  EXPECT_EQ(btree_multi_set.percentile(99), 99);
+  EXPECT_EQ(btree_multi_set.percentile(99.5), 100);
+  EXPECT_EQ(btree_multi_set.percentile(100), 100);
+  EXPECT_THROW(static_cast<void>(btree_multi_set.percentile(101)), std::invalid_argument);
+
+  btree_multi_set.clear();
+  EXPECT_THROW(static_cast<void>(btree_multi_set.percentile(50)), std::out_of_range);
+}
+
+TEST_F(btree_multi_set_test, FindBoundsThroughOrderedMultiSet) {
+  const containers::associative::ordered_multi_set<key_t>& ordered = btree_multi_set;
+  EXPECT_EQ(ordered.find_lower_bound(20), 20);
+  EXPECT_EQ(ordered.find_lower_bound(11), 20);
+  EXPECT_EQ(ordered.find_upper_bound(20), 30);
+  EXPECT_EQ(ordered.find_upper_bound(30), std::nullopt);
+
+  for (int key = 40; key < 400; key += 2) {
+    btree_multi_set.insert(key);
+  }
+  for (int key = 40; key < 398; ++key) {
+    EXPECT_EQ(ordered.find_lower_bound(key), key % 2 == 0 ? key : key + 1);
+    EXPECT_EQ(ordered.find_upper_bound(key), key % 2 == 0 ? key + 2 : key + 1);
+  }
+}
+
+TEST_F(btree_multi_set_test, BehavesLikeSortedVector) {
+  auto generator = std::mt19937(42);
+  auto key = std::uniform_int_distribution<key_t>(0, 299);
+  auto operation = std::uniform_int_distribution<int>(0, 3);
+  auto expected = std::vector<key_t>({10, 20, 20, 30});
+
+  for (int round = 0; round < 20000; ++round) {
+    const auto current = key(generator);
+    const auto position = std::ranges::lower_bound(expected, current);
+    switch (operation(generator)) {
+      case 0:
+        btree_multi_set.remove_one(current);
+        if (position != expected.end() && *position == current) {
+          expected.erase(position);
+        }
+        break;
+      case 1:
+        EXPECT_EQ(btree_multi_set.rank(current), static_cast<size_t>(position - expected.begin()));
+        break;
+      default:
+        btree_multi_set.insert(current);
+        expected.insert(position, current);
+        break;
+    }
+    ASSERT_EQ(btree_multi_set.size(), expected.size());
+  }
+
+  for (size_t index = 0; index < expected.size(); ++index) {
+    EXPECT_EQ(btree_multi_set.select(index), expected[index]);
+  }
+  for (key_t current = 0; current < 300; ++current) {
+    btree_multi_set.remove(current);
+  }
+  EXPECT_TRUE(btree_multi_set.empty());
+}
\ No newline at end of file
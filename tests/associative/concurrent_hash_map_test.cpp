@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "associative/concurrent/concurrent_hash_map.hpp"
+
+class concurrent_hash_map_test : public testing::Test {
+protected:
+  using key_t = std::string;
+  using value_t = int;
+  using concurrent_hash_map_t = containers::associative::concurrent_hash_map<key_t, value_t>;
+
+  static constexpr int number_threads = 4;
+  static constexpr int keys_per_thread = 250;
+
+  concurrent_hash_map_t concurrent_hash_map;
+
+  concurrent_hash_map_test() : concurrent_hash_map(std::hash<key_t>(), 4) {}
+
+  void SetUp() override {
+    concurrent_hash_map.insert("key1", 1);
+    concurrent_hash_map.insert("key2", 2);
+    concurrent_hash_map.insert("key3", 3);
+  }
+
+  void run_on_threads(const std::function<void(int)>& action) {
+    auto threads = std::vector<std::thread>();
+    for (int thread = 0; thread < number_threads; ++thread) {
+      threads.emplace_back(action, thread);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+};
+
+TEST_F(concurrent_hash_map_test, CorrectContainerSize) {
+  EXPECT_EQ(concurrent_hash_map.size(), 3);
+  EXPECT_EQ(concurrent_hash_map.segment_count(), 4);
+}
+
+TEST_F(concurrent_hash_map_test, InsertDuplicateThrowsException) {
+  EXPECT_THROW(concurrent_hash_map.insert("key1", 10), containers::associative::duplicate_key<key_t>);
+  EXPECT_EQ(concurrent_hash_map.size(), 3);
+}
+
+TEST_F(concurrent_hash_map_test, InsertSafelyDoesNotThrow) {
+  EXPECT_NO_THROW(concurrent_hash_map.insert_safely("key1", 10));
+  EXPECT_EQ(concurrent_hash_map.find_by_key("key1"), 1);
+}
+
+TEST_F(concurrent_hash_map_test, UpsertReplacesValue) {
+  concurrent_hash_map.upsert("key1", 10);
+  concurrent_hash_map.upsert("key4", 4);
+  EXPECT_EQ(concurrent_hash_map.find_by_key("key1"), 10);
+  EXPECT_EQ(concurrent_hash_map.find_by_key("key4"), 4);
+  EXPECT_EQ(concurrent_hash_map.size(), 4);
+}
+
+TEST_F(concurrent_hash_map_test, FindByKeyOrThrowThrowsForNonExistingKey) {
+  EXPECT_EQ(concurrent_hash_map.find_by_key_or_throw("key2"), 2);
+  EXPECT_THROW(concurrent_hash_map.find_by_key_or_throw("nonexistent"), containers::associative::value_not_found<key_t>);
+}
+
+TEST_F(concurrent_hash_map_test, RemoveDeletesKeyValuePair) {
+  concurrent_hash_map.remove("key1");
+  concurrent_hash_map.remove("nonexistent");
+  EXPECT_FALSE(concurrent_hash_map.find_by_key("key1").has_value());
+  EXPECT_EQ(concurrent_hash_map.size(), 2);
+}
+
+TEST_F(concurrent_hash_map_test, ConcurrentInsertsAreAllVisible) {
+  run_on_threads([this](const int thread) {
+    for (int index = 0; index < keys_per_thread; ++index) {
+      concurrent_hash_map.insert(std::to_string(thread) + ":" + std::to_string(index), index);
+    }
+  });
+
+  EXPECT_EQ(concurrent_hash_map.size(), 3 + number_threads * keys_per_thread);
+  for (int thread = 0; thread < number_threads; ++thread) {
+    for (int index = 0; index < keys_per_thread; ++index) {
+      EXPECT_EQ(concurrent_hash_map.find_by_key(std::to_string(thread) + ":" + std::to_string(index)), index);
+    }
+  }
+}
+
+TEST_F(concurrent_hash_map_test, ConcurrentMixedOperationsKeepSizeConsistent) {
+  run_on_threads([this](const int thread) {
+    for (int index = 0; index < keys_per_thread; ++index) {
+      const auto key = "shared" + std::to_string(index);
+      concurrent_hash_map.upsert(key, thread);
+      concurrent_hash_map.find_by_key(key);
+      if (index % 2 == 0) {
+        concurrent_hash_map.remove(key);
+      }
+    }
+  });
+
+  size_t expected_size = 3;
+  for (int index = 0; index < keys_per_thread; ++index) {
+    expected_size += concurrent_hash_map.find_by_key("shared" + std::to_string(index)).has_value();
+  }
+  EXPECT_EQ(concurrent_hash_map.size(), expected_size);
+}
+
+TEST_F(concurrent_hash_map_test, TryInsertReportsDuplicateKey) {
+  EXPECT_TRUE(concurrent_hash_map.try_insert("key4", 4).has_value());
+  const auto duplicate = concurrent_hash_map.try_insert("key1", 10);
+
+  ASSERT_FALSE(duplicate.has_value());
+  EXPECT_EQ(duplicate.error(), containers::container_error::duplicate_key);
+  EXPECT_EQ(concurrent_hash_map.find_by_key("key1"), 1);
+  EXPECT_EQ(concurrent_hash_map.size(), 4);
+}
+
+TEST_F(concurrent_hash_map_test, SizeThroughBaseClassMatches) {
+  const containers::container& base = concurrent_hash_map;
+  EXPECT_EQ(base.size(), 3);
+  EXPECT_FALSE(base.empty());
+  concurrent_hash_map.remove("key1");
+  EXPECT_EQ(base.size(), 2);
+}
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+#include "associative/concurrent/concurrent_skip_list_set.hpp"
+
+class concurrent_skip_list_set_test : public testing::Test {
+protected:
+  using key_t = int;
+  using concurrent_skip_list_set_t = containers::associative::concurrent_skip_list_set<key_t>;
+
+  static constexpr int number_threads = 4;
+  static constexpr int keys_per_thread = 500;
+
+  concurrent_skip_list_set_t concurrent_skip_list_set;
+
+  void SetUp() override {
+    concurrent_skip_list_set.insert(30);
+    concurrent_skip_list_set.insert(10);
+    concurrent_skip_list_set.insert(20);
+  }
+
+  void run_on_threads(const std::function<void(int)>& action) {
+    auto threads = std::vector<std::thread>();
+    for (int thread = 0; thread < number_threads; ++thread) {
+      threads.emplace_back(action, thread);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  std::vector<key_t> keys() const {
+    return std::vector<key_t>(concurrent_skip_list_set.begin(), concurrent_skip_list_set.end());
+  }
+};
+
+TEST_F(concurrent_skip_list_set_test, CorrectContainerSize) {
+  EXPECT_EQ(concurrent_skip_list_set.size(), 3);
+  EXPECT_FALSE(concurrent_skip_list_set.empty());
+  EXPECT_EQ(static_cast<const containers::container&>(concurrent_skip_list_set).size(), 3);
+}
+
+TEST_F(concurrent_skip_list_set_test, InsertDuplicateThrowsException) {
+  EXPECT_THROW(concurrent_skip_list_set.insert(10), containers::associative::duplicate_key<key_t>);
+  EXPECT_NO_THROW(concurrent_skip_list_set.insert_safely(10));
+  EXPECT_EQ(concurrent_skip_list_set.size(), 3);
+}
+
+TEST_F(concurrent_skip_list_set_test, TryInsertReportsDuplicateKey) {
+  EXPECT_TRUE(concurrent_skip_list_set.try_insert(40).has_value());
+  const auto duplicate = concurrent_skip_list_set.try_insert(10);
+
+  ASSERT_FALSE(duplicate.has_value());
+  EXPECT_EQ(duplicate.error(), containers::container_error::duplicate_key);
+  EXPECT_EQ(concurrent_skip_list_set.size(), 4);
+}
+
+TEST_F(concurrent_skip_list_set_test, ExistsReturnsCorrectResult) {
+  EXPECT_TRUE(concurrent_skip_list_set.exists(10));
+  EXPECT_FALSE(concurrent_skip_list_set.exists(15));
+}
+
+TEST_F(concurrent_skip_list_set_test, RemoveDeletesKey) {
+  concurrent_skip_list_set.remove(10);
+  concurrent_skip_list_set.remove(15);
+  EXPECT_FALSE(concurrent_skip_list_set.exists(10));
+  EXPECT_TRUE(concurrent_skip_list_set.exists(20));
+  EXPECT_EQ(concurrent_skip_list_set.size(), 2);
+}
+
+TEST_F(concurrent_skip_list_set_test, IteratesKeysInOrder) {
+  static_assert(std::forward_iterator<concurrent_skip_list_set_t::iterator_t>);
+  for (int key = 100; key > 30; --key) {
+    concurrent_skip_list_set.insert(key);
+  }
+
+  const auto result = keys();
+  ASSERT_EQ(result.size(), 73);
+  EXPECT_TRUE(std::ranges::is_sorted(result));
+  EXPECT_EQ(result.front(), 10);
+  EXPECT_EQ(result.back(), 100);
+}
+
+TEST_F(concurrent_skip_list_set_test, LowerBoundFindsFirstKeyNotLess) {
+  EXPECT_EQ(*concurrent_skip_list_set.lower_bound(20), 20);
+  EXPECT_EQ(*concurrent_skip_list_set.lower_bound(11), 20);
+  EXPECT_EQ(*concurrent_skip_list_set.lower_bound(0), 10);
+  EXPECT_EQ(concurrent_skip_list_set.lower_bound(31), concurrent_skip_list_set.end());
+}
+
+TEST_F(concurrent_skip_list_set_test, FindBoundsThroughOrderedSet) {
+  const containers::associative::ordered_set<key_t>& ordered = concurrent_skip_list_set;
+  EXPECT_EQ(ordered.find_lower_bound(20), 20);
+  EXPECT_EQ(ordered.find_lower_bound(11), 20);
+  EXPECT_EQ(ordered.find_upper_bound(20), 30);
+  EXPECT_EQ(ordered.find_upper_bound(0), 10);
+  EXPECT_EQ(ordered.find_upper_bound(30), std::nullopt);
+
+  concurrent_skip_list_set.remove(30);
+  EXPECT_EQ(ordered.find_upper_bound(20), std::nullopt);
+}
+
+TEST_F(concurrent_skip_list_set_test, ConcurrentInsertsOfSameKeysAreDeduplicated) {
+  run_on_threads([this](int) {
+    for (int index = 0; index < keys_per_thread; ++index) {
+      concurrent_skip_list_set.insert_safely(1000 + index);
+    }
+  });
+
+  EXPECT_EQ(concurrent_skip_list_set.size(), 3 + keys_per_thread);
+  const auto result = keys();
+  EXPECT_EQ(result.size(), 3 + keys_per_thread);
+  EXPECT_TRUE(std::ranges::is_sorted(result));
+  EXPECT_EQ(std::ranges::adjacent_find(result), result.end());
+}
+
+TEST_F(concurrent_skip_list_set_test, ConcurrentInsertsAndRemovesKeepSizeConsistent) {
+  run_on_threads([this](const int thread) {
+    for (int index = 0; index < keys_per_thread; ++index) {
+      const auto key = 1000 + index * number_threads + thread;
+      concurrent_skip_list_set.insert(key);
+      if (index % 2 == 0) {
+        concurrent_skip_list_set.remove(key);
+      }
+      concurrent_skip_list_set.exists(1000 + index);
+    }
+  });
+
+  EXPECT_EQ(concurrent_skip_list_set.size(), 3 + number_threads * keys_per_thread / 2);
+  EXPECT_EQ(keys().size(), 3 + number_threads * keys_per_thread / 2);
+  for (int thread = 0; thread < number_threads; ++thread) {
+    for (int index = 0; index < keys_per_thread; ++index) {
+      const auto key = 1000 + index * number_threads + thread;
+      EXPECT_EQ(concurrent_skip_list_set.exists(key), index % 2 != 0);
+    }
+  }
+}
+
+TEST_F(concurrent_skip_list_set_test, IterationDuringWritesSeesStableKeysInOrder) {
+  auto done = std::atomic<bool>(false);
+  auto writer = std::thread([&] {
+    for (int round = 0; round < 20; ++round) {
+      for (int key = 11; key < 30; key += 2) {
+        concurrent_skip_list_set.insert_safely(key);
+      }
+      for (int key = 11; key < 30; key += 2) {
+        concurrent_skip_list_set.remove(key);
+      }
+    }
+    done = true;
+  });
+
+  while (!done) {
+    const auto result = keys();
+    EXPECT_TRUE(std::ranges::is_sorted(result));
+    EXPECT_EQ(std::ranges::adjacent_find(result), result.end());
+    EXPECT_EQ(std::ranges::count(result, 10) + std::ranges::count(result, 20) + std::ranges::count(result, 30), 3);
+  }
+  writer.join();
+  EXPECT_EQ(keys(), std::vector<key_t>({10, 20, 30}));
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <string>
+
+#include "associative/sketch/count_min_sketch.hpp"
+
+class count_min_sketch_test : public ::testing::Test {
+protected:
+  using key_t = std::string;
+  using count_min_sketch_t = containers::associative::count_min_sketch<key_t>;
+
+  count_min_sketch_t count_min_sketch;
+
+  count_min_sketch_test() : count_min_sketch(std::hash<key_t>(), 1024, 4) {}
+
+  void SetUp() override {
+    count_min_sketch.add("heavy", 1000);
+    for (int index = 0; index < 1000; ++index) {
+      count_min_sketch.add("key" + std::to_string(index));
+    }
+  }
+};
+
+TEST_F(count_min_sketch_test, SizeIsTotalCount) {
+  EXPECT_EQ(count_min_sketch.size(), 2000);
+}
+
+TEST_F(count_min_sketch_test, EstimateNeverUndercounts) {
+  EXPECT_GE(count_min_sketch.estimate("heavy"), 1000);
+  for (int index = 0; index < 1000; ++index) {
+    EXPECT_GE(count_min_sketch.estimate("key" + std::to_string(index)), 1);
+  }
+}
+
+TEST_F(count_min_sketch_test, EstimateIsCloseForHeavyHitter) {
+  EXPECT_LE(count_min_sketch.estimate("heavy"), 1010);
+}
+
+TEST_F(count_min_sketch_test, ConservativeUpdateDoesNotOvercountMore) {
+  auto plain = count_min_sketch_t(std::hash<key_t>(), 64, 2, false);
+  auto conservative = count_min_sketch_t(std::hash<key_t>(), 64, 2, true);
+  for (int index = 0; index < 1000; ++index) {
+    plain.add("key" + std::to_string(index));
+    conservative.add("key" + std::to_string(index));
+  }
+  for (int index = 0; index < 1000; ++index) {
+    const auto key = "key" + std::to_string(index);
+    EXPECT_LE(conservative.estimate(key), plain.estimate(key));
+  }
+}
+
+TEST_F(count_min_sketch_test, MergeAddsCounts) {
+  auto other = count_min_sketch_t(std::hash<key_t>(), 1024, 4);
+  other.add("heavy", 500);
+  count_min_sketch.merge(other);
+  EXPECT_GE(count_min_sketch.estimate("heavy"), 1500);
+  EXPECT_EQ(count_min_sketch.size(), 2500);
+}
+
+TEST_F(count_min_sketch_test, MergeWithDifferentDimensionsThrows) {
+  const auto other = count_min_sketch_t(std::hash<key_t>(), 512, 4);
+  EXPECT_THROW(count_min_sketch.merge(other), std::invalid_argument);
+}
+
+TEST_F(count_min_sketch_test, ClearResetsCounters) {
+  count_min_sketch.clear();
+  EXPECT_TRUE(count_min_sketch.empty());
+  EXPECT_EQ(count_min_sketch.estimate("heavy"), 0);
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <string>
+
+#include "associative/filter/cuckoo_filter.hpp"
+
+class cuckoo_filter_test : public ::testing::Test {
+protected:
+  using key_t = std::string;
+  using cuckoo_filter_t = containers::associative::cuckoo_filter<key_t>;
+
+  cuckoo_filter_t cuckoo_filter;
+
+  cuckoo_filter_test() : cuckoo_filter(std::hash<key_t>(), 1000) {}
+
+  void SetUp() override {
+    for (int index = 0; index < 1000; ++index) {
+      cuckoo_filter.insert("key" + std::to_string(index));
+    }
+  }
+};
+
+TEST_F(cuckoo_filter_test, CorrectContainerSize) {
+  EXPECT_EQ(cuckoo_filter.size(), 1000);
+}
+
+TEST_F(cuckoo_filter_test, InsertedKeysAreAlwaysContained) {
+  for (int index = 0; index < 1000; ++index) {
+    EXPECT_TRUE(cuckoo_filter.might_contain("key" + std::to_string(index)));
+  }
+}
+
+TEST_F(cuckoo_filter_test, FalsePositiveRateIsLow) {
+  int false_positives = 0;
+  for (int index = 0; index < 10000; ++index) {
+    false_positives += cuckoo_filter.might_contain("missing" + std::to_string(index));
+  }
+  EXPECT_LT(false_positives, 50);
+}
+
+TEST_F(cuckoo_filter_test, RemoveDeletesKey) {
+  EXPECT_TRUE(cuckoo_filter.remove("key1"));
+  EXPECT_FALSE(cuckoo_filter.might_contain("key1"));
+  EXPECT_EQ(cuckoo_filter.size(), 999);
+  EXPECT_TRUE(cuckoo_filter.might_contain("key2"));
+}
+
+TEST_F(cuckoo_filter_test, RemoveNonExistingKeyReturnsFalse) {
+  EXPECT_FALSE(cuckoo_filter.remove("nonexistent"));
+  EXPECT_EQ(cuckoo_filter.size(), 1000);
+}
+
+TEST_F(cuckoo_filter_test, InsertFailsWhenFull) {
+  auto small_filter = cuckoo_filter_t(std::hash<key_t>(), 8);
+  int index = 0;
+  while (small_filter.insert("key" + std::to_string(index))) {
+    ++index;
+  }
+  EXPECT_GT(small_filter.load_factor(), 0.5);
+  EXPECT_LE(small_filter.load_factor(), 1.0);
+  for (int inserted = 0; inserted < index; ++inserted) {
+    EXPECT_TRUE(small_filter.might_contain("key" + std::to_string(inserted)));
+  }
+}
\ No newline at end of file
@@ -0,0 +1,217 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <string>
+
+#include "associative/durable/durable_hash_map.hpp"
+
+class durable_hash_map_test : public testing::Test {
+protected:
+  using key_t = std::string;
+  using value_t = std::string;
+  using durable_hash_map_t = containers::associative::durable_hash_map<key_t, value_t>;
+
+  std::filesystem::path directory;
+
+  durable_hash_map_test() :
+    directory(std::filesystem::temp_directory_path() / (std::string("durable_hash_map_test_") + ::testing::UnitTest::GetInstance()->current_test_info()->name()))
+  {}
+
+  void SetUp() override {
+    std::filesystem::remove_all(directory);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(directory);
+  }
+};
+
+TEST_F(durable_hash_map_test, ReopenedMapHasSameContents) {
+  {
+    auto map = durable_hash_map_t(std::hash<key_t>(), directory);
+    map.insert("key1", "value1");
+    map.insert("key2", "value2");
+    map.insert_safely("key2", "ignored");
+    map.upsert("key3", "value3");
+    map.upsert("key1", "updated");
+    map.remove("key2");
+    map.remove("nonexistent");
+  }
+
+  const auto map = durable_hash_map_t(std::hash<key_t>(), directory);
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.find_by_key("key1"), "updated");
+  EXPECT_FALSE(map.find_by_key("key2").has_value());
+  EXPECT_EQ(map.find_by_key("key3"), "value3");
+}
+
+TEST_F(durable_hash_map_test, InsertDuplicateThrowsWithoutLogging) {
+  {
+    auto map = durable_hash_map_t(std::hash<key_t>(), directory);
+    map.insert("key", "value");
+    EXPECT_THROW(map.insert("key", "other"), containers::associative::duplicate_key<key_t>);
+  }
+
+  const auto map = durable_hash_map_t(std::hash<key_t>(), directory);
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_EQ(map.find_by_key_or_throw("key"), "value");
+}
+
+TEST_F(durable_hash_map_test, EveryDurabilityLevelRecovers) {
+  for (const auto level : {
+    containers::associative::durability_level::none,
+    containers::associative::durability_level::group_commit,
+    containers::associative::durability_level::every_operation
+  }) {
+    std::filesystem::remove_all(directory);
+    auto options = containers::associative::durability_options{};
+    options.level = level;
+    options.group_size = 3;
+    {
+      auto map = durable_hash_map_t(std::hash<key_t>(), directory, options);
+      for (int i = 0; i < 10; ++i) {
+        map.insert(std::to_string(i), std::to_string(i * i));
+      }
+    }
+
+    const auto map = durable_hash_map_t(std::hash<key_t>(), directory, options);
+    EXPECT_EQ(map.size(), 10);
+    EXPECT_EQ(map.find_by_key("9"), "81");
+  }
+}
+
+TEST_F(durable_hash_map_test, GroupCommitWritesRecordsBeforeGroupIsFull) {
+  auto options = containers::associative::durability_options{};
+  options.level = containers::associative::durability_level::group_commit;
+  options.group_size = 1000;
+  options.group_delay = std::chrono::hours(1);
+  auto map = durable_hash_map_t(std::hash<key_t>(), directory, options);
+  map.insert("key", "value");
+
+  // A copy taken while the map is open sees the log as a crash of the process leaves it
+  auto copy = directory;
+  copy += "_copy";
+  std::filesystem::remove_all(copy);
+  std::filesystem::copy(directory, copy);
+  {
+    const auto recovered = durable_hash_map_t(std::hash<key_t>(), copy, options);
+    EXPECT_EQ(recovered.size(), 1);
+    EXPECT_EQ(recovered.find_by_key("key"), "value");
+  }
+  std::filesystem::remove_all(copy);
+}
+
+TEST_F(durable_hash_map_test, CheckpointKeepsContentsAndEmptiesLog) {
+  {
+    auto map = durable_hash_map_t(std::hash<key_t>(), directory);
+    for (int i = 0; i < 100; ++i) {
+      map.insert(std::to_string(i), "value");
+    }
+    map.checkpoint();
+    EXPECT_EQ(std::filesystem::file_size(directory / "log"), sizeof(containers::associative::log_file_header));
+    map.remove("0");
+    map.upsert("1", "updated");
+  }
+
+  const auto map = durable_hash_map_t(std::hash<key_t>(), directory);
+  EXPECT_EQ(map.size(), 99);
+  EXPECT_FALSE(map.find_by_key("0").has_value());
+  EXPECT_EQ(map.find_by_key("1"), "updated");
+  EXPECT_EQ(map.find_by_key("99"), "value");
+}
+
+TEST_F(durable_hash_map_test, CheckpointIntervalBoundsLog) {
+  auto options = containers::associative::durability_options{};
+  options.checkpoint_interval = 16;
+  {
+    auto map = durable_hash_map_t(std::hash<key_t>(), directory, options);
+    for (int i = 0; i < 100; ++i) {
+      map.upsert(std::to_string(i % 10), std::to_string(i));
+    }
+  }
+  // The last checkpoint after 96 operations leaves 4 records in the log
+  EXPECT_LT(std::filesystem::file_size(directory / "log"), 5 * sizeof(containers::associative::log_record_header) + 100);
+
+  const auto map = durable_hash_map_t(std::hash<key_t>(), directory, options);
+  EXPECT_EQ(map.size(), 10);
+  EXPECT_EQ(map.find_by_key("9"), "99");
+  EXPECT_EQ(map.find_by_key("0"), "90");
+}
+
+TEST_F(durable_hash_map_test, TornRecordEndsLog) {
+  {
+    auto map = durable_hash_map_t(std::hash<key_t>(), directory);
+    map.insert("key1", "value1");
+    map.insert("key2", "value2");
+  }
+  // Cut the last record in half, as a crash in the middle of its write would
+  const auto log_size = std::filesystem::file_size(directory / "log");
+  std::filesystem::resize_file(directory / "log", log_size - 5);
+
+  {
+    auto map = durable_hash_map_t(std::hash<key_t>(), directory);
+    EXPECT_EQ(map.size(), 1);
+    EXPECT_EQ(map.find_by_key("key1"), "value1");
+    map.insert("key3", "value3");
+  }
+
+  const auto map = durable_hash_map_t(std::hash<key_t>(), directory);
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.find_by_key("key3"), "value3");
+}
+
+TEST_F(durable_hash_map_test, CorruptRecordEndsLog) {
+  {
+    auto map = durable_hash_map_t(std::hash<key_t>(), directory);
+    map.insert("key1", "value1");
+    map.insert("key2", "value2");
+  }
+  {
+    auto stream = std::fstream(directory / "log", std::ios::binary | std::ios::in | std::ios::out);
+    stream.seekp(-1, std::ios::end);
+    stream.put('x');
+  }
+
+  const auto map = durable_hash_map_t(std::hash<key_t>(), directory);
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_FALSE(map.find_by_key("key2").has_value());
+}
+
+TEST_F(durable_hash_map_test, CorruptCheckpointThrows) {
+  {
+    auto map = durable_hash_map_t(std::hash<key_t>(), directory);
+    map.insert("key", "value");
+    map.checkpoint();
+  }
+  std::filesystem::resize_file(directory / "checkpoint", std::filesystem::file_size(directory / "checkpoint") - 1);
+
+  EXPECT_THROW(durable_hash_map_t(std::hash<key_t>(), directory), containers::associative::durability_error);
+}
+
+TEST_F(durable_hash_map_test, TriviallyCopyableTypesRoundTrip) {
+  {
+    auto numbers = containers::associative::durable_hash_map<int, double>(std::hash<int>(), directory);
+    numbers.insert(1, 1.5);
+    numbers.upsert(2, 2.5);
+    numbers.checkpoint();
+    numbers.upsert(2, 3.5);
+  }
+
+  const auto numbers = containers::associative::durable_hash_map<int, double>(std::hash<int>(), directory);
+  EXPECT_EQ(numbers.find_by_key(1), 1.5);
+  EXPECT_EQ(numbers.find_by_key(2), 3.5);
+}
+
+TEST_F(durable_hash_map_test, TryInsertDuplicateIsNotLogged) {
+  {
+    auto map = durable_hash_map_t(std::hash<key_t>(), directory);
+    EXPECT_TRUE(map.try_insert("key", "value").has_value());
+    EXPECT_EQ(map.try_insert("key", "other").error(), containers::container_error::duplicate_key);
+  }
+
+  const auto map = durable_hash_map_t(std::hash<key_t>(), directory);
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_EQ(map.find_by_key_or_throw("key"), "value");
+}
\ No newline at end of file
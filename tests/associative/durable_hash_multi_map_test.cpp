@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "associative/durable/durable_hash_multi_map.hpp"
+
+class durable_hash_multi_map_test : public testing::Test {
+protected:
+  using key_t = std::string;
+  using value_t = int;
+  using durable_hash_multi_map_t = containers::associative::durable_hash_multi_map<key_t, value_t>;
+
+  std::filesystem::path directory;
+
+  durable_hash_multi_map_test() :
+    directory(std::filesystem::temp_directory_path() / (std::string("durable_hash_multi_map_test_") + ::testing::UnitTest::GetInstance()->current_test_info()->name()))
+  {}
+
+  void SetUp() override {
+    std::filesystem::remove_all(directory);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove_all(directory);
+  }
+};
+
+TEST_F(durable_hash_multi_map_test, ReopenedMultiMapHasSameValuesInOrder) {
+  {
+    auto map = durable_hash_multi_map_t(std::hash<key_t>(), directory);
+    map.insert("key1", 3);
+    map.insert("key1", 1);
+    map.insert("key1", 2);
+    map.insert("key2", 4);
+    map.insert("key3", 5);
+    map.remove("key1", 1);
+    map.remove_by_key("key2");
+    map.remove_by_key("nonexistent");
+  }
+
+  const auto map = durable_hash_multi_map_t(std::hash<key_t>(), directory);
+  EXPECT_EQ(map.size(), 3);
+  const auto values = map.values("key1");
+  EXPECT_EQ(std::vector(values.begin(), values.end()), (std::vector{3, 2}));
+  EXPECT_FALSE(map.exists_by_key("key2"));
+  EXPECT_TRUE(map.exists("key3", 5));
+}
+
+TEST_F(durable_hash_multi_map_test, CheckpointKeepsValuesInOrder) {
+  {
+    auto map = durable_hash_multi_map_t(std::hash<key_t>(), directory);
+    for (int i = 0; i < 50; ++i) {
+      map.insert(std::to_string(i % 5), i);
+    }
+    map.checkpoint();
+    map.insert("0", 100);
+  }
+
+  const auto map = durable_hash_multi_map_t(std::hash<key_t>(), directory);
+  EXPECT_EQ(map.size(), 51);
+  const auto values = map.values("0");
+  EXPECT_EQ(values.size(), 11);
+  EXPECT_EQ(values.front(), 0);
+  EXPECT_EQ(values[1], 5);
+  EXPECT_EQ(values.back(), 100);
+}
+
+TEST_F(durable_hash_multi_map_test, RecordsContainedInCheckpointAreNotReplayed) {
+  {
+    auto map = durable_hash_multi_map_t(std::hash<key_t>(), directory);
+    map.insert("key", 1);
+    map.insert("key", 2);
+    map.sync();
+    std::filesystem::copy_file(directory / "log", directory / "log.old");
+    map.checkpoint();
+  }
+  // A crash after the checkpoint has been renamed into place but before the log has been emptied
+  std::filesystem::rename(directory / "log.old", directory / "log");
+
+  {
+    auto map = durable_hash_multi_map_t(std::hash<key_t>(), directory);
+    EXPECT_EQ(map.count("key"), 2);
+    map.insert("key", 3);
+  }
+
+  const auto map = durable_hash_multi_map_t(std::hash<key_t>(), directory);
+  EXPECT_EQ(map.count("key"), 3);
+}
\ No newline at end of file
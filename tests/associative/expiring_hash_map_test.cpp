@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <random>
+#include <string>
+
+#include "associative/duplicate_key.hpp"
+#include "associative/map/expiring_hash_map.hpp"
+#include "associative/map/value_not_found.hpp"
+
+using namespace std::chrono_literals;
+
+class expiring_hash_map_test : public testing::Test {
+protected:
+  using key_t = int;
+  using value_t = std::string;
+  using expiring_hash_map_t = containers::associative::expiring_hash_map<key_t, value_t>;
+
+  expiring_hash_map_t::time_point_t time{};
+  expiring_hash_map_t map;
+
+  expiring_hash_map_test() : map(std::hash<key_t>(), 10s, 1ms, [this] {
+    return time;
+  }) {}
+
+  void SetUp() override {
+    map.insert(1, "one");
+    map.insert(2, "two", 5s);
+    map.insert(3, "three", 20s);
+  }
+};
+
+TEST_F(expiring_hash_map_test, ExpiredEntriesAreAbsent) {
+  EXPECT_EQ(map.find_by_key(1), "one");
+  EXPECT_EQ(map.time_to_live(2), 5s);
+
+  time += 5s;
+  EXPECT_FALSE(map.exists(2));
+  EXPECT_FALSE(map.time_to_live(2).has_value());
+  EXPECT_THROW(static_cast<void>(map.find_by_key_or_throw(2)), containers::associative::value_not_found<key_t>);
+  EXPECT_EQ(map.find_by_key_or_throw(1), "one");
+
+  // Lookups never remove, expire() does
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(map.expire(), 1);
+  EXPECT_EQ(map.size(), 2);
+}
+
+TEST_F(expiring_hash_map_test, WritesRemoveExpiredEntries) {
+  time += 15s;
+  map.upsert(4, "four");
+
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_TRUE(map.exists(3));
+  EXPECT_TRUE(map.exists(4));
+  EXPECT_EQ(map.expire(), 0);
+}
+
+TEST_F(expiring_hash_map_test, TouchExtendsTimeToLive) {
+  time += 4s;
+  EXPECT_TRUE(map.touch(2));
+  EXPECT_TRUE(map.touch(1, 30s));
+
+  // The records of the original expiry times are stale now
+  time += 8s;
+  EXPECT_EQ(map.expire(), 0);
+  EXPECT_EQ(map.find_by_key(2), "two");
+  EXPECT_EQ(map.time_to_live(2), 2s);
+
+  time += 2s;
+  EXPECT_FALSE(map.touch(2));
+  EXPECT_EQ(map.expire(), 0);
+  EXPECT_EQ(map.size(), 2);
+}
+
+TEST_F(expiring_hash_map_test, InsertReplacesExpiredEntryOnly) {
+  EXPECT_THROW(map.insert(1, "uno"), containers::associative::duplicate_key<key_t>);
+
+  time += 10s;
+  map.insert(1, "uno", 1s);
+  EXPECT_EQ(map.find_by_key(1), "uno");
+
+  time += 1s;
+  EXPECT_EQ(map.expire(), 1);
+  EXPECT_FALSE(map.exists(1));
+}
+
+TEST_F(expiring_hash_map_test, RemoveAndClear) {
+  EXPECT_TRUE(map.remove(1));
+  EXPECT_FALSE(map.remove(1));
+
+  time += 5s;
+  EXPECT_FALSE(map.remove(2));
+  EXPECT_EQ(map.size(), 1);
+
+  map.clear();
+  EXPECT_TRUE(map.empty());
+  time += 1h;
+  EXPECT_EQ(map.expire(), 0);
+}
+
+TEST_F(expiring_hash_map_test, TimeToLiveBeyondWheel) {
+  // 4 levels of 64 ticks of 1 ms cover less than 5 hours
+  map.upsert(4, "four", 50h);
+
+  time += 49h;
+  EXPECT_EQ(map.expire(), 3);
+  EXPECT_TRUE(map.exists(4));
+
+  time += 1h - 1ms;
+  EXPECT_EQ(map.expire(), 0);
+  time += 1ms;
+  EXPECT_EQ(map.expire(), 1);
+  EXPECT_TRUE(map.empty());
+}
+
+TEST_F(expiring_hash_map_test, ExpiresLikeFullSweep) {
+  auto generator = std::mt19937(42);
+  auto ttl = std::uniform_int_distribution<int>(1, 300000);
+  auto step = std::uniform_int_distribution<int>(0, 5000);
+  auto key = std::uniform_int_distribution<int>(0, 499);
+  auto expected = std::map<key_t, expiring_hash_map_t::time_point_t>();
+  map.clear();
+
+  for (int round = 0; round < 2000; ++round) {
+    time += std::chrono::milliseconds(step(generator));
+    const auto written = key(generator);
+    const auto lifetime = std::chrono::milliseconds(ttl(generator));
+    map.upsert(written, std::to_string(written), lifetime);
+
+    std::erase_if(expected, [this](const auto& entry) {
+      return entry.second <= time;
+    });
+    expected[written] = time + lifetime;
+    ASSERT_EQ(map.size(), expected.size());
+  }
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "associative/set/eytzinger_set.hpp"
+#include "associative/set/flat_ordered_set.hpp"
+
+class eytzinger_set_test : public testing::Test {
+protected:
+  using eytzinger_set_t = containers::associative::eytzinger_set<int>;
+};
+
+TEST_F(eytzinger_set_test, ContainsExactlyItsKeys) {
+  const auto set = eytzinger_set_t(std::vector<int>{30, 10, 20, 10, 40});
+  EXPECT_EQ(set.size(), 4);
+  EXPECT_TRUE(set.exists(10));
+  EXPECT_TRUE(set.exists(40));
+  EXPECT_FALSE(set.exists(15));
+  EXPECT_FALSE(set.exists(50));
+}
+
+TEST_F(eytzinger_set_test, LowerBoundFindsNextKey) {
+  const auto set = eytzinger_set_t(std::vector<int>{10, 20, 30, 40});
+  EXPECT_EQ(set.lower_bound(5), 10);
+  EXPECT_EQ(set.lower_bound(10), 10);
+  EXPECT_EQ(set.lower_bound(11), 20);
+  EXPECT_EQ(set.lower_bound(40), 40);
+  EXPECT_FALSE(set.lower_bound(41).has_value());
+}
+
+TEST_F(eytzinger_set_test, EmptySet) {
+  const auto set = eytzinger_set_t(std::vector<int>());
+  EXPECT_TRUE(set.empty());
+  EXPECT_FALSE(set.exists(0));
+  EXPECT_FALSE(set.lower_bound(0).has_value());
+}
+
+TEST_F(eytzinger_set_test, FreezeKeepsKeysOfFlatOrderedSet) {
+  auto flat = containers::associative::flat_ordered_set<std::string>();
+  flat.insert_batch(std::vector<std::string>{"pear", "apple", "fig", "banana"});
+  const auto frozen = flat.freeze();
+
+  EXPECT_EQ(frozen.size(), 4);
+  EXPECT_TRUE(frozen.exists("fig"));
+  EXPECT_FALSE(frozen.exists("grape"));
+  EXPECT_EQ(frozen.lower_bound("c"), "fig");
+  EXPECT_EQ(frozen.lower_bound("apple"), "apple");
+  EXPECT_FALSE(frozen.lower_bound("plum").has_value());
+}
+
+TEST_F(eytzinger_set_test, MatchesBinarySearchForAllSizes) {
+  auto generator = std::mt19937(42);
+  for (int size = 0; size < 300; ++size) {
+    auto keys = std::vector<int>(size);
+    std::ranges::generate(keys, [&generator] { return static_cast<int>(generator() % 1000); });
+    const auto set = eytzinger_set_t(keys);
+    std::ranges::sort(keys);
+    keys.erase(std::ranges::unique(keys).begin(), keys.end());
+    ASSERT_EQ(set.size(), keys.size());
+
+    for (int key = -1; key <= 1000; ++key) {
+      const auto expected = std::ranges::lower_bound(keys, key);
+      ASSERT_EQ(set.lower_bound(key), expected == keys.end() ? std::nullopt : std::optional{*expected});
+      ASSERT_EQ(set.exists(key), std::ranges::binary_search(keys, key));
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "associative/duplicate_key.hpp"
+#include "associative/map/flat_ordered_map.hpp"
+#include "associative/map/value_not_found.hpp"
+
+class flat_ordered_map_test : public testing::Test {
+protected:
+  using key_t = int;
+  using value_t = std::string;
+  using flat_ordered_map_t = containers::associative::flat_ordered_map<key_t, value_t>;
+
+  flat_ordered_map_t flat_ordered_map;
+
+  void SetUp() override {
+    flat_ordered_map.insert(20, "twenty");
+    flat_ordered_map.insert(10, "ten");
+    flat_ordered_map.insert(30, "thirty");
+  }
+
+  static std::vector<std::pair<key_t, value_t>> collect(const auto& range) {
+    auto pairs = std::vector<std::pair<key_t, value_t>>();
+    for (const auto& pair : range) {
+      pairs.push_back(pair);
+    }
+    return pairs;
+  }
+};
+
+static_assert(std::forward_iterator<containers::associative::flat_ordered_map<int, int>::iterator_t>);
+
+TEST_F(flat_ordered_map_test, CorrectContainerSize) {
+  EXPECT_EQ(flat_ordered_map.size(), 3);
+}
+
+TEST_F(flat_ordered_map_test, InsertDuplicateThrowsException) {
+  EXPECT_THROW(flat_ordered_map.insert(10, "other"), containers::associative::duplicate_key<key_t>);
+  EXPECT_EQ(flat_ordered_map.try_insert(10, "other").error(), containers::container_error::duplicate_key);
+  flat_ordered_map.insert_safely(10, "other");
+  EXPECT_EQ(flat_ordered_map.find_by_key(10), "ten");
+  EXPECT_EQ(flat_ordered_map.size(), 3);
+}
+
+TEST_F(flat_ordered_map_test, UpsertReplacesValue) {
+  flat_ordered_map.upsert(10, "TEN");
+  flat_ordered_map.upsert(40, "forty");
+  EXPECT_EQ(flat_ordered_map.find_by_key(10), "TEN");
+  EXPECT_EQ(flat_ordered_map.find_by_key_or_throw(40), "forty");
+  EXPECT_THROW(static_cast<void>(flat_ordered_map.find_by_key_or_throw(15)), containers::associative::value_not_found<key_t>);
+  EXPECT_EQ(flat_ordered_map.size(), 4);
+}
+
+TEST_F(flat_ordered_map_test, KeysAndValuesAreSeparateSortedArrays) {
+  flat_ordered_map.remove(20);
+  flat_ordered_map.remove(25);
+  flat_ordered_map.insert(5, "five");
+
+  EXPECT_EQ(std::vector(flat_ordered_map.keys().begin(), flat_ordered_map.keys().end()), std::vector<key_t>({5, 10, 30}));
+  EXPECT_EQ(std::vector(flat_ordered_map.values().begin(), flat_ordered_map.values().end()), std::vector<value_t>({"five", "ten", "thirty"}));
+  EXPECT_EQ(flat_ordered_map.size(), 3);
+}
+
+TEST_F(flat_ordered_map_test, BoundsFollowKeyOrder) {
+  EXPECT_EQ(flat_ordered_map.lower_bound(10).key(), 10);
+  EXPECT_EQ(flat_ordered_map.lower_bound(11).key(), 20);
+  EXPECT_EQ(flat_ordered_map.upper_bound(10).value(), "twenty");
+  EXPECT_EQ(flat_ordered_map.upper_bound(30), flat_ordered_map.end());
+  EXPECT_EQ(flat_ordered_map.lower_bound(5), flat_ordered_map.begin());
+  EXPECT_EQ(std::distance(flat_ordered_map.begin(), flat_ordered_map.end()), 3);
+}
+
+TEST_F(flat_ordered_map_test, FindBoundsThroughOrderedMap) {
+  const containers::associative::ordered_map<key_t, value_t>& ordered = flat_ordered_map;
+  EXPECT_EQ(ordered.find_lower_bound(10), std::make_pair(10, std::string("ten")));
+  EXPECT_EQ(ordered.find_lower_bound(11), std::make_pair(20, std::string("twenty")));
+  EXPECT_EQ(ordered.find_upper_bound(20), std::make_pair(30, std::string("thirty")));
+  EXPECT_EQ(ordered.find_upper_bound(30), std::nullopt);
+}
+
+TEST_F(flat_ordered_map_test, ConstructsFromUnsortedPairs) {
+  const auto pairs = std::vector<std::pair<key_t, value_t>>{{3, "three"}, {1, "one"}, {2, "two"}, {1, "uno"}, {3, "tres"}};
+  const auto constructed = flat_ordered_map_t(pairs);
+
+  EXPECT_EQ(collect(constructed), (std::vector<std::pair<key_t, value_t>>{{1, "one"}, {2, "two"}, {3, "three"}}));
+  EXPECT_EQ(constructed.size(), 3);
+  EXPECT_TRUE(flat_ordered_map_t(std::vector<std::pair<key_t, value_t>>()).empty());
+}
+
+TEST_F(flat_ordered_map_test, InsertBatchKeepsExistingValues) {
+  flat_ordered_map.insert_batch(std::map<key_t, value_t>{{40, "forty"}, {5, "five"}, {20, "other"}});
+  flat_ordered_map.insert_batch(std::vector<std::pair<key_t, value_t>>{{25, "twenty-five"}, {15, "fifteen"}, {25, "other"}});
+
+  EXPECT_EQ(collect(flat_ordered_map), (std::vector<std::pair<key_t, value_t>>{
+    {5, "five"}, {10, "ten"}, {15, "fifteen"}, {20, "twenty"}, {25, "twenty-five"}, {30, "thirty"}, {40, "forty"}
+  }));
+  EXPECT_EQ(flat_ordered_map.size(), 7);
+}
+
+TEST_F(flat_ordered_map_test, BehavesLikeStdMap) {
+  auto generator = std::mt19937(42);
+  auto key = std::uniform_int_distribution<int>(0, 999);
+  auto operation = std::uniform_int_distribution<int>(0, 3);
+  auto expected = std::map<key_t, value_t>();
+  flat_ordered_map.clear();
+
+  for (int round = 0; round < 20000; ++round) {
+    const auto current = key(generator);
+    switch (operation(generator)) {
+      case 0:
+        flat_ordered_map.remove(current);
+        expected.erase(current);
+        break;
+      case 1: {
+        auto batch = std::vector<std::pair<key_t, value_t>>();
+        for (int offset = 0; offset < 5; ++offset) {
+          batch.emplace_back((current * 7 + offset * 131) % 1000, std::to_string(round));
+        }
+        flat_ordered_map.insert_batch(batch);
+        expected.insert(batch.begin(), batch.end());
+        break;
+      }
+      default:
+        flat_ordered_map.upsert(current, std::to_string(round));
+        expected[current] = std::to_string(round);
+        break;
+    }
+    ASSERT_EQ(flat_ordered_map.size(), expected.size());
+  }
+
+  EXPECT_EQ(collect(flat_ordered_map), collect(expected));
+  for (int current = 0; current < 1000; ++current) {
+    const auto found = expected.find(current);
+    EXPECT_EQ(flat_ordered_map.find_by_key(current), found == expected.end() ? std::nullopt : std::optional{found->second});
+  }
+}
\ No newline at end of file
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <set>
+#include <vector>
+
+#include "associative/duplicate_key.hpp"
+#include "associative/set/flat_ordered_set.hpp"
+
+class flat_ordered_set_test : public testing::Test {
+protected:
+  using key_t = int;
+  using flat_ordered_set_t = containers::associative::flat_ordered_set<key_t>;
+
+  flat_ordered_set_t flat_ordered_set;
+
+  void SetUp() override {
+    flat_ordered_set.insert(20);
+    flat_ordered_set.insert(10);
+    flat_ordered_set.insert(30);
+  }
+
+  static std::vector<key_t> collect(const auto& range) {
+    return std::vector<key_t>(range.begin(), range.end());
+  }
+};
+
+TEST_F(flat_ordered_set_test, CorrectContainerSize) {
+  EXPECT_EQ(flat_ordered_set.size(), 3);
+}
+
+TEST_F(flat_ordered_set_test, InsertDuplicateThrowsException) {
+  EXPECT_THROW(flat_ordered_set.insert(10), containers::associative::duplicate_key<key_t>);
+  EXPECT_EQ(flat_ordered_set.try_insert(10).error(), containers::container_error::duplicate_key);
+  EXPECT_TRUE(flat_ordered_set.try_insert(15).has_value());
+  flat_ordered_set.insert_safely(10);
+  EXPECT_EQ(flat_ordered_set.size(), 4);
+}
+
+TEST_F(flat_ordered_set_test, RemoveKeepsKeysSorted) {
+  flat_ordered_set.remove(20);
+  flat_ordered_set.remove(25);
+  EXPECT_FALSE(flat_ordered_set.exists(20));
+  EXPECT_TRUE(flat_ordered_set.exists(30));
+  EXPECT_EQ(collect(flat_ordered_set.keys()), std::vector<key_t>({10, 30}));
+  EXPECT_EQ(flat_ordered_set.size(), 2);
+}
+
+TEST_F(flat_ordered_set_test, BoundsFollowKeyOrder) {
+  EXPECT_EQ(*flat_ordered_set.lower_bound(10), 10);
+  EXPECT_EQ(*flat_ordered_set.lower_bound(11), 20);
+  EXPECT_EQ(*flat_ordered_set.upper_bound(10), 20);
+  EXPECT_EQ(flat_ordered_set.upper_bound(30), flat_ordered_set.end());
+  EXPECT_EQ(flat_ordered_set.lower_bound(5), flat_ordered_set.begin());
+}
+
+TEST_F(flat_ordered_set_test, FindBoundsThroughOrderedSet) {
+  const containers::associative::ordered_set<key_t>& ordered = flat_ordered_set;
+  EXPECT_EQ(ordered.find_lower_bound(10), 10);
+  EXPECT_EQ(ordered.find_lower_bound(11), 20);
+  EXPECT_EQ(ordered.find_upper_bound(20), 30);
+  EXPECT_EQ(ordered.find_upper_bound(30), std::nullopt);
+}
+
+TEST_F(flat_ordered_set_test, ConstructsFromUnsortedKeys) {
+  const auto constructed = flat_ordered_set_t(std::vector<key_t>{3, 1, 2, 3, 1});
+  EXPECT_EQ(collect(constructed), std::vector<key_t>({1, 2, 3}));
+  EXPECT_EQ(constructed.size(), 3);
+}
+
+TEST_F(flat_ordered_set_test, InsertBatchMergesKeys) {
+  flat_ordered_set.insert_batch(std::vector<key_t>{40, 5, 20, 5, 15});
+  EXPECT_EQ(collect(flat_ordered_set), std::vector<key_t>({5, 10, 15, 20, 30, 40}));
+  EXPECT_EQ(flat_ordered_set.size(), 6);
+}
+
+TEST_F(flat_ordered_set_test, BehavesLikeStdSet) {
+  auto generator = std::mt19937(42);
+  auto key = std::uniform_int_distribution<int>(0, 999);
+  auto operation = std::uniform_int_distribution<int>(0, 3);
+  auto expected = std::set<key_t>();
+  flat_ordered_set.clear();
+
+  for (int round = 0; round < 20000; ++round) {
+    const auto current = key(generator);
+    switch (operation(generator)) {
+      case 0:
+        flat_ordered_set.remove(current);
+        expected.erase(current);
+        break;
+      case 1: {
+        const auto batch = std::vector<key_t>{current, (current * 7) % 1000, current, (current + 500) % 1000};
+        flat_ordered_set.insert_batch(batch);
+        expected.insert(batch.begin(), batch.end());
+        break;
+      }
+      default:
+        flat_ordered_set.insert_safely(current);
+        expected.insert(current);
+        break;
+    }
+    ASSERT_EQ(flat_ordered_set.size(), expected.size());
+  }
+
+  EXPECT_EQ(collect(flat_ordered_set), collect(expected));
+  for (int current = 0; current < 1000; ++current) {
+    EXPECT_EQ(flat_ordered_set.exists(current), expected.contains(current));
+  }
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "associative/set/front_coded_string_set.hpp"
+#include "associative/snapshot/snapshot_error.hpp"
+
+class front_coded_string_set_test : public testing::Test {
+protected:
+  using front_coded_string_set_t = containers::associative::front_coded_string_set;
+
+  // Small blocks, so a few strings already span several of them
+  front_coded_string_set_t set{std::vector<std::string>{
+    "https://example.com/b", "https://example.com/a", "https://example.com/a/1", "https://example.org", "", "https://example.com/a"
+  }, 2};
+  std::string path = (std::filesystem::temp_directory_path() / (std::string("front_coded_string_set_test_") + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".set")).string();
+
+  void TearDown() override {
+    std::filesystem::remove(path);
+  }
+
+  static std::vector<std::string> collect(const front_coded_string_set_t& set) {
+    return std::vector<std::string>(set.begin(), set.end());
+  }
+};
+
+static_assert(std::forward_iterator<containers::associative::front_coded_string_set::iterator_t>);
+
+TEST_F(front_coded_string_set_test, StoresSortedDistinctStrings) {
+  EXPECT_EQ(set.size(), 5);
+  EXPECT_EQ(set.block_size(), 2);
+  EXPECT_EQ(collect(set), (std::vector<std::string>{
+    "", "https://example.com/a", "https://example.com/a/1", "https://example.com/b", "https://example.org"
+  }));
+}
+
+TEST_F(front_coded_string_set_test, ExistsOnlyForStoredStrings) {
+  EXPECT_TRUE(set.exists(""));
+  EXPECT_TRUE(set.exists("https://example.com/a/1"));
+  EXPECT_TRUE(set.exists("https://example.org"));
+  EXPECT_FALSE(set.exists("https://example.com/"));
+  EXPECT_FALSE(set.exists("https://example.com/a/"));
+  EXPECT_FALSE(set.exists("https://example.org/"));
+}
+
+TEST_F(front_coded_string_set_test, LowerBoundRankAndSelect) {
+  EXPECT_EQ(*set.lower_bound("https://example.com/a/"), "https://example.com/a/1");
+  EXPECT_EQ(*set.lower_bound("https://example.com/a/2"), "https://example.com/b");
+  EXPECT_EQ(set.lower_bound("z"), set.end());
+  EXPECT_EQ(set.lower_bound(""), set.begin());
+  EXPECT_EQ(std::distance(set.lower_bound("https://example.com/b"), set.end()), 2);
+
+  EXPECT_EQ(set.rank(""), 0);
+  EXPECT_EQ(set.rank("https://example.com/b"), 3);
+  EXPECT_EQ(set.rank("z"), 5);
+  EXPECT_EQ(set.select(3), "https://example.com/b");
+  EXPECT_EQ(set.select(0), "");
+  EXPECT_THROW(static_cast<void>(set.select(5)), std::out_of_range);
+}
+
+TEST_F(front_coded_string_set_test, EmptySet) {
+  const auto empty = front_coded_string_set_t(std::vector<std::string>());
+  EXPECT_TRUE(empty.empty());
+  EXPECT_FALSE(empty.exists(""));
+  EXPECT_EQ(empty.rank("a"), 0);
+  EXPECT_EQ(empty.begin(), empty.end());
+  EXPECT_EQ(empty.lower_bound(""), empty.end());
+  EXPECT_THROW(front_coded_string_set_t(std::vector<std::string>(), 0), std::invalid_argument);
+}
+
+TEST_F(front_coded_string_set_test, OpenedFileHasSameContents) {
+  set.save(path);
+  EXPECT_EQ(std::filesystem::file_size(path), set.size_in_bytes());
+
+  const auto mapped = front_coded_string_set_t::open(path);
+  EXPECT_EQ(mapped.size(), 5);
+  EXPECT_EQ(collect(mapped), collect(set));
+  EXPECT_TRUE(mapped.exists("https://example.com/a"));
+  EXPECT_EQ(mapped.rank("https://example.com/a/2"), 3);
+}
+
+TEST_F(front_coded_string_set_test, OpenRejectsOtherFiles) {
+  EXPECT_THROW(front_coded_string_set_t::open(path), containers::associative::snapshot_error);
+  {
+    auto stream = std::ofstream(path, std::ios::binary);
+    stream << std::string(200, 'x');
+  }
+  EXPECT_THROW(front_coded_string_set_t::open(path), containers::associative::snapshot_error);
+
+  set.save(path);
+  std::filesystem::resize_file(path, set.size_in_bytes() - 1);
+  EXPECT_THROW(front_coded_string_set_t::open(path), containers::associative::snapshot_error);
+}
+
+TEST_F(front_coded_string_set_test, BehavesLikeSortedVector) {
+  auto generator = std::mt19937(42);
+  auto letter = std::uniform_int_distribution<int>('a', 'd');
+  auto length = std::uniform_int_distribution<int>(0, 8);
+  auto keys = std::vector<std::string>(2000);
+  for (auto& key : keys) {
+    key.resize(length(generator));
+    std::ranges::generate(key, [&] { return static_cast<char>(letter(generator)); });
+  }
+
+  for (const auto& block_size : {size_t{1}, size_t{3}, size_t{16}, size_t{64}}) {
+    const auto built = front_coded_string_set_t(keys, block_size);
+    auto expected = keys;
+    std::ranges::sort(expected);
+    expected.erase(std::ranges::unique(expected).begin(), expected.end());
+    ASSERT_EQ(collect(built), expected);
+
+    for (int round = 0; round < 500; ++round) {
+      auto key = std::string(length(generator), ' ');
+      std::ranges::generate(key, [&] { return static_cast<char>(letter(generator)); });
+      const auto position = std::ranges::lower_bound(expected, key);
+      const auto rank = static_cast<size_t>(position - expected.begin());
+      ASSERT_EQ(built.rank(key), rank);
+      ASSERT_EQ(built.exists(key), position != expected.end() && *position == key);
+      const auto found = built.lower_bound(key);
+      ASSERT_EQ(found == built.end() ? expected.end() : std::ranges::find(expected, *found), position);
+      if (rank < expected.size()) {
+        ASSERT_EQ(built.select(rank), expected[rank]);
+      }
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "associative/map/frozen_map.hpp"
+
+namespace {
+  using country_t = std::pair<std::string_view, int>;
+
+  constexpr auto dialing_codes = containers::associative::frozen_map(std::to_array<country_t>({
+    {"DE", 49}, {"FR", 33}, {"IT", 39}, {"NL", 31}, {"US", 1}, {"GB", 44}, {"JP", 81}
+  }));
+
+  static_assert(dialing_codes.find_by_key_or_throw("DE") == 49);
+  static_assert(dialing_codes.find_by_key("US") == 1);
+  static_assert(!dialing_codes.find_by_key("XX").has_value());
+}
+
+class frozen_map_test : public testing::Test {
+protected:
+  using frozen_map_t = containers::associative::frozen_map<std::string, int>;
+};
+
+TEST_F(frozen_map_test, ConstexprMapFindsValues) {
+  EXPECT_EQ(dialing_codes.size(), 7);
+  EXPECT_EQ(dialing_codes.find_by_key("JP"), 81);
+  EXPECT_TRUE(dialing_codes.exists("GB"));
+  EXPECT_FALSE(dialing_codes.exists("ES"));
+  EXPECT_THROW(static_cast<void>(dialing_codes.find_by_key_or_throw("ES")), containers::associative::value_not_found<std::string_view>);
+}
+
+TEST_F(frozen_map_test, RuntimeMapFindsValues) {
+  auto pairs = std::vector<std::pair<std::string, int>>();
+  for (int i = 0; i < 10000; ++i) {
+    pairs.emplace_back("key" + std::to_string(i), i);
+  }
+  const auto map = frozen_map_t(pairs);
+  EXPECT_EQ(map.size(), 10000);
+  for (int i = 0; i < 10000; ++i) {
+    EXPECT_EQ(map.find_by_key("key" + std::to_string(i)), i);
+  }
+  EXPECT_FALSE(map.find_by_key("key10000").has_value());
+}
+
+TEST_F(frozen_map_test, DuplicateKeyThrows) {
+  const auto pairs = std::vector<std::pair<std::string, int>>{{"a", 1}, {"b", 2}, {"a", 3}};
+  EXPECT_THROW(frozen_map_t{pairs}, containers::associative::duplicate_key<std::string>);
+}
+
+TEST_F(frozen_map_test, DistinctKeysWithSameHashThrow) {
+  struct constant_hash {
+    constexpr std::uint64_t operator()(const int&) const noexcept {
+      return 0;
+    }
+  };
+  const auto pairs = std::vector<std::pair<int, int>>{{1, 1}, {2, 2}};
+  EXPECT_THROW((containers::associative::frozen_map<int, int, std::dynamic_extent, constant_hash>(pairs)), containers::associative::perfect_hash_error);
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "associative/set/frozen_set.hpp"
+
+namespace {
+  constexpr auto keywords = containers::associative::frozen_set(std::to_array<std::string_view>({
+    "if", "else", "for", "while", "do", "return", "break", "continue", "switch", "case", "default", "goto"
+  }));
+
+  static_assert(keywords.exists("while"));
+  static_assert(keywords.exists("goto"));
+  static_assert(!keywords.exists("whilst"));
+  static_assert(!keywords.exists(""));
+}
+
+class frozen_set_test : public testing::Test {
+protected:
+  using frozen_set_t = containers::associative::frozen_set<int>;
+};
+
+TEST_F(frozen_set_test, ConstexprSetContainsItsKeys) {
+  EXPECT_EQ(keywords.size(), 12);
+  for (const auto& keyword : {"if", "else", "for", "while", "do", "return", "break", "continue", "switch", "case", "default", "goto"}) {
+    EXPECT_TRUE(keywords.exists(keyword));
+  }
+  EXPECT_FALSE(keywords.exists("iff"));
+}
+
+TEST_F(frozen_set_test, RuntimeSetContainsExactlyItsKeys) {
+  auto keys = std::vector<int>();
+  for (int i = 0; i < 10000; ++i) {
+    keys.push_back(i * 3);
+  }
+  const auto set = frozen_set_t(keys);
+  EXPECT_EQ(set.size(), 10000);
+  for (int i = 0; i < 30000; ++i) {
+    EXPECT_EQ(set.exists(i), i % 3 == 0);
+  }
+}
+
+TEST_F(frozen_set_test, IteratesAllKeysOnce) {
+  const auto set = containers::associative::frozen_set<std::string>(std::vector<std::string>{"a", "b", "c"});
+  auto keys = std::vector<std::string>(set.begin(), set.end());
+  std::ranges::sort(keys);
+  EXPECT_EQ(keys, (std::vector<std::string>{"a", "b", "c"}));
+}
+
+TEST_F(frozen_set_test, EmptySetContainsNothing) {
+  const auto set = frozen_set_t(std::vector<int>());
+  EXPECT_TRUE(set.empty());
+  EXPECT_FALSE(set.exists(0));
+}
+
+TEST_F(frozen_set_test, DuplicateKeyThrows) {
+  EXPECT_THROW(frozen_set_t(std::vector{1, 2, 1}), containers::associative::duplicate_key<int>);
+}
\ No newline at end of file
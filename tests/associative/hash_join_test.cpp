@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "associative/join/hash_join.hpp"
+
+class hash_join_test : public ::testing::Test {
+protected:
+  using key_t = std::string;
+  using value_t = int;
+  using hash_join_t = containers::associative::hash_join<key_t, value_t>;
+  using join_mode = containers::associative::join_mode;
+
+  const std::vector<std::pair<key_t, value_t>> build_rows{
+    {"a", 1}, {"b", 2}, {"a", 3}, {"c", 4}
+  };
+  const std::vector<key_t> probe_keys{"a", "x", "c", "a", "y"};
+
+  hash_join_t create_join(const join_mode mode) const {
+    // A batch size of 2 makes sure probes span several batches
+    auto join = hash_join_t(std::hash<key_t>(), mode, 2);
+    join.build(build_rows);
+    return join;
+  }
+};
+
+TEST_F(hash_join_test, BuildInsertsAllRows) {
+  const auto join = create_join(join_mode::inner);
+  EXPECT_EQ(join.build_side().size(), 4);
+  EXPECT_EQ(join.build_side().count("a"), 2);
+}
+
+TEST_F(hash_join_test, BuildWithDistinctKeyEstimate) {
+  auto join = hash_join_t(std::hash<key_t>());
+  join.build(build_rows, 3);
+  EXPECT_EQ(join.build_side().size(), 4);
+  EXPECT_EQ(join.build_side().count("a"), 2);
+  EXPECT_EQ(join.build_side().count("c"), 1);
+}
+
+TEST_F(hash_join_test, InnerJoinEmitsEveryMatch) {
+  const auto join = create_join(join_mode::inner);
+  containers::associative::join_result<value_t> result;
+  join.probe(probe_keys, result);
+
+  EXPECT_EQ(result.probe_indices, (std::vector<size_t>{0, 0, 2, 3, 3}));
+  EXPECT_EQ(result.values, (std::vector<value_t>{1, 3, 4, 1, 3}));
+}
+
+TEST_F(hash_join_test, SemiJoinEmitsMatchingProbesOnce) {
+  const auto join = create_join(join_mode::semi);
+  containers::associative::join_result<value_t> result;
+  join.probe(probe_keys, result);
+
+  EXPECT_EQ(result.probe_indices, (std::vector<size_t>{0, 2, 3}));
+  EXPECT_TRUE(result.values.empty());
+}
+
+TEST_F(hash_join_test, AntiJoinEmitsProbesWithoutMatch) {
+  const auto join = create_join(join_mode::anti);
+  containers::associative::join_result<value_t> result;
+  join.probe(probe_keys, result);
+
+  EXPECT_EQ(result.probe_indices, (std::vector<size_t>{1, 4}));
+}
+
+TEST_F(hash_join_test, ProbeWithCallbackReceivesMatchingRows) {
+  const auto join = create_join(join_mode::inner);
+  size_t emitted = 0;
+  join.probe(probe_keys, [this, &emitted](const size_t probe_index, const std::span<const value_t> matches) {
+    EXPECT_LT(probe_index, probe_keys.size());
+    EXPECT_FALSE(matches.empty());
+    emitted += matches.size();
+  });
+  EXPECT_EQ(emitted, 5);
+}
+
+TEST_F(hash_join_test, ProbeEmptyBuildSide) {
+  const auto join = hash_join_t(std::hash<key_t>(), join_mode::anti);
+  containers::associative::join_result<value_t> result;
+  join.probe(probe_keys, result);
+  EXPECT_EQ(result.size(), probe_keys.size());
+}
\ No newline at end of file
@@ -1,10 +1,15 @@
 #include <gtest/gtest.h>
+#include <atomic>
 #include <functional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "associative/map/hash_map.hpp"
 
+template<typename Map>
+concept has_stats = requires(const Map& map) { map.stats(); };
+
 class hash_map_test : public testing::Test {
 protected:
   using key_t = std::string;
@@ -110,4 +115,110 @@ TEST_F(hash_map_test, ConceptAssertIterator) {
     std::forward_iterator<containers::associative::hash_map_iterator<containers::sequential::doubly_linked_list<std::tuple<std::string, int, containers::hash_t>>, std::string, int>>,
     "hash_map_iterator must satisfy std::forward_iterator"
   );
-}
\ No newline at end of file
+}
+
+TEST_F(hash_map_test, UpsertInsertsMissingKey) {
+  hash_map.upsert("key4", 4);
+  EXPECT_EQ(hash_map.find_by_key("key4"), 4);
+  EXPECT_EQ(hash_map.size(), 4);
+}
+
+TEST_F(hash_map_test, UpsertReplacesExistingValue) {
+  hash_map.upsert("key1", 100);
+  EXPECT_EQ(hash_map.find_by_key("key1"), 100);
+  EXPECT_EQ(hash_map.size(), 3);
+}
+
+TEST_F(hash_map_test, BuildParallelInsertsAllPairsAndKeepsFirstOccurrence) {
+  auto pairs = std::vector<std::pair<key_t, value_t>>();
+  for (int index = 0; index < 500; ++index) {
+    pairs.emplace_back(std::to_string(index), index);
+  }
+  pairs.emplace_back("key1", 100);
+  pairs.emplace_back("0", 100);
+
+  hash_map.build_parallel(pairs, 4);
+  EXPECT_EQ(hash_map.size(), 503);
+  EXPECT_EQ(hash_map.find_by_key("key1"), 1);
+  for (int index = 0; index < 500; ++index) {
+    EXPECT_EQ(hash_map.find_by_key(std::to_string(index)), index);
+  }
+
+  hash_map.insert("key4", 4);
+  EXPECT_EQ(hash_map.find_by_key("key4"), 4);
+}
+
+TEST_F(hash_map_test, ParallelForEachVisitsEveryPair) {
+  for (int index = 0; index < 500; ++index) {
+    hash_map.insert(std::to_string(index), index);
+  }
+
+  std::atomic<int> visited = 0;
+  std::atomic<long> sum = 0;
+  hash_map.parallel_for_each([&visited, &sum](const key_t&, const value_t& value) {
+    ++visited;
+    sum += value;
+  }, 4);
+  EXPECT_EQ(visited.load(), 503);
+  EXPECT_EQ(sum.load(), 6 + 499 * 500 / 2);
+}
+
+TEST_F(hash_map_test, ParallelReduceCombinesMappedValues) {
+  for (int index = 0; index < 500; ++index) {
+    hash_map.insert(std::to_string(index), index);
+  }
+
+  const auto sum = hash_map.parallel_reduce(100L, [](const key_t&, const value_t& value) {
+    return static_cast<long>(value);
+  }, std::plus<>(), 4);
+  const auto longest_key = hash_map.parallel_reduce(size_t{0}, [](const key_t& key, const value_t&) {
+    return key.size();
+  }, [](const size_t& first, const size_t& second) { return std::max(first, second); }, 3);
+
+  EXPECT_EQ(sum, 100 + 6 + 499 * 500 / 2);
+  EXPECT_EQ(longest_key, 4);
+
+  const auto empty = hash_map_t(std::hash<key_t>());
+  const auto init_only = empty.parallel_reduce(7, [](const key_t&, const value_t& value) { return value; }, std::plus<>());
+  EXPECT_EQ(init_only, 7);
+}
+
+TEST_F(hash_map_test, StatsRevealBadHashFunction) {
+  static_assert(!has_stats<hash_map_t>, "statistics are disabled by default");
+
+  // Only the length of the key counts, so all keys of one length share a chain
+  auto map = containers::associative::hash_map<key_t, value_t, true>([](const key_t& key) {
+    return static_cast<containers::hash_t>(key.size());
+  });
+  for (int index = 0; index < 10; ++index) {
+    map.insert(std::to_string(index), index);
+  }
+  EXPECT_EQ(map.find_by_key("3"), 3);
+  EXPECT_FALSE(map.find_by_key("x").has_value());
+
+  const auto stats = map.stats();
+  EXPECT_EQ(stats.element_count, 10);
+  EXPECT_EQ(stats.bucket_count, 16);
+  EXPECT_DOUBLE_EQ(stats.load_factor, 10.0 / 16);
+  EXPECT_EQ(stats.max_chain_length, 10);
+  ASSERT_EQ(stats.chain_length_histogram.size(), 11);
+  EXPECT_EQ(stats.chain_length_histogram[0], 15);
+  EXPECT_EQ(stats.chain_length_histogram[10], 1);
+  EXPECT_DOUBLE_EQ(stats.empty_bucket_ratio, 15.0 / 16);
+  EXPECT_EQ(stats.rehash_count, 4);
+  EXPECT_GT(stats.bytes_per_element, 0);
+  EXPECT_EQ(stats.hit_count, 1);
+  EXPECT_EQ(stats.hit_probe_count, 4);
+  EXPECT_EQ(stats.miss_count, 1);
+  EXPECT_EQ(stats.miss_probe_count, 10);
+}
+
+TEST_F(hash_map_test, TryInsertReportsDuplicateKey) {
+  EXPECT_TRUE(hash_map.try_insert("key4", 4).has_value());
+  const auto duplicate = hash_map.try_insert("key1", 10);
+
+  ASSERT_FALSE(duplicate.has_value());
+  EXPECT_EQ(duplicate.error(), containers::container_error::duplicate_key);
+  EXPECT_EQ(hash_map.find_by_key("key1"), 1);
+  EXPECT_EQ(hash_map.size(), 4);
+}
@@ -89,4 +89,96 @@ TEST_F(hash_multi_map_test, IteratorEqualityIsCorrect) {
   EXPECT_EQ(first, hash_multi_map.begin()) << "equal iterators of the same container must be equal";
   EXPECT_EQ(second, comparison.begin()) << "equal iterators of the same container must be equal";
   EXPECT_NE(first, second) << "iterators at the same position of two different containers must not be equal";
-}
\ No newline at end of file
+}
+
+TEST_F(hash_multi_map_test, CountReturnsNumberOfValuesPerKey) {
+  EXPECT_EQ(hash_multi_map.count("key1"), 2);
+  EXPECT_EQ(hash_multi_map.count("key2"), 1);
+  EXPECT_EQ(hash_multi_map.count("nonexistent"), 0);
+}
+
+TEST_F(hash_multi_map_test, ValuesReturnsAllValuesInInsertionOrder) {
+  hash_multi_map.insert("key1", 100);
+  const auto& values = hash_multi_map.values("key1");
+  ASSERT_EQ(values.size(), 3);
+  EXPECT_EQ(values[0], 1);
+  EXPECT_EQ(values[1], 10);
+  EXPECT_EQ(values[2], 100);
+  EXPECT_TRUE(hash_multi_map.values("nonexistent").empty());
+}
+
+TEST_F(hash_multi_map_test, EqualRangeSpansAllValuesOfKey) {
+  const auto& [first, last] = hash_multi_map.equal_range("key1");
+  EXPECT_EQ(std::vector<value_t>(first, last), (std::vector<value_t>{1, 10}));
+
+  const auto& [missing_first, missing_last] = hash_multi_map.equal_range("nonexistent");
+  EXPECT_EQ(missing_first, missing_last);
+}
+
+TEST_F(hash_multi_map_test, RemoveLastValueRemovesKey) {
+  hash_multi_map.remove("key2", 2);
+  EXPECT_FALSE(hash_multi_map.exists_by_key("key2"));
+  EXPECT_EQ(hash_multi_map.count("key2"), 0);
+  EXPECT_EQ(hash_multi_map.size(), 3);
+}
+
+TEST_F(hash_multi_map_test, IteratorVisitsEveryKeyValuePair) {
+  for (int index = 0; index < 50; ++index) {
+    hash_multi_map.insert("key" + std::to_string(index % 5), index);
+  }
+
+  size_t visited = 0;
+  for (const auto& [key, value] : hash_multi_map) {
+    EXPECT_TRUE(hash_multi_map.exists(key, value));
+    visited++;
+  }
+  EXPECT_EQ(visited, hash_multi_map.size());
+}
+
+TEST_F(hash_multi_map_test, BuildParallelGroupsValuesInInputOrder) {
+  auto pairs = std::vector<std::pair<key_t, value_t>>{{"key1", 20}};
+  for (int index = 0; index < 300; ++index) {
+    pairs.emplace_back(std::to_string(index % 100), index);
+  }
+
+  hash_multi_map.build_parallel(pairs, 4);
+  EXPECT_EQ(hash_multi_map.size(), 305);
+  EXPECT_EQ(hash_multi_map.count("key1"), 3);
+  EXPECT_EQ(hash_multi_map.values("key1")[2], 20);
+  for (int index = 0; index < 100; ++index) {
+    const auto values = hash_multi_map.values(std::to_string(index));
+    EXPECT_EQ(std::vector<value_t>(values.begin(), values.end()), (std::vector{index, index + 100, index + 200}));
+  }
+}
+
+TEST_F(hash_multi_map_test, ParallelReduceVisitsEveryValue) {
+  for (int index = 0; index < 300; ++index) {
+    hash_multi_map.insert("skewed", index);
+  }
+
+  const auto sum = hash_multi_map.parallel_reduce(0L, [](const key_t&, const value_t& value) {
+    return static_cast<long>(value);
+  }, std::plus<>(), 4);
+  EXPECT_EQ(sum, 16 + 299 * 300 / 2);
+}
+
+TEST_F(hash_multi_map_test, StatsCountKeysPerChain) {
+  auto map = containers::associative::hash_multi_map<key_t, value_t, true>(std::hash<key_t>());
+  for (int index = 0; index < 30; ++index) {
+    map.insert("key", index);
+  }
+  map.insert("other", 1);
+  EXPECT_EQ(map.count("key"), 30);
+  EXPECT_EQ(map.count("missing"), 0);
+
+  // A lookup compares keys, however many values they have
+  const auto stats = map.stats();
+  EXPECT_EQ(stats.element_count, 31);
+  EXPECT_EQ(stats.bucket_count, 4);
+  EXPECT_DOUBLE_EQ(stats.load_factor, 0.5);
+  EXPECT_LE(stats.max_chain_length, 2);
+  EXPECT_EQ(stats.hit_count, 1);
+  EXPECT_EQ(stats.miss_count, 1);
+  EXPECT_LE(stats.hit_probe_count, 2);
+  EXPECT_GT(stats.bytes_per_element, 30 * sizeof(value_t) / 31.0);
+}
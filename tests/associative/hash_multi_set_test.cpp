@@ -86,4 +86,61 @@ TEST_F(hash_multi_set_test, IteratorEqualityIsCorrect) {
   EXPECT_EQ(first, hash_multi_set.begin()) << "equal iterators of the same container must be equal";
   EXPECT_EQ(second, comparison.begin()) << "equal iterators of the same container must be equal";
   EXPECT_NE(first, second) << "iterators at the same position of two different containers must not be equal";
-}
\ No newline at end of file
+}
+
+TEST_F(hash_multi_set_test, FilterKeepsExistingKeys) {
+  hash_multi_set.enable_filter();
+  EXPECT_TRUE(hash_multi_set.filter_enabled());
+  for (int index = 0; index < 100; ++index) {
+    hash_multi_set.insert("filtered" + std::to_string(index % 50));
+  }
+  EXPECT_TRUE(hash_multi_set.exists("key1"));
+  for (int index = 0; index < 50; ++index) {
+    EXPECT_TRUE(hash_multi_set.exists("filtered" + std::to_string(index)));
+  }
+  EXPECT_FALSE(hash_multi_set.exists("nonexistent"));
+}
+
+TEST_F(hash_multi_set_test, CountReturnsNumberOfOccurrences) {
+  EXPECT_EQ(hash_multi_set.count("key1"), 2);
+  EXPECT_EQ(hash_multi_set.count("key2"), 1);
+  EXPECT_EQ(hash_multi_set.count("nonexistent"), 0);
+}
+
+TEST_F(hash_multi_set_test, BuildParallelKeepsDuplicates) {
+  auto keys = std::vector<key_t>{"key1"};
+  for (int index = 0; index < 300; ++index) {
+    keys.push_back(std::to_string(index % 100));
+  }
+
+  hash_multi_set.build_parallel(keys, 3);
+  EXPECT_EQ(hash_multi_set.size(), 305);
+  EXPECT_EQ(hash_multi_set.count("key1"), 3);
+  for (int index = 0; index < 100; ++index) {
+    EXPECT_EQ(hash_multi_set.count(std::to_string(index)), 3);
+  }
+}
+
+TEST_F(hash_multi_set_test, ParallelReduceVisitsEveryOccurrence) {
+  const auto occurrences_of_key1 = hash_multi_set.parallel_reduce(0, [](const key_t& key) {
+    return key == "key1" ? 1 : 0;
+  }, std::plus<>(), 2);
+  EXPECT_EQ(occurrences_of_key1, 2);
+}
+
+TEST_F(hash_multi_set_test, StatsCountWholeChainForCount) {
+  auto set = containers::associative::hash_multi_set<key_t, true>([](const key_t&) {
+    return containers::hash_t{0};
+  });
+  set.insert("a");
+  set.insert("b");
+  set.insert("a");
+  EXPECT_EQ(set.count("a"), 2);
+  EXPECT_TRUE(set.exists("b"));
+
+  const auto stats = set.stats();
+  EXPECT_EQ(stats.max_chain_length, 3);
+  EXPECT_EQ(stats.hit_count, 2);
+  EXPECT_EQ(stats.hit_probe_count, 3 + 2);
+  EXPECT_EQ(stats.miss_count, 0);
+}
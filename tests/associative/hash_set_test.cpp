@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
+#include <atomic>
 #include <functional>
 #include <string>
+#include <vector>
 
 #include "associative/set/hash_set.hpp"
 
@@ -94,4 +96,93 @@ TEST_F(hash_set_test, ConceptAssertIterator) {
     std::forward_iterator<containers::associative::hash_set_iterator<containers::sequential::doubly_linked_list<std::pair<std::string, containers::hash_t>>, std::string>>,
     "hash_set_iterator must satisfy std::forward_iterator"
   );
-}
\ No newline at end of file
+}
+
+TEST_F(hash_set_test, FilterKeepsExistingKeys) {
+  hash_set.enable_filter();
+  EXPECT_TRUE(hash_set.filter_enabled());
+  for (int index = 0; index < 100; ++index) {
+    hash_set.insert("filtered" + std::to_string(index));
+  }
+  EXPECT_TRUE(hash_set.exists("key1"));
+  for (int index = 0; index < 100; ++index) {
+    EXPECT_TRUE(hash_set.exists("filtered" + std::to_string(index)));
+  }
+  EXPECT_FALSE(hash_set.exists("nonexistent"));
+}
+
+TEST_F(hash_set_test, FilterRespectsRemovedKeys) {
+  hash_set.enable_filter();
+  hash_set.remove("key1");
+  EXPECT_FALSE(hash_set.exists("key1"));
+  hash_set.disable_filter();
+  EXPECT_FALSE(hash_set.filter_enabled());
+  EXPECT_TRUE(hash_set.exists("key2"));
+}
+
+TEST_F(hash_set_test, BuildParallelInsertsAllKeysOnce) {
+  auto keys = std::vector<key_t>{"key1", "key4"};
+  for (int index = 0; index < 500; ++index) {
+    keys.push_back(std::to_string(index));
+    keys.push_back(std::to_string(index));
+  }
+
+  hash_set.enable_filter();
+  hash_set.build_parallel(keys, 4);
+  EXPECT_EQ(hash_set.size(), 504);
+  EXPECT_TRUE(hash_set.exists("key1"));
+  EXPECT_TRUE(hash_set.exists("key4"));
+  for (int index = 0; index < 500; ++index) {
+    EXPECT_TRUE(hash_set.exists(std::to_string(index)));
+  }
+}
+
+TEST_F(hash_set_test, ParallelReduceCountsAllKeys) {
+  for (int index = 0; index < 300; ++index) {
+    hash_set.insert(std::to_string(index));
+  }
+
+  std::atomic<int> visited = 0;
+  hash_set.parallel_for_each([&visited](const key_t&) { ++visited; }, 4);
+  const auto total_length = hash_set.parallel_reduce(size_t{0}, [](const key_t& key) {
+    return key.size();
+  }, std::plus<>(), 4);
+
+  EXPECT_EQ(visited.load(), 303);
+  EXPECT_EQ(total_length, 3 * 4 + 10 + 90 * 2 + 200 * 3);
+}
+
+TEST_F(hash_set_test, StatsCountProbesAndRehashes) {
+  auto set = containers::associative::hash_set<key_t, true>(std::hash<key_t>());
+  for (int index = 0; index < 100; ++index) {
+    set.insert(std::to_string(index));
+  }
+  for (int index = 0; index < 200; ++index) {
+    static_cast<void>(set.exists(std::to_string(index)));
+  }
+
+  const auto stats = set.stats();
+  EXPECT_EQ(stats.element_count, 100);
+  EXPECT_EQ(stats.bucket_count, 256);
+  EXPECT_EQ(stats.rehash_count, 8);
+  EXPECT_EQ(stats.hit_count, 100);
+  EXPECT_EQ(stats.miss_count, 100);
+  EXPECT_GE(stats.hit_probe_count, 100);
+  auto buckets = size_t{0};
+  auto elements = size_t{0};
+  for (size_t length = 0; length < stats.chain_length_histogram.size(); ++length) {
+    buckets += stats.chain_length_histogram[length];
+    elements += length * stats.chain_length_histogram[length];
+  }
+  EXPECT_EQ(buckets, 256);
+  EXPECT_EQ(elements, 100);
+}
+
+TEST_F(hash_set_test, TryInsertReportsDuplicateKey) {
+  EXPECT_TRUE(hash_set.try_insert("key4").has_value());
+  const auto duplicate = hash_set.try_insert("key1");
+
+  ASSERT_FALSE(duplicate.has_value());
+  EXPECT_EQ(duplicate.error(), containers::container_error::duplicate_key);
+  EXPECT_EQ(hash_set.size(), 4);
+}
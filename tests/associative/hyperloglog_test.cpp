@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <string>
+
+#include "associative/sketch/hyperloglog.hpp"
+
+class hyperloglog_test : public ::testing::Test {
+protected:
+  using key_t = std::string;
+  using hyperloglog_t = containers::associative::hyperloglog<key_t>;
+
+  hyperloglog_t hyperloglog;
+
+  hyperloglog_test() : hyperloglog(std::hash<key_t>(), 12) {}
+};
+
+TEST_F(hyperloglog_test, EmptyEstimateIsZero) {
+  EXPECT_EQ(hyperloglog.estimate(), 0);
+}
+
+TEST_F(hyperloglog_test, DuplicatesAreCountedOnce) {
+  for (int index = 0; index < 1000; ++index) {
+    hyperloglog.add("key");
+  }
+  EXPECT_NEAR(hyperloglog.estimate(), 1, 0.01);
+  EXPECT_EQ(hyperloglog.size(), 1000);
+}
+
+TEST_F(hyperloglog_test, EstimateIsAccurateForSmallCardinality) {
+  for (int index = 0; index < 1000; ++index) {
+    hyperloglog.add("key" + std::to_string(index));
+  }
+  EXPECT_NEAR(hyperloglog.estimate(), 1000, 50);
+}
+
+TEST_F(hyperloglog_test, EstimateIsAccurateForLargeCardinality) {
+  for (int index = 0; index < 100000; ++index) {
+    hyperloglog.add("key" + std::to_string(index));
+  }
+  // Relative standard error is about 1.6% for a precision of 12
+  EXPECT_NEAR(hyperloglog.estimate(), 100000, 5000);
+}
+
+TEST_F(hyperloglog_test, MergeEstimatesUnion) {
+  auto other = hyperloglog_t(std::hash<key_t>(), 12);
+  for (int index = 0; index < 1000; ++index) {
+    hyperloglog.add("key" + std::to_string(index));
+    other.add("key" + std::to_string(index + 500));
+  }
+  hyperloglog.merge(other);
+  EXPECT_NEAR(hyperloglog.estimate(), 1500, 75);
+}
+
+TEST_F(hyperloglog_test, InvalidPrecisionThrows) {
+  EXPECT_THROW(hyperloglog_t(std::hash<key_t>(), 3), std::invalid_argument);
+  EXPECT_THROW(hyperloglog_t(std::hash<key_t>(), 19), std::invalid_argument);
+}
+
+TEST_F(hyperloglog_test, MemoryUsageIsFixed) {
+  EXPECT_EQ(hyperloglog.memory_usage(), 4096);
+  for (int index = 0; index < 10000; ++index) {
+    hyperloglog.add("key" + std::to_string(index));
+  }
+  EXPECT_EQ(hyperloglog.memory_usage(), 4096);
+}
\ No newline at end of file
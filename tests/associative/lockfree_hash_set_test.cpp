@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "associative/concurrent/lockfree_hash_set.hpp"
+
+class lockfree_hash_set_test : public testing::Test {
+protected:
+  using key_t = std::string;
+  using lockfree_hash_set_t = containers::associative::lockfree_hash_set<key_t>;
+
+  static constexpr int number_threads = 4;
+  static constexpr int keys_per_thread = 500;
+
+  lockfree_hash_set_t lockfree_hash_set;
+
+  lockfree_hash_set_test() : lockfree_hash_set(std::hash<key_t>()) {}
+
+  void SetUp() override {
+    lockfree_hash_set.insert("key1");
+    lockfree_hash_set.insert("key2");
+    lockfree_hash_set.insert("key3");
+  }
+
+  void run_on_threads(const std::function<void(int)>& action) {
+    auto threads = std::vector<std::thread>();
+    for (int thread = 0; thread < number_threads; ++thread) {
+      threads.emplace_back(action, thread);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+};
+
+TEST_F(lockfree_hash_set_test, CorrectContainerSize) {
+  EXPECT_EQ(lockfree_hash_set.size(), 3);
+  EXPECT_EQ(static_cast<const containers::container&>(lockfree_hash_set).size(), 3);
+}
+
+TEST_F(lockfree_hash_set_test, InsertDuplicateThrowsException) {
+  EXPECT_THROW(lockfree_hash_set.insert("key1"), containers::associative::duplicate_key<key_t>);
+  EXPECT_NO_THROW(lockfree_hash_set.insert_safely("key1"));
+  EXPECT_EQ(lockfree_hash_set.size(), 3);
+}
+
+TEST_F(lockfree_hash_set_test, ExistsReturnsCorrectResult) {
+  EXPECT_TRUE(lockfree_hash_set.exists("key1"));
+  EXPECT_FALSE(lockfree_hash_set.exists("nonexistent"));
+}
+
+TEST_F(lockfree_hash_set_test, RemoveDeletesKey) {
+  lockfree_hash_set.remove("key1");
+  lockfree_hash_set.remove("nonexistent");
+  EXPECT_FALSE(lockfree_hash_set.exists("key1"));
+  EXPECT_TRUE(lockfree_hash_set.exists("key2"));
+  EXPECT_EQ(lockfree_hash_set.size(), 2);
+}
+
+TEST_F(lockfree_hash_set_test, BucketsGrowWithSize) {
+  for (int index = 0; index < 1000; ++index) {
+    lockfree_hash_set.insert(std::to_string(index));
+  }
+  EXPECT_GE(lockfree_hash_set.bucket_count(), 256);
+  for (int index = 0; index < 1000; ++index) {
+    EXPECT_TRUE(lockfree_hash_set.exists(std::to_string(index)));
+  }
+}
+
+TEST_F(lockfree_hash_set_test, ConcurrentInsertsOfSameKeysAreDeduplicated) {
+  run_on_threads([this](int) {
+    for (int index = 0; index < keys_per_thread; ++index) {
+      lockfree_hash_set.insert_safely(std::to_string(index));
+    }
+  });
+
+  EXPECT_EQ(lockfree_hash_set.size(), 3 + keys_per_thread);
+  for (int index = 0; index < keys_per_thread; ++index) {
+    EXPECT_TRUE(lockfree_hash_set.exists(std::to_string(index)));
+  }
+}
+
+TEST_F(lockfree_hash_set_test, ConcurrentInsertsAndRemovesKeepSizeConsistent) {
+  run_on_threads([this](const int thread) {
+    for (int index = 0; index < keys_per_thread; ++index) {
+      const auto key = std::to_string(thread) + ":" + std::to_string(index);
+      lockfree_hash_set.insert(key);
+      if (index % 2 == 0) {
+        lockfree_hash_set.remove(key);
+      }
+      lockfree_hash_set.exists(std::to_string(index));
+    }
+  });
+
+  EXPECT_EQ(lockfree_hash_set.size(), 3 + number_threads * keys_per_thread / 2);
+  for (int thread = 0; thread < number_threads; ++thread) {
+    for (int index = 0; index < keys_per_thread; ++index) {
+      const auto key = std::to_string(thread) + ":" + std::to_string(index);
+      EXPECT_EQ(lockfree_hash_set.exists(key), index % 2 != 0);
+    }
+  }
+}
+
+TEST_F(lockfree_hash_set_test, TryInsertReportsDuplicateKey) {
+  EXPECT_TRUE(lockfree_hash_set.try_insert("key4").has_value());
+  const auto duplicate = lockfree_hash_set.try_insert("key1");
+
+  ASSERT_FALSE(duplicate.has_value());
+  EXPECT_EQ(duplicate.error(), containers::container_error::duplicate_key);
+  EXPECT_EQ(lockfree_hash_set.size(), 4);
+}
\ No newline at end of file
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "associative/cache/lru_cache.hpp"
+
+class lru_cache_test : public testing::Test {
+protected:
+  using key_t = int;
+  using value_t = std::string;
+  using lru_cache_t = containers::associative::lru_cache<key_t, value_t>;
+
+  std::vector<std::pair<key_t, value_t>> evicted;
+  lru_cache_t cache;
+
+  lru_cache_test() : cache(std::hash<key_t>(), 3, nullptr, [this](const key_t& key, const value_t& value) {
+    evicted.emplace_back(key, value);
+  }) {}
+
+  void SetUp() override {
+    cache.put(1, "one");
+    cache.put(2, "two");
+    cache.put(3, "three");
+  }
+};
+
+TEST_F(lru_cache_test, GetReturnsCachedValues) {
+  EXPECT_EQ(cache.size(), 3);
+  EXPECT_EQ(cache.get(1), "one");
+  EXPECT_EQ(cache.get(3), "three");
+  EXPECT_FALSE(cache.get(4).has_value());
+  EXPECT_EQ(cache.hits(), 2);
+  EXPECT_EQ(cache.misses(), 1);
+}
+
+TEST_F(lru_cache_test, PutEvictsLeastRecentlyUsed) {
+  static_cast<void>(cache.get(1));
+  cache.put(4, "four");
+
+  EXPECT_EQ(cache.size(), 3);
+  EXPECT_FALSE(cache.exists(2));
+  EXPECT_TRUE(cache.exists(1));
+  EXPECT_EQ(evicted, (std::vector<std::pair<key_t, value_t>>{{2, "two"}}));
+  EXPECT_EQ(cache.evictions(), 1);
+
+  cache.put(5, "five");
+  EXPECT_FALSE(cache.exists(3));
+}
+
+TEST_F(lru_cache_test, PutReplacesValueAndMarksUsed) {
+  cache.put(1, "uno");
+  cache.put(4, "four");
+
+  EXPECT_EQ(cache.get(1), "uno");
+  EXPECT_FALSE(cache.exists(2));
+  EXPECT_EQ(cache.size(), 3);
+}
+
+TEST_F(lru_cache_test, RemoveDoesNotCallEvictionCallback) {
+  EXPECT_TRUE(cache.remove(2));
+  EXPECT_FALSE(cache.remove(2));
+  EXPECT_EQ(cache.size(), 2);
+  cache.put(4, "four");
+  EXPECT_TRUE(evicted.empty());
+
+  cache.clear();
+  EXPECT_TRUE(cache.empty());
+  EXPECT_EQ(cache.weight(), 0);
+  EXPECT_TRUE(evicted.empty());
+}
+
+TEST_F(lru_cache_test, ExistsDoesNotMarkUsed) {
+  EXPECT_TRUE(cache.exists(1));
+  cache.put(4, "four");
+  EXPECT_FALSE(cache.exists(1));
+  EXPECT_EQ(cache.hits(), 0);
+}
+
+TEST_F(lru_cache_test, CapacityInBytes) {
+  auto cache = containers::associative::lru_cache<key_t, value_t>(std::hash<key_t>(), 10, [](const key_t&, const value_t& value) {
+    return value.size();
+  });
+  cache.put(1, "aaaa");
+  cache.put(2, "bbbb");
+  EXPECT_EQ(cache.weight(), 8);
+
+  cache.put(3, "cccc");
+  EXPECT_FALSE(cache.exists(1));
+  EXPECT_EQ(cache.weight(), 8);
+
+  cache.put(2, "bbbbbbbb");
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_EQ(cache.weight(), 8);
+
+  // Heavier than the whole cache, so it replaces nothing and is not stored
+  cache.put(4, std::string(11, 'd'));
+  EXPECT_FALSE(cache.exists(4));
+  EXPECT_TRUE(cache.exists(2));
+}
+
+TEST_F(lru_cache_test, CapacityOfOneKeepsLastEntry) {
+  auto cache = containers::associative::lru_cache<key_t, value_t>(std::hash<key_t>(), 1);
+  for (int i = 0; i < 100; ++i) {
+    cache.put(i, std::to_string(i));
+    EXPECT_EQ(cache.get(i), std::to_string(i));
+  }
+  EXPECT_EQ(cache.size(), 1);
+  EXPECT_EQ(cache.evictions(), 99);
+}
+
+TEST_F(lru_cache_test, LargeCacheEvictsInOrder) {
+  auto large = lru_cache_t(std::hash<key_t>(), 1000);
+  for (key_t key = 0; key < 5000; ++key) {
+    large.put(key, std::to_string(key));
+    // Keeps key 0 recently used, so it is never evicted
+    ASSERT_EQ(large.get(0), "0");
+  }
+
+  EXPECT_EQ(large.size(), 1000);
+  EXPECT_TRUE(large.exists(0));
+  EXPECT_FALSE(large.exists(4000));
+  for (key_t key = 4001; key < 5000; ++key) {
+    ASSERT_EQ(large.get(key), std::to_string(key));
+  }
+  large.clear();
+  EXPECT_TRUE(large.empty());
+  EXPECT_FALSE(large.exists(4999));
+}
\ No newline at end of file
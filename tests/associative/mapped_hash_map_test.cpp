@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <string>
+
+#include "associative/map/hash_map.hpp"
+#include "associative/snapshot/mapped_hash_map.hpp"
+
+class mapped_hash_map_test : public testing::Test {
+protected:
+  using key_t = std::string;
+  using value_t = std::string;
+  using hash_map_t = containers::associative::hash_map<key_t, value_t>;
+  using mapped_hash_map_t = containers::associative::mapped_hash_map<key_t, value_t>;
+
+  hash_map_t hash_map;
+  std::string path;
+
+  mapped_hash_map_test() :
+    hash_map(std::hash<key_t>()),
+    path((std::filesystem::temp_directory_path() / (std::string("mapped_hash_map_test_") + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".snapshot")).string())
+  {}
+
+  void SetUp() override {
+    hash_map.insert("key1", "value1");
+    hash_map.insert("key2", "");
+    hash_map.insert("key3", std::string(100, 'x'));
+    hash_map.save_snapshot(path);
+  }
+
+  void TearDown() override {
+    std::filesystem::remove(path);
+  }
+};
+
+TEST_F(mapped_hash_map_test, OpenedSnapshotHasSameContents) {
+  const auto mapped = mapped_hash_map_t::open(path, std::hash<key_t>());
+  EXPECT_EQ(mapped.size(), 3);
+  EXPECT_EQ(mapped.find_by_key("key1"), "value1");
+  EXPECT_EQ(mapped.find_by_key("key2"), "");
+  EXPECT_EQ(mapped.find_by_key("key3"), std::string(100, 'x'));
+  EXPECT_FALSE(mapped.find_by_key("nonexistent").has_value());
+  EXPECT_FALSE(mapped.exists("key"));
+}
+
+TEST_F(mapped_hash_map_test, FindViewPointsIntoMapping) {
+  const auto mapped = mapped_hash_map_t::open(path, std::hash<key_t>());
+  EXPECT_EQ(mapped.find_view("key1"), std::string_view("value1"));
+  EXPECT_THROW(static_cast<void>(mapped.find_by_key_or_throw("nonexistent")), containers::associative::value_not_found<key_t>);
+}
+
+TEST_F(mapped_hash_map_test, SnapshotOutlivesFile) {
+  const auto mapped = mapped_hash_map_t::open(path, std::hash<key_t>());
+  std::filesystem::remove(path);
+  EXPECT_EQ(mapped.find_by_key("key1"), "value1");
+}
+
+TEST_F(mapped_hash_map_test, TriviallyCopyableTypesRoundTrip) {
+  auto numbers = containers::associative::hash_map<int, double>(std::hash<int>());
+  for (int key = -500; key < 500; ++key) {
+    numbers.insert(key, key * 0.5);
+  }
+  numbers.save_snapshot(path);
+
+  const auto mapped = containers::associative::mapped_hash_map<int, double>::open(path, std::hash<int>());
+  EXPECT_EQ(mapped.size(), 1000);
+  EXPECT_EQ(mapped.bucket_count(), 1024);
+  for (int key = -500; key < 500; ++key) {
+    EXPECT_EQ(mapped.find_by_key(key), key * 0.5);
+  }
+  EXPECT_FALSE(mapped.exists(500));
+}
+
+TEST_F(mapped_hash_map_test, OpenRejectsOtherTypes) {
+  using other_t = containers::associative::mapped_hash_map<std::string, int>;
+  EXPECT_THROW(static_cast<void>(other_t::open(path, std::hash<std::string>())), containers::associative::snapshot_error);
+}
+
+TEST_F(mapped_hash_map_test, OpenRejectsCorruptFiles) {
+  EXPECT_THROW(static_cast<void>(mapped_hash_map_t::open(path + ".missing", std::hash<key_t>())), containers::associative::snapshot_error);
+
+  std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8);
+  EXPECT_THROW(static_cast<void>(mapped_hash_map_t::open(path, std::hash<key_t>())), containers::associative::snapshot_error);
+
+  std::ofstream(path, std::ios::binary | std::ios::trunc) << "not a snapshot, but long enough to hold a header of a snapshot file";
+  EXPECT_THROW(static_cast<void>(mapped_hash_map_t::open(path, std::hash<key_t>())), containers::associative::snapshot_error);
+}
\ No newline at end of file
@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "associative/map/persistent_hash_map.hpp"
+
+class persistent_hash_map_test : public testing::Test {
+protected:
+  using key_t = std::string;
+  using value_t = int;
+  using persistent_hash_map_t = containers::associative::persistent_hash_map<key_t, value_t>;
+
+  static constexpr int number_keys = 2000;
+
+  persistent_hash_map_t persistent_hash_map;
+
+  persistent_hash_map_test() : persistent_hash_map(std::hash<key_t>()) {}
+
+  void SetUp() override {
+    persistent_hash_map.insert("key1", 1);
+    persistent_hash_map.insert("key2", 2);
+    persistent_hash_map.insert("key3", 3);
+  }
+};
+
+TEST_F(persistent_hash_map_test, CorrectContainerSize) {
+  EXPECT_EQ(persistent_hash_map.size(), 3);
+}
+
+TEST_F(persistent_hash_map_test, InsertDuplicateThrowsException) {
+  EXPECT_THROW(persistent_hash_map.insert("key1", 10), containers::associative::duplicate_key<key_t>);
+  EXPECT_NO_THROW(persistent_hash_map.insert_safely("key1", 10));
+  EXPECT_EQ(persistent_hash_map.find_by_key("key1"), 1);
+  EXPECT_EQ(persistent_hash_map.size(), 3);
+}
+
+TEST_F(persistent_hash_map_test, UpsertReplacesValue) {
+  persistent_hash_map.upsert("key1", 10);
+  persistent_hash_map.upsert("key4", 4);
+  EXPECT_EQ(persistent_hash_map.find_by_key("key1"), 10);
+  EXPECT_EQ(persistent_hash_map.find_by_key("key4"), 4);
+  EXPECT_EQ(persistent_hash_map.size(), 4);
+}
+
+TEST_F(persistent_hash_map_test, FindByKeyOrThrowThrowsForNonExistingKey) {
+  EXPECT_EQ(persistent_hash_map.find_by_key_or_throw("key2"), 2);
+  EXPECT_THROW(persistent_hash_map.find_by_key_or_throw("nonexistent"), containers::associative::value_not_found<key_t>);
+}
+
+TEST_F(persistent_hash_map_test, RemoveDeletesKeyValuePair) {
+  persistent_hash_map.remove("key1");
+  persistent_hash_map.remove("nonexistent");
+  EXPECT_FALSE(persistent_hash_map.find_by_key("key1").has_value());
+  EXPECT_EQ(persistent_hash_map.size(), 2);
+}
+
+TEST_F(persistent_hash_map_test, CopyIsIndependentSnapshot) {
+  const auto snapshot = persistent_hash_map;
+  persistent_hash_map.upsert("key1", 10);
+  persistent_hash_map.remove("key2");
+  persistent_hash_map.insert("key4", 4);
+
+  EXPECT_EQ(snapshot.size(), 3);
+  EXPECT_EQ(snapshot.find_by_key("key1"), 1);
+  EXPECT_EQ(snapshot.find_by_key("key2"), 2);
+  EXPECT_FALSE(snapshot.find_by_key("key4").has_value());
+  EXPECT_EQ(persistent_hash_map.size(), 3);
+}
+
+TEST_F(persistent_hash_map_test, WithAndWithoutReturnNewVersions) {
+  const auto added = persistent_hash_map.with("key4", 4);
+  const auto removed = added.without("key1");
+
+  EXPECT_EQ(persistent_hash_map.size(), 3);
+  EXPECT_FALSE(persistent_hash_map.find_by_key("key4").has_value());
+  EXPECT_EQ(added.size(), 4);
+  EXPECT_EQ(added.find_by_key("key1"), 1);
+  EXPECT_EQ(removed.size(), 3);
+  EXPECT_FALSE(removed.find_by_key("key1").has_value());
+  EXPECT_EQ(removed.find_by_key("key4"), 4);
+}
+
+TEST_F(persistent_hash_map_test, ManyKeysSurviveInsertAndRemove) {
+  for (int index = 0; index < number_keys; ++index) {
+    persistent_hash_map.insert(std::to_string(index), index);
+  }
+  const auto full = persistent_hash_map;
+  for (int index = 0; index < number_keys; index += 2) {
+    persistent_hash_map.remove(std::to_string(index));
+  }
+
+  EXPECT_EQ(persistent_hash_map.size(), 3 + number_keys / 2);
+  EXPECT_EQ(full.size(), 3 + number_keys);
+  for (int index = 0; index < number_keys; ++index) {
+    EXPECT_EQ(full.find_by_key(std::to_string(index)), index);
+    EXPECT_EQ(persistent_hash_map.find_by_key(std::to_string(index)).has_value(), index % 2 != 0);
+  }
+}
+
+TEST_F(persistent_hash_map_test, CollidingKeysAreKeptApart) {
+  auto colliding = containers::associative::persistent_hash_map<int, int>([](const int&) { return 42; });
+  for (int key = 0; key < 10; ++key) {
+    colliding.insert(key, key * 10);
+  }
+  const auto snapshot = colliding;
+  for (int key = 0; key < 9; ++key) {
+    colliding.remove(key);
+  }
+
+  EXPECT_EQ(colliding.size(), 1);
+  EXPECT_EQ(colliding.find_by_key(9), 90);
+  EXPECT_FALSE(colliding.find_by_key(0).has_value());
+  EXPECT_EQ(snapshot.find_by_key(5), 50);
+}
+
+TEST_F(persistent_hash_map_test, TransientBatchesUpdatesWithoutTouchingSource) {
+  auto transient = persistent_hash_map.as_transient();
+  for (int index = 0; index < number_keys; ++index) {
+    transient.insert(std::to_string(index), index);
+  }
+  transient.remove("key1");
+  transient.upsert("key2", 20);
+  const auto first = transient.persistent();
+
+  // Updates after persistent() must not leak into the returned version
+  transient.upsert("0", -1);
+  transient.remove("1");
+  const auto second = transient.persistent();
+
+  EXPECT_EQ(persistent_hash_map.size(), 3);
+  EXPECT_EQ(persistent_hash_map.find_by_key("key1"), 1);
+  EXPECT_FALSE(persistent_hash_map.find_by_key("0").has_value());
+
+  EXPECT_EQ(first.size(), 2 + number_keys);
+  EXPECT_EQ(first.find_by_key("key2"), 20);
+  EXPECT_EQ(first.find_by_key("0"), 0);
+  EXPECT_EQ(first.find_by_key("1"), 1);
+
+  EXPECT_EQ(second.size(), 1 + number_keys);
+  EXPECT_EQ(second.find_by_key("0"), -1);
+  EXPECT_FALSE(second.find_by_key("1").has_value());
+}
+
+TEST_F(persistent_hash_map_test, MovedTransientKeepsEarlierVersionUnchanged) {
+  static_assert(!std::is_copy_constructible_v<persistent_hash_map_t::transient>);
+  static_assert(!std::is_copy_assignable_v<persistent_hash_map_t::transient>);
+
+  auto first = persistent_hash_map.as_transient();
+  for (int index = 0; index < number_keys; ++index) {
+    first.insert(std::to_string(index), index);
+  }
+  auto second = std::move(first);
+  const auto version = second.persistent();
+
+  // Updates of the transient after persistent() copy the nodes the version shares
+  for (int index = 0; index < number_keys; ++index) {
+    second.upsert(std::to_string(index), -index);
+  }
+  second.remove("key1");
+  first = std::move(second);
+  first.insert("other", 0);
+
+  EXPECT_EQ(version.size(), 3 + number_keys);
+  EXPECT_EQ(version.find_by_key("key1"), 1);
+  EXPECT_FALSE(version.find_by_key("other").has_value());
+  for (int index = 0; index < number_keys; ++index) {
+    EXPECT_EQ(version.find_by_key(std::to_string(index)), index);
+  }
+  EXPECT_EQ(first.find_by_key("1"), -1);
+  EXPECT_EQ(first.size(), 3 + number_keys);
+}
+
+TEST_F(persistent_hash_map_test, IteratorVisitsEveryPair) {
+  for (int index = 0; index < number_keys; ++index) {
+    persistent_hash_map.insert(std::to_string(index), index);
+  }
+
+  int count = 0;
+  int sum = 0;
+  for (const auto& [key, value] : persistent_hash_map) {
+    ++count;
+    sum += value;
+  }
+  EXPECT_EQ(count, 3 + number_keys);
+  EXPECT_EQ(sum, 6 + number_keys * (number_keys - 1) / 2);
+}
+
+TEST_F(persistent_hash_map_test, TryInsertReportsDuplicateKey) {
+  const auto snapshot = persistent_hash_map;
+  EXPECT_TRUE(persistent_hash_map.try_insert("key4", 4).has_value());
+  EXPECT_EQ(persistent_hash_map.try_insert("key1", 10).error(), containers::container_error::duplicate_key);
+  EXPECT_EQ(persistent_hash_map.find_by_key("key1"), 1);
+  EXPECT_EQ(persistent_hash_map.size(), 4);
+  EXPECT_EQ(snapshot.size(), 3);
+
+  auto transient = persistent_hash_map.as_transient();
+  EXPECT_TRUE(transient.try_insert("key5", 5).has_value());
+  EXPECT_EQ(transient.try_insert("key5", 50).error(), containers::container_error::duplicate_key);
+  EXPECT_THROW(transient.insert("key5", 50), containers::associative::duplicate_key<key_t>);
+  EXPECT_EQ(transient.find_by_key("key5"), 5);
+  EXPECT_EQ(transient.size(), 5);
+}
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "associative/concurrent/read_mostly_hash_map.hpp"
+
+class read_mostly_hash_map_test : public testing::Test {
+protected:
+  using key_t = std::string;
+  using value_t = int;
+  using read_mostly_hash_map_t = containers::associative::read_mostly_hash_map<key_t, value_t>;
+
+  static constexpr int number_readers = 4;
+  static constexpr int number_keys = 200;
+
+  read_mostly_hash_map_t read_mostly_hash_map;
+
+  read_mostly_hash_map_test() : read_mostly_hash_map(std::hash<key_t>()) {}
+
+  void SetUp() override {
+    read_mostly_hash_map.insert("key1", 1);
+    read_mostly_hash_map.insert("key2", 2);
+    read_mostly_hash_map.insert("key3", 3);
+  }
+};
+
+TEST_F(read_mostly_hash_map_test, CorrectContainerSize) {
+  EXPECT_EQ(read_mostly_hash_map.size(), 3);
+  EXPECT_FALSE(read_mostly_hash_map.empty());
+  const containers::container& base = read_mostly_hash_map;
+  EXPECT_EQ(base.size(), 3);
+}
+
+TEST_F(read_mostly_hash_map_test, InsertDuplicateThrowsException) {
+  EXPECT_THROW(read_mostly_hash_map.insert("key1", 10), containers::associative::duplicate_key<key_t>);
+  EXPECT_EQ(read_mostly_hash_map.size(), 3);
+}
+
+TEST_F(read_mostly_hash_map_test, InsertSafelyDoesNotThrow) {
+  EXPECT_NO_THROW(read_mostly_hash_map.insert_safely("key1", 10));
+  EXPECT_EQ(read_mostly_hash_map.find_by_key("key1"), 1);
+}
+
+TEST_F(read_mostly_hash_map_test, UpsertReplacesValue) {
+  read_mostly_hash_map.upsert("key1", 10);
+  read_mostly_hash_map.upsert("key4", 4);
+  EXPECT_EQ(read_mostly_hash_map.find_by_key("key1"), 10);
+  EXPECT_EQ(read_mostly_hash_map.find_by_key("key4"), 4);
+  EXPECT_EQ(read_mostly_hash_map.size(), 4);
+}
+
+TEST_F(read_mostly_hash_map_test, FindByKeyOrThrowThrowsForNonExistingKey) {
+  EXPECT_EQ(read_mostly_hash_map.find_by_key_or_throw("key2"), 2);
+  EXPECT_THROW(read_mostly_hash_map.find_by_key_or_throw("nonexistent"), containers::associative::value_not_found<key_t>);
+}
+
+TEST_F(read_mostly_hash_map_test, RemoveDeletesKeyValuePair) {
+  read_mostly_hash_map.remove("key1");
+  read_mostly_hash_map.remove("nonexistent");
+  EXPECT_FALSE(read_mostly_hash_map.find_by_key("key1").has_value());
+  EXPECT_EQ(read_mostly_hash_map.find_by_key("key2"), 2);
+  EXPECT_EQ(read_mostly_hash_map.size(), 2);
+}
+
+TEST_F(read_mostly_hash_map_test, BucketsGrowAndShrinkWithSize) {
+  for (int index = 0; index < number_keys; ++index) {
+    read_mostly_hash_map.insert(std::to_string(index), index);
+  }
+  EXPECT_GE(read_mostly_hash_map.bucket_count(), 256);
+
+  for (int index = 0; index < number_keys; ++index) {
+    EXPECT_EQ(read_mostly_hash_map.find_by_key(std::to_string(index)), index);
+    read_mostly_hash_map.remove(std::to_string(index));
+  }
+  EXPECT_LE(read_mostly_hash_map.bucket_count(), 16);
+  EXPECT_EQ(read_mostly_hash_map.find_by_key("key3"), 3);
+}
+
+TEST_F(read_mostly_hash_map_test, ReadersSeeConsistentValuesWhileWriterUpdates) {
+  for (int index = 0; index < number_keys; ++index) {
+    read_mostly_hash_map.insert(std::to_string(index), 0);
+  }
+
+  std::atomic<bool> done = false;
+  std::atomic<int> inconsistent = 0;
+  auto readers = std::vector<std::thread>();
+  for (int reader = 0; reader < number_readers; ++reader) {
+    readers.emplace_back([this, &done, &inconsistent] {
+      while (!done.load()) {
+        for (int index = 0; index < number_keys; ++index) {
+          // Values only ever grow and the even keys are never removed
+          const auto value = read_mostly_hash_map.find_by_key(std::to_string(index));
+          if (index % 2 == 0 && (!value.has_value() || *value < 0)) {
+            ++inconsistent;
+          }
+        }
+      }
+    });
+  }
+
+  for (int round = 1; round <= 20; ++round) {
+    for (int index = 0; index < number_keys; ++index) {
+      if (index % 2 == 0) {
+        read_mostly_hash_map.upsert(std::to_string(index), round);
+      } else if (round % 2 == 0) {
+        read_mostly_hash_map.insert(std::to_string(index), round);
+      } else {
+        read_mostly_hash_map.remove(std::to_string(index));
+      }
+    }
+  }
+  done.store(true);
+  for (auto& reader : readers) {
+    reader.join();
+  }
+
+  EXPECT_EQ(inconsistent.load(), 0);
+  EXPECT_EQ(read_mostly_hash_map.size(), 3 + number_keys);
+  EXPECT_EQ(read_mostly_hash_map.find_by_key("0"), 20);
+}
+
+TEST_F(read_mostly_hash_map_test, TryInsertReportsDuplicateKey) {
+  EXPECT_TRUE(read_mostly_hash_map.try_insert("key4", 4).has_value());
+  const auto duplicate = read_mostly_hash_map.try_insert("key1", 10);
+
+  ASSERT_FALSE(duplicate.has_value());
+  EXPECT_EQ(duplicate.error(), containers::container_error::duplicate_key);
+  EXPECT_EQ(read_mostly_hash_map.find_by_key("key1"), 1);
+  EXPECT_EQ(read_mostly_hash_map.size(), 4);
+}
\ No newline at end of file
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "associative/cache/sharded_lru_cache.hpp"
+
+class sharded_lru_cache_test : public testing::Test {
+protected:
+  using key_t = int;
+  using value_t = int;
+  using sharded_lru_cache_t = containers::associative::sharded_lru_cache<key_t, value_t>;
+
+  sharded_lru_cache_t cache;
+
+  sharded_lru_cache_test() : cache(std::hash<key_t>(), 1024, 4) {}
+};
+
+TEST_F(sharded_lru_cache_test, ShardCountIsPowerOfTwo) {
+  EXPECT_EQ(cache.shard_count(), 4);
+  EXPECT_EQ(sharded_lru_cache_t(std::hash<key_t>(), 10, 3).shard_count(), 4);
+  EXPECT_EQ(sharded_lru_cache_t(std::hash<key_t>(), 10, 0).shard_count(), 1);
+  EXPECT_EQ(sharded_lru_cache_t(std::hash<key_t>(), 10, 64).shard_count(), 8);
+  EXPECT_EQ(sharded_lru_cache_t(std::hash<key_t>(), 0, 64).shard_count(), 1);
+}
+
+TEST_F(sharded_lru_cache_test, ShardsSumUpToCapacity) {
+  auto small = sharded_lru_cache_t(std::hash<key_t>(), 10, 64);
+  for (int i = 0; i < 1000; ++i) {
+    small.put(i, i);
+  }
+  EXPECT_EQ(small.size(), 10);
+  EXPECT_EQ(small.size() + small.evictions(), 1000);
+}
+
+TEST_F(sharded_lru_cache_test, GetReturnsCachedValues) {
+  for (int i = 0; i < 100; ++i) {
+    cache.put(i, i * i);
+  }
+  EXPECT_EQ(cache.size(), 100);
+  EXPECT_EQ(cache.get(9), 81);
+  EXPECT_FALSE(cache.get(100).has_value());
+  EXPECT_TRUE(cache.remove(9));
+  EXPECT_FALSE(cache.exists(9));
+  EXPECT_EQ(cache.hits(), 1);
+  EXPECT_EQ(cache.misses(), 1);
+}
+
+TEST_F(sharded_lru_cache_test, SizeStaysWithinCapacity) {
+  for (int i = 0; i < 10000; ++i) {
+    cache.put(i, i);
+  }
+  EXPECT_LE(cache.size(), 1024);
+  EXPECT_EQ(cache.size() + cache.evictions(), 10000);
+}
+
+TEST_F(sharded_lru_cache_test, ConcurrentAccess) {
+  auto threads = std::vector<std::thread>();
+  for (int thread = 0; thread < 4; ++thread) {
+    threads.emplace_back([this, thread] {
+      for (int i = 0; i < 5000; ++i) {
+        const auto key = (i * 7 + thread) % 2000;
+        if (const auto value = cache.get(key)) {
+          EXPECT_EQ(*value, key * 2);
+        } else {
+          cache.put(key, key * 2);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(cache.hits() + cache.misses(), 20000);
+  EXPECT_LE(cache.size(), 1024);
+  EXPECT_EQ(cache.weight(), cache.size());
+}
\ No newline at end of file
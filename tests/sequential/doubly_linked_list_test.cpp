@@ -76,3 +76,40 @@ TEST_F(doubly_linked_list_test, EraseTail) {
   list.erase(list.back());
   EXPECT_EQ(list.back()->data, -4);
 }
+
+
+TEST_F(doubly_linked_list_test, DestroyLongListOfLists) {
+  auto lists = std::make_unique<
+      containers::sequential::doubly_linked_list<doubly_linked_list_t>>();
+  for (int i = 0; i < 1000000; ++i) {
+    lists->push_front(doubly_linked_list_t());
+  }
+  EXPECT_NO_THROW(lists.reset());
+}
+
+TEST_F(doubly_linked_list_test, CopySurvivesDestructionOfOriginal) {
+  auto copy = std::make_unique<doubly_linked_list_t>(list);
+  list = doubly_linked_list_t();
+  EXPECT_EQ(copy->front()->data, 200);
+  EXPECT_EQ(copy->back()->data, 10);
+}
+
+TEST_F(doubly_linked_list_test, MoveToFrontRelinksNode) {
+  list.move_to_front(list.back());
+  EXPECT_EQ(list.front()->data, 10);
+  EXPECT_EQ(list.back()->data, -4);
+
+  list.move_to_front(list.front()->next);
+  EXPECT_EQ(list.front()->data, 200);
+  EXPECT_EQ(list.front()->next->data, 10);
+  EXPECT_EQ(list.back()->prev.lock()->data, 10);
+  EXPECT_EQ(list.size(), 3);
+}
+
+TEST_F(doubly_linked_list_test, EraseLastNodeEmptiesList) {
+  while (!list.empty()) {
+    list.erase(list.front());
+  }
+  EXPECT_EQ(list.front(), nullptr);
+  EXPECT_EQ(list.back(), nullptr);
+}
@@ -43,3 +43,15 @@ TEST_F(priority_queue_test, QueueIsEmptyCorrectBehaviour){
     ASSERT_THROW(queue.pop(), std::out_of_range);
     ASSERT_THROW(queue.top(), std::out_of_range);
 }
+
+TEST_F(priority_queue_test, TryPopAndTryTopReportEmptyQueue){
+    EXPECT_EQ(queue.try_top()->get(), 2042006);
+    EXPECT_TRUE(queue.try_pop().has_value());
+    EXPECT_TRUE(queue.try_pop().has_value());
+    EXPECT_EQ(queue.try_top()->get(), 42);
+    EXPECT_TRUE(queue.try_pop().has_value());
+
+    EXPECT_EQ(queue.try_pop().error(), containers::container_error::empty_container);
+    EXPECT_EQ(queue.try_top().error(), containers::container_error::empty_container);
+    EXPECT_TRUE(queue.empty());
+}
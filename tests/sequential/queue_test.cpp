@@ -40,3 +40,13 @@ TEST_F(list_queue_test, QueueIsEmptyCorrectBehaviour){
     EXPECT_TRUE(list_queue.empty());
     ASSERT_THROW(list_queue.dequeue(), containers::sequential::empty_container);
 }
+TEST_F(list_queue_test, TryDequeueReportsEmptyQueue){
+    EXPECT_EQ(list_queue.try_dequeue(), 42);
+    EXPECT_EQ(list_queue.try_dequeue(), 69);
+    EXPECT_EQ(list_queue.try_dequeue(), 2042006);
+
+    const auto empty = list_queue.try_dequeue();
+    ASSERT_FALSE(empty.has_value());
+    EXPECT_EQ(empty.error(), containers::container_error::empty_container);
+    EXPECT_TRUE(list_queue.empty());
+}
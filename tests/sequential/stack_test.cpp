@@ -40,3 +40,13 @@ TEST_F(list_stack_test, ListIsEmptyCorrectBehaviour){
     EXPECT_TRUE(list_stack.empty());
     ASSERT_THROW(list_stack.pop(), containers::sequential::empty_container);
 }
+TEST_F(list_stack_test, TryPopAndTryTopReportEmptyStack){
+    EXPECT_EQ(list_stack.try_top()->get(), 2042006);
+    EXPECT_EQ(list_stack.try_pop(), 2042006);
+    EXPECT_EQ(list_stack.try_pop(), 69);
+    EXPECT_EQ(list_stack.try_pop(), 42);
+
+    EXPECT_EQ(list_stack.try_pop().error(), containers::container_error::empty_container);
+    EXPECT_EQ(list_stack.try_top().error(), containers::container_error::empty_container);
+    EXPECT_TRUE(list_stack.empty());
+}